@@ -0,0 +1,269 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <utime.h>
+#include <sys/stat.h>
+#include "config.h"
+#include "hash.h"
+#include "cache.h"
+#include "log.h"
+
+static char cache_dir[512];
+static uint64_t cache_max_bytes;
+static int cache_on;
+static CacheStats stats;
+
+int cache_open(const char *dir, uint64_t max_bytes) {
+    snprintf(cache_dir, sizeof(cache_dir), "%s", dir);
+    // 상위 디렉토리부터 차례로 생성
+    char path[512];
+    snprintf(path, sizeof(path), "%s", dir);
+    for (char *p = path + 1; *p; p++) {
+        if (*p == '/') {
+            *p = '\0';
+            mkdir(path, 0755);
+            *p = '/';
+        }
+    }
+    if (mkdir(path, 0755) != 0 && errno != EEXIST) {
+        log_error("캐시 디렉토리 생성 실패: %s\n", dir);
+        return -1;
+    }
+    cache_max_bytes = max_bytes;
+    cache_on = 1;
+    memset(&stats, 0, sizeof(stats));
+    return 0;
+}
+
+int cache_enabled(void) {
+    return cache_on;
+}
+
+uint64_t cache_stage_key(uint64_t input_hash, const char *stage,
+                         const CacheRegRange *ranges, int range_count, uint64_t extra) {
+    uint64_t key = hash64(stage, strlen(stage), input_hash);
+    key = hash64(&extra, sizeof(extra), key);
+    for (int r = 0; r < range_count; r++) {
+        for (int addr = ranges[r].first; addr <= ranges[r].last; addr++) {
+            int value;
+            if (reg_read_by_addr(ranges[r].page, addr, &value) == 0) {
+                int entry[3] = { ranges[r].page, addr, value };
+                key = hash64(entry, sizeof(entry), key);
+            }
+        }
+    }
+    return key;
+}
+
+static void entry_path(char *path, size_t size, uint64_t key, const char *stage) {
+    snprintf(path, size, "%s/%016llx.%s", cache_dir, (unsigned long long)key, stage);
+}
+
+// ============================================================
+// LRU 삭제
+// ============================================================
+// 항목을 사용할 때마다 mtime을 갱신하므로 mtime이 가장 오래된 항목이 가장 오래 사용하지 않은 항목
+// 같은 초 안에 여러 항목을 쓰므로 나노초까지 비교
+
+typedef struct {
+    char name[64];
+    uint64_t size;
+    long long mtime;    // 나노초
+} CacheEntry;
+
+static int compare_mtime(const void *a, const void *b) {
+    const CacheEntry *ea = (const CacheEntry *)a;
+    const CacheEntry *eb = (const CacheEntry *)b;
+    return (ea->mtime > eb->mtime) - (ea->mtime < eb->mtime);
+}
+
+// keep: 방금 저장한 항목 이름 (크기에는 포함하되 삭제하지 않음)
+static void evict_to_limit(const char *keep) {
+    DIR *dir = opendir(cache_dir);
+    if (!dir) {
+        return;
+    }
+    CacheEntry *entries = NULL;
+    int count = 0, capacity = 0;
+    uint64_t total = 0;
+    struct dirent *ent;
+    while ((ent = readdir(dir)) != NULL) {
+        if (ent->d_name[0] == '.' || strlen(ent->d_name) >= sizeof(entries[0].name)) {
+            continue; // ".", "..", 임시 파일(.tmp-*)
+        }
+        char path[1024];
+        struct stat st;
+        snprintf(path, sizeof(path), "%s/%s", cache_dir, ent->d_name);
+        if (stat(path, &st) != 0 || !S_ISREG(st.st_mode)) {
+            continue;
+        }
+        if (count == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            CacheEntry *grown = (CacheEntry *)realloc(entries, (size_t)capacity * sizeof(CacheEntry));
+            if (!grown) {
+                break;
+            }
+            entries = grown;
+        }
+        strcpy(entries[count].name, ent->d_name);
+        entries[count].size = (uint64_t)st.st_size;
+        entries[count].mtime = (long long)st.st_mtime * 1000000000LL + st.st_mtim.tv_nsec;
+        total += (uint64_t)st.st_size;
+        count++;
+    }
+    closedir(dir);
+
+    if (total > cache_max_bytes) {
+        qsort(entries, (size_t)count, sizeof(CacheEntry), compare_mtime);
+        for (int i = 0; i < count && total > cache_max_bytes; i++) {
+            if (strcmp(entries[i].name, keep) == 0) {
+                continue;
+            }
+            char path[1024];
+            snprintf(path, sizeof(path), "%s/%s", cache_dir, entries[i].name);
+            if (unlink(path) == 0) {
+                total -= entries[i].size;
+                stats.evictions++;
+            }
+        }
+    }
+    free(entries);
+}
+
+// 사용 시각 갱신 (LRU)
+static void touch_entry(const char *path) {
+    utime(path, NULL);
+}
+
+// ============================================================
+// 파일 / 메모리 항목
+// ============================================================
+
+static int copy_file(const char *src, const char *dest) {
+    FILE *in = fopen(src, "rb");
+    if (!in) {
+        return -1;
+    }
+    FILE *out = fopen(dest, "wb");
+    if (!out) {
+        fclose(in);
+        return -1;
+    }
+    char buffer[1 << 16];
+    size_t n;
+    int result = 0;
+    while ((n = fread(buffer, 1, sizeof(buffer), in)) > 0) {
+        if (fwrite(buffer, 1, n, out) != n) {
+            result = -1;
+            break;
+        }
+    }
+    fclose(in);
+    if (fclose(out) != 0) {
+        result = -1;
+    }
+    return result;
+}
+
+int cache_fetch_file(uint64_t key, const char *stage, const char *dest) {
+    char path[1024];
+    entry_path(path, sizeof(path), key, stage);
+    if (access(path, R_OK) != 0) {
+        stats.misses++;
+        return 1;
+    }
+    // 하드 링크는 이후 dest를 덮어쓸 때 캐시 항목까지 바뀌므로 복사로 꺼냄
+    if (copy_file(path, dest) != 0) {
+        log_error("캐시 항목 복사 실패: %s -> %s\n", path, dest);
+        stats.misses++;
+        return -1;
+    }
+    touch_entry(path);
+    stats.hits++;
+    return 0;
+}
+
+// 임시 파일에 쓴 뒤 rename하여 다른 프로세스가 쓰는 중인 항목을 읽지 않도록 함
+static int publish_entry(const char *tmp, uint64_t key, const char *stage) {
+    char path[1024];
+    entry_path(path, sizeof(path), key, stage);
+    if (rename(tmp, path) != 0) {
+        unlink(tmp);
+        return -1;
+    }
+    stats.stores++;
+    char name[64];
+    snprintf(name, sizeof(name), "%016llx.%s", (unsigned long long)key, stage);
+    evict_to_limit(name);
+    return 0;
+}
+
+int cache_store_file(uint64_t key, const char *stage, const char *src) {
+    char tmp[1024];
+    snprintf(tmp, sizeof(tmp), "%s/.tmp-%ld-%016llx", cache_dir, (long)getpid(), (unsigned long long)key);
+    if (copy_file(src, tmp) != 0) {
+        unlink(tmp);
+        return -1;
+    }
+    return publish_entry(tmp, key, stage);
+}
+
+int cache_load_blob(uint64_t key, const char *stage, void **data, size_t *size) {
+    char path[1024];
+    entry_path(path, sizeof(path), key, stage);
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        stats.misses++;
+        return 1;
+    }
+    struct stat st;
+    if (fstat(fileno(file), &st) != 0) {
+        fclose(file);
+        stats.misses++;
+        return -1;
+    }
+    *size = (size_t)st.st_size;
+    *data = malloc(*size ? *size : 1);
+    if (!*data || fread(*data, 1, *size, file) != *size) {
+        free(*data);
+        *data = NULL;
+        fclose(file);
+        stats.misses++;
+        return -1;
+    }
+    fclose(file);
+    touch_entry(path);
+    stats.hits++;
+    return 0;
+}
+
+int cache_store_blob(uint64_t key, const char *stage, const void *data, size_t size) {
+    char tmp[1024];
+    snprintf(tmp, sizeof(tmp), "%s/.tmp-%ld-%016llx", cache_dir, (long)getpid(), (unsigned long long)key);
+    FILE *file = fopen(tmp, "wb");
+    if (!file) {
+        return -1;
+    }
+    size_t written = fwrite(data, 1, size, file);
+    if (fclose(file) != 0 || written != size) {
+        unlink(tmp);
+        return -1;
+    }
+    return publish_entry(tmp, key, stage);
+}
+
+CacheStats cache_stats(void) {
+    return stats;
+}
+
+void cache_print_stats(void) {
+    unsigned lookups = stats.hits + stats.misses;
+    log_info("캐시 (%s): hit %u, miss %u", cache_dir, stats.hits, stats.misses);
+    if (lookups > 0) {
+        log_info(" (hit %.1f%%)", 100.0 * stats.hits / lookups);
+    }
+    log_info(", 저장 %u, 삭제 %u\n", stats.stores, stats.evictions);
+}
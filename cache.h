@@ -0,0 +1,62 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// 단계 결과 디스크 캐시 (content-addressed)
+// 키 = 입력 픽셀 해시 + 단계 이름 + 그 단계가 읽는 레지스터 값 해시
+// 항목은 <캐시 디렉토리>/<키 16진수>.<단계> 파일로 저장되며,
+// 크기 제한을 넘으면 가장 오래 사용하지 않은 항목(mtime 기준)부터 삭제
+
+#define CACHE_DEFAULT_DIR "test_out/cache"
+#define CACHE_DEFAULT_MAX_MB 512
+
+// 단계가 읽는 레지스터 범위 (registers_list.csv의 page/addr)
+typedef struct {
+    int page;
+    int first;
+    int last;
+} CacheRegRange;
+
+typedef struct {
+    unsigned hits;
+    unsigned misses;
+    unsigned stores;
+    unsigned evictions;
+} CacheStats;
+
+// 캐시 사용 시작 (디렉토리가 없으면 생성)
+// 반환값: 0 성공, -1 실패
+int cache_open(const char *dir, uint64_t max_bytes);
+
+// 캐시를 사용 중인지 확인
+int cache_enabled(void);
+
+// 단계 키 계산: 입력 해시 + 단계 이름 + 레지스터 값 + 추가 파라미터(비트 수 등)
+uint64_t cache_stage_key(uint64_t input_hash, const char *stage,
+                         const CacheRegRange *ranges, int range_count, uint64_t extra);
+
+// 캐시 항목을 dest 파일로 복사
+// 반환값: 0 hit, 1 miss, -1 실패
+int cache_fetch_file(uint64_t key, const char *stage, const char *dest);
+
+// src 파일을 캐시 항목으로 저장
+// 반환값: 0 성공, -1 실패
+int cache_store_file(uint64_t key, const char *stage, const char *src);
+
+// 캐시 항목을 메모리로 읽기 (*data는 호출자가 free)
+// 반환값: 0 hit, 1 miss, -1 실패
+int cache_load_blob(uint64_t key, const char *stage, void **data, size_t *size);
+
+// 메모리 데이터를 캐시 항목으로 저장
+// 반환값: 0 성공, -1 실패
+int cache_store_blob(uint64_t key, const char *stage, const void *data, size_t size);
+
+// 누적 통계
+CacheStats cache_stats(void);
+
+// 통계 출력
+void cache_print_stats(void);
+
+#endif // CACHE_H
@@ -0,0 +1,659 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "config.h"
+#include "image_io.h"
+#include "sink.h"
+#include "compare.h"
+#include "hexdump.h"
+#include "ctcz.h"
+#include "log.h"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static int alloc_compare_image(CompareImage *image, int width, int height, int bits, const char *format) {
+    memset(image, 0, sizeof(*image));
+    if (width <= 0 || height <= 0) {
+        log_error("잘못된 이미지 크기: %d x %d\n", width, height);
+        return -1;
+    }
+    image->samples = (uint16_t *)malloc((size_t)width * height * 2 * sizeof(uint16_t));
+    if (!image->samples) {
+        log_error("비교 이미지 메모리 할당 실패 (%d x %d)\n", width, height);
+        return -1;
+    }
+    image->width = width;
+    image->height = height;
+    image->bits = bits;
+    image->format = format;
+    return 0;
+}
+
+void compare_free(CompareImage *image) {
+    free(image->samples);
+    image->samples = NULL;
+}
+
+// ============================================================
+// 형식별 읽기
+// ============================================================
+
+int compare_from_rgbg(const uint16_t *rgbg, int width, int height, int bits,
+                      int order, int odd_col, CompareImage *image) {
+    if (alloc_compare_image(image, width, height, bits, "RAW") != 0) {
+        return -1;
+    }
+    // Even row의 패널 홀수 열 [G, B]만 순서가 반대, 나머지는 [R/B, G]
+    image->phase = (order + odd_col) & 1;
+    size_t n = (size_t)width * 2;
+    for (int y = 0; y < height; y++) {
+        const uint16_t *src = rgbg + (size_t)y * n;
+        uint16_t *dst = image->samples + (size_t)y * n;
+        int even_row = ((y + order) & 1) == 0;
+        memcpy(dst, src, n * sizeof(uint16_t));
+        if (even_row) {
+            for (int x = (odd_col ? 0 : 1); x < width; x += 2) {
+                dst[x * 2 + 0] = src[x * 2 + 1];
+                dst[x * 2 + 1] = src[x * 2 + 0];
+            }
+        }
+    }
+    return 0;
+}
+
+// PPM 헤더 토큰 읽기 (공백/주석 건너뜀)
+static int read_ppm_token(FILE *file, int *value) {
+    int c = fgetc(file);
+    while (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '#') {
+        if (c == '#') {
+            while (c != '\n' && c != EOF) {
+                c = fgetc(file);
+            }
+        }
+        c = fgetc(file);
+    }
+    if (c < '0' || c > '9') {
+        return -1;
+    }
+    *value = 0;
+    while (c >= '0' && c <= '9') {
+        *value = *value * 10 + (c - '0');
+        c = fgetc(file);
+    }
+    return 0; // 토큰 뒤 공백 1개는 소비됨
+}
+
+// PPM(P6) 읽기: R 픽셀은 [R, G, 0], B 픽셀은 [0, G, B]로 저장되어 있음
+// 위상은 항상 0이어야 하는 채널이 실제로 0인 쪽으로 결정
+static int load_ppm(FILE *file, const char *filename, CompareImage *image) {
+    int width, height, maxval;
+    if (read_ppm_token(file, &width) != 0 || read_ppm_token(file, &height) != 0 ||
+        read_ppm_token(file, &maxval) != 0 || maxval <= 0 || maxval > 65535) {
+        log_error("PPM 헤더 오류: %s\n", filename);
+        return -1;
+    }
+    int bits = 1;
+    while ((1 << bits) - 1 < maxval) {
+        bits++;
+    }
+    int bytes = maxval > 255 ? 2 : 1;
+    size_t row_bytes = (size_t)width * 3 * bytes;
+    uint8_t *row = (uint8_t *)malloc(row_bytes);
+    uint16_t *rgb3 = (uint16_t *)malloc((size_t)width * height * 3 * sizeof(uint16_t));
+    if (!row || !rgb3) {
+        log_error("PPM 버퍼 할당 실패\n");
+        free(row);
+        free(rgb3);
+        return -1;
+    }
+
+    // 위상별로 0이어야 하는 채널이 0이 아닌 픽셀 수
+    uint64_t violations[2] = { 0, 0 };
+    for (int y = 0; y < height; y++) {
+        if (fread(row, 1, row_bytes, file) != row_bytes) {
+            log_error("PPM 데이터 읽기 실패: %s\n", filename);
+            free(row);
+            free(rgb3);
+            return -1;
+        }
+        uint16_t *dst = rgb3 + (size_t)y * width * 3;
+        for (size_t i = 0; i < (size_t)width * 3; i++) {
+            dst[i] = bytes == 2 ? (uint16_t)((row[i * 2] << 8) | row[i * 2 + 1]) : row[i];
+        }
+        for (int x = 0; x < width; x++) {
+            int r_pixel_phase0 = ((x + y) & 1) == 0;
+            if (dst[x * 3 + 2]) violations[r_pixel_phase0 ? 0 : 1]++;   // R 픽셀인데 B가 있음
+            if (dst[x * 3 + 0]) violations[r_pixel_phase0 ? 1 : 0]++;   // B 픽셀인데 R이 있음
+        }
+    }
+    free(row);
+
+    if (alloc_compare_image(image, width, height, bits, "PPM") != 0) {
+        free(rgb3);
+        return -1;
+    }
+    image->phase = violations[1] < violations[0] ? 1 : 0;
+    if (violations[image->phase] > 0) {
+        log_error("경고: RGBG 형식이 아닌 PPM입니다 (R/B 동시 사용 픽셀 %llu개): %s\n",
+                  (unsigned long long)violations[image->phase], filename);
+    }
+    for (int y = 0; y < height; y++) {
+        const uint16_t *src = rgb3 + (size_t)y * width * 3;
+        uint16_t *dst = image->samples + (size_t)y * width * 2;
+        for (int x = 0; x < width; x++) {
+            int r_pixel = ((x + y + image->phase) & 1) == 0;
+            dst[x * 2 + 0] = r_pixel ? src[x * 3 + 0] : src[x * 3 + 2];
+            dst[x * 2 + 1] = src[x * 3 + 1];
+        }
+    }
+    free(rgb3);
+    return 0;
+}
+
+// 네이티브 RGBG 덤프 (--seq 출력, 헤더 없음, 서브픽셀 순서는 por_rgbg_order)
+static int load_dump(FILE *file, const char *filename, const CompareDumpInfo *dump, CompareImage *image) {
+    if (!dump || dump->width <= 0 || dump->height <= 0) {
+        log_error("RGBG 덤프는 --size WxH가 필요합니다: %s\n", filename);
+        return -1;
+    }
+    size_t n = (size_t)dump->width * dump->height * 2;
+    size_t sample_bytes = dump->depth == 8 ? 1 : sizeof(uint16_t);
+    uint16_t *samples = (uint16_t *)malloc(n * sizeof(uint16_t));
+    if (!samples) {
+        log_error("덤프 버퍼 할당 실패\n");
+        return -1;
+    }
+    int result = 0;
+    if (fseek(file, (long)(n * sample_bytes) * dump->frame, SEEK_SET) != 0) {
+        result = -1;
+    } else if (sample_bytes == 1) {
+        // 8bit 샘플은 뒤쪽부터 넓혀서 같은 버퍼 사용
+        uint8_t *bytes = (uint8_t *)samples;
+        if (fread(bytes, 1, n, file) != n) {
+            result = -1;
+        }
+        for (size_t i = n; i-- > 0 && result == 0;) {
+            samples[i] = bytes[i];
+        }
+    } else if (fread(samples, sizeof(uint16_t), n, file) != n) {
+        result = -1;
+    }
+    if (result == 0) {
+        result = compare_from_rgbg(samples, dump->width, dump->height, dump->depth,
+                                   ip_ports.por_rgbg_order & 1, 0, image);
+        image->format = "DUMP";
+    } else {
+        log_error("덤프 프레임 %d 읽기 실패: %s\n", dump->frame, filename);
+    }
+    free(samples);
+    return result;
+}
+
+int compare_from_rgbg_array(const RGBGArray *rgbg, CompareImage *image) {
+    size_t n = (size_t)rgbg->width * rgbg->height * 2;
+    uint16_t *samples = rgbg->data16;
+    if (rgbg->depth == 8) {
+        samples = (uint16_t *)malloc(n * sizeof(uint16_t));
+        for (size_t i = 0; samples && i < n; i++) {
+            samples[i] = rgbg->data[i];
+        }
+    }
+    int result = samples ? compare_from_rgbg(samples, rgbg->width, rgbg->height, rgbg->depth,
+                                             rgbg->order, rgbg->x0 & 1, image) : -1;
+    if (samples != rgbg->data16) {
+        free(samples);
+    }
+    return result;
+}
+
+// hex 덤프 (RTL $writememh 출력 / --hex 출력)
+static int load_hex(const char *filename, const CompareDumpInfo *dump, CompareImage *image) {
+    HexDumpOptions opt;
+    hexdump_default_options(&opt);
+    if (dump) {
+        opt.bits = dump->depth;
+        opt.pixels_per_beat = dump->ppc > 0 ? dump->ppc : 1;
+        opt.beat_bits = dump->beat_bits;
+        opt.lsb_first = dump->lsb_first;
+    } else {
+        opt.bits = 8;
+    }
+    RGBGArray rgbg;
+    if (hexdump_read_rgbg(filename, dump ? dump->width : 0, dump ? dump->height : 0,
+                          dump ? dump->frame : 0, &opt, &rgbg) != 0) {
+        return -1;
+    }
+    int result = compare_from_rgbg_array(&rgbg, image);
+    image->format = "HEX";
+    free_rgbg(&rgbg);
+    return result;
+}
+
+// .ctcz 압축 파일 (RGBG 종류만 비교 가능)
+static int load_ctcz(const char *filename, CompareImage *image) {
+    RGBGArray rgbg;
+    RGBArray rgb;
+    int kind = read_ctcz(filename, &rgbg, &rgb);
+    if (kind < 0) {
+        return -1;
+    }
+    if (kind != CTCZ_KIND_RGBG) {
+        log_error("RGB .ctcz는 비교할 수 없습니다 (RGBG 출력만 비교): %s\n", filename);
+        free_rgb(&rgb);
+        return -1;
+    }
+    int result = compare_from_rgbg_array(&rgbg, image);
+    image->format = "CTCZ";
+    free_rgbg(&rgbg);
+    return result;
+}
+
+static int has_hex_extension(const char *filename) {
+    const char *dot = strrchr(filename, '.');
+    return dot && (strcmp(dot, ".hex") == 0 || strcmp(dot, ".mem") == 0);
+}
+
+int compare_load(const char *filename, const CompareDumpInfo *dump, CompareImage *image) {
+    memset(image, 0, sizeof(*image));
+    if (has_hex_extension(filename)) {
+        return load_hex(filename, dump, image);
+    }
+    FILE *file = fopen(filename, "rb");
+    if (!file) {
+        log_error("파일을 열 수 없습니다: %s\n", filename);
+        return -1;
+    }
+    char magic[4] = { 0 };
+    size_t got = fread(magic, 1, sizeof(magic), file);
+    int result;
+    if (got >= 2 && magic[0] == 'P' && magic[1] == '6') {
+        fseek(file, 2, SEEK_SET);
+        result = load_ppm(file, filename, image);
+        fclose(file);
+    } else if (got == 4 && memcmp(magic, "CTCZ", 4) == 0) {
+        fclose(file);
+        result = load_ctcz(filename, image);
+    } else if (got == 4 && memcmp(magic, "RGBG", 4) == 0) {
+        fclose(file);
+        RGBGArray rgbg;
+        if (read_raw(filename, &rgbg) != 0) {
+            return -1;
+        }
+        result = compare_from_rgbg(rgbg.data16, rgbg.width, rgbg.height, rgbg.depth,
+                                   rgbg.order, rgbg.x0 & 1, image);
+        free_rgbg(&rgbg);
+    } else {
+        result = load_dump(file, filename, dump, image);
+        fclose(file);
+    }
+    return result;
+}
+
+// ============================================================
+// 비교 커널
+// ============================================================
+
+typedef struct {
+    uint64_t mismatches[3];
+    uint64_t sse[3];
+    int max_error[3];
+} RowAccum;
+
+// 절대 오차 -> 히스토그램 구간 (0, 1, 2~3, 4~7, ...)
+static int error_bin(unsigned e) {
+    int bin = 0;
+    while (e) {
+        bin++;
+        e >>= 1;
+    }
+    return bin;
+}
+
+// 샘플 [begin, end) 구간 스칼라 비교 (행 끝, SSE2 미지원, 16bit 샘플)
+// r_first: 행의 첫 픽셀이 R 픽셀
+static void compare_row_scalar(const uint16_t *a, const uint16_t *b, size_t begin, size_t end,
+                               int r_first, RowAccum *acc, uint64_t hist[3][COMPARE_HIST_BINS],
+                               uint8_t *bitmap_row) {
+    for (size_t i = begin; i < end; i++) {
+        unsigned e = a[i] > b[i] ? (unsigned)(a[i] - b[i]) : (unsigned)(b[i] - a[i]);
+        if (e == 0) {
+            continue;
+        }
+        size_t pixel = i / 2;
+        int c = (i & 1) ? 1 : (((pixel & 1) == 0) == r_first ? 0 : 2);
+        acc->mismatches[c]++;
+        acc->sse[c] += (uint64_t)e * e;
+        if ((int)e > acc->max_error[c]) {
+            acc->max_error[c] = (int)e;
+        }
+        hist[c][error_bin(e)]++;
+        if (bitmap_row) {
+            bitmap_row[pixel >> 3] |= (uint8_t)(0x80 >> (pixel & 7));
+        }
+    }
+}
+
+#if defined(__SSE2__)
+static uint64_t hsum_epi64(__m128i v) {
+    uint64_t lanes[2];
+    _mm_storeu_si128((__m128i *)lanes, v);
+    return lanes[0] + lanes[1];
+}
+
+static int hmax_epi16(__m128i v) {
+    v = _mm_max_epi16(v, _mm_srli_si128(v, 8));
+    v = _mm_max_epi16(v, _mm_srli_si128(v, 4));
+    v = _mm_max_epi16(v, _mm_srli_si128(v, 2));
+    return _mm_cvtsi128_si32(v) & 0xFFFF;
+}
+
+// 16bit 레인 8개의 합
+static uint64_t hsum_epu16(__m128i v) {
+    __m128i s = _mm_madd_epi16(_mm_srli_epi16(v, 1), _mm_set1_epi16(1));
+    __m128i t = _mm_madd_epi16(_mm_and_si128(v, _mm_set1_epi16(1)), _mm_set1_epi16(1));
+    int32_t a[4], b[4];
+    _mm_storeu_si128((__m128i *)a, s);
+    _mm_storeu_si128((__m128i *)b, t);
+    return (uint64_t)(2 * (a[0] + a[1] + a[2] + a[3]) + b[0] + b[1] + b[2] + b[3]);
+}
+
+// 한 행 비교 (샘플 8개 = 픽셀 4개 단위, 15bit 이하 샘플)
+// 채널별 레인 마스크로 불일치 수 / 제곱합 / 최대 오차를 누적하고,
+// 불일치가 있는 블록만 히스토그램과 비트맵을 스칼라로 갱신
+static void compare_row_sse2(const uint16_t *a, const uint16_t *b, size_t n,
+                             int r_first, RowAccum *acc, uint64_t hist[3][COMPARE_HIST_BINS],
+                             uint8_t *bitmap_row) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i even_px = _mm_setr_epi16(-1, 0, 0, 0, -1, 0, 0, 0);  // 픽셀 0, 2의 R/B 샘플
+    const __m128i odd_px = _mm_setr_epi16(0, 0, -1, 0, 0, 0, -1, 0);   // 픽셀 1, 3의 R/B 샘플
+    __m128i mask[3];
+    mask[0] = r_first ? even_px : odd_px;
+    mask[1] = _mm_setr_epi16(0, -1, 0, -1, 0, -1, 0, -1);
+    mask[2] = r_first ? odd_px : even_px;
+
+    __m128i count[3], sse[3], max[3];
+    for (int c = 0; c < 3; c++) {
+        count[c] = zero;
+        sse[c] = zero;
+        max[c] = zero;
+    }
+
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i va = _mm_loadu_si128((const __m128i *)(a + i));
+        __m128i vb = _mm_loadu_si128((const __m128i *)(b + i));
+        __m128i d = _mm_or_si128(_mm_subs_epu16(va, vb), _mm_subs_epu16(vb, va));
+        __m128i eq = _mm_cmpeq_epi16(d, zero);
+        int eq_bits = _mm_movemask_epi8(eq);
+        if (eq_bits == 0xFFFF) {
+            continue;
+        }
+        for (int c = 0; c < 3; c++) {
+            __m128i dc = _mm_and_si128(d, mask[c]);
+            count[c] = _mm_sub_epi16(count[c], _mm_andnot_si128(eq, mask[c]));
+            max[c] = _mm_max_epi16(max[c], dc);
+            __m128i sq = _mm_madd_epi16(dc, dc);
+            sse[c] = _mm_add_epi64(sse[c], _mm_add_epi64(_mm_unpacklo_epi32(sq, zero),
+                                                         _mm_unpackhi_epi32(sq, zero)));
+        }
+
+        // 히스토그램 / 비트맵: 불일치 레인만
+        uint16_t diff[8];
+        _mm_storeu_si128((__m128i *)diff, d);
+        for (int lane = 0; lane < 8; lane++) {
+            if (diff[lane] == 0) {
+                continue;
+            }
+            size_t pixel = (i + lane) / 2;
+            int c = (lane & 1) ? 1 : (((pixel & 1) == 0) == r_first ? 0 : 2);
+            hist[c][error_bin(diff[lane])]++;
+            if (bitmap_row) {
+                bitmap_row[pixel >> 3] |= (uint8_t)(0x80 >> (pixel & 7));
+            }
+        }
+    }
+
+    for (int c = 0; c < 3; c++) {
+        acc->mismatches[c] += hsum_epu16(count[c]);
+        acc->sse[c] += hsum_epi64(sse[c]);
+        int m = hmax_epi16(max[c]);
+        if (m > acc->max_error[c]) {
+            acc->max_error[c] = m;
+        }
+    }
+    compare_row_scalar(a, b, i, n, r_first, acc, hist, bitmap_row);
+}
+#endif
+
+int compare_images(const CompareImage *a, const CompareImage *b,
+                   uint8_t *bitmap, CompareResult *result) {
+    memset(result, 0, sizeof(*result));
+    if (a->width != b->width || a->height != b->height) {
+        log_error("이미지 크기가 다릅니다: %d x %d vs %d x %d\n", a->width, a->height, b->width, b->height);
+        return -1;
+    }
+    if (a->bits != b->bits) {
+        log_error("샘플 비트 수가 다릅니다: %d vs %d\n", a->bits, b->bits);
+        return -1;
+    }
+
+    size_t n = (size_t)a->width * 2;
+    size_t bitmap_stride = ((size_t)a->width + 7) / 8;
+    if (bitmap) {
+        memset(bitmap, 0, bitmap_stride * a->height);
+    }
+    RowAccum acc;
+    memset(&acc, 0, sizeof(acc));
+    for (int y = 0; y < a->height; y++) {
+        const uint16_t *ra = a->samples + (size_t)y * n;
+        const uint16_t *rb = b->samples + (size_t)y * n;
+        int r_first = ((y + a->phase) & 1) == 0;
+        uint8_t *bitmap_row = bitmap ? bitmap + (size_t)y * bitmap_stride : NULL;
+#if defined(__SSE2__)
+        // 16bit 샘플은 부호 있는 16bit 최대/곱셈 범위를 넘으므로 스칼라로 처리
+        if (a->bits <= 15) {
+            compare_row_sse2(ra, rb, n, r_first, &acc, result->histogram, bitmap_row);
+            continue;
+        }
+#endif
+        compare_row_scalar(ra, rb, 0, n, r_first, &acc, result->histogram, bitmap_row);
+    }
+
+    // 채널별 샘플 수: G는 픽셀마다, R/B는 위상에 따라 절반씩
+    uint64_t pixels = (uint64_t)a->width * a->height;
+    uint64_t r_pixels = 0;
+    for (int y = 0; y < a->height; y++) {
+        r_pixels += (uint64_t)((a->width + (((y + a->phase) & 1) == 0 ? 1 : 0)) / 2);
+    }
+    result->channel_samples[0] = r_pixels;
+    result->channel_samples[1] = pixels;
+    result->channel_samples[2] = pixels - r_pixels;
+    result->samples = pixels * 2;
+
+    for (int c = 0; c < 3; c++) {
+        result->channel_mismatches[c] = acc.mismatches[c];
+        result->channel_sse[c] = acc.sse[c];
+        result->channel_max_error[c] = acc.max_error[c];
+        result->histogram[c][0] = result->channel_samples[c] - acc.mismatches[c];
+        result->mismatches += acc.mismatches[c];
+        if (acc.max_error[c] > result->max_error) {
+            result->max_error = acc.max_error[c];
+        }
+    }
+    if (bitmap) {
+        for (size_t i = 0; i < bitmap_stride * a->height; i++) {
+            result->mismatch_pixels += (uint64_t)__builtin_popcount(bitmap[i]);
+        }
+    } else {
+        // 비트맵 없이 호출한 경우 픽셀 수는 샘플 기준 상한값
+        result->mismatch_pixels = result->mismatches;
+    }
+    return 0;
+}
+
+double compare_psnr(const CompareResult *result, int bits, int channel) {
+    uint64_t sse = 0, samples = 0;
+    for (int c = 0; c < 3; c++) {
+        if (channel < 0 || channel == c) {
+            sse += result->channel_sse[c];
+            samples += result->channel_samples[c];
+        }
+    }
+    if (sse == 0 || samples == 0) {
+        return INFINITY;
+    }
+    double peak = (double)((1u << bits) - 1);
+    double mse = (double)sse / (double)samples;
+    return 10.0 * log10(peak * peak / mse);
+}
+
+// ============================================================
+// 명령행
+// ============================================================
+
+static void print_psnr(const char *label, double psnr) {
+    if (isinf(psnr)) {
+        log_info("  %s: inf\n", label);
+    } else {
+        log_info("  %s: %.2f dB\n", label, psnr);
+    }
+}
+
+static void print_compare_result(const CompareResult *r, int bits) {
+    static const char *names[3] = { "R", "G", "B" };
+    log_info("  샘플 수       : %llu\n", (unsigned long long)r->samples);
+    log_info("  불일치 샘플   : %llu (%.4f%%)\n", (unsigned long long)r->mismatches,
+             r->samples ? 100.0 * (double)r->mismatches / (double)r->samples : 0.0);
+    log_info("  불일치 픽셀   : %llu\n", (unsigned long long)r->mismatch_pixels);
+    log_info("  최대 절대 오차: %d\n", r->max_error);
+    log_info("PSNR (%dbit 최대값 기준):\n", bits);
+    print_psnr("전체", compare_psnr(r, bits, -1));
+    for (int c = 0; c < 3; c++) {
+        print_psnr(names[c], compare_psnr(r, bits, c));
+    }
+    log_info("채널별 (샘플 / 불일치 / 최대 오차):\n");
+    for (int c = 0; c < 3; c++) {
+        log_info("  %s: %llu / %llu / %d\n", names[c], (unsigned long long)r->channel_samples[c],
+                 (unsigned long long)r->channel_mismatches[c], r->channel_max_error[c]);
+    }
+    if (r->mismatches == 0) {
+        return;
+    }
+    log_info("절대 오차 히스토그램 (R / G / B):\n");
+    for (int k = 0; k < COMPARE_HIST_BINS; k++) {
+        if (r->histogram[0][k] == 0 && r->histogram[1][k] == 0 && r->histogram[2][k] == 0) {
+            continue;
+        }
+        if (k <= 1) {
+            log_info("  %11d", k);
+        } else {
+            char range[32];
+            snprintf(range, sizeof(range), "%u~%u", 1u << (k - 1), (1u << k) - 1);
+            log_info("  %11s", range);
+        }
+        log_info(": %llu / %llu / %llu\n", (unsigned long long)r->histogram[0][k],
+                 (unsigned long long)r->histogram[1][k], (unsigned long long)r->histogram[2][k]);
+    }
+}
+
+// 불일치 픽셀 비트맵을 PBM(P4)으로 저장 (1 = 불일치, 검은색)
+static int save_mismatch_bitmap(const char *filename, const uint8_t *bitmap, int width, int height) {
+    OutputSink sink;
+    if (sink_open_file(&sink, filename) != 0) {
+        return -1;
+    }
+    sink_printf(&sink, "P4\n%d %d\n", width, height);
+    sink_write(&sink, bitmap, ((size_t)width + 7) / 8 * height);
+    if (sink_close(&sink) != 0) {
+        log_error("비트맵 저장 실패: %s\n", filename);
+        return -1;
+    }
+    log_info("불일치 비트맵 저장: %s\n", filename);
+    return 0;
+}
+
+int compare_main(int argc, char *argv[]) {
+    if (argc < 4) {
+        log_info("사용법: %s --compare <A> <B> [옵션]\n", argv[0]);
+        log_info("  입력: PPM(10/12bit), 패킹 RAW, .ctcz, 네이티브 RGBG 덤프(--seq 출력), hex 덤프(.hex/.mem)\n");
+        log_info("  --size WxH   RGBG/hex 덤프 크기\n");
+        log_info("  --depth D    RGBG 덤프 샘플 비트 깊이 / hex 필드 비트 수 (8/10/12/16, 기본 8)\n");
+        log_info("  --frame N    RGBG/hex 덤프에서 비교할 프레임 번호 (기본 0)\n");
+        log_info("  --ppc N      hex: 클럭당 픽셀 수 (기본 1)\n");
+        log_info("  --beat W     hex: beat 비트 폭 (기본 필드 합계)\n");
+        log_info("  --lsb-first  hex: 첫 서브픽셀이 최하위 필드\n");
+        log_info("  (hex 덤프 첫 줄에 --hex 형식 주석이 있으면 크기/레이아웃은 주석 값 사용)\n");
+        log_info("  --map FILE   불일치 픽셀 비트맵(PBM) 저장 경로 (기본 test_out/img/compare_mismatch.pbm)\n");
+        return 1;
+    }
+
+    CompareDumpInfo dump = { 0, 0, 8, 0, 1, 0, 0 };
+    const char *map_file = "test_out/img/compare_mismatch.pbm";
+    for (int i = 4; i < argc; i++) {
+        if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            if (sscanf(argv[++i], "%dx%d", &dump.width, &dump.height) != 2) {
+                log_error("잘못된 크기: %s (예: 1080x2392)\n", argv[i]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--depth") == 0 && i + 1 < argc) {
+            dump.depth = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--frame") == 0 && i + 1 < argc) {
+            dump.frame = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--ppc") == 0 && i + 1 < argc) {
+            dump.ppc = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--beat") == 0 && i + 1 < argc) {
+            dump.beat_bits = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--lsb-first") == 0) {
+            dump.lsb_first = 1;
+        } else if (strcmp(argv[i], "--map") == 0 && i + 1 < argc) {
+            map_file = argv[++i];
+        } else {
+            log_error("알 수 없는 옵션: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    CompareImage a, b;
+    double start = now_seconds();
+    if (compare_load(argv[2], &dump, &a) != 0) {
+        return 1;
+    }
+    if (compare_load(argv[3], &dump, &b) != 0) {
+        compare_free(&a);
+        return 1;
+    }
+    double loaded = now_seconds();
+    log_info("A: %s (%s %dbit, %d x %d)\n", argv[2], a.format, a.bits, a.width, a.height);
+    log_info("B: %s (%s %dbit, %d x %d)\n", argv[3], b.format, b.bits, b.width, b.height);
+    if (a.phase != b.phase && a.width == b.width && a.height == b.height) {
+        log_error("경고: R/B 픽셀 위상이 다릅니다 (서브픽셀 순서 확인 필요)\n");
+    }
+
+    size_t bitmap_size = ((size_t)a.width + 7) / 8 * (a.height > 0 ? a.height : 0);
+    uint8_t *bitmap = (uint8_t *)malloc(bitmap_size ? bitmap_size : 1);
+    CompareResult result;
+    int status = bitmap ? compare_images(&a, &b, bitmap, &result) : -1;
+    double compared = now_seconds();
+    if (status == 0) {
+        print_compare_result(&result, a.bits);
+        log_info("시간: 읽기 %.1f ms, 비교 %.2f ms\n", (loaded - start) * 1000.0, (compared - loaded) * 1000.0);
+        if (result.mismatches > 0 && make_parent_directory(map_file) == 0) {
+            save_mismatch_bitmap(map_file, bitmap, a.width, a.height);
+        }
+        log_info("%s\n", result.mismatches == 0 ? "결과: 동일" : "결과: 불일치");
+    }
+
+    free(bitmap);
+    compare_free(&a);
+    compare_free(&b);
+    return (status == 0 && result.mismatches == 0) ? 0 : 1;
+}
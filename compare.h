@@ -0,0 +1,80 @@
+#ifndef COMPARE_H
+#define COMPARE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "image_io.h"
+
+// C 모델 출력과 RTL 덤프 비교
+// PPM(10/12bit), 패킹 RAW, 네이티브 RGBG 덤프를 공통 형식으로 읽어 샘플 단위로 비교
+
+// 공통 비교 형식: 픽셀당 [R 또는 B, G] 2샘플
+// 패널 위치 (x, y)의 픽셀은 (x + y + phase)가 짝수이면 R 픽셀, 홀수이면 B 픽셀
+// (RGBG 서브픽셀 순서/ROI 시작 위치와 무관하게 같은 채널끼리 비교됨)
+typedef struct {
+    uint16_t *samples;      // width * height * 2
+    int width;
+    int height;
+    int bits;               // 샘플 비트 수 (8/10/12/16)
+    int phase;              // R/B 픽셀 위상 (0 또는 1)
+    const char *format;     // "PPM", "RAW", "CTCZ", "DUMP", "HEX"
+} CompareImage;
+
+// 네이티브 RGBG 덤프(--seq 출력) / hex 덤프를 읽을 때 필요한 정보 (PPM/RAW는 파일 헤더 사용)
+// hex 덤프에 형식 주석이 있으면 크기/레이아웃은 주석 값 사용
+typedef struct {
+    int width;
+    int height;
+    int depth;              // 덤프 샘플 비트 깊이 (8: 1바이트, 10/12/16: uint16_t), hex는 필드 비트 수
+    int frame;              // 읽을 프레임 번호
+    int ppc;                // hex: 클럭(beat)당 픽셀 수
+    int beat_bits;          // hex: beat 비트 폭 (0 = 필드 합계)
+    int lsb_first;          // hex: 첫 서브픽셀이 최하위 필드
+} CompareDumpInfo;
+
+#define COMPARE_HIST_BINS 17    // 0, 1, 2~3, 4~7, ..., 32768~65535
+
+// 비교 결과 (채널 인덱스: 0 = R, 1 = G, 2 = B)
+typedef struct {
+    uint64_t samples;
+    uint64_t mismatches;                    // 다른 샘플 수
+    uint64_t mismatch_pixels;               // 샘플 하나라도 다른 픽셀 수
+    int max_error;                          // 최대 절대 오차
+    uint64_t channel_samples[3];
+    uint64_t channel_mismatches[3];
+    int channel_max_error[3];
+    uint64_t channel_sse[3];                // 오차 제곱합
+    uint64_t histogram[3][COMPARE_HIST_BINS]; // 절대 오차 구간별 샘플 수 (bin k: 2^(k-1) <= e < 2^k)
+} CompareResult;
+
+// 파일 형식 판별 후 공통 형식으로 읽기
+// ("P6" = PPM, "RGBG" = 패킹 RAW, "CTCZ" = 압축 RGBG, 확장자 .hex/.mem = hex 덤프, 그 외 = 네이티브 덤프)
+// 반환값: 0 성공, -1 실패
+int compare_load(const char *filename, const CompareDumpInfo *dump, CompareImage *image);
+
+// RGBG 서브픽셀 샘플(행당 width * 2)을 공통 형식으로 변환
+// order: 첫 행 기준 서브픽셀 순서 (RGBG_ORDER_*), odd_col: 첫 열이 패널 홀수 열
+// 반환값: 0 성공, -1 실패
+int compare_from_rgbg(const uint16_t *rgbg, int width, int height, int bits,
+                      int order, int odd_col, CompareImage *image);
+
+// RGBG 배열 (8bit는 16bit 샘플로 변환) -> 공통 형식
+// 반환값: 0 성공, -1 실패
+int compare_from_rgbg_array(const RGBGArray *rgbg, CompareImage *image);
+
+void compare_free(CompareImage *image);
+
+// 두 이미지 비교 (크기/비트 수가 같아야 함)
+// bitmap: 불일치 픽셀 비트맵 (PBM P4 행 형식, 행당 (width + 7) / 8 바이트, NULL이면 생략)
+// 반환값: 0 성공, -1 실패
+int compare_images(const CompareImage *a, const CompareImage *b,
+                   uint8_t *bitmap, CompareResult *result);
+
+// PSNR (dB, 오차가 없으면 INFINITY), channel < 0이면 전체
+double compare_psnr(const CompareResult *result, int bits, int channel);
+
+// --compare 명령행 처리
+// 반환값: 0 동일, 1 불일치/실패
+int compare_main(int argc, char *argv[]);
+
+#endif // COMPARE_H
@@ -3,11 +3,12 @@
 #include <string.h>
 #include <ctype.h>
 #include "config.h"
+#include "log.h"
 #include "config_tables.h" // 룩업 테이블 Include
 
-// 전역 변수 메모리 할당
-IpPorts_t ip_ports;
-int regmap[REG_PAGE][PAGE_ADDR];
+// 전역 변수 메모리 할당 (registers_list.csv 기본값으로 정적 초기화, config 파싱 없이 사용 가능)
+IpPorts_t ip_ports = PORT_DEFAULTS;
+RegFile_t regfile = REG_DEFAULTS;
 
 // 문자열 앞뒤 공백 제거 유틸리티 함수
 static void trim_space(char *str) {
@@ -18,27 +19,195 @@ static void trim_space(char *str) {
     memmove(str, p, l + 1);
 }
 
+// 레지스터 값 변경 알림 콜백 / 변경 세대 카운터
+static RegWriteHook reg_write_hook = NULL;
+static unsigned reg_generation = 0;
+
+void config_set_write_hook(RegWriteHook hook) {
+    reg_write_hook = hook;
+}
+
+unsigned config_generation(void) {
+    return reg_generation;
+}
+
+// 매핑 항목 값 읽기 (필드 크기별)
+static int read_mapped(const ConfigMap *entry) {
+    switch (entry->size) {
+    case 1:
+        return *(const uint8_t *)entry->ptr;
+    case 2:
+        return *(const uint16_t *)entry->ptr;
+    default:
+        return *(const int *)entry->ptr;
+    }
+}
+
+// 값이 항목의 비트 수 안에 들어가는지 확인
+static int fits_width(const ConfigMap *entry, int value) {
+    return entry->width >= 32 || ((unsigned)value >> entry->width) == 0;
+}
+
+// 매핑 항목에 값 쓰기 (비트 수를 넘는 값은 하위 비트만 사용, 값이 바뀐 경우에만 세대 증가 및 콜백 호출)
+static void write_mapped(const ConfigMap *entry, int value) {
+    if (entry->width < 32) {
+        value &= (int)((1u << entry->width) - 1);
+    }
+    if (read_mapped(entry) == value) {
+        return;
+    }
+    switch (entry->size) {
+    case 1:
+        *(uint8_t *)entry->ptr = (uint8_t)value;
+        break;
+    case 2:
+        *(uint16_t *)entry->ptr = (uint16_t)value;
+        break;
+    default:
+        *(int *)entry->ptr = value;
+        break;
+    }
+    reg_generation++;
+    if (reg_write_hook) {
+        reg_write_hook(entry->page, entry->addr);
+    }
+}
+
+// 이름으로 PORT/REG 매핑 항목 찾기
+static const ConfigMap *find_mapped(const char *key, int *is_port) {
+    for (int i = 0; i < port_table_size; i++) {
+        if (strcmp(port_table[i].name, key) == 0) {
+            *is_port = 1;
+            return &port_table[i];
+        }
+    }
+    for (int i = 0; i < reg_table_size; i++) {
+        if (strcmp(reg_table[i].name, key) == 0) {
+            *is_port = 0;
+            return &reg_table[i];
+        }
+    }
+    return NULL;
+}
+
+// 이름으로 PORT/REG 값 쓰기 (por_dbv는 14bit -> H/L로 분리)
+int reg_write_by_name(const char *key, int value) {
+    if (strcmp(key, "por_dbv") == 0) {
+        reg_write_by_name("por_dbv_h", (value >> 8) & 0x3F); // 상위 6비트
+        reg_write_by_name("por_dbv_l", value & 0xFF);        // 하위 8비트
+        return 0;
+    }
+    int is_port;
+    const ConfigMap *entry = find_mapped(key, &is_port);
+    if (!entry) {
+        return -1;
+    }
+    write_mapped(entry, value);
+    return 0;
+}
+
+// 이름으로 PORT/REG 값 읽기
+int reg_read_by_name(const char *key, int *value) {
+    if (strcmp(key, "por_dbv") == 0) {
+        *value = (ip_ports.por_dbv_h << 8) | ip_ports.por_dbv_l;
+        return 0;
+    }
+    int is_port;
+    const ConfigMap *entry = find_mapped(key, &is_port);
+    if (!entry) {
+        return -1;
+    }
+    *value = read_mapped(entry);
+    return 0;
+}
+
+// 이름으로 PORT/REG 비트 수 읽기
+int reg_width_by_name(const char *key) {
+    if (strcmp(key, "por_dbv") == 0) {
+        return 14;
+    }
+    int is_port;
+    const ConfigMap *entry = find_mapped(key, &is_port);
+    return entry ? entry->width : -1;
+}
+
+// PORT 다음 REG 순서로 index번째 이름
+const char *reg_name_at(int index) {
+    if (index < 0) {
+        return NULL;
+    }
+    if (index < port_table_size) {
+        return port_table[index].name;
+    }
+    index -= port_table_size;
+    return index < reg_table_size ? reg_table[index].name : NULL;
+}
+
+// page/addr 위치의 PORT/REG 매핑 항목 (생성된 주소 인덱스로 바로 찾음)
+static const ConfigMap *find_by_addr(int page, int addr) {
+    if (page < 0 || page >= REG_PAGE || addr < 0 || addr >= PAGE_ADDR || !addr_index[page]) {
+        return NULL;
+    }
+    int index = addr_index[page][addr];
+    if (index == 0) {
+        return NULL;
+    }
+    return index <= port_table_size ? &port_table[index - 1] : &reg_table[index - 1 - port_table_size];
+}
+
+// page/addr 위치의 PORT/REG 값 읽기
+int reg_read_by_addr(int page, int addr, int *value) {
+    const ConfigMap *entry = find_by_addr(page, addr);
+    if (!entry) {
+        return -1;
+    }
+    *value = read_mapped(entry);
+    return 0;
+}
+
+int reg_value_at(int page, int addr) {
+    const ConfigMap *entry = find_by_addr(page, addr);
+    return entry ? read_mapped(entry) : 0;
+}
+
+// 기본값 복원 (정적 기본값 이미지 복사, 콜백은 모든 항목에 호출)
+void config_load_defaults(void) {
+    ip_ports = port_defaults;
+    regfile = reg_defaults;
+    reg_generation++;
+    if (reg_write_hook) {
+        for (int i = 0; i < port_table_size; i++) {
+            reg_write_hook(port_table[i].page, port_table[i].addr);
+        }
+        for (int i = 0; i < reg_table_size; i++) {
+            reg_write_hook(reg_table[i].page, reg_table[i].addr);
+        }
+    }
+}
+
 // config.txt 로드 함수
 int load_config(const char *filename) {
     FILE *fp = fopen(filename, "r");
     if (!fp) {
-        printf("Error: Cannot open config file '%s'.\n", filename);
+        log_error("Error: Cannot open config file '%s'.\n", filename);
         return -1;
     }
 
     char line[256];
     int line_num = 0;
+    int applied = 0;
 
-    printf("========================================\n");
-    printf("Config 파싱 시작: %s\n", filename);
-    printf("========================================\n");
+    // 항목별 출력은 debug 레벨 (배치/스윕 실행에서는 요약 한 줄만)
+    log_debug("========================================\n");
+    log_debug("Config 파싱 시작: %s\n", filename);
+    log_debug("========================================\n");
 
     while (fgets(line, sizeof(line), fp)) {
         line_num++;
         trim_space(line);
 
-        // 빈 줄이거나 주석(#, //)은 무시
-        if (line[0] == '\0' || line[0] == '#' || (line[0] == '/' && line[1] == '/')) {
+        // 빈 줄이거나 주석(#, //), 구분선(=====)은 무시
+        if (line[0] == '\0' || line[0] == '#' || line[0] == '=' || (line[0] == '/' && line[1] == '/')) {
             continue;
         }
 
@@ -59,39 +228,27 @@ int load_config(const char *filename) {
             // DBV 14bit port 통합 처리 (14bit -> H/L)
             // ========================================================
             if (strcmp(key, "por_dbv") == 0) {
-                ip_ports.set_dbv_h = (value >> 8) & 0x3F; // 상위 6비트
-                ip_ports.set_dbv_l = value & 0xFF;        // 하위 8비트
-                
-                printf("  [PORT-V] %-25s = %d -> (H: 0x%02X, L: 0x%02X)\n", 
-                       key, value, ip_ports.set_dbv_h, ip_ports.set_dbv_l);
-                found = 1; // 이미 처리했으므로 아래 검색 루프를 건너뜀
+                reg_write_by_name(key, value);
+                log_debug("  [PORT-V] %-25s = %d -> (H: 0x%02X, L: 0x%02X)\n", 
+                          key, value, ip_ports.por_dbv_h, ip_ports.por_dbv_l);
+                found = 1; // 이미 처리했으므로 아래 검색을 건너뜀
             }
             // ========================================================
-             
-            // ========================================================
-            // 1. PORT 테이블 검색
-            // ========================================================
-            for (int i = 0; i < port_table_size; i++) {
-                if (strcmp(port_table[i].name, key) == 0) {
-                    *(port_table[i].ptr) = value;
-                    printf("  [PORT] %-25s = %d (0x%X)\n", key, value, value);
-                    found = 1;
-                    break;
-                }
-            }
-            // ======================================================
-            
+
             // ========================================================
-            // 2. PORT에 없으면 REG 테이블 검색
+            // 1. PORT 테이블 검색, 2. PORT에 없으면 REG 테이블 검색
             // ========================================================
             if (!found) {
-                for (int i = 0; i < reg_table_size; i++) {
-                    if (strcmp(reg_table[i].name, key) == 0) {
-                        *(reg_table[i].ptr) = value;
-                        printf("  [REG ] %-25s = %d (0x%X)\n", key, value, value);
-                        found = 1;
-                        break;
+                int is_port;
+                const ConfigMap *entry = find_mapped(key, &is_port);
+                if (entry) {
+                    if (!fits_width(entry, value)) {
+                        log_error("  [WARN] '%s' = %d (0x%X)가 %d비트 범위를 벗어납니다 (line %d, 하위 비트만 사용)\n",
+                                  key, value, value, entry->width, line_num);
                     }
+                    write_mapped(entry, value);
+                    log_debug("  %s %-25s = %d (0x%X)\n", is_port ? "[PORT]" : "[REG ]", key, value, value);
+                    found = 1;
                 }
             }
             // ========================================================
@@ -100,14 +257,17 @@ int load_config(const char *filename) {
             // 3. 둘 다 없으면 경고 출력 (오타 방지용)
             // ========================================================
             if (!found) {
-                printf("  [WARN] Unknown key '%s' at line %d\n", key, line_num);
+                log_error("  [WARN] Unknown key '%s' at line %d\n", key, line_num);
+            } else {
+                applied++;
             }
             // ========================================================
         }
     }
 
     fclose(fp);
-    printf("========================================\n\n");
+    log_debug("========================================\n\n");
+    log_info("Config 로드: %s (%d개 항목)\n", filename, applied);
     return 0;
 }
 
@@ -115,18 +275,17 @@ int load_config(const char *filename) {
 
 // 현재 적용된 주요 설정값을 출력하는 함수
 void print_config(void) {
-    printf("--- Current Configuration ---\n");
-    printf("  [PORT] por_rgbg_order       : %d\n", ip_ports.por_rgbg_order);
-    printf("  [PORT] por_fcon             :%d\n", ip_ports.por_fcon);
-    printf("  [PORT] por_dbv_h            : %d\n", ip_ports.por_dbv_h);
-    printf("  [PORT] por_dbv_l            : %d\n", ip_ports.por_dbv_l);
-    printf("  [PORT] por_freq_sel         : %d\n", ip_ports.por_freq_sel);
-    printf("  [REG ] reg_ctc_lctc_en      : %d\n", regmap[0x05][0x01]);
-    printf("  [REG ] reg_ctc_actc_en      : %d\n", regmap[0x05][0x02]);
-    printf("  [REG ] reg_ctc_color_mode   : %d\n", regmap[0x05][0x03]);
-    printf("  [REG ] reg_ctc_th_gray      : %d\n", regmap[0x05][0x08]);
-    printf("  [REG ] reg_ctc_freq_gain0   : %d\n", regmap[0x05][0xD2]);
-    printf("  [REG ] R_ctb_lctb_en        : %d\n", regmap[0x05][0x01]);
-    printf("  [REG ] R_ctb_th_gray        : %d\n", regmap[0x05][0x08]);
-    printf("-----------------------------\n");
+    log_info("--- Current Configuration ---\n");
+    log_info("  [PORT] por_rgbg_order       : %d\n", ip_ports.por_rgbg_order);
+    log_info("  [PORT] por_fcon             :%d\n", ip_ports.por_fcon);
+    log_info("  [PORT] por_dbv_h            : %d\n", ip_ports.por_dbv_h);
+    log_info("  [PORT] por_dbv_l            : %d\n", ip_ports.por_dbv_l);
+    log_info("  [REG ] reg_ctc_lctc_en      : %d\n", regfile.reg_ctc_lctc_en);
+    log_info("  [REG ] reg_ctc_actc_en      : %d\n", regfile.reg_ctc_actc_en);
+    log_info("  [REG ] reg_ctc_color_mode   : %d\n", regfile.reg_ctc_color_mode);
+    log_info("  [REG ] reg_ctc_th_gray      : %d\n", regfile.reg_ctc_th_gray);
+    log_info("  [REG ] reg_ctc_freq_gain0   : %d\n", regfile.reg_ctc_freq_gain0);
+    log_info("  [REG ] R_ctb_lctb_en        : %d\n", regfile.reg_ctc_lctc_en);
+    log_info("  [REG ] R_ctb_th_gray        : %d\n", regfile.reg_ctc_th_gray);
+    log_info("-----------------------------\n");
 }
\ No newline at end of file
@@ -6,22 +6,57 @@
 // 1. 외부 입력 포트(PORT) 구조체 정의
 // registers_list.csv에서 'Type'이 PORT인 항목들입니다.
 typedef struct {
-    int set_order_bgfirst_en;
-    int set_dbv_h;
-    int set_dbv_l;
-    int set_freq_sel;
+    int por_rgbg_order;
+    int por_dbv_h;
+    int por_dbv_l;
+    int por_fcon;
 } IpPorts_t;
 
-// 전역 인스턴스 선언 (다른 파일에서 ip_ports.set_freq_sel 형태로 접근 가능)
+// 전역 인스턴스 선언 (다른 파일에서 ip_ports.por_fcon 형태로 접근 가능)
 extern IpPorts_t ip_ports;
 
-// IP 내부 레지스터 배열 선언 (기존 프로젝트에 맞게 크기 조절 가능)
+// IP 내부 레지스터 주소 공간 (registers_list.csv의 Page/Address 범위)
+// 값은 regfile.h의 RegFile_t 필드에 저장 (이름 접근은 regmap.h 매크로)
 #define REG_PAGE 16
 #define PAGE_ADDR 256
-extern int regmap[REG_PAGE][PAGE_ADDR];
+#include "regfile.h"
+
+// 레지스터 값이 바뀔 때 호출되는 콜백 (page/addr: registers_list.csv 위치)
+typedef void (*RegWriteHook)(int page, int addr);
 
 // 함수 선언
 int load_config(const char *filename);
 void print_config(void);
 
+// PORT/REG 값을 registers_list.csv 기본값으로 되돌림 (전역 변수는 프로그램 시작 시 이미 기본값)
+void config_load_defaults(void);
+
+// 이름으로 PORT/REG 값 쓰기 (por_dbv는 14bit -> H/L로 분리)
+// 반환값: 0 성공, -1 알 수 없는 이름
+int reg_write_by_name(const char *key, int value);
+
+// 이름으로 PORT/REG 값 읽기
+// 반환값: 0 성공, -1 알 수 없는 이름
+int reg_read_by_name(const char *key, int *value);
+
+// 이름으로 PORT/REG 비트 수 (registers_list.csv Width 열, por_dbv는 14)
+// 반환값: 비트 수, -1 알 수 없는 이름
+int reg_width_by_name(const char *key);
+
+// index번째 PORT/REG 이름 (PORT 다음 REG 순서, 범위를 벗어나면 NULL)
+const char *reg_name_at(int index);
+
+// page/addr 위치(registers_list.csv 기준)의 PORT/REG 값 읽기
+// 반환값: 0 성공, -1 해당 위치에 레지스터 없음
+int reg_read_by_addr(int page, int addr, int *value);
+
+// page/addr 위치의 PORT/REG 값 (해당 위치에 레지스터가 없으면 0)
+int reg_value_at(int page, int addr);
+
+// 레지스터 변경 콜백 등록 (파생 테이블 무효화용)
+void config_set_write_hook(RegWriteHook hook);
+
+// 레지스터 값이 바뀔 때마다 증가하는 세대 번호
+unsigned config_generation(void);
+
 #endif // CONFIG_H
\ No newline at end of file
@@ -1,32 +1,704 @@
+// ==========================================
+// AUTO-GENERATED FILE by gen_registers.py
+// DO NOT EDIT THIS FILE DIRECTLY.
+// ==========================================
 #ifndef CONFIG_TABLES_H
 #define CONFIG_TABLES_H
 
 #include "config.h"
 
 // 문자열과 변수 포인터를 매핑할 구조체
+// page/addr: registers_list.csv 위치 (파생 테이블 의존성 추적용)
 typedef struct {
     const char *name;
-    int *ptr;
+    void *ptr;
+    uint8_t size;               // 필드 바이트 수 (1, 2, 4)
+    uint8_t width;              // 비트 수 (Width 열, 쓰기 시 이 비트 수로 자름)
+    uint8_t page;
+    uint8_t addr;
 } ConfigMap;
 
 // PORT 매핑 테이블
-static ConfigMap port_table[] = {
-    {"por_rgbg_order",        &ip_ports.por_rgbg_order},
-    {"por_dbv_h",             &ip_ports.por_dbv_h},
-    {"por_dbv_l",             &ip_ports.por_dbv_l},
-    {"por_fcon",              &ip_ports.por_fcon},
+static const ConfigMap port_table[] = {
+    {"por_rgbg_order",              &ip_ports.por_rgbg_order,        sizeof(int),  1, 0x01, 0x01},
+    {"por_dbv_h",                   &ip_ports.por_dbv_h,             sizeof(int),  6, 0x01, 0x02},
+    {"por_dbv_l",                   &ip_ports.por_dbv_l,             sizeof(int),  8, 0x01, 0x03},
+    {"por_fcon",                    &ip_ports.por_fcon,              sizeof(int),  8, 0x01, 0x04},
 };
 static const int port_table_size = sizeof(port_table) / sizeof(port_table[0]);
 
-// REG 매핑 테이블 (regmap 배열과 직접 매핑)
-static ConfigMap reg_table[] = {
-    {"reg_ctc_lctc_en",           &regmap[0x05][0x01]},
-    {"reg_ctc_actc_en",           &regmap[0x05][0x02]},
-    {"reg_ctc_color_mode",        &regmap[0x05][0x03]},
-    {"reg_ctc_th_gray",           &regmap[0x05][0x08]},
-    {"reg_ctc_freq_gain0",        &regmap[0x05][0xD2]},
-    // 필요에 따라 나머지 레지스터들도 여기에 추가...
+// REG 매핑 테이블 (regfile 필드와 직접 매핑)
+static const ConfigMap reg_table[] = {
+    {"reg_ctc_lctc_en",             &regfile.reg_ctc_lctc_en,               1,  8, 0x05, 0x01},
+    {"reg_ctc_actc_en",             &regfile.reg_ctc_actc_en,               1,  8, 0x05, 0x02},
+    {"reg_ctc_color_mode",          &regfile.reg_ctc_color_mode,            1,  8, 0x05, 0x03},
+    {"reg_ctc_dbv_gain_en",         &regfile.reg_ctc_dbv_gain_en,           1,  8, 0x05, 0x04},
+    {"reg_ctc_frq_gain_en",         &regfile.reg_ctc_frq_gain_en,           1,  8, 0x05, 0x05},
+    {"reg_ctc_lctc_off_mask0",      &regfile.reg_ctc_lctc_off_mask0,        1,  8, 0x05, 0x06},
+    {"reg_ctc_lctc_off_mask1",      &regfile.reg_ctc_lctc_off_mask1,        1,  8, 0x05, 0x07},
+    {"reg_ctc_th_gray",             &regfile.reg_ctc_th_gray,               1,  8, 0x05, 0x08},
+    {"reg_ctc_th_delta_line_avg",   &regfile.reg_ctc_th_delta_line_avg,     1,  8, 0x05, 0x09},
+    {"reg_ctc_th_sat",              &regfile.reg_ctc_th_sat,                1,  8, 0x05, 0x0A},
+    {"reg_ctc_lut_end_itp",         &regfile.reg_ctc_lut_end_itp,           1,  8, 0x05, 0x0B},
+    {"reg_ctc_delt_pxlv_mode",      &regfile.reg_ctc_delt_pxlv_mode,        1,  8, 0x05, 0x0C},
+    {"reg_ctc_delt_linev_mode",     &regfile.reg_ctc_delt_linev_mode,       1,  8, 0x05, 0x0D},
+    {"reg_ctc_lctc_interval_no",    &regfile.reg_ctc_lctc_interval_no,      1,  8, 0x05, 0x0E},
+    {"reg_ctc_diff_gray",           &regfile.reg_ctc_diff_gray,             1,  8, 0x05, 0x0F},
+    {"reg_ctc_pxl_vol_coefi_r",     &regfile.reg_ctc_pxl_vol_coefi_r,       1,  8, 0x05, 0x10},
+    {"reg_ctc_pxl_vol_coefi_g",     &regfile.reg_ctc_pxl_vol_coefi_g,       1,  8, 0x05, 0x11},
+    {"reg_ctc_pxl_vol_coefi_b",     &regfile.reg_ctc_pxl_vol_coefi_b,       1,  8, 0x05, 0x12},
+    {"reg_ctc_line_vol_coefi_r",    &regfile.reg_ctc_line_vol_coefi_r,      1,  8, 0x05, 0x13},
+    {"reg_ctc_line_vol_coefi_g0",   &regfile.reg_ctc_line_vol_coefi_g0,     1,  8, 0x05, 0x14},
+    {"reg_ctc_line_vol_coefi_b",    &regfile.reg_ctc_line_vol_coefi_b,      1,  8, 0x05, 0x15},
+    {"reg_ctc_line_vol_coefi_g1",   &regfile.reg_ctc_line_vol_coefi_g1,     1,  8, 0x05, 0x16},
+    {"reg_ctc_gamma_gray_idx_x1",   &regfile.reg_ctc_gamma_gray_idx_x1,     1,  8, 0x05, 0x17},
+    {"reg_ctc_gamma_gray_idx_x2",   &regfile.reg_ctc_gamma_gray_idx_x2,     1,  8, 0x05, 0x18},
+    {"reg_ctc_gamma_gray_idx_x3",   &regfile.reg_ctc_gamma_gray_idx_x3,     1,  8, 0x05, 0x19},
+    {"reg_ctc_gamma_gray_idx_x4",   &regfile.reg_ctc_gamma_gray_idx_x4,     1,  8, 0x05, 0x1A},
+    {"reg_ctc_gamma_gray_idx_x5",   &regfile.reg_ctc_gamma_gray_idx_x5,     1,  8, 0x05, 0x1B},
+    {"reg_ctc_gamma_gray_idx_x6",   &regfile.reg_ctc_gamma_gray_idx_x6,     1,  8, 0x05, 0x1C},
+    {"reg_ctc_gamma_gray_idx_x7",   &regfile.reg_ctc_gamma_gray_idx_x7,     1,  8, 0x05, 0x1D},
+    {"reg_ctc_nor_vol_r_y1",        &regfile.reg_ctc_nor_vol_r_y1,          1,  8, 0x05, 0x1E},
+    {"reg_ctc_nor_vol_r_y2",        &regfile.reg_ctc_nor_vol_r_y2,          1,  8, 0x05, 0x1F},
+    {"reg_ctc_nor_vol_r_y3",        &regfile.reg_ctc_nor_vol_r_y3,          1,  8, 0x05, 0x20},
+    {"reg_ctc_nor_vol_r_y4",        &regfile.reg_ctc_nor_vol_r_y4,          1,  8, 0x05, 0x21},
+    {"reg_ctc_nor_vol_r_y5",        &regfile.reg_ctc_nor_vol_r_y5,          1,  8, 0x05, 0x22},
+    {"reg_ctc_nor_vol_r_y6",        &regfile.reg_ctc_nor_vol_r_y6,          1,  8, 0x05, 0x23},
+    {"reg_ctc_nor_vol_r_y7",        &regfile.reg_ctc_nor_vol_r_y7,          1,  8, 0x05, 0x24},
+    {"reg_ctc_nor_vol_r_y8",        &regfile.reg_ctc_nor_vol_r_y8,          1,  8, 0x05, 0x25},
+    {"reg_ctc_nor_vol_g_y1",        &regfile.reg_ctc_nor_vol_g_y1,          1,  8, 0x05, 0x26},
+    {"reg_ctc_nor_vol_g_y2",        &regfile.reg_ctc_nor_vol_g_y2,          1,  8, 0x05, 0x27},
+    {"reg_ctc_nor_vol_g_y3",        &regfile.reg_ctc_nor_vol_g_y3,          1,  8, 0x05, 0x28},
+    {"reg_ctc_nor_vol_g_y4",        &regfile.reg_ctc_nor_vol_g_y4,          1,  8, 0x05, 0x29},
+    {"reg_ctc_nor_vol_g_y5",        &regfile.reg_ctc_nor_vol_g_y5,          1,  8, 0x05, 0x2A},
+    {"reg_ctc_nor_vol_g_y6",        &regfile.reg_ctc_nor_vol_g_y6,          1,  8, 0x05, 0x2B},
+    {"reg_ctc_nor_vol_g_y7",        &regfile.reg_ctc_nor_vol_g_y7,          1,  8, 0x05, 0x2C},
+    {"reg_ctc_nor_vol_g_y8",        &regfile.reg_ctc_nor_vol_g_y8,          1,  8, 0x05, 0x2D},
+    {"reg_ctc_nor_vol_b_y1",        &regfile.reg_ctc_nor_vol_b_y1,          1,  8, 0x05, 0x2E},
+    {"reg_ctc_nor_vol_b_y2",        &regfile.reg_ctc_nor_vol_b_y2,          1,  8, 0x05, 0x2F},
+    {"reg_ctc_nor_vol_b_y3",        &regfile.reg_ctc_nor_vol_b_y3,          1,  8, 0x05, 0x30},
+    {"reg_ctc_nor_vol_b_y4",        &regfile.reg_ctc_nor_vol_b_y4,          1,  8, 0x05, 0x31},
+    {"reg_ctc_nor_vol_b_y5",        &regfile.reg_ctc_nor_vol_b_y5,          1,  8, 0x05, 0x32},
+    {"reg_ctc_nor_vol_b_y6",        &regfile.reg_ctc_nor_vol_b_y6,          1,  8, 0x05, 0x33},
+    {"reg_ctc_nor_vol_b_y7",        &regfile.reg_ctc_nor_vol_b_y7,          1,  8, 0x05, 0x34},
+    {"reg_ctc_nor_vol_b_y8",        &regfile.reg_ctc_nor_vol_b_y8,          1,  8, 0x05, 0x35},
+    {"reg_ctc_pxl_gray_x0",         &regfile.reg_ctc_pxl_gray_x0,           1,  8, 0x05, 0x36},
+    {"reg_ctc_pxl_gray_x1",         &regfile.reg_ctc_pxl_gray_x1,           1,  8, 0x05, 0x37},
+    {"reg_ctc_pxl_gray_x2",         &regfile.reg_ctc_pxl_gray_x2,           1,  8, 0x05, 0x38},
+    {"reg_ctc_del_vol_idx_actb_y0", &regfile.reg_ctc_del_vol_idx_actb_y0,   1,  8, 0x05, 0x39},
+    {"reg_ctc_del_vol_idx_actb_y1", &regfile.reg_ctc_del_vol_idx_actb_y1,   1,  8, 0x05, 0x3A},
+    {"reg_ctc_del_vol_idx_actb_y2", &regfile.reg_ctc_del_vol_idx_actb_y2,   1,  8, 0x05, 0x3B},
+    {"reg_ctc_del_vol_idx_actb_y3", &regfile.reg_ctc_del_vol_idx_actb_y3,   1,  8, 0x05, 0x3C},
+    {"reg_ctc_del_vol_idx_actb_y4", &regfile.reg_ctc_del_vol_idx_actb_y4,   1,  8, 0x05, 0x3D},
+    {"reg_ctc_del_vol_idx_actb_y5", &regfile.reg_ctc_del_vol_idx_actb_y5,   1,  8, 0x05, 0x3E},
+    {"reg_ctc_del_vol_idx_lctb_y0", &regfile.reg_ctc_del_vol_idx_lctb_y0,   1,  8, 0x05, 0x3F},
+    {"reg_ctc_del_vol_idx_lctb_y1", &regfile.reg_ctc_del_vol_idx_lctb_y1,   1,  8, 0x05, 0x40},
+    {"reg_ctc_del_vol_idx_lctb_y2", &regfile.reg_ctc_del_vol_idx_lctb_y2,   1,  8, 0x05, 0x41},
+    {"reg_ctc_del_vol_idx_lctb_y3", &regfile.reg_ctc_del_vol_idx_lctb_y3,   1,  8, 0x05, 0x42},
+    {"reg_ctc_del_vol_idx_lctb_y4", &regfile.reg_ctc_del_vol_idx_lctb_y4,   1,  8, 0x05, 0x43},
+    {"reg_ctc_del_vol_idx_lctb_y5", &regfile.reg_ctc_del_vol_idx_lctb_y5,   1,  8, 0x05, 0x44},
+    {"reg_ctc_actc_lut_nega_00",    &regfile.reg_ctc_actc_lut_nega_00,      1,  8, 0x05, 0x45},
+    {"reg_ctc_actc_lut_nega_01",    &regfile.reg_ctc_actc_lut_nega_01,      1,  8, 0x05, 0x46},
+    {"reg_ctc_actc_lut_nega_02",    &regfile.reg_ctc_actc_lut_nega_02,      1,  8, 0x05, 0x47},
+    {"reg_ctc_actc_lut_nega_03",    &regfile.reg_ctc_actc_lut_nega_03,      1,  8, 0x05, 0x48},
+    {"reg_ctc_actc_lut_nega_10",    &regfile.reg_ctc_actc_lut_nega_10,      1,  8, 0x05, 0x49},
+    {"reg_ctc_actc_lut_nega_11",    &regfile.reg_ctc_actc_lut_nega_11,      1,  8, 0x05, 0x4A},
+    {"reg_ctc_actc_lut_nega_12",    &regfile.reg_ctc_actc_lut_nega_12,      1,  8, 0x05, 0x4B},
+    {"reg_ctc_actc_lut_nega_13",    &regfile.reg_ctc_actc_lut_nega_13,      1,  8, 0x05, 0x4C},
+    {"reg_ctc_actc_lut_nega_20",    &regfile.reg_ctc_actc_lut_nega_20,      1,  8, 0x05, 0x4D},
+    {"reg_ctc_actc_lut_nega_21",    &regfile.reg_ctc_actc_lut_nega_21,      1,  8, 0x05, 0x4E},
+    {"reg_ctc_actc_lut_nega_22",    &regfile.reg_ctc_actc_lut_nega_22,      1,  8, 0x05, 0x4F},
+    {"reg_ctc_actc_lut_nega_23",    &regfile.reg_ctc_actc_lut_nega_23,      1,  8, 0x05, 0x50},
+    {"reg_ctc_actc_lut_nega_30",    &regfile.reg_ctc_actc_lut_nega_30,      1,  8, 0x05, 0x51},
+    {"reg_ctc_actc_lut_nega_31",    &regfile.reg_ctc_actc_lut_nega_31,      1,  8, 0x05, 0x52},
+    {"reg_ctc_actc_lut_nega_32",    &regfile.reg_ctc_actc_lut_nega_32,      1,  8, 0x05, 0x53},
+    {"reg_ctc_actc_lut_nega_33",    &regfile.reg_ctc_actc_lut_nega_33,      1,  8, 0x05, 0x54},
+    {"reg_ctc_actc_lut_nega_40",    &regfile.reg_ctc_actc_lut_nega_40,      1,  8, 0x05, 0x55},
+    {"reg_ctc_actc_lut_nega_41",    &regfile.reg_ctc_actc_lut_nega_41,      1,  8, 0x05, 0x56},
+    {"reg_ctc_actc_lut_nega_42",    &regfile.reg_ctc_actc_lut_nega_42,      1,  8, 0x05, 0x57},
+    {"reg_ctc_actc_lut_nega_43",    &regfile.reg_ctc_actc_lut_nega_43,      1,  8, 0x05, 0x58},
+    {"reg_ctc_actc_lut_nega_50",    &regfile.reg_ctc_actc_lut_nega_50,      1,  8, 0x05, 0x59},
+    {"reg_ctc_actc_lut_nega_51",    &regfile.reg_ctc_actc_lut_nega_51,      1,  8, 0x05, 0x5A},
+    {"reg_ctc_actc_lut_nega_52",    &regfile.reg_ctc_actc_lut_nega_52,      1,  8, 0x05, 0x5B},
+    {"reg_ctc_actc_lut_nega_53",    &regfile.reg_ctc_actc_lut_nega_53,      1,  8, 0x05, 0x5C},
+    {"reg_ctc_actc_lut_posi_00",    &regfile.reg_ctc_actc_lut_posi_00,      1,  8, 0x05, 0x5D},
+    {"reg_ctc_actc_lut_posi_01",    &regfile.reg_ctc_actc_lut_posi_01,      1,  8, 0x05, 0x5E},
+    {"reg_ctc_actc_lut_posi_02",    &regfile.reg_ctc_actc_lut_posi_02,      1,  8, 0x05, 0x5F},
+    {"reg_ctc_actc_lut_posi_03",    &regfile.reg_ctc_actc_lut_posi_03,      1,  8, 0x05, 0x60},
+    {"reg_ctc_actc_lut_posi_10",    &regfile.reg_ctc_actc_lut_posi_10,      1,  8, 0x05, 0x61},
+    {"reg_ctc_actc_lut_posi_11",    &regfile.reg_ctc_actc_lut_posi_11,      1,  8, 0x05, 0x62},
+    {"reg_ctc_actc_lut_posi_12",    &regfile.reg_ctc_actc_lut_posi_12,      1,  8, 0x05, 0x63},
+    {"reg_ctc_actc_lut_posi_13",    &regfile.reg_ctc_actc_lut_posi_13,      1,  8, 0x05, 0x64},
+    {"reg_ctc_actc_lut_posi_20",    &regfile.reg_ctc_actc_lut_posi_20,      1,  8, 0x05, 0x65},
+    {"reg_ctc_actc_lut_posi_21",    &regfile.reg_ctc_actc_lut_posi_21,      1,  8, 0x05, 0x66},
+    {"reg_ctc_actc_lut_posi_22",    &regfile.reg_ctc_actc_lut_posi_22,      1,  8, 0x05, 0x67},
+    {"reg_ctc_actc_lut_posi_23",    &regfile.reg_ctc_actc_lut_posi_23,      1,  8, 0x05, 0x68},
+    {"reg_ctc_actc_lut_posi_30",    &regfile.reg_ctc_actc_lut_posi_30,      1,  8, 0x05, 0x69},
+    {"reg_ctc_actc_lut_posi_31",    &regfile.reg_ctc_actc_lut_posi_31,      1,  8, 0x05, 0x6A},
+    {"reg_ctc_actc_lut_posi_32",    &regfile.reg_ctc_actc_lut_posi_32,      1,  8, 0x05, 0x6B},
+    {"reg_ctc_actc_lut_posi_33",    &regfile.reg_ctc_actc_lut_posi_33,      1,  8, 0x05, 0x6C},
+    {"reg_ctc_actc_lut_posi_40",    &regfile.reg_ctc_actc_lut_posi_40,      1,  8, 0x05, 0x6D},
+    {"reg_ctc_actc_lut_posi_41",    &regfile.reg_ctc_actc_lut_posi_41,      1,  8, 0x05, 0x6E},
+    {"reg_ctc_actc_lut_posi_42",    &regfile.reg_ctc_actc_lut_posi_42,      1,  8, 0x05, 0x6F},
+    {"reg_ctc_actc_lut_posi_43",    &regfile.reg_ctc_actc_lut_posi_43,      1,  8, 0x05, 0x70},
+    {"reg_ctc_actc_lut_posi_50",    &regfile.reg_ctc_actc_lut_posi_50,      1,  8, 0x05, 0x71},
+    {"reg_ctc_actc_lut_posi_51",    &regfile.reg_ctc_actc_lut_posi_51,      1,  8, 0x05, 0x72},
+    {"reg_ctc_actc_lut_posi_52",    &regfile.reg_ctc_actc_lut_posi_52,      1,  8, 0x05, 0x73},
+    {"reg_ctc_actc_lut_posi_53",    &regfile.reg_ctc_actc_lut_posi_53,      1,  8, 0x05, 0x74},
+    {"reg_ctc_lctc_lut_nega_00",    &regfile.reg_ctc_lctc_lut_nega_00,      1,  8, 0x05, 0x75},
+    {"reg_ctc_lctc_lut_nega_01",    &regfile.reg_ctc_lctc_lut_nega_01,      1,  8, 0x05, 0x76},
+    {"reg_ctc_lctc_lut_nega_02",    &regfile.reg_ctc_lctc_lut_nega_02,      1,  8, 0x05, 0x77},
+    {"reg_ctc_lctc_lut_nega_03",    &regfile.reg_ctc_lctc_lut_nega_03,      1,  8, 0x05, 0x78},
+    {"reg_ctc_lctc_lut_nega_10",    &regfile.reg_ctc_lctc_lut_nega_10,      1,  8, 0x05, 0x79},
+    {"reg_ctc_lctc_lut_nega_11",    &regfile.reg_ctc_lctc_lut_nega_11,      1,  8, 0x05, 0x7A},
+    {"reg_ctc_lctc_lut_nega_12",    &regfile.reg_ctc_lctc_lut_nega_12,      1,  8, 0x05, 0x7B},
+    {"reg_ctc_lctc_lut_nega_13",    &regfile.reg_ctc_lctc_lut_nega_13,      1,  8, 0x05, 0x7C},
+    {"reg_ctc_lctc_lut_nega_20",    &regfile.reg_ctc_lctc_lut_nega_20,      1,  8, 0x05, 0x7D},
+    {"reg_ctc_lctc_lut_nega_21",    &regfile.reg_ctc_lctc_lut_nega_21,      1,  8, 0x05, 0x7E},
+    {"reg_ctc_lctc_lut_nega_22",    &regfile.reg_ctc_lctc_lut_nega_22,      1,  8, 0x05, 0x7F},
+    {"reg_ctc_lctc_lut_nega_23",    &regfile.reg_ctc_lctc_lut_nega_23,      1,  8, 0x05, 0x80},
+    {"reg_ctc_lctc_lut_nega_30",    &regfile.reg_ctc_lctc_lut_nega_30,      1,  8, 0x05, 0x81},
+    {"reg_ctc_lctc_lut_nega_31",    &regfile.reg_ctc_lctc_lut_nega_31,      1,  8, 0x05, 0x82},
+    {"reg_ctc_lctc_lut_nega_32",    &regfile.reg_ctc_lctc_lut_nega_32,      1,  8, 0x05, 0x83},
+    {"reg_ctc_lctc_lut_nega_33",    &regfile.reg_ctc_lctc_lut_nega_33,      1,  8, 0x05, 0x84},
+    {"reg_ctc_lctc_lut_nega_40",    &regfile.reg_ctc_lctc_lut_nega_40,      1,  8, 0x05, 0x85},
+    {"reg_ctc_lctc_lut_nega_41",    &regfile.reg_ctc_lctc_lut_nega_41,      1,  8, 0x05, 0x86},
+    {"reg_ctc_lctc_lut_nega_42",    &regfile.reg_ctc_lctc_lut_nega_42,      1,  8, 0x05, 0x87},
+    {"reg_ctc_lctc_lut_nega_43",    &regfile.reg_ctc_lctc_lut_nega_43,      1,  8, 0x05, 0x88},
+    {"reg_ctc_lctc_lut_nega_50",    &regfile.reg_ctc_lctc_lut_nega_50,      1,  8, 0x05, 0x89},
+    {"reg_ctc_lctc_lut_nega_51",    &regfile.reg_ctc_lctc_lut_nega_51,      1,  8, 0x05, 0x8A},
+    {"reg_ctc_lctc_lut_nega_52",    &regfile.reg_ctc_lctc_lut_nega_52,      1,  8, 0x05, 0x8B},
+    {"reg_ctc_lctc_lut_nega_53",    &regfile.reg_ctc_lctc_lut_nega_53,      1,  8, 0x05, 0x8C},
+    {"reg_ctc_lctc_lut_posi_00",    &regfile.reg_ctc_lctc_lut_posi_00,      1,  8, 0x05, 0x8D},
+    {"reg_ctc_lctc_lut_posi_01",    &regfile.reg_ctc_lctc_lut_posi_01,      1,  8, 0x05, 0x8E},
+    {"reg_ctc_lctc_lut_posi_02",    &regfile.reg_ctc_lctc_lut_posi_02,      1,  8, 0x05, 0x8F},
+    {"reg_ctc_lctc_lut_posi_03",    &regfile.reg_ctc_lctc_lut_posi_03,      1,  8, 0x05, 0x90},
+    {"reg_ctc_lctc_lut_posi_10",    &regfile.reg_ctc_lctc_lut_posi_10,      1,  8, 0x05, 0x91},
+    {"reg_ctc_lctc_lut_posi_11",    &regfile.reg_ctc_lctc_lut_posi_11,      1,  8, 0x05, 0x92},
+    {"reg_ctc_lctc_lut_posi_12",    &regfile.reg_ctc_lctc_lut_posi_12,      1,  8, 0x05, 0x93},
+    {"reg_ctc_lctc_lut_posi_13",    &regfile.reg_ctc_lctc_lut_posi_13,      1,  8, 0x05, 0x94},
+    {"reg_ctc_lctc_lut_posi_20",    &regfile.reg_ctc_lctc_lut_posi_20,      1,  8, 0x05, 0x95},
+    {"reg_ctc_lctc_lut_posi_21",    &regfile.reg_ctc_lctc_lut_posi_21,      1,  8, 0x05, 0x96},
+    {"reg_ctc_lctc_lut_posi_22",    &regfile.reg_ctc_lctc_lut_posi_22,      1,  8, 0x05, 0x97},
+    {"reg_ctc_lctc_lut_posi_23",    &regfile.reg_ctc_lctc_lut_posi_23,      1,  8, 0x05, 0x98},
+    {"reg_ctc_lctc_lut_posi_30",    &regfile.reg_ctc_lctc_lut_posi_30,      1,  8, 0x05, 0x99},
+    {"reg_ctc_lctc_lut_posi_31",    &regfile.reg_ctc_lctc_lut_posi_31,      1,  8, 0x05, 0x9A},
+    {"reg_ctc_lctc_lut_posi_32",    &regfile.reg_ctc_lctc_lut_posi_32,      1,  8, 0x05, 0x9B},
+    {"reg_ctc_lctc_lut_posi_33",    &regfile.reg_ctc_lctc_lut_posi_33,      1,  8, 0x05, 0x9C},
+    {"reg_ctc_lctc_lut_posi_40",    &regfile.reg_ctc_lctc_lut_posi_40,      1,  8, 0x05, 0x9D},
+    {"reg_ctc_lctc_lut_posi_41",    &regfile.reg_ctc_lctc_lut_posi_41,      1,  8, 0x05, 0x9E},
+    {"reg_ctc_lctc_lut_posi_42",    &regfile.reg_ctc_lctc_lut_posi_42,      1,  8, 0x05, 0x9F},
+    {"reg_ctc_lctc_lut_posi_43",    &regfile.reg_ctc_lctc_lut_posi_43,      1,  8, 0x05, 0xA0},
+    {"reg_ctc_lctc_lut_posi_50",    &regfile.reg_ctc_lctc_lut_posi_50,      1,  8, 0x05, 0xA1},
+    {"reg_ctc_lctc_lut_posi_51",    &regfile.reg_ctc_lctc_lut_posi_51,      1,  8, 0x05, 0xA2},
+    {"reg_ctc_lctc_lut_posi_52",    &regfile.reg_ctc_lctc_lut_posi_52,      1,  8, 0x05, 0xA3},
+    {"reg_ctc_lctc_lut_posi_53",    &regfile.reg_ctc_lctc_lut_posi_53,      1,  8, 0x05, 0xA4},
+    {"reg_ctc_line_r_nega_gain0",   &regfile.reg_ctc_line_r_nega_gain0,     1,  8, 0x05, 0xA5},
+    {"reg_ctc_line_r_nega_gain1",   &regfile.reg_ctc_line_r_nega_gain1,     1,  8, 0x05, 0xA6},
+    {"reg_ctc_line_r_nega_gain2",   &regfile.reg_ctc_line_r_nega_gain2,     1,  8, 0x05, 0xA7},
+    {"reg_ctc_line_r_nega_gain3",   &regfile.reg_ctc_line_r_nega_gain3,     1,  8, 0x05, 0xA8},
+    {"reg_ctc_line_r_nega_gain4",   &regfile.reg_ctc_line_r_nega_gain4,     1,  8, 0x05, 0xA9},
+    {"reg_ctc_line_r_nega_gain5",   &regfile.reg_ctc_line_r_nega_gain5,     1,  8, 0x05, 0xAA},
+    {"reg_ctc_line_g_nega_gain0",   &regfile.reg_ctc_line_g_nega_gain0,     1,  8, 0x05, 0xAB},
+    {"reg_ctc_line_g_nega_gain1",   &regfile.reg_ctc_line_g_nega_gain1,     1,  8, 0x05, 0xAC},
+    {"reg_ctc_line_g_nega_gain2",   &regfile.reg_ctc_line_g_nega_gain2,     1,  8, 0x05, 0xAD},
+    {"reg_ctc_line_g_nega_gain3",   &regfile.reg_ctc_line_g_nega_gain3,     1,  8, 0x05, 0xAE},
+    {"reg_ctc_line_g_nega_gain4",   &regfile.reg_ctc_line_g_nega_gain4,     1,  8, 0x05, 0xAF},
+    {"reg_ctc_line_g_nega_gain5",   &regfile.reg_ctc_line_g_nega_gain5,     1,  8, 0x05, 0xB0},
+    {"reg_ctc_line_b_nega_gain0",   &regfile.reg_ctc_line_b_nega_gain0,     1,  8, 0x05, 0xB1},
+    {"reg_ctc_line_b_nega_gain1",   &regfile.reg_ctc_line_b_nega_gain1,     1,  8, 0x05, 0xB2},
+    {"reg_ctc_line_b_nega_gain2",   &regfile.reg_ctc_line_b_nega_gain2,     1,  8, 0x05, 0xB3},
+    {"reg_ctc_line_b_nega_gain3",   &regfile.reg_ctc_line_b_nega_gain3,     1,  8, 0x05, 0xB4},
+    {"reg_ctc_line_b_nega_gain4",   &regfile.reg_ctc_line_b_nega_gain4,     1,  8, 0x05, 0xB5},
+    {"reg_ctc_line_b_nega_gain5",   &regfile.reg_ctc_line_b_nega_gain5,     1,  8, 0x05, 0xB6},
+    {"reg_ctc_line_r_posi_gain0",   &regfile.reg_ctc_line_r_posi_gain0,     1,  8, 0x05, 0xB7},
+    {"reg_ctc_line_r_posi_gain1",   &regfile.reg_ctc_line_r_posi_gain1,     1,  8, 0x05, 0xB8},
+    {"reg_ctc_line_r_posi_gain2",   &regfile.reg_ctc_line_r_posi_gain2,     1,  8, 0x05, 0xB9},
+    {"reg_ctc_line_r_posi_gain3",   &regfile.reg_ctc_line_r_posi_gain3,     1,  8, 0x05, 0xBA},
+    {"reg_ctc_line_r_posi_gain4",   &regfile.reg_ctc_line_r_posi_gain4,     1,  8, 0x05, 0xBB},
+    {"reg_ctc_line_r_posi_gain5",   &regfile.reg_ctc_line_r_posi_gain5,     1,  8, 0x05, 0xBC},
+    {"reg_ctc_line_g_posi_gain0",   &regfile.reg_ctc_line_g_posi_gain0,     1,  8, 0x05, 0xBD},
+    {"reg_ctc_line_g_posi_gain1",   &regfile.reg_ctc_line_g_posi_gain1,     1,  8, 0x05, 0xBE},
+    {"reg_ctc_line_g_posi_gain2",   &regfile.reg_ctc_line_g_posi_gain2,     1,  8, 0x05, 0xBF},
+    {"reg_ctc_line_g_posi_gain3",   &regfile.reg_ctc_line_g_posi_gain3,     1,  8, 0x05, 0xC0},
+    {"reg_ctc_line_g_posi_gain4",   &regfile.reg_ctc_line_g_posi_gain4,     1,  8, 0x05, 0xC1},
+    {"reg_ctc_line_g_posi_gain5",   &regfile.reg_ctc_line_g_posi_gain5,     1,  8, 0x05, 0xC2},
+    {"reg_ctc_line_b_posi_gain0",   &regfile.reg_ctc_line_b_posi_gain0,     1,  8, 0x05, 0xC3},
+    {"reg_ctc_line_b_posi_gain1",   &regfile.reg_ctc_line_b_posi_gain1,     1,  8, 0x05, 0xC4},
+    {"reg_ctc_line_b_posi_gain2",   &regfile.reg_ctc_line_b_posi_gain2,     1,  8, 0x05, 0xC5},
+    {"reg_ctc_line_b_posi_gain3",   &regfile.reg_ctc_line_b_posi_gain3,     1,  8, 0x05, 0xC6},
+    {"reg_ctc_line_b_posi_gain4",   &regfile.reg_ctc_line_b_posi_gain4,     1,  8, 0x05, 0xC7},
+    {"reg_ctc_line_b_posi_gain5",   &regfile.reg_ctc_line_b_posi_gain5,     1,  8, 0x05, 0xC8},
+    {"reg_ctc_dbv_node_x0",         &regfile.reg_ctc_dbv_node_x0,           1,  8, 0x05, 0xC9},
+    {"reg_ctc_dbv_node_x1",         &regfile.reg_ctc_dbv_node_x1,           1,  8, 0x05, 0xCA},
+    {"reg_ctc_dbv_node_x2",         &regfile.reg_ctc_dbv_node_x2,           1,  8, 0x05, 0xCB},
+    {"reg_ctc_dbv_node_x3",         &regfile.reg_ctc_dbv_node_x3,           1,  8, 0x05, 0xCC},
+    {"reg_ctc_dbv_gain_y0",         &regfile.reg_ctc_dbv_gain_y0,           1,  8, 0x05, 0xCD},
+    {"reg_ctc_dbv_gain_y1",         &regfile.reg_ctc_dbv_gain_y1,           1,  8, 0x05, 0xCE},
+    {"reg_ctc_dbv_gain_y2",         &regfile.reg_ctc_dbv_gain_y2,           1,  8, 0x05, 0xCF},
+    {"reg_ctc_dbv_gain_y3",         &regfile.reg_ctc_dbv_gain_y3,           1,  8, 0x05, 0xD0},
+    {"reg_ctc_dbv_gain_y4",         &regfile.reg_ctc_dbv_gain_y4,           1,  8, 0x05, 0xD1},
+    {"reg_ctc_freq_gain0",          &regfile.reg_ctc_freq_gain0,            1,  8, 0x05, 0xD2},
+    {"reg_ctc_freq_gain1",          &regfile.reg_ctc_freq_gain1,            1,  8, 0x05, 0xD3},
+    {"reg_ctc_freq_gain2",          &regfile.reg_ctc_freq_gain2,            1,  8, 0x05, 0xD4},
+    {"reg_ctc_freq_gain3",          &regfile.reg_ctc_freq_gain3,            1,  8, 0x05, 0xD5},
+    {"reg_ctc_freq_gain4",          &regfile.reg_ctc_freq_gain4,            1,  8, 0x05, 0xD6},
 };
 static const int reg_table_size = sizeof(reg_table) / sizeof(reg_table[0]);
 
-#endif // CONFIG_TABLES_H
\ No newline at end of file
+// page/addr -> 항목 번호 + 1 (0: 없음, port_table 다음에 reg_table 순서)
+static const uint16_t addr_index_p01[PAGE_ADDR] = {
+    [0x01] = 1,
+    [0x02] = 2,
+    [0x03] = 3,
+    [0x04] = 4,
+};
+static const uint16_t addr_index_p05[PAGE_ADDR] = {
+    [0x01] = 5,
+    [0x02] = 6,
+    [0x03] = 7,
+    [0x04] = 8,
+    [0x05] = 9,
+    [0x06] = 10,
+    [0x07] = 11,
+    [0x08] = 12,
+    [0x09] = 13,
+    [0x0A] = 14,
+    [0x0B] = 15,
+    [0x0C] = 16,
+    [0x0D] = 17,
+    [0x0E] = 18,
+    [0x0F] = 19,
+    [0x10] = 20,
+    [0x11] = 21,
+    [0x12] = 22,
+    [0x13] = 23,
+    [0x14] = 24,
+    [0x15] = 25,
+    [0x16] = 26,
+    [0x17] = 27,
+    [0x18] = 28,
+    [0x19] = 29,
+    [0x1A] = 30,
+    [0x1B] = 31,
+    [0x1C] = 32,
+    [0x1D] = 33,
+    [0x1E] = 34,
+    [0x1F] = 35,
+    [0x20] = 36,
+    [0x21] = 37,
+    [0x22] = 38,
+    [0x23] = 39,
+    [0x24] = 40,
+    [0x25] = 41,
+    [0x26] = 42,
+    [0x27] = 43,
+    [0x28] = 44,
+    [0x29] = 45,
+    [0x2A] = 46,
+    [0x2B] = 47,
+    [0x2C] = 48,
+    [0x2D] = 49,
+    [0x2E] = 50,
+    [0x2F] = 51,
+    [0x30] = 52,
+    [0x31] = 53,
+    [0x32] = 54,
+    [0x33] = 55,
+    [0x34] = 56,
+    [0x35] = 57,
+    [0x36] = 58,
+    [0x37] = 59,
+    [0x38] = 60,
+    [0x39] = 61,
+    [0x3A] = 62,
+    [0x3B] = 63,
+    [0x3C] = 64,
+    [0x3D] = 65,
+    [0x3E] = 66,
+    [0x3F] = 67,
+    [0x40] = 68,
+    [0x41] = 69,
+    [0x42] = 70,
+    [0x43] = 71,
+    [0x44] = 72,
+    [0x45] = 73,
+    [0x46] = 74,
+    [0x47] = 75,
+    [0x48] = 76,
+    [0x49] = 77,
+    [0x4A] = 78,
+    [0x4B] = 79,
+    [0x4C] = 80,
+    [0x4D] = 81,
+    [0x4E] = 82,
+    [0x4F] = 83,
+    [0x50] = 84,
+    [0x51] = 85,
+    [0x52] = 86,
+    [0x53] = 87,
+    [0x54] = 88,
+    [0x55] = 89,
+    [0x56] = 90,
+    [0x57] = 91,
+    [0x58] = 92,
+    [0x59] = 93,
+    [0x5A] = 94,
+    [0x5B] = 95,
+    [0x5C] = 96,
+    [0x5D] = 97,
+    [0x5E] = 98,
+    [0x5F] = 99,
+    [0x60] = 100,
+    [0x61] = 101,
+    [0x62] = 102,
+    [0x63] = 103,
+    [0x64] = 104,
+    [0x65] = 105,
+    [0x66] = 106,
+    [0x67] = 107,
+    [0x68] = 108,
+    [0x69] = 109,
+    [0x6A] = 110,
+    [0x6B] = 111,
+    [0x6C] = 112,
+    [0x6D] = 113,
+    [0x6E] = 114,
+    [0x6F] = 115,
+    [0x70] = 116,
+    [0x71] = 117,
+    [0x72] = 118,
+    [0x73] = 119,
+    [0x74] = 120,
+    [0x75] = 121,
+    [0x76] = 122,
+    [0x77] = 123,
+    [0x78] = 124,
+    [0x79] = 125,
+    [0x7A] = 126,
+    [0x7B] = 127,
+    [0x7C] = 128,
+    [0x7D] = 129,
+    [0x7E] = 130,
+    [0x7F] = 131,
+    [0x80] = 132,
+    [0x81] = 133,
+    [0x82] = 134,
+    [0x83] = 135,
+    [0x84] = 136,
+    [0x85] = 137,
+    [0x86] = 138,
+    [0x87] = 139,
+    [0x88] = 140,
+    [0x89] = 141,
+    [0x8A] = 142,
+    [0x8B] = 143,
+    [0x8C] = 144,
+    [0x8D] = 145,
+    [0x8E] = 146,
+    [0x8F] = 147,
+    [0x90] = 148,
+    [0x91] = 149,
+    [0x92] = 150,
+    [0x93] = 151,
+    [0x94] = 152,
+    [0x95] = 153,
+    [0x96] = 154,
+    [0x97] = 155,
+    [0x98] = 156,
+    [0x99] = 157,
+    [0x9A] = 158,
+    [0x9B] = 159,
+    [0x9C] = 160,
+    [0x9D] = 161,
+    [0x9E] = 162,
+    [0x9F] = 163,
+    [0xA0] = 164,
+    [0xA1] = 165,
+    [0xA2] = 166,
+    [0xA3] = 167,
+    [0xA4] = 168,
+    [0xA5] = 169,
+    [0xA6] = 170,
+    [0xA7] = 171,
+    [0xA8] = 172,
+    [0xA9] = 173,
+    [0xAA] = 174,
+    [0xAB] = 175,
+    [0xAC] = 176,
+    [0xAD] = 177,
+    [0xAE] = 178,
+    [0xAF] = 179,
+    [0xB0] = 180,
+    [0xB1] = 181,
+    [0xB2] = 182,
+    [0xB3] = 183,
+    [0xB4] = 184,
+    [0xB5] = 185,
+    [0xB6] = 186,
+    [0xB7] = 187,
+    [0xB8] = 188,
+    [0xB9] = 189,
+    [0xBA] = 190,
+    [0xBB] = 191,
+    [0xBC] = 192,
+    [0xBD] = 193,
+    [0xBE] = 194,
+    [0xBF] = 195,
+    [0xC0] = 196,
+    [0xC1] = 197,
+    [0xC2] = 198,
+    [0xC3] = 199,
+    [0xC4] = 200,
+    [0xC5] = 201,
+    [0xC6] = 202,
+    [0xC7] = 203,
+    [0xC8] = 204,
+    [0xC9] = 205,
+    [0xCA] = 206,
+    [0xCB] = 207,
+    [0xCC] = 208,
+    [0xCD] = 209,
+    [0xCE] = 210,
+    [0xCF] = 211,
+    [0xD0] = 212,
+    [0xD1] = 213,
+    [0xD2] = 214,
+    [0xD3] = 215,
+    [0xD4] = 216,
+    [0xD5] = 217,
+    [0xD6] = 218,
+};
+static const uint16_t *const addr_index[REG_PAGE] = {
+    [0x01] = addr_index_p01,
+    [0x05] = addr_index_p05,
+};
+
+// registers_list.csv Default 열 (config 파일이 없어도 이 값으로 시작)
+#define PORT_DEFAULTS { \
+    .por_rgbg_order             = 0x00, \
+    .por_dbv_h                  = 0x02, \
+    .por_dbv_l                  = 0x00, \
+    .por_fcon                   = 0x00, \
+}
+#define REG_DEFAULTS { \
+    .reg_ctc_lctc_en                = 0x01, \
+    .reg_ctc_actc_en                = 0x00, \
+    .reg_ctc_color_mode             = 0x00, \
+    .reg_ctc_dbv_gain_en            = 0x00, \
+    .reg_ctc_frq_gain_en            = 0x00, \
+    .reg_ctc_lctc_off_mask0         = 0x00, \
+    .reg_ctc_lctc_off_mask1         = 0x00, \
+    .reg_ctc_th_gray                = 0x20, \
+    .reg_ctc_th_delta_line_avg      = 0x30, \
+    .reg_ctc_th_sat                 = 0xFF, \
+    .reg_ctc_lut_end_itp            = 0x01, \
+    .reg_ctc_delt_pxlv_mode         = 0x00, \
+    .reg_ctc_delt_linev_mode        = 0x01, \
+    .reg_ctc_lctc_interval_no       = 0x04, \
+    .reg_ctc_diff_gray              = 0x0A, \
+    .reg_ctc_pxl_vol_coefi_r        = 0x80, \
+    .reg_ctc_pxl_vol_coefi_g        = 0x80, \
+    .reg_ctc_pxl_vol_coefi_b        = 0x80, \
+    .reg_ctc_line_vol_coefi_r       = 0x80, \
+    .reg_ctc_line_vol_coefi_g0      = 0x80, \
+    .reg_ctc_line_vol_coefi_b       = 0x80, \
+    .reg_ctc_line_vol_coefi_g1      = 0x80, \
+    .reg_ctc_gamma_gray_idx_x1      = 0x10, \
+    .reg_ctc_gamma_gray_idx_x2      = 0x20, \
+    .reg_ctc_gamma_gray_idx_x3      = 0x40, \
+    .reg_ctc_gamma_gray_idx_x4      = 0x60, \
+    .reg_ctc_gamma_gray_idx_x5      = 0x80, \
+    .reg_ctc_gamma_gray_idx_x6      = 0xA0, \
+    .reg_ctc_gamma_gray_idx_x7      = 0xE0, \
+    .reg_ctc_nor_vol_r_y1           = 0xE8, \
+    .reg_ctc_nor_vol_r_y2           = 0xD8, \
+    .reg_ctc_nor_vol_r_y3           = 0xD0, \
+    .reg_ctc_nor_vol_r_y4           = 0xB7, \
+    .reg_ctc_nor_vol_r_y5           = 0xB0, \
+    .reg_ctc_nor_vol_r_y6           = 0xA9, \
+    .reg_ctc_nor_vol_r_y7           = 0x9D, \
+    .reg_ctc_nor_vol_r_y8           = 0x97, \
+    .reg_ctc_nor_vol_g_y1           = 0xE8, \
+    .reg_ctc_nor_vol_g_y2           = 0xD8, \
+    .reg_ctc_nor_vol_g_y3           = 0xD0, \
+    .reg_ctc_nor_vol_g_y4           = 0xB7, \
+    .reg_ctc_nor_vol_g_y5           = 0xB0, \
+    .reg_ctc_nor_vol_g_y6           = 0xA9, \
+    .reg_ctc_nor_vol_g_y7           = 0x9D, \
+    .reg_ctc_nor_vol_g_y8           = 0x97, \
+    .reg_ctc_nor_vol_b_y1           = 0xE8, \
+    .reg_ctc_nor_vol_b_y2           = 0xD8, \
+    .reg_ctc_nor_vol_b_y3           = 0xD0, \
+    .reg_ctc_nor_vol_b_y4           = 0xB7, \
+    .reg_ctc_nor_vol_b_y5           = 0xB0, \
+    .reg_ctc_nor_vol_b_y6           = 0xA9, \
+    .reg_ctc_nor_vol_b_y7           = 0x9D, \
+    .reg_ctc_nor_vol_b_y8           = 0x97, \
+    .reg_ctc_pxl_gray_x0            = 0x3F, \
+    .reg_ctc_pxl_gray_x1            = 0x7F, \
+    .reg_ctc_pxl_gray_x2            = 0xBF, \
+    .reg_ctc_del_vol_idx_actb_y0    = 0x18, \
+    .reg_ctc_del_vol_idx_actb_y1    = 0x28, \
+    .reg_ctc_del_vol_idx_actb_y2    = 0x38, \
+    .reg_ctc_del_vol_idx_actb_y3    = 0x48, \
+    .reg_ctc_del_vol_idx_actb_y4    = 0x58, \
+    .reg_ctc_del_vol_idx_actb_y5    = 0x68, \
+    .reg_ctc_del_vol_idx_lctb_y0    = 0x18, \
+    .reg_ctc_del_vol_idx_lctb_y1    = 0x28, \
+    .reg_ctc_del_vol_idx_lctb_y2    = 0x38, \
+    .reg_ctc_del_vol_idx_lctb_y3    = 0x48, \
+    .reg_ctc_del_vol_idx_lctb_y4    = 0x58, \
+    .reg_ctc_del_vol_idx_lctb_y5    = 0x68, \
+    .reg_ctc_actc_lut_nega_00       = 0x0A, \
+    .reg_ctc_actc_lut_nega_01       = 0x0A, \
+    .reg_ctc_actc_lut_nega_02       = 0x0A, \
+    .reg_ctc_actc_lut_nega_03       = 0x0A, \
+    .reg_ctc_actc_lut_nega_10       = 0x0A, \
+    .reg_ctc_actc_lut_nega_11       = 0x0A, \
+    .reg_ctc_actc_lut_nega_12       = 0x0A, \
+    .reg_ctc_actc_lut_nega_13       = 0x0A, \
+    .reg_ctc_actc_lut_nega_20       = 0x0A, \
+    .reg_ctc_actc_lut_nega_21       = 0x0A, \
+    .reg_ctc_actc_lut_nega_22       = 0x0A, \
+    .reg_ctc_actc_lut_nega_23       = 0x0A, \
+    .reg_ctc_actc_lut_nega_30       = 0x0A, \
+    .reg_ctc_actc_lut_nega_31       = 0x0A, \
+    .reg_ctc_actc_lut_nega_32       = 0x0A, \
+    .reg_ctc_actc_lut_nega_33       = 0x0A, \
+    .reg_ctc_actc_lut_nega_40       = 0x0A, \
+    .reg_ctc_actc_lut_nega_41       = 0x0A, \
+    .reg_ctc_actc_lut_nega_42       = 0x0A, \
+    .reg_ctc_actc_lut_nega_43       = 0x0A, \
+    .reg_ctc_actc_lut_nega_50       = 0x0A, \
+    .reg_ctc_actc_lut_nega_51       = 0x0A, \
+    .reg_ctc_actc_lut_nega_52       = 0x0A, \
+    .reg_ctc_actc_lut_nega_53       = 0x0A, \
+    .reg_ctc_actc_lut_posi_00       = 0x0A, \
+    .reg_ctc_actc_lut_posi_01       = 0x0A, \
+    .reg_ctc_actc_lut_posi_02       = 0x0A, \
+    .reg_ctc_actc_lut_posi_03       = 0x0A, \
+    .reg_ctc_actc_lut_posi_10       = 0x0A, \
+    .reg_ctc_actc_lut_posi_11       = 0x0A, \
+    .reg_ctc_actc_lut_posi_12       = 0x0A, \
+    .reg_ctc_actc_lut_posi_13       = 0x0A, \
+    .reg_ctc_actc_lut_posi_20       = 0x0A, \
+    .reg_ctc_actc_lut_posi_21       = 0x0A, \
+    .reg_ctc_actc_lut_posi_22       = 0x0A, \
+    .reg_ctc_actc_lut_posi_23       = 0x0A, \
+    .reg_ctc_actc_lut_posi_30       = 0x0A, \
+    .reg_ctc_actc_lut_posi_31       = 0x0A, \
+    .reg_ctc_actc_lut_posi_32       = 0x0A, \
+    .reg_ctc_actc_lut_posi_33       = 0x0A, \
+    .reg_ctc_actc_lut_posi_40       = 0x0A, \
+    .reg_ctc_actc_lut_posi_41       = 0x0A, \
+    .reg_ctc_actc_lut_posi_42       = 0x0A, \
+    .reg_ctc_actc_lut_posi_43       = 0x0A, \
+    .reg_ctc_actc_lut_posi_50       = 0x0A, \
+    .reg_ctc_actc_lut_posi_51       = 0x0A, \
+    .reg_ctc_actc_lut_posi_52       = 0x0A, \
+    .reg_ctc_actc_lut_posi_53       = 0x0A, \
+    .reg_ctc_lctc_lut_nega_00       = 0x08, \
+    .reg_ctc_lctc_lut_nega_01       = 0x10, \
+    .reg_ctc_lctc_lut_nega_02       = 0x11, \
+    .reg_ctc_lctc_lut_nega_03       = 0x11, \
+    .reg_ctc_lctc_lut_nega_10       = 0x10, \
+    .reg_ctc_lctc_lut_nega_11       = 0x10, \
+    .reg_ctc_lctc_lut_nega_12       = 0x20, \
+    .reg_ctc_lctc_lut_nega_13       = 0x30, \
+    .reg_ctc_lctc_lut_nega_20       = 0x22, \
+    .reg_ctc_lctc_lut_nega_21       = 0x34, \
+    .reg_ctc_lctc_lut_nega_22       = 0x34, \
+    .reg_ctc_lctc_lut_nega_23       = 0x40, \
+    .reg_ctc_lctc_lut_nega_30       = 0x24, \
+    .reg_ctc_lctc_lut_nega_31       = 0x3C, \
+    .reg_ctc_lctc_lut_nega_32       = 0x44, \
+    .reg_ctc_lctc_lut_nega_33       = 0x44, \
+    .reg_ctc_lctc_lut_nega_40       = 0x30, \
+    .reg_ctc_lctc_lut_nega_41       = 0x3A, \
+    .reg_ctc_lctc_lut_nega_42       = 0x46, \
+    .reg_ctc_lctc_lut_nega_43       = 0x50, \
+    .reg_ctc_lctc_lut_nega_50       = 0x3E, \
+    .reg_ctc_lctc_lut_nega_51       = 0x50, \
+    .reg_ctc_lctc_lut_nega_52       = 0x50, \
+    .reg_ctc_lctc_lut_nega_53       = 0x54, \
+    .reg_ctc_lctc_lut_posi_00       = 0x08, \
+    .reg_ctc_lctc_lut_posi_01       = 0x10, \
+    .reg_ctc_lctc_lut_posi_02       = 0x12, \
+    .reg_ctc_lctc_lut_posi_03       = 0x12, \
+    .reg_ctc_lctc_lut_posi_10       = 0x10, \
+    .reg_ctc_lctc_lut_posi_11       = 0x19, \
+    .reg_ctc_lctc_lut_posi_12       = 0x1E, \
+    .reg_ctc_lctc_lut_posi_13       = 0x24, \
+    .reg_ctc_lctc_lut_posi_20       = 0x14, \
+    .reg_ctc_lctc_lut_posi_21       = 0x20, \
+    .reg_ctc_lctc_lut_posi_22       = 0x30, \
+    .reg_ctc_lctc_lut_posi_23       = 0x3C, \
+    .reg_ctc_lctc_lut_posi_30       = 0x26, \
+    .reg_ctc_lctc_lut_posi_31       = 0x30, \
+    .reg_ctc_lctc_lut_posi_32       = 0x34, \
+    .reg_ctc_lctc_lut_posi_33       = 0x42, \
+    .reg_ctc_lctc_lut_posi_40       = 0x28, \
+    .reg_ctc_lctc_lut_posi_41       = 0x30, \
+    .reg_ctc_lctc_lut_posi_42       = 0x44, \
+    .reg_ctc_lctc_lut_posi_43       = 0x46, \
+    .reg_ctc_lctc_lut_posi_50       = 0x32, \
+    .reg_ctc_lctc_lut_posi_51       = 0x40, \
+    .reg_ctc_lctc_lut_posi_52       = 0x50, \
+    .reg_ctc_lctc_lut_posi_53       = 0x5C, \
+    .reg_ctc_line_r_nega_gain0      = 0x7F, \
+    .reg_ctc_line_r_nega_gain1      = 0x7F, \
+    .reg_ctc_line_r_nega_gain2      = 0xFF, \
+    .reg_ctc_line_r_nega_gain3      = 0xFF, \
+    .reg_ctc_line_r_nega_gain4      = 0x80, \
+    .reg_ctc_line_r_nega_gain5      = 0x80, \
+    .reg_ctc_line_g_nega_gain0      = 0x7F, \
+    .reg_ctc_line_g_nega_gain1      = 0x7F, \
+    .reg_ctc_line_g_nega_gain2      = 0xFF, \
+    .reg_ctc_line_g_nega_gain3      = 0xFF, \
+    .reg_ctc_line_g_nega_gain4      = 0x80, \
+    .reg_ctc_line_g_nega_gain5      = 0x80, \
+    .reg_ctc_line_b_nega_gain0      = 0x7F, \
+    .reg_ctc_line_b_nega_gain1      = 0x7F, \
+    .reg_ctc_line_b_nega_gain2      = 0xFF, \
+    .reg_ctc_line_b_nega_gain3      = 0xFF, \
+    .reg_ctc_line_b_nega_gain4      = 0x80, \
+    .reg_ctc_line_b_nega_gain5      = 0x80, \
+    .reg_ctc_line_r_posi_gain0      = 0x7F, \
+    .reg_ctc_line_r_posi_gain1      = 0x7F, \
+    .reg_ctc_line_r_posi_gain2      = 0xFF, \
+    .reg_ctc_line_r_posi_gain3      = 0xFF, \
+    .reg_ctc_line_r_posi_gain4      = 0x80, \
+    .reg_ctc_line_r_posi_gain5      = 0x80, \
+    .reg_ctc_line_g_posi_gain0      = 0x7F, \
+    .reg_ctc_line_g_posi_gain1      = 0x7F, \
+    .reg_ctc_line_g_posi_gain2      = 0xFF, \
+    .reg_ctc_line_g_posi_gain3      = 0xFF, \
+    .reg_ctc_line_g_posi_gain4      = 0x80, \
+    .reg_ctc_line_g_posi_gain5      = 0x80, \
+    .reg_ctc_line_b_posi_gain0      = 0x7F, \
+    .reg_ctc_line_b_posi_gain1      = 0x7F, \
+    .reg_ctc_line_b_posi_gain2      = 0xFF, \
+    .reg_ctc_line_b_posi_gain3      = 0xFF, \
+    .reg_ctc_line_b_posi_gain4      = 0x80, \
+    .reg_ctc_line_b_posi_gain5      = 0x80, \
+    .reg_ctc_dbv_node_x0            = 0x1F, \
+    .reg_ctc_dbv_node_x1            = 0x3F, \
+    .reg_ctc_dbv_node_x2            = 0x7F, \
+    .reg_ctc_dbv_node_x3            = 0xDF, \
+    .reg_ctc_dbv_gain_y0            = 0x20, \
+    .reg_ctc_dbv_gain_y1            = 0x40, \
+    .reg_ctc_dbv_gain_y2            = 0x60, \
+    .reg_ctc_dbv_gain_y3            = 0x80, \
+    .reg_ctc_dbv_gain_y4            = 0xA0, \
+    .reg_ctc_freq_gain0             = 0x80, \
+    .reg_ctc_freq_gain1             = 0xA0, \
+    .reg_ctc_freq_gain2             = 0xC0, \
+    .reg_ctc_freq_gain3             = 0xD0, \
+    .reg_ctc_freq_gain4             = 0xE0, \
+}
+
+static const IpPorts_t port_defaults = PORT_DEFAULTS;
+static const RegFile_t reg_defaults = REG_DEFAULTS;
+
+#endif // CONFIG_TABLES_H
@@ -0,0 +1,134 @@
+// image_io_test --serve --socket 서버 클라이언트 (스크립트용)
+// 사용법: ctc_client [--socket 경로] [요청...]
+//   요청을 인자로 주면 각 인자를 한 줄 요청으로 보내고, 없으면 stdin의 줄을 그대로 보냄
+//   응답을 기다리지 않고 계속 보내며 (파이프라인) 받은 응답은 순서대로 stdout에 출력
+//   반환값: 0 모든 응답 ok, 1 error 응답 있음, 2 연결 실패
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "server.h"
+
+static int write_all(int fd, const char *data, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, data, len);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return -1;
+        }
+        data += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+// 응답 줄 출력 및 error 응답 여부 확인 ("<id> error ...")
+static int print_responses(char *buffer, size_t *length, int *errors) {
+    size_t start = 0;
+    char *nl;
+    while ((nl = (char *)memchr(buffer + start, '\n', *length - start)) != NULL) {
+        size_t end = (size_t)(nl - buffer);
+        const char *space = (const char *)memchr(buffer + start, ' ', end - start);
+        if (space && (size_t)(buffer + end - space) >= 6 && strncmp(space + 1, "error", 5) == 0) {
+            (*errors)++;
+        }
+        if (write_all(STDOUT_FILENO, buffer + start, end - start + 1) != 0) {
+            return -1;
+        }
+        start = end + 1;
+    }
+    memmove(buffer, buffer + start, *length - start);
+    *length -= start;
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    const char *path = SERVER_DEFAULT_SOCKET;
+    int first = 1;
+    if (argc >= 3 && strcmp(argv[1], "--socket") == 0) {
+        path = argv[2];
+        first = 3;
+    } else if (argc >= 2 && (strcmp(argv[1], "-h") == 0 || strcmp(argv[1], "--help") == 0)) {
+        printf("사용법: %s [--socket 경로] [요청...]\n", argv[0]);
+        printf("  요청 예: \"1 process in=a.bmp ppm10=out/a_10bit.ppm hash=raw10\"\n");
+        printf("  요청이 없으면 stdin에서 한 줄씩 읽어 보냄 (기본 소켓 %s)\n", SERVER_DEFAULT_SOCKET);
+        return 0;
+    }
+
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    snprintf(addr.sun_path, sizeof(addr.sun_path), "%s", path);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        fprintf(stderr, "서버에 연결할 수 없습니다: %s\n", path);
+        return 2;
+    }
+
+    // 인자 요청은 한 번에 보내고 송신 종료
+    int from_stdin = first >= argc;
+    if (!from_stdin) {
+        for (int i = first; i < argc; i++) {
+            if (write_all(fd, argv[i], strlen(argv[i])) != 0 || write_all(fd, "\n", 1) != 0) {
+                fprintf(stderr, "요청 전송 실패\n");
+                close(fd);
+                return 2;
+            }
+        }
+        shutdown(fd, SHUT_WR);
+    }
+
+    char in_buffer[65536];
+    char *out_buffer = (char *)malloc(1 << 20);
+    size_t out_length = 0;
+    int errors = 0;
+    int stdin_open = from_stdin;
+    int result = out_buffer ? 0 : 2;
+    while (result == 0) {
+        struct pollfd fds[2] = { { fd, POLLIN, 0 }, { STDIN_FILENO, POLLIN, 0 } };
+        if (poll(fds, stdin_open ? 2 : 1, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            result = 2;
+            break;
+        }
+        if (stdin_open && (fds[1].revents & (POLLIN | POLLHUP))) {
+            ssize_t n = read(STDIN_FILENO, in_buffer, sizeof(in_buffer));
+            if (n > 0) {
+                if (write_all(fd, in_buffer, (size_t)n) != 0) {
+                    result = 2;
+                }
+            } else if (n == 0 || errno != EINTR) {
+                stdin_open = 0;
+                shutdown(fd, SHUT_WR);
+            }
+        }
+        if (fds[0].revents & (POLLIN | POLLHUP | POLLERR)) {
+            ssize_t n = read(fd, out_buffer + out_length, (1 << 20) - out_length);
+            if (n <= 0) {
+                if (n < 0 && errno == EINTR) {
+                    continue;
+                }
+                break;
+            }
+            out_length += (size_t)n;
+            if (print_responses(out_buffer, &out_length, &errors) != 0) {
+                result = 2;
+            }
+        }
+    }
+    free(out_buffer);
+    close(fd);
+    if (result != 0) {
+        fprintf(stderr, "서버 통신 오류\n");
+        return result;
+    }
+    return errors ? 1 : 0;
+}
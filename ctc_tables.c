@@ -0,0 +1,256 @@
+#include <string.h>
+#include "config.h"
+#include "regmap.h"
+#include "ctc_tables.h"
+
+CtcTables ctc_tables;
+
+// ============================================================
+// 테이블별 의존 레지스터 범위
+// ============================================================
+// 각 테이블이 읽는 레지스터를 (page, 시작 addr, 끝 addr)로 나열
+// 다른 파생 값을 사용하는 테이블(라인 게인)은 그 입력 레지스터도 함께 나열
+
+typedef struct {
+    int page;
+    int first;
+    int last;
+} RegRange;
+
+#define PORT_PAGE 0x01
+#define CTC_PAGE 0x05
+#define MAX_RANGES 6
+
+typedef struct {
+    const char *name;
+    RegRange ranges[MAX_RANGES];
+    int range_count;
+    void (*build)(void);
+} CtcTableDesc;
+
+// ============================================================
+// 테이블 계산 함수
+// ============================================================
+// 임시 대체 공식 (ctc_tables.h 참고): 읽는 레지스터는 테이블 의존성 범위와 일치하지만
+// 구간 선택 / 게인 곱 / 보간 방식은 사양 확인 전 자리 표시
+
+static int clamp_int(int v, int lo, int hi) {
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+// DBV 상위 8비트를 dbv_node_x0..3과 비교하여 5개 구간 중 하나의 게인 선택
+static void build_dbv_gain(void) {
+    if (!reg_ctc_dbv_gain_en) {
+        ctc_tables.dbv_gain = CTC_GAIN_ONE;
+        return;
+    }
+    int dbv8 = ((ip_ports.por_dbv_h << 8) | ip_ports.por_dbv_l) >> 6;
+    const int nodes[4] = { reg_ctc_dbv_node_x0, reg_ctc_dbv_node_x1,
+                           reg_ctc_dbv_node_x2, reg_ctc_dbv_node_x3 };
+    int region = 0;
+    while (region < 4 && dbv8 >= nodes[region]) {
+        region++;
+    }
+    ctc_tables.dbv_gain = reg_value_at(CTC_PAGE, 0xCD + region); // dbv_gain_y0..4
+}
+
+// por_fcon으로 freq_gain0..4 중 하나 선택
+static void build_freq_gain(void) {
+    if (!reg_ctc_frq_gain_en) {
+        ctc_tables.freq_gain = CTC_GAIN_ONE;
+        return;
+    }
+    int sel = clamp_int(ip_ports.por_fcon, 0, 4);
+    ctc_tables.freq_gain = reg_value_at(CTC_PAGE, 0xD2 + sel); // freq_gain0..4
+}
+
+// 라인 게인 = line_{r,g,b}_{nega,posi}_gain{0..5} x DBV 게인 x 주파수 게인
+static void build_line_gain(void) {
+    int global = ctc_tables.dbv_gain * ctc_tables.freq_gain;
+    for (int sign = 0; sign < 2; sign++) {
+        for (int c = 0; c < 3; c++) {
+            for (int k = 0; k < 6; k++) {
+                int reg = reg_value_at(CTC_PAGE, 0xA5 + sign * 18 + c * 6 + k);
+                ctc_tables.line_gain[c][sign][k] =
+                    (reg * global + CTC_GAIN_ONE * CTC_GAIN_ONE / 2) / (CTC_GAIN_ONE * CTC_GAIN_ONE);
+            }
+        }
+    }
+}
+
+// 계조 -> 정규화 전압: (gamma_gray_idx_x1..x7, 255)의 8개 점을 nor_vol_y1..y8로 구간 선형 보간
+// x1 미만은 x1의 값으로 고정
+static void build_nor_vol(int channel) {
+    int xs[8];
+    int ys[8];
+    for (int k = 0; k < 7; k++) {
+        xs[k] = reg_value_at(CTC_PAGE, 0x17 + k);
+    }
+    xs[7] = 255;
+    for (int k = 0; k < 8; k++) {
+        ys[k] = reg_value_at(CTC_PAGE, 0x1E + channel * 8 + k);
+    }
+
+    uint16_t *lut = ctc_tables.nor_vol[channel];
+    int seg = 0;
+    for (int g = 0; g < 256; g++) {
+        while (seg < 7 && g > xs[seg]) {
+            seg++;
+        }
+        int v;
+        if (seg == 0 || g >= xs[seg]) {
+            v = ys[seg];
+        } else {
+            int x0 = xs[seg - 1], x1 = xs[seg];
+            int y0 = ys[seg - 1], y1 = ys[seg];
+            v = (x1 > x0) ? y0 + ((y1 - y0) * (g - x0)) / (x1 - x0) : y1;
+        }
+        lut[g] = (uint16_t)clamp_int(v, 0, 0xFFFF);
+    }
+}
+
+static void build_nor_vol_r(void) { build_nor_vol(0); }
+static void build_nor_vol_g(void) { build_nor_vol(1); }
+static void build_nor_vol_b(void) { build_nor_vol(2); }
+
+// 오름차순 경계값 배열로 0..255 -> 구간 번호 맵 생성
+static void build_bin_map(uint8_t *map, const int *bounds, int count) {
+    int bin = 0;
+    for (int v = 0; v < 256; v++) {
+        while (bin < count && v >= bounds[bin]) {
+            bin++;
+        }
+        map[v] = (uint8_t)bin;
+    }
+}
+
+static void build_pxl_gray_bin(void) {
+    const int bounds[3] = { reg_ctc_pxl_gray_x0, reg_ctc_pxl_gray_x1, reg_ctc_pxl_gray_x2 };
+    build_bin_map(ctc_tables.pxl_gray_bin, bounds, 3);
+}
+
+static void build_actc_bin(void) {
+    int bounds[6];
+    for (int k = 0; k < 6; k++) {
+        bounds[k] = reg_value_at(CTC_PAGE, 0x39 + k); // del_vol_idx_actb_y0..5
+    }
+    build_bin_map(ctc_tables.actc_bin, bounds, 6);
+}
+
+static void build_lctc_bin(void) {
+    int bounds[6];
+    for (int k = 0; k < 6; k++) {
+        bounds[k] = reg_value_at(CTC_PAGE, 0x3F + k); // del_vol_idx_lctb_y0..5
+    }
+    build_bin_map(ctc_tables.lctc_bin, bounds, 6);
+}
+
+// nega 6x4 다음에 posi 6x4가 연속으로 배치됨
+static void copy_lut(int16_t lut[2][6][4], int base) {
+    for (int sign = 0; sign < 2; sign++) {
+        for (int k = 0; k < 6; k++) {
+            for (int j = 0; j < 4; j++) {
+                lut[sign][k][j] = (int16_t)reg_value_at(CTC_PAGE, base + sign * 24 + k * 4 + j);
+            }
+        }
+    }
+}
+
+static void build_actc_lut(void) { copy_lut(ctc_tables.actc_lut, 0x45); }
+static void build_lctc_lut(void) { copy_lut(ctc_tables.lctc_lut, 0x75); }
+
+// ============================================================
+// 테이블 목록 (CtcTableId 순서, 계산도 이 순서로 수행)
+// ============================================================
+
+static const CtcTableDesc table_descs[CTC_TABLE_COUNT] = {
+    [CTC_TABLE_DBV_GAIN] = { "dbv_gain",
+        { { PORT_PAGE, 0x02, 0x03 }, { CTC_PAGE, 0x04, 0x04 }, { CTC_PAGE, 0xC9, 0xD1 } }, 3,
+        build_dbv_gain },
+    [CTC_TABLE_FREQ_GAIN] = { "freq_gain",
+        { { PORT_PAGE, 0x04, 0x04 }, { CTC_PAGE, 0x05, 0x05 }, { CTC_PAGE, 0xD2, 0xD6 } }, 3,
+        build_freq_gain },
+    [CTC_TABLE_LINE_GAIN] = { "line_gain",
+        { { CTC_PAGE, 0xA5, 0xC8 },
+          { PORT_PAGE, 0x02, 0x04 }, { CTC_PAGE, 0x04, 0x05 }, { CTC_PAGE, 0xC9, 0xD6 } }, 4,
+        build_line_gain },
+    [CTC_TABLE_NOR_VOL_R] = { "nor_vol_r",
+        { { CTC_PAGE, 0x17, 0x1D }, { CTC_PAGE, 0x1E, 0x25 } }, 2, build_nor_vol_r },
+    [CTC_TABLE_NOR_VOL_G] = { "nor_vol_g",
+        { { CTC_PAGE, 0x17, 0x1D }, { CTC_PAGE, 0x26, 0x2D } }, 2, build_nor_vol_g },
+    [CTC_TABLE_NOR_VOL_B] = { "nor_vol_b",
+        { { CTC_PAGE, 0x17, 0x1D }, { CTC_PAGE, 0x2E, 0x35 } }, 2, build_nor_vol_b },
+    [CTC_TABLE_PXL_GRAY_BIN] = { "pxl_gray_bin",
+        { { CTC_PAGE, 0x36, 0x38 } }, 1, build_pxl_gray_bin },
+    [CTC_TABLE_ACTC_BIN] = { "actc_bin",
+        { { CTC_PAGE, 0x39, 0x3E } }, 1, build_actc_bin },
+    [CTC_TABLE_LCTC_BIN] = { "lctc_bin",
+        { { CTC_PAGE, 0x3F, 0x44 } }, 1, build_lctc_bin },
+    [CTC_TABLE_ACTC_LUT] = { "actc_lut",
+        { { CTC_PAGE, 0x45, 0x74 } }, 1, build_actc_lut },
+    [CTC_TABLE_LCTC_LUT] = { "lctc_lut",
+        { { CTC_PAGE, 0x75, 0xA4 } }, 1, build_lctc_lut },
+};
+
+// ============================================================
+// 의존성 맵 / 무효화
+// ============================================================
+
+static uint32_t reg_dependents[REG_PAGE][PAGE_ADDR]; // 레지스터 -> 테이블 비트마스크
+static uint32_t dirty_mask;
+static unsigned rebuild_counts[CTC_TABLE_COUNT];
+
+// config 쓰기 콜백: 바뀐 레지스터를 읽는 테이블만 무효화
+static void on_register_write(int page, int addr) {
+    if (page >= 0 && page < REG_PAGE && addr >= 0 && addr < PAGE_ADDR) {
+        dirty_mask |= reg_dependents[page][addr];
+    }
+}
+
+void ctc_tables_init(void) {
+    memset(reg_dependents, 0, sizeof(reg_dependents));
+    for (int id = 0; id < CTC_TABLE_COUNT; id++) {
+        const CtcTableDesc *desc = &table_descs[id];
+        for (int r = 0; r < desc->range_count; r++) {
+            const RegRange *range = &desc->ranges[r];
+            for (int addr = range->first; addr <= range->last; addr++) {
+                reg_dependents[range->page][addr] |= 1u << id;
+            }
+        }
+    }
+    memset(rebuild_counts, 0, sizeof(rebuild_counts));
+    ctc_tables_invalidate_all();
+    config_set_write_hook(on_register_write);
+}
+
+void ctc_tables_invalidate_all(void) {
+    dirty_mask = (1u << CTC_TABLE_COUNT) - 1;
+}
+
+int ctc_tables_refresh(void) {
+    int rebuilt = 0;
+    for (int id = 0; id < CTC_TABLE_COUNT && dirty_mask; id++) {
+        if (dirty_mask & (1u << id)) {
+            table_descs[id].build();
+            dirty_mask &= ~(1u << id);
+            rebuild_counts[id]++;
+            rebuilt++;
+        }
+    }
+    return rebuilt;
+}
+
+uint32_t ctc_tables_dependents(int page, int addr) {
+    if (page < 0 || page >= REG_PAGE || addr < 0 || addr >= PAGE_ADDR) {
+        return 0;
+    }
+    return reg_dependents[page][addr];
+}
+
+const char *ctc_table_name(int id) {
+    return (id >= 0 && id < CTC_TABLE_COUNT) ? table_descs[id].name : "?";
+}
+
+unsigned ctc_table_rebuild_count(int id) {
+    return (id >= 0 && id < CTC_TABLE_COUNT) ? rebuild_counts[id] : 0;
+}
@@ -0,0 +1,67 @@
+#ifndef CTC_TABLES_H
+#define CTC_TABLES_H
+
+#include <stdint.h>
+
+// regfile/ip_ports에서 파생되는 테이블 종류
+// 레지스터가 바뀌면 해당 레지스터를 읽는 테이블만 무효화되고
+// ctc_tables_refresh()에서 무효화된 테이블만 다시 계산됨
+//
+// 주의: 테이블 계산 공식은 임시 대체 공식임 (registers_list.csv / 사양에 근거 없음)
+//   DBV 상위 8비트(dbv >> 6)로 노드 구간 선택, 라인 게인 = reg x DBV 게인 x 주파수 게인 / 128^2,
+//   정규화 전압 구간 선형 보간 등은 의존성 / 무효화 구조를 확인하기 위한 자리 표시
+// 현재 이미지 경로(RGBG 변환, PPM / RAW / BMP 출력)는 이 테이블을 읽지 않으며,
+// 실제 CTC 단계를 추가할 때 사양의 공식으로 교체해야 함 (의존 레지스터 범위와 무효화 동작만 확정)
+typedef enum {
+    CTC_TABLE_DBV_GAIN = 0,     // DBV 구간 게인 (dbv_node_x0..3, dbv_gain_y0..4, por_dbv)
+    CTC_TABLE_FREQ_GAIN,        // 주파수 게인 (freq_gain0..4, por_fcon)
+    CTC_TABLE_LINE_GAIN,        // 라인 게인 캐시 (line_*_gain x DBV 게인 x 주파수 게인)
+    CTC_TABLE_NOR_VOL_R,        // R 계조 -> 정규화 전압 LUT (gamma_gray_idx, nor_vol_r)
+    CTC_TABLE_NOR_VOL_G,        // G 계조 -> 정규화 전압 LUT
+    CTC_TABLE_NOR_VOL_B,        // B 계조 -> 정규화 전압 LUT
+    CTC_TABLE_PXL_GRAY_BIN,     // 계조 -> 픽셀 계조 구간 (pxl_gray_x0..2)
+    CTC_TABLE_ACTC_BIN,         // 전압차 -> ACTC 구간 (del_vol_idx_actb_y0..5)
+    CTC_TABLE_LCTC_BIN,         // 전압차 -> LCTC 구간 (del_vol_idx_lctb_y0..5)
+    CTC_TABLE_ACTC_LUT,         // ACTC 보정 LUT (actc_lut_nega/posi)
+    CTC_TABLE_LCTC_LUT,         // LCTC 보정 LUT (lctc_lut_nega/posi)
+    CTC_TABLE_COUNT
+} CtcTableId;
+
+#define CTC_GAIN_ONE 128        // 게인 1.0 (게인 비활성화 시 값)
+
+// 파생 테이블 (ctc_tables_refresh() 이후 유효, 값은 임시 공식 결과)
+typedef struct {
+    int dbv_gain;               // 현재 DBV 구간 게인
+    int freq_gain;              // 현재 por_fcon 주파수 게인
+    int line_gain[3][2][6];     // [R/G/B][nega/posi][구간], DBV/주파수 게인 적용
+    uint16_t nor_vol[3][256];   // [R/G/B][계조] 정규화 전압
+    uint8_t pxl_gray_bin[256];  // 계조 -> 0..3
+    uint8_t actc_bin[256];      // 전압차 -> 0..6
+    uint8_t lctc_bin[256];      // 전압차 -> 0..6
+    int16_t actc_lut[2][6][4];  // [nega/posi][구간][항목]
+    int16_t lctc_lut[2][6][4];
+} CtcTables;
+
+// 전역 파생 테이블
+extern CtcTables ctc_tables;
+
+// 레지스터 -> 테이블 의존성 맵 생성 및 config 쓰기 콜백 등록 (모든 테이블 무효화)
+void ctc_tables_init(void);
+
+// 무효화된 테이블만 다시 계산
+// 반환값: 다시 계산한 테이블 수
+int ctc_tables_refresh(void);
+
+// 모든 테이블 무효화 (regfile을 직접 수정한 경우)
+void ctc_tables_invalidate_all(void);
+
+// page/addr 레지스터를 읽는 테이블 비트마스크 (1 << CtcTableId)
+uint32_t ctc_tables_dependents(int page, int addr);
+
+// 테이블 이름
+const char *ctc_table_name(int id);
+
+// 테이블별 누적 재계산 횟수
+unsigned ctc_table_rebuild_count(int id);
+
+#endif // CTC_TABLES_H
@@ -0,0 +1,408 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <pthread.h>
+#include "config.h"
+#include "ctc_tables.h"
+#include "image_io.h"
+#include "sink.h"
+#include "pattern.h"
+#include "ctcmodel.h"
+
+struct CtcContext {
+    IpPorts_t ports;
+    RegFile_t regs;
+    unsigned generation;        // 레지스터 변경 시 증가
+    char error[256];
+};
+
+// 레지스터 함수(config.c)는 전역 ip_ports/regfile을 사용하므로
+// 레지스터 읽기/쓰기는 잠금 후 컨텍스트 값을 전역에 올려서 처리
+static pthread_mutex_t ctc_lock = PTHREAD_MUTEX_INITIALIZER;
+static const CtcContext *installed = NULL;
+static unsigned installed_generation = 0;
+static pthread_once_t ctc_tables_once = PTHREAD_ONCE_INIT;
+
+static void set_error(CtcContext *ctx, const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    vsnprintf(ctx->error, sizeof(ctx->error), format, args);
+    va_end(args);
+}
+
+// 잠금 상태에서 호출: 컨텍스트 레지스터를 전역에 적용
+static void install(const CtcContext *ctx) {
+    if (installed == ctx && installed_generation == ctx->generation) {
+        return;
+    }
+    ip_ports = ctx->ports;
+    regfile = ctx->regs;
+    ctc_tables_invalidate_all();
+    installed = ctx;
+    installed_generation = ctx->generation;
+}
+
+// 잠금 상태에서 호출: 전역 레지스터를 컨텍스트에 반영
+static void capture(CtcContext *ctx) {
+    ctx->ports = ip_ports;
+    ctx->regs = regfile;
+    ctx->generation++;
+    installed = ctx;
+    installed_generation = ctx->generation;
+}
+
+int ctc_api_version(void) {
+    return CTC_API_VERSION;
+}
+
+CtcContext *ctc_create(void) {
+    pthread_once(&ctc_tables_once, ctc_tables_init);
+    CtcContext *ctx = (CtcContext *)calloc(1, sizeof(CtcContext));
+    if (!ctx) {
+        return NULL;
+    }
+    // 현재 전역 값(라이브러리 단독 사용 시 registers_list.csv 기본값)에서 시작
+    pthread_mutex_lock(&ctc_lock);
+    ctx->ports = ip_ports;
+    ctx->regs = regfile;
+    pthread_mutex_unlock(&ctc_lock);
+    return ctx;
+}
+
+void ctc_destroy(CtcContext *ctx) {
+    if (!ctx) {
+        return;
+    }
+    pthread_mutex_lock(&ctc_lock);
+    if (installed == ctx) {
+        installed = NULL;
+    }
+    pthread_mutex_unlock(&ctc_lock);
+    free(ctx);
+}
+
+const char *ctc_last_error(const CtcContext *ctx) {
+    return ctx ? ctx->error : "컨텍스트가 없습니다";
+}
+
+int ctc_load_config(CtcContext *ctx, const char *path) {
+    if (!ctx || !path) {
+        return -1;
+    }
+    pthread_mutex_lock(&ctc_lock);
+    install(ctx);
+    int result = load_config(path);
+    capture(ctx);
+    pthread_mutex_unlock(&ctc_lock);
+    if (result != 0) {
+        set_error(ctx, "config 파일을 읽을 수 없습니다: %s", path);
+    }
+    return result;
+}
+
+int ctc_set_register(CtcContext *ctx, const char *name, int value) {
+    if (!ctx || !name) {
+        return -1;
+    }
+    pthread_mutex_lock(&ctc_lock);
+    install(ctx);
+    int result = reg_write_by_name(name, value);
+    capture(ctx);
+    pthread_mutex_unlock(&ctc_lock);
+    if (result != 0) {
+        set_error(ctx, "알 수 없는 레지스터: %s", name);
+    }
+    return result;
+}
+
+int ctc_get_register(CtcContext *ctx, const char *name, int *value) {
+    if (!ctx || !name || !value) {
+        return -1;
+    }
+    pthread_mutex_lock(&ctc_lock);
+    install(ctx);
+    int result = reg_read_by_name(name, value);
+    pthread_mutex_unlock(&ctc_lock);
+    if (result != 0) {
+        set_error(ctx, "알 수 없는 레지스터: %s", name);
+    }
+    return result;
+}
+
+// ============================================================
+// 버퍼
+// ============================================================
+
+static int check_buffer(CtcContext *ctx, const CtcBuffer *buffer, int channels, const char *what) {
+    if (!buffer || !buffer->data || buffer->width <= 0 || buffer->height <= 0) {
+        set_error(ctx, "%s 버퍼가 비어 있습니다", what);
+        return -1;
+    }
+    if (buffer->channels != channels) {
+        set_error(ctx, "%s 버퍼 채널 수는 %d이어야 합니다 (현재 %d)", what, channels, buffer->channels);
+        return -1;
+    }
+    if (buffer->bits != 8 && buffer->bits != 10 && buffer->bits != 12 && buffer->bits != 16) {
+        set_error(ctx, "%s 버퍼 비트 수는 8/10/12/16이어야 합니다 (현재 %d)", what, buffer->bits);
+        return -1;
+    }
+    return 0;
+}
+
+static inline size_t sample_bytes(const CtcBuffer *buffer) {
+    return buffer->bits == 8 ? 1 : sizeof(uint16_t);
+}
+
+static inline uint8_t *sample_at(const CtcBuffer *buffer, int x, int y, int c) {
+    return (uint8_t *)buffer->data + (ptrdiff_t)y * buffer->row_stride +
+           (ptrdiff_t)x * buffer->pixel_stride + (ptrdiff_t)c * buffer->channel_stride;
+}
+
+// 채널 c의 행 y를 연속 샘플로 (이미 연속이면 복사 없이 버퍼 위치 반환)
+static void *gather_channel(const CtcBuffer *buffer, int y, int c, void *scratch) {
+    size_t bytes = sample_bytes(buffer);
+    if (buffer->pixel_stride == (ptrdiff_t)bytes) {
+        return sample_at(buffer, 0, y, c);
+    }
+    for (int x = 0; x < buffer->width; x++) {
+        memcpy((uint8_t *)scratch + x * bytes, sample_at(buffer, x, y, c), bytes);
+    }
+    return scratch;
+}
+
+// 행 y의 샘플이 픽셀/채널 순서로 붙어 있으면 그 위치, 아니면 NULL
+static void *contiguous_row(const CtcBuffer *buffer, int y) {
+    size_t bytes = sample_bytes(buffer);
+    if (buffer->channel_stride == (ptrdiff_t)bytes &&
+        buffer->pixel_stride == (ptrdiff_t)(bytes * buffer->channels)) {
+        return sample_at(buffer, 0, y, 0);
+    }
+    return NULL;
+}
+
+int ctc_rgb_to_rgbg(CtcContext *ctx, const CtcBuffer *rgb, CtcBuffer *rgbg) {
+    if (!ctx) {
+        return -1;
+    }
+    if (check_buffer(ctx, rgb, 3, "RGB") != 0 || check_buffer(ctx, rgbg, 2, "RGBG") != 0) {
+        return -1;
+    }
+    if (rgb->width != rgbg->width || rgb->height != rgbg->height || rgb->bits != rgbg->bits) {
+        set_error(ctx, "RGB(%dx%d, %dbit)와 RGBG(%dx%d, %dbit) 버퍼 크기/비트 수가 다릅니다",
+                  rgb->width, rgb->height, rgb->bits, rgbg->width, rgbg->height, rgbg->bits);
+        return -1;
+    }
+    rgbg->x0 = rgb->x0;
+    rgbg->y0 = rgb->y0;
+
+    // 행 단위로 기존 변환 함수 실행 (연속 행은 호출자 메모리를 그대로 사용)
+    size_t bytes = sample_bytes(rgb);
+    uint8_t *scratch = (uint8_t *)malloc((size_t)rgb->width * bytes * 5);
+    if (!scratch) {
+        set_error(ctx, "행 버퍼 할당 실패");
+        return -1;
+    }
+    uint8_t *plane_scratch[3] = { scratch, scratch + rgb->width * bytes, scratch + rgb->width * bytes * 2 };
+    uint8_t *out_scratch = scratch + rgb->width * bytes * 3;
+
+    RGBArray row;
+    RGBGArray row_rgbg;
+    memset(&row, 0, sizeof(row));
+    memset(&row_rgbg, 0, sizeof(row_rgbg));
+    row.width = row_rgbg.width = rgb->width;
+    row.height = row_rgbg.height = 1;
+    row.depth = row_rgbg.depth = rgb->bits;
+    row.x0 = row_rgbg.x0 = rgb->x0;
+    row_rgbg.order = ctx->ports.por_rgbg_order & 1;
+
+    int result = 0;
+    for (int y = 0; y < rgb->height && result == 0; y++) {
+        void *planes[3];
+        for (int c = 0; c < 3; c++) {
+            planes[c] = gather_channel(rgb, y, c, plane_scratch[c]);
+        }
+        void *out = contiguous_row(rgbg, y);
+        void *dst = out ? out : out_scratch;
+        row.y0 = row_rgbg.y0 = rgb->y0 + y;
+        if (rgb->bits == 8) {
+            row.r = (uint8_t *)planes[0];
+            row.g = (uint8_t *)planes[1];
+            row.b = (uint8_t *)planes[2];
+            row_rgbg.data = (uint8_t *)dst;
+        } else {
+            row.r16 = (uint16_t *)planes[0];
+            row.g16 = (uint16_t *)planes[1];
+            row.b16 = (uint16_t *)planes[2];
+            row_rgbg.data16 = (uint16_t *)dst;
+        }
+        result = rgb_to_rgbg_rows(&row, &row_rgbg, 0, 1);
+        if (!out) {
+            for (int x = 0; x < rgbg->width; x++) {
+                for (int c = 0; c < 2; c++) {
+                    memcpy(sample_at(rgbg, x, y, c), out_scratch + ((size_t)x * 2 + c) * bytes, bytes);
+                }
+            }
+        }
+    }
+    free(scratch);
+    if (result != 0) {
+        set_error(ctx, "RGBG 변환 실패");
+    }
+    return result;
+}
+
+int ctc_encode(CtcContext *ctx, const CtcBuffer *rgbg, CtcFormat format,
+               void *out, size_t capacity, size_t *size) {
+    if (!ctx || !size) {
+        return -1;
+    }
+    *size = 0;
+    if (check_buffer(ctx, rgbg, 2, "RGBG") != 0) {
+        return -1;
+    }
+    if (format < CTC_FORMAT_PPM10 || format > CTC_FORMAT_RAW12) {
+        set_error(ctx, "알 수 없는 형식: %d", (int)format);
+        return -1;
+    }
+
+    // 저장 함수가 읽는 연속 배열 (호출자 버퍼가 연속이면 복사하지 않음)
+    RGBGArray array;
+    memset(&array, 0, sizeof(array));
+    array.width = rgbg->width;
+    array.height = rgbg->height;
+    array.depth = rgbg->bits;
+    array.order = ctx->ports.por_rgbg_order & 1;
+    array.x0 = rgbg->x0;
+    array.y0 = rgbg->y0;
+    size_t bytes = sample_bytes(rgbg);
+    size_t row_bytes = (size_t)rgbg->width * 2 * bytes;
+    void *copy = NULL;
+    if (contiguous_row(rgbg, 0) && rgbg->row_stride == (ptrdiff_t)row_bytes) {
+        if (bytes == 1) {
+            array.data = (uint8_t *)rgbg->data;
+        } else {
+            array.data16 = (uint16_t *)rgbg->data;
+        }
+    } else {
+        copy = malloc(row_bytes * rgbg->height);
+        if (!copy) {
+            set_error(ctx, "인코딩 버퍼 할당 실패");
+            return -1;
+        }
+        for (int y = 0; y < rgbg->height; y++) {
+            for (int x = 0; x < rgbg->width; x++) {
+                for (int c = 0; c < 2; c++) {
+                    memcpy((uint8_t *)copy + (size_t)y * row_bytes + ((size_t)x * 2 + c) * bytes,
+                           sample_at(rgbg, x, y, c), bytes);
+                }
+            }
+        }
+        if (bytes == 1) {
+            array.data = (uint8_t *)copy;
+        } else {
+            array.data16 = (uint16_t *)copy;
+        }
+    }
+
+    OutputSink sink;
+    sink_init_memory(&sink);
+    int bits = (format == CTC_FORMAT_PPM10 || format == CTC_FORMAT_RAW10) ? 10 : 12;
+    int result = (format == CTC_FORMAT_PPM10 || format == CTC_FORMAT_PPM12)
+                     ? write_rgbg_ppm(&sink, &array, bits)
+                     : write_rgbg_raw(&sink, &array, bits);
+    result |= sink_close(&sink);
+    free(copy);
+    if (result != 0) {
+        sink_free(&sink);
+        set_error(ctx, "인코딩 실패");
+        return -1;
+    }
+    *size = (size_t)sink.size;
+    if (!out || capacity < *size) {
+        sink_free(&sink);
+        set_error(ctx, "출력 버퍼 크기 부족: %zu / %zu bytes", capacity, *size);
+        return -1;
+    }
+    memcpy(out, sink.data, *size);
+    sink_free(&sink);
+    return 0;
+}
+
+int ctc_pattern(CtcContext *ctx, const char *spec, CtcBuffer *buffer) {
+    if (!ctx) {
+        return -1;
+    }
+    int channels = buffer ? buffer->channels : 0;
+    if (check_buffer(ctx, buffer, channels == 2 ? 2 : 3, "패턴") != 0) {
+        return -1;
+    }
+    PatternSpec pattern;
+    if (!spec || pattern_parse(spec, &pattern) != 0) {
+        set_error(ctx, "잘못된 패턴 지정: %s", spec ? spec : "(null)");
+        return -1;
+    }
+    if (pattern.width && (pattern.width != buffer->width || pattern.height != buffer->height)) {
+        set_error(ctx, "패턴 크기(%dx%d)와 버퍼 크기(%dx%d)가 다릅니다",
+                  pattern.width, pattern.height, buffer->width, buffer->height);
+        return -1;
+    }
+    pattern.width = buffer->width;
+    pattern.height = buffer->height;
+
+    // 연속 배열에 생성한 뒤 호출자 stride로 복사
+    size_t bytes = sample_bytes(buffer);
+    RGBArray rgb;
+    RGBGArray rgbg;
+    int result;
+    if (channels == 2) {
+        result = alloc_rgbg(&rgbg, buffer->width, buffer->height, buffer->bits);
+        if (result == 0) {
+            rgbg.order = ctx->ports.por_rgbg_order & 1;
+            rgbg.x0 = buffer->x0;
+            rgbg.y0 = buffer->y0;
+            result = pattern_fill_rgbg(&pattern, &rgbg);
+        }
+    } else {
+        result = pattern_generate_rgb(&pattern, buffer->bits, &rgb);
+        if (result == 0 && (buffer->x0 || buffer->y0)) {
+            rgb.x0 = buffer->x0;
+            rgb.y0 = buffer->y0;
+            result = pattern_fill_rgb(&pattern, &rgb);
+        }
+    }
+    if (result != 0) {
+        if (channels == 2) {
+            free_rgbg(&rgbg);
+        } else {
+            free_rgb(&rgb);
+        }
+        set_error(ctx, "패턴 생성 실패: %s", spec);
+        return -1;
+    }
+
+    for (int y = 0; y < buffer->height; y++) {
+        size_t row = (size_t)y * buffer->width;
+        for (int x = 0; x < buffer->width; x++) {
+            for (int c = 0; c < channels; c++) {
+                const void *src;
+                if (channels == 2) {
+                    src = bytes == 1 ? (const void *)&rgbg.data[(row + x) * 2 + c]
+                                     : (const void *)&rgbg.data16[(row + x) * 2 + c];
+                } else if (bytes == 1) {
+                    src = c == 0 ? &rgb.r[row + x] : c == 1 ? &rgb.g[row + x] : &rgb.b[row + x];
+                } else {
+                    src = c == 0 ? (const void *)&rgb.r16[row + x]
+                        : c == 1 ? (const void *)&rgb.g16[row + x] : (const void *)&rgb.b16[row + x];
+                }
+                memcpy(sample_at(buffer, x, y, c), src, bytes);
+            }
+        }
+    }
+    if (channels == 2) {
+        free_rgbg(&rgbg);
+    } else {
+        free_rgb(&rgb);
+    }
+    return 0;
+}
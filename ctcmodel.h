@@ -0,0 +1,90 @@
+#ifndef CTCMODEL_H
+#define CTCMODEL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// libctcmodel 공개 C API (make lib -> libctcmodel.so)
+// 호출자 버퍼(행/픽셀/채널 stride 지정)에서 바로 단계를 실행하므로 파일을 거치지 않고
+// NumPy 배열 등을 복사 없이 넘길 수 있음 (Python 래퍼: ctcmodel.py)
+//
+// 이 헤더의 구조체/함수 시그니처는 CTC_API_VERSION이 같은 동안 바뀌지 않음
+// 반환값 규칙: 0 성공, -1 실패 (실패 이유는 ctc_last_error)
+
+#define CTC_API_VERSION 1
+
+#if defined(_WIN32)
+#define CTC_API __declspec(dllexport)
+#else
+#define CTC_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 레지스터 상태를 가진 처리 컨텍스트
+// 컨텍스트마다 PORT/REG 값을 따로 가지며, 여러 스레드에서 호출하면 단계 실행은 순서대로 처리됨
+typedef struct CtcContext CtcContext;
+
+// 호출자 이미지 버퍼 (stride는 바이트 단위, 음수 가능)
+// 샘플 (x, y, c) 위치 = data + y * row_stride + x * pixel_stride + c * channel_stride
+//   NumPy (H, W, C) 배열: strides = (row_stride, pixel_stride, channel_stride)
+//   평면 (C, H, W) 배열: strides = (channel_stride, row_stride, pixel_stride)
+typedef struct {
+    void *data;
+    int width;
+    int height;
+    int channels;               // RGB 3, RGBG 2
+    int bits;                   // 8 (uint8_t 샘플), 10/12/16 (uint16_t 샘플)
+    ptrdiff_t row_stride;
+    ptrdiff_t pixel_stride;
+    ptrdiff_t channel_stride;
+    int x0;                     // 패널 기준 시작 위치 (ROI/타일, 전체 프레임은 0)
+    int y0;
+} CtcBuffer;
+
+// 메모리 인코딩 형식 (파일 저장 함수와 같은 바이트열)
+typedef enum {
+    CTC_FORMAT_PPM10 = 0,
+    CTC_FORMAT_PPM12,
+    CTC_FORMAT_RAW10,
+    CTC_FORMAT_RAW12
+} CtcFormat;
+
+CTC_API int ctc_api_version(void);
+
+// 컨텍스트 생성 (레지스터는 현재 전역 값, 라이브러리 단독 사용 시 registers_list.csv 기본값에서 시작하며 config는 ctc_load_config로 읽음)
+// 반환값: 컨텍스트, 실패 시 NULL
+CTC_API CtcContext *ctc_create(void);
+CTC_API void ctc_destroy(CtcContext *ctx);
+
+// 마지막 실패 이유 (없으면 빈 문자열)
+CTC_API const char *ctc_last_error(const CtcContext *ctx);
+
+// config 파일을 이 컨텍스트 레지스터에 적용
+CTC_API int ctc_load_config(CtcContext *ctx, const char *path);
+
+// 이름으로 PORT/REG 값 쓰기/읽기 (config.txt와 같은 이름, por_dbv는 14bit 통합 값)
+CTC_API int ctc_set_register(CtcContext *ctx, const char *name, int value);
+CTC_API int ctc_get_register(CtcContext *ctx, const char *name, int *value);
+
+// RGB (channels 3) -> RGBG 서브픽셀 (channels 2) 변환
+// 입력/출력 bits가 같아야 하며, 출력 (x0, y0)는 입력 값 사용
+CTC_API int ctc_rgb_to_rgbg(CtcContext *ctx, const CtcBuffer *rgb, CtcBuffer *rgbg);
+
+// RGBG 버퍼를 PPM/RAW 바이트열로 인코딩하여 out에 기록 (서브픽셀 순서는 컨텍스트의 por_rgbg_order)
+// *size에 필요한 크기를 기록하며, capacity가 부족하면 아무것도 쓰지 않고 -1 (out = NULL로 크기만 조회 가능)
+CTC_API int ctc_encode(CtcContext *ctx, const CtcBuffer *rgbg, CtcFormat format,
+                       void *out, size_t capacity, size_t *size);
+
+// 합성 테스트 패턴을 버퍼에 생성 (channels 3: RGB, channels 2: 컨텍스트 por_rgbg_order의 RGBG)
+// spec: "이름[,WxH][,키=값]..." (pattern.h, 크기를 생략하면 버퍼 크기, 지정하면 버퍼 크기와 같아야 함)
+// 레벨은 8bit 기준이며 버퍼 bits로 확장, 시작 위치 (x0, y0)는 버퍼 값 사용
+CTC_API int ctc_pattern(CtcContext *ctx, const char *spec, CtcBuffer *buffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // CTCMODEL_H
@@ -0,0 +1,192 @@
+"""libctcmodel.so ctypes 래퍼
+
+NumPy 배열(또는 쓰기 가능한 연속 버퍼)을 복사 없이 C 모델 단계에 넘긴다.
+
+    import numpy as np, ctcmodel
+    with ctcmodel.Context("config.txt") as ctx:
+        rgbg = ctx.rgb_to_rgbg(rgb)               # (H, W, 3) uint8 -> (H, W, 2)
+        ppm = ctx.encode(rgbg, "ppm10")           # 파일 저장 함수와 같은 바이트열
+        ctx.set("por_rgbg_order", 1)
+
+배열 형태: (H, W, C) 또는 평면 (C, H, W), uint8은 8bit, uint16은 bits= 로 비트 수 지정.
+라이브러리 경로: 환경 변수 CTCMODEL_LIB, 없으면 이 파일과 같은 디렉토리의 libctcmodel.so (make lib).
+"""
+
+import ctypes
+import os
+
+API_VERSION = 1
+FORMATS = {"ppm10": 0, "ppm12": 1, "raw10": 2, "raw12": 3}
+
+
+class CtcBuffer(ctypes.Structure):
+    _fields_ = [
+        ("data", ctypes.c_void_p),
+        ("width", ctypes.c_int),
+        ("height", ctypes.c_int),
+        ("channels", ctypes.c_int),
+        ("bits", ctypes.c_int),
+        ("row_stride", ctypes.c_ssize_t),
+        ("pixel_stride", ctypes.c_ssize_t),
+        ("channel_stride", ctypes.c_ssize_t),
+        ("x0", ctypes.c_int),
+        ("y0", ctypes.c_int),
+    ]
+
+
+class CtcError(RuntimeError):
+    pass
+
+
+_lib = None
+
+
+def load_library(path=None):
+    global _lib
+    default = path is None
+    if default and _lib is not None:
+        return _lib
+    if default:
+        path = os.environ.get("CTCMODEL_LIB") or os.path.join(
+            os.path.dirname(os.path.abspath(__file__)), "libctcmodel.so")
+    lib = ctypes.CDLL(path)
+    lib.ctc_api_version.restype = ctypes.c_int
+    lib.ctc_create.restype = ctypes.c_void_p
+    lib.ctc_destroy.argtypes = [ctypes.c_void_p]
+    lib.ctc_last_error.argtypes = [ctypes.c_void_p]
+    lib.ctc_last_error.restype = ctypes.c_char_p
+    lib.ctc_load_config.argtypes = [ctypes.c_void_p, ctypes.c_char_p]
+    lib.ctc_set_register.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.c_int]
+    lib.ctc_get_register.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.POINTER(ctypes.c_int)]
+    lib.ctc_rgb_to_rgbg.argtypes = [ctypes.c_void_p, ctypes.POINTER(CtcBuffer), ctypes.POINTER(CtcBuffer)]
+    lib.ctc_encode.argtypes = [ctypes.c_void_p, ctypes.POINTER(CtcBuffer), ctypes.c_int,
+                               ctypes.c_void_p, ctypes.c_size_t, ctypes.POINTER(ctypes.c_size_t)]
+    lib.ctc_pattern.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.POINTER(CtcBuffer)]
+    if lib.ctc_api_version() != API_VERSION:
+        raise CtcError("libctcmodel API 버전 불일치: %d (래퍼 %d)" % (lib.ctc_api_version(), API_VERSION))
+    if default:
+        _lib = lib
+    return lib
+
+
+def _array_info(obj):
+    """(주소, shape, strides, itemsize, 유지할 객체) - NumPy는 복사 없이, 그 외는 쓰기 가능한 연속 버퍼"""
+    interface = getattr(obj, "__array_interface__", None)
+    if interface is not None:
+        shape = tuple(interface["shape"])
+        itemsize = int(interface["typestr"][2:])
+        strides = interface.get("strides")
+        if strides is None:
+            strides, step = [], itemsize
+            for n in reversed(shape):
+                strides.insert(0, step)
+                step *= n
+        return interface["data"][0], shape, tuple(strides), itemsize, obj
+    view = memoryview(obj)
+    if not view.c_contiguous or view.readonly:
+        raise CtcError("NumPy가 아닌 버퍼는 쓰기 가능한 연속 버퍼여야 합니다")
+    holder = (ctypes.c_char * view.nbytes).from_buffer(view.cast("B"))
+    return ctypes.addressof(holder), tuple(view.shape), tuple(view.strides), view.itemsize, (view, holder)
+
+
+def _describe(obj, channels, bits, x0, y0):
+    address, shape, strides, itemsize, keep = _array_info(obj)
+    if len(shape) != 3:
+        raise CtcError("3차원 배열이 필요합니다: %s" % (shape,))
+    if shape[2] == channels:
+        height, width = shape[0], shape[1]
+        row, pixel, channel = strides
+    elif shape[0] == channels:
+        height, width = shape[1], shape[2]
+        channel, row, pixel = strides
+    else:
+        raise CtcError("채널 수 %d인 (H, W, C) / (C, H, W) 배열이 필요합니다: %s" % (channels, shape))
+    if bits is None:
+        if itemsize != 1:
+            raise CtcError("uint16 배열은 bits=10/12/16을 지정해야 합니다")
+        bits = 8
+    if (bits == 8) != (itemsize == 1) or itemsize not in (1, 2):
+        raise CtcError("bits=%d와 샘플 크기 %d바이트가 맞지 않습니다" % (bits, itemsize))
+    buf = CtcBuffer(address, width, height, channels, bits, row, pixel, channel, x0, y0)
+    return buf, keep
+
+
+def _empty_like_rgbg(height, width, itemsize):
+    try:
+        import numpy
+        return numpy.empty((height, width, 2), dtype=numpy.uint8 if itemsize == 1 else numpy.uint16)
+    except ImportError:
+        data = bytearray(height * width * 2 * itemsize)
+        return memoryview(data).cast("B" if itemsize == 1 else "H", shape=[height, width, 2])
+
+
+class Context:
+    def __init__(self, config=None, library=None):
+        self._lib = load_library(library)
+        self._ctx = self._lib.ctc_create()
+        if not self._ctx:
+            raise CtcError("컨텍스트 생성 실패")
+        if config is not None:
+            self.load_config(config)
+
+    def close(self):
+        if self._ctx:
+            self._lib.ctc_destroy(self._ctx)
+            self._ctx = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+    def __del__(self):
+        try:
+            self.close()
+        except Exception:
+            pass
+
+    def _check(self, result):
+        if result != 0:
+            raise CtcError(self._lib.ctc_last_error(self._ctx).decode("utf-8", "replace"))
+
+    def load_config(self, path):
+        self._check(self._lib.ctc_load_config(self._ctx, os.fsencode(path)))
+
+    def set(self, name, value):
+        self._check(self._lib.ctc_set_register(self._ctx, name.encode(), int(value)))
+
+    def get(self, name):
+        value = ctypes.c_int()
+        self._check(self._lib.ctc_get_register(self._ctx, name.encode(), ctypes.byref(value)))
+        return value.value
+
+    def rgb_to_rgbg(self, rgb, bits=None, x0=0, y0=0, out=None):
+        """RGB (H, W, 3) -> RGBG (H, W, 2), out을 주면 그 배열에 기록"""
+        src, keep_src = _describe(rgb, 3, bits, x0, y0)
+        if out is None:
+            out = _empty_like_rgbg(src.height, src.width, 1 if src.bits == 8 else 2)
+        dst, keep_dst = _describe(out, 2, src.bits if src.bits != 8 else None, x0, y0)
+        self._check(self._lib.ctc_rgb_to_rgbg(self._ctx, ctypes.byref(src), ctypes.byref(dst)))
+        del keep_src, keep_dst
+        return out
+
+    def encode(self, rgbg, fmt, bits=None, x0=0, y0=0):
+        """RGBG 배열을 PPM/RAW 바이트열로 ("ppm10", "ppm12", "raw10", "raw12")"""
+        src, keep = _describe(rgbg, 2, bits, x0, y0)
+        size = ctypes.c_size_t()
+        self._lib.ctc_encode(self._ctx, ctypes.byref(src), FORMATS[fmt], None, 0, ctypes.byref(size))
+        if size.value == 0:
+            self._check(-1)
+        out = ctypes.create_string_buffer(size.value)
+        self._check(self._lib.ctc_encode(self._ctx, ctypes.byref(src), FORMATS[fmt], out,
+                                         size.value, ctypes.byref(size)))
+        del keep
+        return out.raw[:size.value]
+
+    def pattern(self, spec, out, channels=3, bits=None, x0=0, y0=0):
+        """합성 테스트 패턴 ("bars", "window,size=25" 등)을 out에 생성 (channels 3: RGB, 2: RGBG)"""
+        dst, keep = _describe(out, channels, bits, x0, y0)
+        self._check(self._lib.ctc_pattern(self._ctx, spec.encode(), ctypes.byref(dst)))
+        del keep
+        return out
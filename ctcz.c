@@ -0,0 +1,561 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ctcz.h"
+#include "log.h"
+
+#define CTCZ_HEADER_SIZE 20
+#define CTCZ_VERSION 1
+#define CTCZ_FLAG_ODD_COL 0x01
+#define CTCZ_RUN_LONG 63        // 10111111: 뒤에 LEB128 추가 개수
+#define CTCZ_FLUSH_BYTES (64 * 1024)
+#define CTCZ_ROW_PREDICT 0      // 행 모드: 예측 잔차 토큰
+#define CTCZ_ROW_RAW 1          // 행 모드: 원본 샘플 (8bit: 1바이트, 그 외: LE16)
+#define CTCZ_RAW_RETRY 16
+
+// 압축할 평면 정보 (RGBG: 평면 1개, RGB: 평면 3개)
+typedef struct {
+    const uint8_t *p8[3];
+    const uint16_t *p16[3];
+    int planes;
+    size_t row_samples;
+    int height;
+    int left;               // 같은 색 왼쪽 이웃 거리 (샘플)
+    int up;                 // 같은 색 위쪽 이웃 거리 (행)
+    int bits;
+} CtczPlanes;
+
+typedef struct {
+    OutputSink *sink;
+    uint8_t *buf;
+    size_t len;
+    size_t cap;
+    uint64_t run;           // 아직 기록하지 않은 잔차 0 개수 (행 끝에서 기록)
+} CtczWriter;
+
+static void put_le32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v & 0xFF);
+    p[1] = (uint8_t)((v >> 8) & 0xFF);
+    p[2] = (uint8_t)((v >> 16) & 0xFF);
+    p[3] = (uint8_t)((v >> 24) & 0xFF);
+}
+
+static uint32_t get_le32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// MED 예측 (a: 왼쪽, b: 위, c: 왼쪽 위) - 평탄/가로/세로 경계에서 모두 잔차 0에 가까움
+static inline unsigned med_predict(unsigned a, unsigned b, unsigned c) {
+    unsigned hi = a > b ? a : b;
+    unsigned lo = a > b ? b : a;
+    if (c >= hi) {
+        return lo;
+    }
+    if (c <= lo) {
+        return hi;
+    }
+    return a + b - c;
+}
+
+// (샘플 - 예측) mod 2^bits -> 부호 있는 값 -> zigzag
+static inline unsigned to_residual(unsigned sample, unsigned pred, unsigned mask) {
+    unsigned d = (sample - pred) & mask;
+    int s = (d > (mask >> 1)) ? (int)d - (int)mask - 1 : (int)d;
+    return ((unsigned)s << 1) ^ (unsigned)(s >> 31);
+}
+
+static inline unsigned from_residual(unsigned r, unsigned pred, unsigned mask) {
+    int s = (int)(r >> 1) ^ -(int)(r & 1);
+    return (pred + (unsigned)s) & mask;
+}
+
+// ============================================================
+// 압축
+// ============================================================
+
+static void flush_run(CtczWriter *w) {
+    if (w->run == 0) {
+        return;
+    }
+    if (w->run <= CTCZ_RUN_LONG) {
+        w->buf[w->len++] = (uint8_t)(0x80 | (w->run - 1));
+    } else {
+        uint64_t extra = w->run - (CTCZ_RUN_LONG + 1);
+        w->buf[w->len++] = (uint8_t)(0x80 | CTCZ_RUN_LONG);
+        do {
+            uint8_t b = (uint8_t)(extra & 0x7F);
+            extra >>= 7;
+            w->buf[w->len++] = (uint8_t)(b | (extra ? 0x80 : 0));
+        } while (extra);
+    }
+    w->run = 0;
+}
+
+static inline void emit_residual(CtczWriter *w, unsigned r) {
+    if (r == 0) {
+        w->run++;
+        return;
+    }
+    flush_run(w);
+    if (r < 0x80) {
+        w->buf[w->len++] = (uint8_t)r;
+    } else if (r < (1u << 13)) {
+        w->buf[w->len++] = (uint8_t)(0xC0 | (r >> 8));
+        w->buf[w->len++] = (uint8_t)r;
+    } else {
+        w->buf[w->len++] = (uint8_t)(0xE0 | (r >> 16));
+        w->buf[w->len++] = (uint8_t)(r >> 8);
+        w->buf[w->len++] = (uint8_t)r;
+    }
+}
+
+static int flush_writer(CtczWriter *w) {
+    int result = w->len ? sink_write(w->sink, w->buf, w->len) : 0;
+    w->len = 0;
+    return result;
+}
+
+// 평면 행을 uint16 샘플로
+static void fetch_row(const CtczPlanes *pl, int plane, int y, uint16_t *dst) {
+    size_t base = (size_t)y * pl->row_samples;
+    if (pl->p16[plane]) {
+        memcpy(dst, pl->p16[plane] + base, pl->row_samples * sizeof(uint16_t));
+    } else {
+        const uint8_t *src = pl->p8[plane] + base;
+        for (size_t i = 0; i < pl->row_samples; i++) {
+            dst[i] = src[i];
+        }
+    }
+}
+
+static void encode_row(CtczWriter *w, const uint16_t *cur, const uint16_t *up, size_t n,
+                       size_t left, unsigned mask) {
+    size_t head = left < n ? left : n;
+    if (!up) {
+        for (size_t i = 0; i < head; i++) {
+            emit_residual(w, to_residual(cur[i], 0, mask));
+        }
+        for (size_t i = head; i < n; i++) {
+            emit_residual(w, to_residual(cur[i], cur[i - left], mask));
+        }
+        return;
+    }
+    for (size_t i = 0; i < head; i++) {
+        emit_residual(w, to_residual(cur[i], up[i], mask));
+    }
+    for (size_t i = head; i < n; i++) {
+        unsigned pred = med_predict(cur[i - left], up[i], up[i - left]);
+        emit_residual(w, to_residual(cur[i], pred, mask));
+    }
+}
+
+static int encode_planes(OutputSink *sink, const uint8_t header[CTCZ_HEADER_SIZE], const CtczPlanes *pl) {
+    if (sink_write(sink, header, CTCZ_HEADER_SIZE) != 0) {
+        log_error("CTCZ 헤더 쓰기 실패\n");
+        return -1;
+    }
+    CtczWriter w;
+    memset(&w, 0, sizeof(w));
+    w.sink = sink;
+    w.cap = CTCZ_FLUSH_BYTES + pl->row_samples * 3 + 16;
+    w.buf = (uint8_t *)malloc(w.cap);
+    uint16_t *rows = (uint16_t *)malloc(pl->row_samples * (size_t)(pl->up + 1) * sizeof(uint16_t));
+    if (!w.buf || !rows) {
+        log_error("CTCZ 버퍼 할당 실패\n");
+        free(w.buf);
+        free(rows);
+        return -1;
+    }
+
+    unsigned mask = (1u << pl->bits) - 1;
+    size_t raw_bytes = pl->row_samples * (pl->bits > 8 ? 2 : 1);
+    int raw_streak = 0;     // 연속으로 원본 저장한 행 수
+    int result = 0;
+    for (int plane = 0; plane < pl->planes && result == 0; plane++) {
+        for (int y = 0; y < pl->height && result == 0; y++) {
+            uint16_t *cur = rows + (size_t)(y % (pl->up + 1)) * pl->row_samples;
+            const uint16_t *up = (y >= pl->up)
+                ? rows + (size_t)((y - pl->up) % (pl->up + 1)) * pl->row_samples : NULL;
+            fetch_row(pl, plane, y, cur);
+            // 토큰이 원본 샘플보다 길어지는 행(잡음 등)은 원본으로 저장
+            // 원본 행이 이어지면 CTCZ_RAW_RETRY 행마다만 토큰을 다시 시도 (잡음 영역 압축 시간 절약)
+            size_t mark = w.len;
+            int try_tokens = raw_streak % CTCZ_RAW_RETRY == 0;
+            if (try_tokens) {
+                w.buf[w.len++] = CTCZ_ROW_PREDICT;
+                encode_row(&w, cur, up, pl->row_samples, (size_t)pl->left, mask);
+                flush_run(&w);
+            }
+            if (try_tokens && w.len - mark - 1 <= raw_bytes) {
+                raw_streak = 0;
+            } else {
+                raw_streak++;
+                w.len = mark;
+                w.buf[w.len++] = CTCZ_ROW_RAW;
+                for (size_t i = 0; i < pl->row_samples; i++) {
+                    w.buf[w.len++] = (uint8_t)cur[i];
+                    if (pl->bits > 8) {
+                        w.buf[w.len++] = (uint8_t)(cur[i] >> 8);
+                    }
+                }
+            }
+            if (w.len >= CTCZ_FLUSH_BYTES) {
+                result = flush_writer(&w);
+            }
+        }
+    }
+    if (result == 0) {
+        result = flush_writer(&w);
+    }
+    free(w.buf);
+    free(rows);
+    if (result != 0) {
+        log_error("CTCZ 데이터 쓰기 실패\n");
+    }
+    return result;
+}
+
+static void make_header(uint8_t header[CTCZ_HEADER_SIZE], int kind, int bits, int order, int flags,
+                        int width, int height) {
+    memset(header, 0, CTCZ_HEADER_SIZE);
+    memcpy(header, "CTCZ", 4);
+    header[4] = CTCZ_VERSION;
+    header[5] = (uint8_t)kind;
+    header[6] = (uint8_t)bits;
+    header[7] = (uint8_t)order;
+    header[8] = (uint8_t)flags;
+    put_le32(header + 12, (uint32_t)width);
+    put_le32(header + 16, (uint32_t)height);
+}
+
+int write_rgbg_ctcz(OutputSink *sink, const RGBGArray *rgbg) {
+    if (!rgbg || (!rgbg->data && !rgbg->data16)) {
+        log_error("유효하지 않은 RGBG 배열\n");
+        return -1;
+    }
+    uint8_t header[CTCZ_HEADER_SIZE];
+    make_header(header, CTCZ_KIND_RGBG, rgbg->depth, (rgbg->order + rgbg->y0) & 1,
+                (rgbg->x0 & 1) ? CTCZ_FLAG_ODD_COL : 0, rgbg->width, rgbg->height);
+
+    CtczPlanes pl;
+    memset(&pl, 0, sizeof(pl));
+    pl.p8[0] = rgbg->depth == 8 ? rgbg->data : NULL;
+    pl.p16[0] = rgbg->depth == 8 ? NULL : rgbg->data16;
+    pl.planes = 1;
+    pl.row_samples = (size_t)rgbg->width * 2;
+    pl.height = rgbg->height;
+    pl.left = 4;
+    pl.up = 2;
+    pl.bits = rgbg->depth;
+    return encode_planes(sink, header, &pl);
+}
+
+int write_rgb_ctcz(OutputSink *sink, const RGBArray *rgb) {
+    if (!rgb || (rgb->depth == 8 ? !rgb->r : !rgb->r16)) {
+        log_error("유효하지 않은 RGB 배열\n");
+        return -1;
+    }
+    uint8_t header[CTCZ_HEADER_SIZE];
+    make_header(header, CTCZ_KIND_RGB, rgb->depth, 0, 0, rgb->width, rgb->height);
+
+    CtczPlanes pl;
+    memset(&pl, 0, sizeof(pl));
+    if (rgb->depth == 8) {
+        pl.p8[0] = rgb->r;
+        pl.p8[1] = rgb->g;
+        pl.p8[2] = rgb->b;
+    } else {
+        pl.p16[0] = rgb->r16;
+        pl.p16[1] = rgb->g16;
+        pl.p16[2] = rgb->b16;
+    }
+    pl.planes = 3;
+    pl.row_samples = (size_t)rgb->width;
+    pl.height = rgb->height;
+    pl.left = 1;
+    pl.up = 1;
+    pl.bits = rgb->depth;
+    return encode_planes(sink, header, &pl);
+}
+
+static int save_ctcz(const char *filename, const RGBGArray *rgbg, const RGBArray *rgb) {
+    OutputSink sink;
+    if (make_parent_directory(filename) != 0 || sink_open_file(&sink, filename) != 0) {
+        return -1;
+    }
+    int result = rgbg ? write_rgbg_ctcz(&sink, rgbg) : write_rgb_ctcz(&sink, rgb);
+    uint64_t size = sink.size;
+    if (sink_close(&sink) != 0 || result != 0) {
+        return -1;
+    }
+    log_debug("CTCZ 파일 저장 완료: %s (%llu bytes)\n", filename, (unsigned long long)size);
+    return 0;
+}
+
+int save_rgbg_to_ctcz(const RGBGArray *rgbg, const char *filename) {
+    return save_ctcz(filename, rgbg, NULL);
+}
+
+int save_rgb_to_ctcz(const RGBArray *rgb, const char *filename) {
+    return save_ctcz(filename, NULL, rgb);
+}
+
+// ============================================================
+// 복원
+// ============================================================
+
+typedef struct {
+    const uint8_t *p;
+    const uint8_t *end;
+    uint64_t zeros;         // 남은 잔차 0 개수
+    int error;
+} CtczReader;
+
+static inline unsigned next_residual(CtczReader *r) {
+    if (r->zeros > 0) {
+        r->zeros--;
+        return 0;
+    }
+    if (r->p >= r->end) {
+        r->error = 1;
+        return 0;
+    }
+    unsigned b = *r->p++;
+    if (b < 0x80) {
+        return b;
+    }
+    if ((b & 0xC0) == 0x80) {
+        uint64_t n = (b & 0x3F) + 1;
+        if ((b & 0x3F) == CTCZ_RUN_LONG) {
+            uint64_t extra = 0;
+            int shift = 0;
+            unsigned c;
+            do {
+                if (r->p >= r->end || shift > 56) {
+                    r->error = 1;
+                    return 0;
+                }
+                c = *r->p++;
+                extra |= (uint64_t)(c & 0x7F) << shift;
+                shift += 7;
+            } while (c & 0x80);
+            n += extra;
+        }
+        r->zeros = n - 1;
+        return 0;
+    }
+    if ((b & 0xE0) == 0xC0) {
+        if (r->p >= r->end) {
+            r->error = 1;
+            return 0;
+        }
+        return ((b & 0x1F) << 8) | *r->p++;
+    }
+    if (r->end - r->p < 2) {
+        r->error = 1;
+        return 0;
+    }
+    unsigned v = ((b & 0x1F) << 16) | ((unsigned)r->p[0] << 8) | r->p[1];
+    r->p += 2;
+    return v;
+}
+
+static void decode_row(CtczReader *r, uint16_t *cur, const uint16_t *up, size_t n,
+                       size_t left, unsigned mask) {
+    size_t head = left < n ? left : n;
+    for (size_t i = 0; i < head; i++) {
+        cur[i] = (uint16_t)from_residual(next_residual(r), up ? up[i] : 0, mask);
+    }
+    if (!up) {
+        for (size_t i = head; i < n; i++) {
+            cur[i] = (uint16_t)from_residual(next_residual(r), cur[i - left], mask);
+        }
+        return;
+    }
+    for (size_t i = head; i < n; i++) {
+        unsigned pred = med_predict(cur[i - left], up[i], up[i - left]);
+        cur[i] = (uint16_t)from_residual(next_residual(r), pred, mask);
+    }
+}
+
+// 평면 복원 (출력 평면 포인터는 pl의 p8/p16, const를 벗겨서 씀)
+static int decode_planes(CtczReader *r, const CtczPlanes *pl) {
+    uint16_t *rows = (uint16_t *)malloc(pl->row_samples * (size_t)(pl->up + 1) * sizeof(uint16_t));
+    if (!rows) {
+        log_error("CTCZ 버퍼 할당 실패\n");
+        return -1;
+    }
+    unsigned mask = (1u << pl->bits) - 1;
+    size_t raw_bytes = pl->row_samples * (pl->bits > 8 ? 2 : 1);
+    for (int plane = 0; plane < pl->planes && !r->error; plane++) {
+        for (int y = 0; y < pl->height && !r->error; y++) {
+            uint16_t *cur = rows + (size_t)(y % (pl->up + 1)) * pl->row_samples;
+            const uint16_t *up = (y >= pl->up)
+                ? rows + (size_t)((y - pl->up) % (pl->up + 1)) * pl->row_samples : NULL;
+            int mode = (r->p < r->end) ? *r->p++ : -1;
+            if (mode == CTCZ_ROW_PREDICT) {
+                decode_row(r, cur, up, pl->row_samples, (size_t)pl->left, mask);
+                r->error |= r->zeros != 0;   // 0 개수는 행을 넘지 않음
+            } else if (mode == CTCZ_ROW_RAW && (size_t)(r->end - r->p) >= raw_bytes) {
+                for (size_t i = 0; i < pl->row_samples; i++) {
+                    cur[i] = (pl->bits > 8) ? (uint16_t)((r->p[2 * i] | (r->p[2 * i + 1] << 8)) & mask)
+                                            : r->p[i];
+                }
+                r->p += raw_bytes;
+            } else {
+                r->error = 1;
+                break;
+            }
+            size_t base = (size_t)y * pl->row_samples;
+            if (pl->p16[plane]) {
+                memcpy((uint16_t *)pl->p16[plane] + base, cur, pl->row_samples * sizeof(uint16_t));
+            } else {
+                uint8_t *dst = (uint8_t *)pl->p8[plane] + base;
+                for (size_t i = 0; i < pl->row_samples; i++) {
+                    dst[i] = (uint8_t)cur[i];
+                }
+            }
+        }
+    }
+    free(rows);
+    // 토큰이 남거나 모자라면 손상된 데이터
+    if (r->error || r->p != r->end) {
+        log_error("CTCZ 데이터 손상 (남은 바이트 %ld)\n", (long)(r->end - r->p));
+        return -1;
+    }
+    return 0;
+}
+
+int ctcz_decode(const uint8_t *data, size_t size, RGBGArray *rgbg, RGBArray *rgb) {
+    memset(rgbg, 0, sizeof(*rgbg));
+    memset(rgb, 0, sizeof(*rgb));
+    if (size < CTCZ_HEADER_SIZE || memcmp(data, "CTCZ", 4) != 0) {
+        log_error("CTCZ 데이터가 아닙니다\n");
+        return -1;
+    }
+    int kind = data[5];
+    int bits = data[6];
+    int width = (int)get_le32(data + 12);
+    int height = (int)get_le32(data + 16);
+    if (data[4] != CTCZ_VERSION || (kind != CTCZ_KIND_RGBG && kind != CTCZ_KIND_RGB) ||
+        (bits != 8 && bits != 10 && bits != 12 && bits != 16) || width <= 0 || height <= 0) {
+        log_error("지원하지 않는 CTCZ 헤더: version=%d, kind=%d, bits=%d, %d x %d\n",
+                  data[4], kind, bits, width, height);
+        return -1;
+    }
+
+    CtczReader r = { data + CTCZ_HEADER_SIZE, data + size, 0, 0 };
+    CtczPlanes pl;
+    memset(&pl, 0, sizeof(pl));
+    pl.height = height;
+    pl.bits = bits;
+    if (kind == CTCZ_KIND_RGBG) {
+        if (alloc_rgbg(rgbg, width, height, bits) != 0) {
+            return -1;
+        }
+        rgbg->order = data[7] & 1;
+        rgbg->x0 = (data[8] & CTCZ_FLAG_ODD_COL) ? 1 : 0; // 열 패리티만 보존됨
+        pl.p8[0] = rgbg->data;
+        pl.p16[0] = rgbg->data16;
+        pl.planes = 1;
+        pl.row_samples = (size_t)width * 2;
+        pl.left = 4;
+        pl.up = 2;
+        if (decode_planes(&r, &pl) != 0) {
+            free_rgbg(rgbg);
+            return -1;
+        }
+        return kind;
+    }
+
+    size_t n = (size_t)width * height;
+    rgb->width = width;
+    rgb->height = height;
+    rgb->depth = bits;
+    int ok;
+    if (bits == 8) {
+        rgb->r = (uint8_t *)malloc(n);
+        rgb->g = (uint8_t *)malloc(n);
+        rgb->b = (uint8_t *)malloc(n);
+        ok = rgb->r && rgb->g && rgb->b;
+        pl.p8[0] = rgb->r;
+        pl.p8[1] = rgb->g;
+        pl.p8[2] = rgb->b;
+    } else {
+        rgb->r16 = (uint16_t *)malloc(n * sizeof(uint16_t));
+        rgb->g16 = (uint16_t *)malloc(n * sizeof(uint16_t));
+        rgb->b16 = (uint16_t *)malloc(n * sizeof(uint16_t));
+        ok = rgb->r16 && rgb->g16 && rgb->b16;
+        pl.p16[0] = rgb->r16;
+        pl.p16[1] = rgb->g16;
+        pl.p16[2] = rgb->b16;
+    }
+    if (!ok) {
+        log_error("RGB 배열 메모리 할당 실패 (%d x %d)\n", width, height);
+        free_rgb(rgb);
+        return -1;
+    }
+    pl.planes = 3;
+    pl.row_samples = (size_t)width;
+    pl.left = 1;
+    pl.up = 1;
+    if (decode_planes(&r, &pl) != 0) {
+        free_rgb(rgb);
+        return -1;
+    }
+    return kind;
+}
+
+int read_ctcz(const char *filename, RGBGArray *rgbg, RGBArray *rgb) {
+    FILE *file = fopen(filename, "rb");
+    if (!file) {
+        log_error("파일을 열 수 없습니다: %s\n", filename);
+        return -1;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t *data = (uint8_t *)malloc(size > 0 ? (size_t)size : 1);
+    if (!data || size < 0 || fread(data, 1, (size_t)size, file) != (size_t)size) {
+        log_error("파일 읽기 실패: %s\n", filename);
+        free(data);
+        fclose(file);
+        return -1;
+    }
+    fclose(file);
+    int kind = ctcz_decode(data, (size_t)size, rgbg, rgb);
+    free(data);
+    if (kind < 0) {
+        log_error("CTCZ 파일 복원 실패: %s\n", filename);
+    }
+    return kind;
+}
+
+int convert_ctcz(const char *ctcz_filename, const char *out_filename, int bits) {
+    if (bits != 10 && bits != 12) {
+        log_error("지원하지 않는 PPM 비트 수: %d (10 또는 12)\n", bits);
+        return -1;
+    }
+    RGBGArray rgbg;
+    RGBArray rgb;
+    int kind = read_ctcz(ctcz_filename, &rgbg, &rgb);
+    if (kind < 0) {
+        return -1;
+    }
+    OutputSink sink;
+    int result = -1;
+    if (make_parent_directory(out_filename) == 0 && sink_open_file(&sink, out_filename) == 0) {
+        result = (kind == CTCZ_KIND_RGBG) ? write_rgbg_ppm(&sink, &rgbg, bits)
+                                          : write_rgb_bmp_8bit(&sink, &rgb);
+        if (sink_close(&sink) != 0) {
+            result = -1;
+        }
+    }
+    if (result == 0) {
+        log_debug("변환 완료: %s -> %s (%s)\n", ctcz_filename, out_filename,
+                  kind == CTCZ_KIND_RGBG ? (bits == 10 ? "10bit PPM" : "12bit PPM") : "8bit BMP");
+    }
+    free_rgbg(&rgbg);
+    free_rgb(&rgb);
+    return result;
+}
@@ -0,0 +1,54 @@
+#ifndef CTCZ_H
+#define CTCZ_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "image_io.h"
+#include "sink.h"
+
+// .ctcz 무손실 압축 형식 (미리보기 / 결과 보관용, 외부 라이브러리 없음)
+// RGBG 배열은 네이티브 서브픽셀(픽셀당 2샘플)을 저장하므로 PPM의 0 채널이 처음부터 없고,
+// 저장 깊이 그대로 보관하여 10/12bit PPM을 모두 같은 바이트로 다시 만들 수 있음
+//
+//   헤더(20바이트): "CTCZ", 버전, 종류(0 = RGBG, 1 = RGB), 비트 깊이, 서브픽셀 순서,
+//                   플래그(bit0 = 첫 열이 패널 홀수 열), 예약 3바이트, 너비, 높이 (LE32)
+//   데이터: 행마다 모드 바이트 + 행 데이터
+//     모드 0: 같은 색 이웃(왼쪽/위/왼쪽 위)으로 MED 예측한 잔차를 바이트 토큰으로 기록
+//     모드 1: 원본 샘플 (8bit: 1바이트, 그 외: LE16) - 토큰이 원본보다 길어지는 행 (잡음 등)
+//     0xxxxxxx             잔차 0~127 (zigzag)
+//     10xxxxxx             잔차 0이 x+1개 (x = 63이면 뒤에 LEB128로 추가 개수, 행을 넘지 않음)
+//     110xxxxx yyyyyyyy    잔차 13bit
+//     111xxxxx y z         잔차 21bit (16bit 샘플)
+//   RGBG: 행당 width * 2 샘플 한 평면, 같은 색 이웃은 왼쪽 4샘플 / 위 2행
+//   RGB : R, G, B 평면 순서, 같은 색 이웃은 왼쪽 1샘플 / 위 1행
+
+#define CTCZ_KIND_RGBG 0
+#define CTCZ_KIND_RGB  1
+
+// RGBG 배열을 .ctcz로 출력 (저장 깊이 그대로)
+// 반환값: 0 성공, -1 실패
+int write_rgbg_ctcz(OutputSink *sink, const RGBGArray *rgbg);
+
+// RGB 배열을 .ctcz로 출력 (저장 깊이 그대로)
+// 반환값: 0 성공, -1 실패
+int write_rgb_ctcz(OutputSink *sink, const RGBArray *rgb);
+
+// 파일 저장 (상위 디렉토리 생성)
+// 반환값: 0 성공, -1 실패
+int save_rgbg_to_ctcz(const RGBGArray *rgbg, const char *filename);
+int save_rgb_to_ctcz(const RGBArray *rgb, const char *filename);
+
+// 메모리의 .ctcz 데이터 복원 (종류에 따라 rgbg 또는 rgb 하나만 채움)
+// 반환값: 복원한 종류 (CTCZ_KIND_*), -1 실패 (형식 오류, 잘린 데이터)
+int ctcz_decode(const uint8_t *data, size_t size, RGBGArray *rgbg, RGBArray *rgb);
+
+// .ctcz 파일 읽기
+// 반환값: 복원한 종류 (CTCZ_KIND_*), -1 실패
+int read_ctcz(const char *filename, RGBGArray *rgbg, RGBArray *rgb);
+
+// .ctcz 파일을 원래 출력 형식으로 복원 (RGBG -> 10/12bit PPM, RGB -> 8bit BMP)
+// bits: RGBG PPM 비트 수 (10/12)
+// 반환값: 0 성공, -1 실패
+int convert_ctcz(const char *ctcz_filename, const char *out_filename, int bits);
+
+#endif // CTCZ_H
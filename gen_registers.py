@@ -2,55 +2,147 @@ import csv
 import sys
 import os
 
+HEADER = ("// ==========================================\n"
+          "// AUTO-GENERATED FILE by gen_registers.py\n"
+          "// DO NOT EDIT THIS FILE DIRECTLY.\n"
+          "// ==========================================\n")
+
+
+def field_type(width):
+    # Width 열 비트 수 -> 저장 타입
+    if width <= 8:
+        return "uint8_t"
+    if width <= 16:
+        return "uint16_t"
+    return "uint32_t"
+
+
 def generate_files(csv_filename):
     if not os.path.exists(csv_filename):
         print(f"Error: {csv_filename} not found.")
         sys.exit(1)
 
     registers = []
-    with open(csv_filename, 'r', encoding='utf-8') as f:
+    # registers_list.csv는 UTF-8 BOM으로 저장되어 있음
+    with open(csv_filename, 'r', encoding='utf-8-sig') as f:
         reader = csv.DictReader(f)
         for row in reader:
             # 빈 줄 무시
             if row['Name'].strip():
+                row = {k: (v or '').strip() for k, v in row.items()}
+                # Width 열이 비어 있으면 8bit
+                row['Width'] = int(row.get('Width') or 8)
+                if not 1 <= row['Width'] <= 32:
+                    print(f"Error: {row['Name']} Width {row['Width']} (1~32)")
+                    sys.exit(1)
+                default = int(row.get('Default') or '0', 0)
+                if default >= (1 << row['Width']):
+                    print(f"Error: {row['Name']} Default {row['Default']} exceeds {row['Width']} bits")
+                    sys.exit(1)
                 registers.append(row)
 
-    # 1. regmap.h 자동 생성 (기존 regmap.h 대체)
-    with open('regmap.h', 'w', encoding='utf-8') as f:
-        f.write("// ==========================================\n")
-        f.write("// AUTO-GENERATED FILE by gen_regs.py\n")
-        f.write("// DO NOT EDIT THIS FILE DIRECTLY.\n")
-        f.write("// ==========================================\n")
+    ports = [r for r in registers if r['Type'] == 'PORT']
+    regs = [r for r in registers if r['Type'] == 'REG']
+
+    # 1. regfile.h 자동 생성 (타입 있는 레지스터 파일 구조체)
+    with open('regfile.h', 'w', encoding='utf-8', newline='\r\n') as f:
+        f.write(HEADER)
+        f.write("#ifndef REGFILE_H\n#define REGFILE_H\n\n")
+        f.write("#include <stdint.h>\n\n")
+        f.write("// IP 내부 레지스터 파일 (registers_list.csv 순서, 필드 크기는 Width 열)\n")
+        f.write("// 이름 매크로(regmap.h)로 접근하며 page/addr 접근은 reg_read_by_addr / reg_value_at\n")
+        f.write("typedef struct {\n")
+        for reg in regs:
+            decl = f"    {field_type(reg['Width'])} {reg['Name']};"
+            comment = f"// {reg['Page']}:{reg['Address']} {reg['Width']}bit"
+            if reg['Description']:
+                comment += f" {reg['Description']}"
+            f.write(f"{decl:<46} {comment}\n")
+        f.write("} RegFile_t;\n\n")
+        f.write("extern RegFile_t regfile;\n\n")
+        f.write("#endif // REGFILE_H\n")
+
+    # 2. regmap.h 자동 생성 (레지스터 이름 -> regfile 필드 매크로)
+    with open('regmap.h', 'w', encoding='utf-8', newline='\r\n') as f:
+        f.write(HEADER)
         f.write("#ifndef _REGMAP_H_\n#define _REGMAP_H_\n\n")
-        
-        for reg in registers:
-            name = reg['Name'].strip()
-            page = reg['Page'].strip()
-            addr = reg['Address'].strip()
-            desc = reg.get('Description', '').strip()
-            f.write(f"#define {name:<30} regmap[{page}][{addr}]  // {desc}\n")
-            
+        f.write('#include "config.h"\n\n')
+
+        for reg in regs:
+            name = reg['Name']
+            line = f"#define {name:<34} regfile.{name}"
+            if reg['Description']:
+                line += f"  // {reg['Description']}"
+            f.write(line + "\n")
+
         f.write("\n#endif // _REGMAP_H_\n")
 
-    # 2. reg_table.h 자동 생성 (util_reg.c에서 사용될 파싱 테이블)
-    with open('reg_table.h', 'w', encoding='utf-8') as f:
-        f.write("// ==========================================\n")
-        f.write("// AUTO-GENERATED FILE by gen_regs.py\n")
-        f.write("// DO NOT EDIT THIS FILE DIRECTLY.\n")
-        f.write("// ==========================================\n")
-        f.write("#ifndef _REG_TABLE_H_\n#define _REG_TABLE_H_\n\n")
-        f.write('#include "regmap.h"\n\n')
-        f.write("typedef struct {\n    const char *name;\n    int *ptr;\n} ConfigMap;\n\n")
-        
-        f.write("static ConfigMap config_table[] = {\n")
-        for reg in registers:
-            name = reg['Name'].strip()
-            f.write(f'    {{"{name}", &{name}}},\n')
+    # 3. config_tables.h 자동 생성 (config.c에서 사용될 파싱 테이블 / 기본값)
+    with open('config_tables.h', 'w', encoding='utf-8', newline='\r\n') as f:
+        f.write(HEADER)
+        f.write("#ifndef CONFIG_TABLES_H\n#define CONFIG_TABLES_H\n\n")
+        f.write('#include "config.h"\n\n')
+        f.write("// 문자열과 변수 포인터를 매핑할 구조체\n")
+        f.write("// page/addr: registers_list.csv 위치 (파생 테이블 의존성 추적용)\n")
+        f.write("typedef struct {\n    const char *name;\n    void *ptr;\n"
+                "    uint8_t size;               // 필드 바이트 수 (1, 2, 4)\n"
+                "    uint8_t width;              // 비트 수 (Width 열, 쓰기 시 이 비트 수로 자름)\n"
+                "    uint8_t page;\n    uint8_t addr;\n} ConfigMap;\n\n")
+
+        f.write("// PORT 매핑 테이블\n")
+        f.write("static const ConfigMap port_table[] = {\n")
+        for reg in ports:
+            name = reg['Name']
+            f.write(f'    {{{(chr(34) + name + chr(34) + ","):<30} &ip_ports.{name + ",":<22} '
+                    f'sizeof(int), {reg["Width"]:>2}, {reg["Page"]}, {reg["Address"]}}},\n')
+        f.write("};\n")
+        f.write("static const int port_table_size = sizeof(port_table) / sizeof(port_table[0]);\n\n")
+
+        f.write("// REG 매핑 테이블 (regfile 필드와 직접 매핑)\n")
+        f.write("static const ConfigMap reg_table[] = {\n")
+        for reg in regs:
+            name = reg['Name']
+            size = {"uint8_t": 1, "uint16_t": 2, "uint32_t": 4}[field_type(reg['Width'])]
+            f.write(f'    {{{(chr(34) + name + chr(34) + ","):<30} &regfile.{name + ",":<30} '
+                    f'{size}, {reg["Width"]:>2}, {reg["Page"]}, {reg["Address"]}}},\n')
+        f.write("};\n")
+        f.write("static const int reg_table_size = sizeof(reg_table) / sizeof(reg_table[0]);\n\n")
+
+        # page/addr -> 항목 번호 (reg_read_by_addr를 검색 없이 처리)
+        pages = {}
+        for index, reg in enumerate(ports + regs):
+            page = int(reg['Page'], 0)
+            addr = int(reg['Address'], 0)
+            if addr in pages.get(page, {}):
+                print(f"Error: {reg['Name']} duplicates address {reg['Page']}:{reg['Address']}")
+                sys.exit(1)
+            pages.setdefault(page, {})[addr] = index + 1
+        f.write("// page/addr -> 항목 번호 + 1 (0: 없음, port_table 다음에 reg_table 순서)\n")
+        for page in sorted(pages):
+            f.write(f"static const uint16_t addr_index_p{page:02X}[PAGE_ADDR] = {{\n")
+            for addr in sorted(pages[page]):
+                f.write(f"    [0x{addr:02X}] = {pages[page][addr]},\n")
+            f.write("};\n")
+        f.write("static const uint16_t *const addr_index[REG_PAGE] = {\n")
+        for page in sorted(pages):
+            f.write(f"    [0x{page:02X}] = addr_index_p{page:02X},\n")
         f.write("};\n\n")
-        f.write("static const int config_table_size = sizeof(config_table) / sizeof(config_table[0]);\n\n")
-        f.write("#endif // _REG_TABLE_H_\n")
 
-    print("Successfully generated 'regmap.h' and 'reg_table.h'.")
+        # Default 열 -> 초기값 (전역 변수 정적 초기화와 config_load_defaults에서 사용)
+        f.write("// registers_list.csv Default 열 (config 파일이 없어도 이 값으로 시작)\n")
+        f.write("#define PORT_DEFAULTS { \\\n")
+        for reg in ports:
+            f.write(f"    .{reg['Name']:<26} = {reg['Default'] or '0'}, \\\n")
+        f.write("}\n")
+        f.write("#define REG_DEFAULTS { \\\n")
+        for reg in regs:
+            f.write(f"    .{reg['Name']:<30} = {reg['Default'] or '0'}, \\\n")
+        f.write("}\n\n")
+        f.write("static const IpPorts_t port_defaults = PORT_DEFAULTS;\n")
+        f.write("static const RegFile_t reg_defaults = REG_DEFAULTS;\n\n")
+        f.write("#endif // CONFIG_TABLES_H\n")
+
+    print("Successfully generated 'regfile.h', 'regmap.h' and 'config_tables.h'.")
 
 if __name__ == "__main__":
-    generate_files('registers.csv')
\ No newline at end of file
+    generate_files('registers_list.csv')
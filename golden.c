@@ -0,0 +1,288 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "image_io.h"
+#include "sink.h"
+#include "golden.h"
+#include "log.h"
+
+#define GOLDEN_OUT_DIR "test_out/golden"
+
+// ============================================================
+// 매니페스트
+// ============================================================
+
+int golden_load(const char *path, GoldenDb *db) {
+    memset(db, 0, sizeof(*db));
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        return 0; // 새 매니페스트
+    }
+
+    char line[512];
+    int line_no = 0;
+    while (fgets(line, sizeof(line), file)) {
+        line_no++;
+        if (line[0] == '#' || line[0] == '\n' || line[0] == '\r') {
+            continue;
+        }
+        char name[256];
+        unsigned long long hash, size;
+        if (sscanf(line, "%255s %llx %llu", name, &hash, &size) != 3) {
+            log_error("매니페스트 형식 오류: %s:%d\n", path, line_no);
+            fclose(file);
+            golden_free(db);
+            return -1;
+        }
+        if (golden_set(db, name, hash, size) != 0) {
+            fclose(file);
+            golden_free(db);
+            return -1;
+        }
+    }
+    fclose(file);
+    return 0;
+}
+
+static int compare_entry_name(const void *a, const void *b) {
+    return strcmp(((const GoldenEntry *)a)->name, ((const GoldenEntry *)b)->name);
+}
+
+int golden_save(const char *path, GoldenDb *db) {
+    FILE *file = fopen(path, "w");
+    if (!file) {
+        log_error("매니페스트를 저장할 수 없습니다: %s\n", path);
+        return -1;
+    }
+    qsort(db->entries, (size_t)db->count, sizeof(GoldenEntry), compare_entry_name);
+    fprintf(file, "# <출력 이름> <해시> <크기>\n");
+    for (int i = 0; i < db->count; i++) {
+        fprintf(file, "%s %016llx %llu\n", db->entries[i].name,
+                (unsigned long long)db->entries[i].hash, (unsigned long long)db->entries[i].size);
+    }
+    if (fclose(file) != 0) {
+        log_error("매니페스트 쓰기 실패: %s\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+GoldenEntry *golden_find(GoldenDb *db, const char *name) {
+    for (int i = 0; i < db->count; i++) {
+        if (strcmp(db->entries[i].name, name) == 0) {
+            return &db->entries[i];
+        }
+    }
+    return NULL;
+}
+
+int golden_set(GoldenDb *db, const char *name, uint64_t hash, uint64_t size) {
+    GoldenEntry *entry = golden_find(db, name);
+    if (!entry) {
+        if (db->count == db->capacity) {
+            int capacity = db->capacity ? db->capacity * 2 : 64;
+            GoldenEntry *grown = (GoldenEntry *)realloc(db->entries, (size_t)capacity * sizeof(GoldenEntry));
+            if (!grown) {
+                log_error("매니페스트 메모리 할당 실패\n");
+                return -1;
+            }
+            db->entries = grown;
+            db->capacity = capacity;
+        }
+        entry = &db->entries[db->count++];
+        snprintf(entry->name, sizeof(entry->name), "%s", name);
+    }
+    entry->hash = hash;
+    entry->size = size;
+    return 0;
+}
+
+void golden_free(GoldenDb *db) {
+    free(db->entries);
+    memset(db, 0, sizeof(*db));
+}
+
+// ============================================================
+// 출력 비교
+// ============================================================
+
+typedef enum {
+    GOLDEN_PPM = 0,
+    GOLDEN_RAW,
+    GOLDEN_BMP8
+} GoldenOutputKind;
+
+// 입력 한 장에서 비교하는 출력 (일반 실행/--save-raw와 같은 이름)
+typedef struct {
+    const char *suffix;
+    GoldenOutputKind kind;
+    int bits;
+} GoldenOutput;
+
+static const GoldenOutput golden_outputs[] = {
+    { "_10bit.ppm",  GOLDEN_PPM,  10 },
+    { "_12bit.ppm",  GOLDEN_PPM,  12 },
+    { "_raw10.raw",  GOLDEN_RAW,  10 },
+    { "_raw12.raw",  GOLDEN_RAW,  12 },
+    { "_8bit.bmp",   GOLDEN_BMP8, 8 },
+};
+
+typedef struct {
+    int outputs;
+    int matched;
+    int mismatched;
+    int added;
+    int missing;
+} GoldenStats;
+
+static int emit_output(const GoldenOutput *out, RGBArray *rgb, RGBGArray *rgbg, OutputSink *sink) {
+    switch (out->kind) {
+    case GOLDEN_PPM:
+        return write_rgbg_ppm(sink, rgbg, out->bits);
+    case GOLDEN_RAW:
+        return write_rgbg_raw(sink, rgbg, out->bits);
+    case GOLDEN_BMP8:
+        return write_rgb_bmp_8bit(sink, rgb);
+    }
+    return -1;
+}
+
+// 불일치한 출력을 확인용 파일로 저장
+static void save_mismatch(const GoldenOutput *out, RGBArray *rgb, RGBGArray *rgbg, const char *name) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s", GOLDEN_OUT_DIR, name);
+    OutputSink sink;
+    if (make_parent_directory(path) != 0 || sink_open_file(&sink, path) != 0) {
+        return;
+    }
+    int result = emit_output(out, rgb, rgbg, &sink);
+    if (sink_close(&sink) == 0 && result == 0) {
+        log_info("    -> %s\n", path);
+    }
+}
+
+// 입력 파일 이름에서 경로와 확장자 제거
+static void output_base_name(const char *filename, int depth, char *out, size_t out_size) {
+    const char *base = strrchr(filename, '/');
+    base = base ? base + 1 : filename;
+    snprintf(out, out_size, "%s", base);
+    char *dot = strrchr(out, '.');
+    if (dot) {
+        *dot = '\0';
+    }
+    if (depth != 8) {
+        size_t len = strlen(out);
+        snprintf(out + len, out_size - len, "_d%d", depth);
+    }
+}
+
+static int check_image(GoldenDb *db, const char *filename, int depth, int update, GoldenStats *stats) {
+    RGBArray rgb;
+    RGBGArray rgbg;
+    if (read_bmp_depth(filename, &rgb, depth) != 0) {
+        return -1;
+    }
+    if (rgb_to_rgbg(&rgb, &rgbg) != 0) {
+        free_rgb(&rgb);
+        return -1;
+    }
+
+    char base[256];
+    output_base_name(filename, depth, base, sizeof(base));
+
+    int result = 0;
+    int count = (int)(sizeof(golden_outputs) / sizeof(golden_outputs[0]));
+    for (int i = 0; i < count && result == 0; i++) {
+        const GoldenOutput *out = &golden_outputs[i];
+        char name[300];
+        snprintf(name, sizeof(name), "%s%s", base, out->suffix);
+
+        OutputSink sink;
+        if (sink_init_hash(&sink) != 0) {
+            result = -1;
+            break;
+        }
+        if (emit_output(out, &rgb, &rgbg, &sink) != 0 || sink_close(&sink) != 0) {
+            sink_free(&sink);
+            result = -1;
+            break;
+        }
+        uint64_t hash = sink_hash(&sink);
+        uint64_t size = sink.size;
+        sink_free(&sink);
+        stats->outputs++;
+
+        GoldenEntry *entry = golden_find(db, name);
+        if (entry && entry->hash == hash && entry->size == size) {
+            stats->matched++;
+        } else if (update) {
+            log_info("  %s %s: %016llx (%llu bytes)\n", entry ? "갱신" : "추가", name,
+                     (unsigned long long)hash, (unsigned long long)size);
+            result = golden_set(db, name, hash, size);
+            stats->added++;
+        } else if (!entry) {
+            log_info("  항목 없음 %s: %016llx (%llu bytes, --update로 추가)\n", name,
+                     (unsigned long long)hash, (unsigned long long)size);
+            stats->missing++;
+        } else {
+            log_info("  불일치 %s: 기대 %016llx (%llu bytes), 결과 %016llx (%llu bytes)\n", name,
+                     (unsigned long long)entry->hash, (unsigned long long)entry->size,
+                     (unsigned long long)hash, (unsigned long long)size);
+            save_mismatch(out, &rgb, &rgbg, name);
+            stats->mismatched++;
+        }
+    }
+
+    free_rgb(&rgb);
+    free_rgbg(&rgbg);
+    return result;
+}
+
+int golden_main(int argc, char *argv[]) {
+    if (argc < 4) {
+        log_info("사용법: %s --golden <매니페스트> [--update] [--depth D] <BMP>...\n", argv[0]);
+        log_info("  각 BMP의 10/12bit PPM, RAW10/12, 8bit BMP 출력을 파일로 쓰지 않고 해시로 비교\n");
+        log_info("  불일치한 출력만 %s/에 저장\n", GOLDEN_OUT_DIR);
+        log_info("  --update   없는 항목/다른 항목을 현재 결과로 기록\n");
+        log_info("  --depth D  내부 비트 깊이 (8/10/12/16, 기본 8)\n");
+        return 1;
+    }
+
+    const char *db_path = argv[2];
+    int update = 0;
+    int depth = 8;
+    GoldenDb db;
+    if (golden_load(db_path, &db) != 0) {
+        return 1;
+    }
+
+    GoldenStats stats;
+    memset(&stats, 0, sizeof(stats));
+    int failed = 0;
+    for (int i = 3; i < argc; i++) {
+        if (strcmp(argv[i], "--update") == 0) {
+            update = 1;
+        } else if (strcmp(argv[i], "--depth") == 0 && i + 1 < argc) {
+            depth = atoi(argv[++i]);
+        } else {
+            log_info("%s\n", argv[i]);
+            if (check_image(&db, argv[i], depth, update, &stats) != 0) {
+                log_error("  오류: 처리 실패\n");
+                failed++;
+            }
+        }
+    }
+
+    log_info("\n골든 비교: 출력 %d개, 일치 %d, 불일치 %d, 항목 없음 %d",
+             stats.outputs, stats.matched, stats.mismatched, stats.missing);
+    if (update) {
+        log_info(", 기록 %d", stats.added);
+    }
+    log_info("\n");
+
+    if (update && stats.added > 0 && golden_save(db_path, &db) != 0) {
+        failed++;
+    }
+    golden_free(&db);
+    return (failed || stats.mismatched || stats.missing) ? 1 : 0;
+}
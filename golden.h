@@ -0,0 +1,44 @@
+#ifndef GOLDEN_H
+#define GOLDEN_H
+
+#include <stdint.h>
+
+// 골든 회귀 비교
+// 출력 파일을 쓰지 않고 스트리밍 해시로만 계산하여 매니페스트의 해시/크기와 비교
+// 불일치한 출력만 test_out/golden/에 파일로 저장
+
+// 매니페스트 항목 (한 줄: <출력 이름> <해시 16진수> <크기>)
+typedef struct {
+    char name[256];
+    uint64_t hash;
+    uint64_t size;
+} GoldenEntry;
+
+typedef struct {
+    GoldenEntry *entries;
+    int count;
+    int capacity;
+} GoldenDb;
+
+// 매니페스트 읽기 (파일이 없으면 빈 매니페스트)
+// 반환값: 0 성공, -1 실패
+int golden_load(const char *path, GoldenDb *db);
+
+// 매니페스트 저장 (이름 순)
+// 반환값: 0 성공, -1 실패
+int golden_save(const char *path, GoldenDb *db);
+
+// 이름으로 항목 찾기 (없으면 NULL)
+GoldenEntry *golden_find(GoldenDb *db, const char *name);
+
+// 항목 추가 또는 갱신
+// 반환값: 0 성공, -1 실패
+int golden_set(GoldenDb *db, const char *name, uint64_t hash, uint64_t size);
+
+void golden_free(GoldenDb *db);
+
+// --golden 명령행 처리
+// 반환값: 0 모두 일치, 1 불일치/실패
+int golden_main(int argc, char *argv[]);
+
+#endif // GOLDEN_H
@@ -0,0 +1,29 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// 64bit 비암호화 해시 (행/프레임 변경 감지, 캐시 키용)
+// 8바이트 단위로 곱셈-혼합하며, seed로 여러 버퍼를 연결하여 해시할 수 있음
+// 예: h = hash64(g, n, hash64(r, n, 0))
+uint64_t hash64(const void *data, size_t len, uint64_t seed);
+
+// 스트리밍 해시 (출력 파일 내용 해시용)
+// HASH_STREAM_BLOCK 단위 블록을 연결하여 해시하므로 결과는 update 호출 단위와 무관
+#define HASH_STREAM_BLOCK 4096
+
+typedef struct {
+    uint64_t state;
+    uint64_t total;             // 누적 바이트 수
+    size_t fill;                // block에 채워진 바이트 수
+    uint8_t block[HASH_STREAM_BLOCK];
+} Hash64Stream;
+
+void hash64_stream_init(Hash64Stream *s, uint64_t seed);
+void hash64_stream_update(Hash64Stream *s, const void *data, size_t len);
+
+// 남은 바이트와 전체 길이를 반영한 최종 해시 (스트림 상태는 바뀌지 않음)
+uint64_t hash64_stream_final(const Hash64Stream *s);
+
+#endif // HASH_H
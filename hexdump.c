@@ -0,0 +1,808 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include "config.h"
+#include "hexdump.h"
+#include "log.h"
+
+#define HEX_MAX_BEAT_BITS 1024
+#define HEX_MAX_THREADS 64
+#define HEX_CHUNK_BYTES (1 << 20)   // 스레드별 포맷 버퍼 크기 (이 단위로 pwrite)
+
+// 바이트 -> 16진수 2글자 표
+static char hex_pairs[256][2];
+static pthread_once_t hex_pairs_once = PTHREAD_ONCE_INIT;
+
+static void init_hex_pairs(void) {
+    static const char digits[] = "0123456789abcdef";
+    for (int v = 0; v < 256; v++) {
+        hex_pairs[v][0] = digits[v >> 4];
+        hex_pairs[v][1] = digits[v & 0xF];
+    }
+}
+
+void hexdump_default_options(HexDumpOptions *opt) {
+    opt->bits = 0;
+    opt->pixels_per_beat = 1;
+    opt->beat_bits = 0;
+    opt->lsb_first = 0;
+    opt->threads = 0;
+    opt->header = 1;
+}
+
+// 덤프 대상 (RGB 또는 RGBG 배열)
+typedef struct {
+    const RGBArray *rgb;
+    const RGBGArray *rgbg;
+    int width;
+    int height;
+    int subpixels;          // 픽셀당 서브픽셀 수 (RGB 3, RGBG 2)
+} HexSource;
+
+typedef struct {
+    HexSource src;
+    int bits;
+    int fields;             // beat당 필드 수
+    int beat_bits;
+    int lsb_first;
+    int digits;             // 줄당 16진수 자릿수
+    size_t line_len;        // 자릿수 + 줄바꿈
+    size_t beats_per_row;
+    size_t row_bytes;
+    size_t header_len;
+    int fd;
+} HexJob;
+
+typedef struct {
+    const HexJob *job;
+    int y_begin;
+    int y_end;
+    int result;
+} HexWorker;
+
+// beat 하나를 16진수 한 줄로 포맷
+static char *format_beat(const HexJob *job, const uint16_t *fields, char *out) {
+    uint64_t words[HEX_MAX_BEAT_BITS / 64];
+    int word_count = (job->beat_bits + 63) / 64;
+    memset(words, 0, (size_t)word_count * sizeof(uint64_t));
+    for (int k = 0; k < job->fields; k++) {
+        int pos = (job->lsb_first ? k : job->fields - 1 - k) * job->bits;
+        uint64_t v = fields[k];
+        words[pos / 64] |= v << (pos % 64);
+        if (pos % 64 + job->bits > 64) {
+            words[pos / 64 + 1] |= v >> (64 - pos % 64);
+        }
+    }
+
+    // 최상위 자리부터 바이트 단위 표 변환 (자릿수가 홀수이면 첫 자리만 따로)
+    int byte = (job->digits - 1) / 2;
+    if (job->digits & 1) {
+        uint8_t b = (uint8_t)(words[byte / 8] >> ((byte % 8) * 8));
+        *out++ = hex_pairs[b][1];
+        byte--;
+    }
+    for (; byte >= 0; byte--) {
+        uint8_t b = (uint8_t)(words[byte / 8] >> ((byte % 8) * 8));
+        memcpy(out, hex_pairs[b], 2);
+        out += 2;
+    }
+    *out++ = '\n';
+    return out;
+}
+
+static void source_row(const HexSource *src, int y, uint16_t *dst, int bits) {
+    if (src->rgb) {
+        rgb_row_to_samples(src->rgb, y, dst, bits);
+    } else {
+        rgbg_row_to_samples(src->rgbg, y, dst, bits);
+    }
+}
+
+#ifndef _WIN32
+// 행 구간 [y_begin, y_end)를 포맷하여 파일의 해당 위치에 씀
+static void *hex_worker(void *arg) {
+    HexWorker *w = (HexWorker *)arg;
+    const HexJob *job = w->job;
+    size_t row_samples = job->beats_per_row * job->fields;   // 행 끝 0 채움 포함
+    int rows_per_chunk = (int)(HEX_CHUNK_BYTES / job->row_bytes);
+    if (rows_per_chunk < 1) {
+        rows_per_chunk = 1;
+    }
+    uint16_t *samples = (uint16_t *)calloc(row_samples, sizeof(uint16_t));
+    char *buffer = (char *)malloc(job->row_bytes * rows_per_chunk);
+    if (!samples || !buffer) {
+        free(samples);
+        free(buffer);
+        w->result = -1;
+        return NULL;
+    }
+
+    for (int y0 = w->y_begin; y0 < w->y_end && w->result == 0; y0 += rows_per_chunk) {
+        int y1 = y0 + rows_per_chunk < w->y_end ? y0 + rows_per_chunk : w->y_end;
+        char *out = buffer;
+        for (int y = y0; y < y1; y++) {
+            source_row(&job->src, y, samples, job->bits);
+            for (size_t b = 0; b < job->beats_per_row; b++) {
+                out = format_beat(job, samples + b * job->fields, out);
+            }
+        }
+        size_t len = (size_t)(out - buffer);
+        off_t offset = (off_t)(job->header_len + (size_t)y0 * job->row_bytes);
+        size_t done = 0;
+        while (done < len) {
+            ssize_t n = pwrite(job->fd, buffer + done, len - done, offset + (off_t)done);
+            if (n <= 0) {
+                w->result = -1;
+                break;
+            }
+            done += (size_t)n;
+        }
+    }
+    free(samples);
+    free(buffer);
+    return NULL;
+}
+#endif
+
+// order: RGBG 서브픽셀 순서 (헤더에 기록, RGB는 -1)
+static int hexdump_source(const char *filename, const HexSource *src, int depth, int order,
+                          const char *label, const HexDumpOptions *opt) {
+#ifdef _WIN32
+    (void)filename; (void)src; (void)depth; (void)order; (void)label; (void)opt;
+    log_error("hex 덤프는 이 플랫폼에서 지원하지 않습니다\n");
+    return -1;
+#else
+    pthread_once(&hex_pairs_once, init_hex_pairs);
+
+    HexJob job;
+    memset(&job, 0, sizeof(job));
+    job.src = *src;
+    job.bits = opt->bits > 0 ? opt->bits : depth;
+    job.fields = opt->pixels_per_beat * src->subpixels;
+    job.lsb_first = opt->lsb_first;
+    int field_bits = job.fields * job.bits;
+    job.beat_bits = opt->beat_bits > 0 ? opt->beat_bits : field_bits;
+    if ((job.bits != 8 && job.bits != 10 && job.bits != 12 && job.bits != 16) ||
+        opt->pixels_per_beat < 1 || job.beat_bits < field_bits || job.beat_bits > HEX_MAX_BEAT_BITS) {
+        log_error("잘못된 hex 덤프 형식: bits=%d, ppc=%d, beat=%d (필드 합계 %d, 최대 %d)\n",
+                  job.bits, opt->pixels_per_beat, job.beat_bits, field_bits, HEX_MAX_BEAT_BITS);
+        return -1;
+    }
+    job.digits = (job.beat_bits + 3) / 4;
+    job.line_len = (size_t)job.digits + 1;
+    job.beats_per_row = ((size_t)src->width + opt->pixels_per_beat - 1) / opt->pixels_per_beat;
+    job.row_bytes = job.beats_per_row * job.line_len;
+
+    char header[256] = "";
+    if (opt->header) {
+        int len = snprintf(header, sizeof(header), "// %s %dx%d bits=%d ppc=%d beat=%d %s",
+                           label, src->width, src->height, job.bits, opt->pixels_per_beat, job.beat_bits,
+                           job.lsb_first ? "lsb-first" : "msb-first");
+        if (order >= 0) {
+            len += snprintf(header + len, sizeof(header) - len, " order=%d", order);
+        }
+        snprintf(header + len, sizeof(header) - len, "\n");
+    }
+    job.header_len = strlen(header);
+
+    if (make_parent_directory(filename) != 0) {
+        return -1;
+    }
+    job.fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (job.fd < 0) {
+        log_error("파일을 생성할 수 없습니다: %s\n", filename);
+        return -1;
+    }
+    uint64_t total = job.header_len + (uint64_t)job.row_bytes * src->height;
+    if ((job.header_len > 0 && write(job.fd, header, job.header_len) != (ssize_t)job.header_len) ||
+        ftruncate(job.fd, (off_t)total) != 0) {
+        log_error("hex 파일 크기 설정 실패: %s\n", filename);
+        close(job.fd);
+        return -1;
+    }
+
+    // 행 구간을 스레드 수만큼 나누어 포맷 (줄 길이 고정이므로 위치가 미리 정해짐)
+    int threads = opt->threads > 0 ? opt->threads : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads < 1) threads = 1;
+    if (threads > HEX_MAX_THREADS) threads = HEX_MAX_THREADS;
+    if (threads > src->height) threads = src->height;
+    HexWorker workers[HEX_MAX_THREADS];
+    pthread_t tids[HEX_MAX_THREADS];
+    for (int t = 0; t < threads; t++) {
+        workers[t].job = &job;
+        workers[t].y_begin = (int)((int64_t)src->height * t / threads);
+        workers[t].y_end = (int)((int64_t)src->height * (t + 1) / threads);
+        workers[t].result = 0;
+    }
+    int started = 1;
+    for (int t = 1; t < threads; t++, started++) {
+        if (pthread_create(&tids[t], NULL, hex_worker, &workers[t]) != 0) {
+            break;
+        }
+    }
+    // 스레드를 만들지 못한 구간은 호출 스레드에서 처리
+    for (int t = started; t < threads; t++) {
+        hex_worker(&workers[t]);
+    }
+    hex_worker(&workers[0]);
+    int result = workers[0].result;
+    for (int t = 1; t < threads; t++) {
+        if (t < started) {
+            pthread_join(tids[t], NULL);
+        }
+        if (workers[t].result != 0) {
+            result = -1;
+        }
+    }
+    if (close(job.fd) != 0) {
+        result = -1;
+    }
+    if (result != 0) {
+        log_error("hex 덤프 쓰기 실패: %s\n", filename);
+        return -1;
+    }
+    log_debug("hex 덤프 저장 완료: %s (%zu줄 x %d자리, %llu bytes)\n", filename,
+              job.beats_per_row * src->height, job.digits, (unsigned long long)total);
+    return 0;
+#endif
+}
+
+int hexdump_rgbg(const char *filename, const RGBGArray *rgbg, const HexDumpOptions *opt) {
+    if (!rgbg || (!rgbg->data && !rgbg->data16)) {
+        log_error("유효하지 않은 RGBG 배열\n");
+        return -1;
+    }
+    HexSource src = { NULL, rgbg, rgbg->width, rgbg->height, 2 };
+    return hexdump_source(filename, &src, rgbg->depth, rgbg->order, "rgbg", opt);
+}
+
+int hexdump_rgb(const char *filename, const RGBArray *rgb, const HexDumpOptions *opt) {
+    if (!rgb || (!rgb->r && !rgb->r16)) {
+        log_error("유효하지 않은 RGB 배열\n");
+        return -1;
+    }
+    HexSource src = { rgb, NULL, rgb->width, rgb->height, 3 };
+    return hexdump_source(filename, &src, rgb->depth, -1, "rgb", opt);
+}
+
+// ============================================================
+// 읽기 (RTL $writememh 출력 등)
+// ============================================================
+
+#define HEX_INVALID 0xFF
+#define HEX_UNKNOWN 0x10    // x/z (값 0으로 읽고 개수만 셈)
+#define HEX_MIN_CHUNK (16 * 1024)   // 구간 최소 크기 (작은 파일은 스레드 수보다 적게 나눔)
+
+// 문자 -> 16진수 값 표
+static uint8_t hex_values[256];
+static pthread_once_t hex_values_once = PTHREAD_ONCE_INIT;
+
+static void init_hex_values(void) {
+    memset(hex_values, HEX_INVALID, sizeof(hex_values));
+    for (int c = '0'; c <= '9'; c++) hex_values[c] = (uint8_t)(c - '0');
+    for (int c = 'a'; c <= 'f'; c++) hex_values[c] = (uint8_t)(c - 'a' + 10);
+    for (int c = 'A'; c <= 'F'; c++) hex_values[c] = (uint8_t)(c - 'A' + 10);
+    hex_values['x'] = hex_values['X'] = hex_values['z'] = hex_values['Z'] = HEX_UNKNOWN;
+}
+
+static inline int is_hex_space(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\f' || c == '\v';
+}
+
+// 읽기 레이아웃
+typedef struct {
+    int width;
+    int height;
+    int bits;
+    int fields;
+    int beat_bits;
+    int lsb_first;
+    size_t beats_per_row;
+    uint64_t frame_begin;   // 읽을 프레임의 첫 주소
+    uint64_t frame_end;
+    RGBGArray *rgbg;
+    uint8_t *written;       // 프레임 beat별 저장 표시 (빠진 beat / 중복 주소 구분)
+} HexReadJob;
+
+// 파일 구간 하나 (줄 경계에서 나눔)
+// 1단계: 토큰 수와 마지막 @주소만 세어 구간 시작 주소를 앞 구간에서 이어받을 수 있게 함
+// 2단계: 시작 주소를 알고 값을 풀어 배열에 저장
+typedef struct {
+    const HexReadJob *job;
+    const char *begin;
+    const char *end;
+    int has_address;        // 구간 안에 @주소가 있음
+    uint64_t end_address;   // 구간 끝 주소 (has_address이면 절대값, 아니면 구간 시작 기준)
+    uint64_t start_address; // 2단계 입력
+    uint64_t stored;        // 프레임 안에 처음 저장한 beat 수
+    uint64_t duplicate;     // 이미 저장된 beat에 다시 쓴 수
+    uint64_t unknown;       // x/z 자릿수
+    int decode;             // 0: 1단계, 1: 2단계
+    int result;
+    const char *error_at;
+} HexChunk;
+
+// 주석/공백을 건너뛰고 다음 토큰 시작 위치 반환 (없으면 end)
+static const char *skip_to_token(const char *p, const char *end) {
+    while (p < end) {
+        if (is_hex_space(*p)) {
+            p++;
+        } else if (*p == '/' && p + 1 < end && p[1] == '/') {
+            const char *nl = (const char *)memchr(p, '\n', (size_t)(end - p));
+            p = nl ? nl + 1 : end;
+        } else if (*p == '/' && p + 1 < end && p[1] == '*') {
+            p += 2;
+            while (p + 1 < end && !(p[0] == '*' && p[1] == '/')) {
+                p++;
+            }
+            p = p + 1 < end ? p + 2 : end;
+        } else {
+            break;
+        }
+    }
+    return p;
+}
+
+static const char *token_end(const char *p, const char *end) {
+    while (p < end && !is_hex_space(*p) && *p != '/') {
+        p++;
+    }
+    return p;
+}
+
+// 16진수 토큰을 64bit 워드 배열(하위 워드부터)로 변환
+// 반환값: 0 성공, -1 잘못된 문자/beat 폭 초과
+static int parse_hex_word(const char *s, const char *e, uint64_t *words, int word_count, uint64_t *unknown) {
+    memset(words, 0, (size_t)word_count * sizeof(uint64_t));
+    if (e - s <= 16) {
+        // 짧은 토큰 (일반적인 경우): 한 워드에 누적
+        uint64_t v = 0;
+        for (const char *p = s; p < e; p++) {
+            uint8_t d = hex_values[(uint8_t)*p];
+            if (d > 0xF) {
+                if (d == HEX_UNKNOWN) {
+                    (*unknown)++;
+                    d = 0;
+                } else if (*p == '_') {
+                    continue;
+                } else {
+                    return -1;
+                }
+            }
+            v = (v << 4) | d;
+        }
+        words[0] = v;
+        return 0;
+    }
+    int nibble = 0;
+    for (const char *p = e; p-- > s;) {
+        uint8_t d = hex_values[(uint8_t)*p];
+        if (d > 0xF) {
+            if (d == HEX_UNKNOWN) {
+                (*unknown)++;
+                d = 0;
+            } else if (*p == '_') {
+                continue;
+            } else {
+                return -1;
+            }
+        }
+        if (d && nibble / 16 >= word_count) {
+            return -1;
+        }
+        if (nibble / 16 < word_count) {
+            words[nibble / 16] |= (uint64_t)d << ((nibble % 16) * 4);
+        }
+        nibble++;
+    }
+    return 0;
+}
+
+static inline unsigned extract_field(const uint64_t *words, int pos, int bits) {
+    uint64_t v = words[pos / 64] >> (pos % 64);
+    if (pos % 64 + bits > 64) {
+        v |= words[pos / 64 + 1] << (64 - pos % 64);
+    }
+    return (unsigned)(v & ((1u << bits) - 1));
+}
+
+// beat 하나를 RGBG 배열에 저장 (행 끝 0 채움 필드는 버림)
+// 반환값: 1 처음 저장, 0 이미 저장된 beat (중복 주소)
+static int store_beat(const HexReadJob *job, uint64_t beat, const uint64_t *words) {
+    size_t row = (size_t)(beat / job->beats_per_row);
+    size_t first = (size_t)(beat % job->beats_per_row) * job->fields;
+    size_t row_samples = (size_t)job->width * 2;
+    size_t base = row * row_samples;
+    RGBGArray *rgbg = job->rgbg;
+    for (int k = 0; k < job->fields && first + k < row_samples; k++) {
+        int pos = (job->lsb_first ? k : job->fields - 1 - k) * job->bits;
+        unsigned v = extract_field(words, pos, job->bits);
+        if (rgbg->data16) {
+            rgbg->data16[base + first + k] = (uint16_t)v;
+        } else {
+            rgbg->data[base + first + k] = (uint8_t)v;
+        }
+    }
+    // 구간이 겹쳐 같은 beat를 여러 스레드가 쓸 수 있으므로 표시는 원자적으로 교환
+    return __atomic_exchange_n(&job->written[beat], 1, __ATOMIC_RELAXED) == 0;
+}
+
+static void *hex_read_worker(void *arg) {
+    HexChunk *c = (HexChunk *)arg;
+    const HexReadJob *job = c->job;
+    uint64_t words[HEX_MAX_BEAT_BITS / 64];
+    int word_count = (job->beat_bits + 63) / 64;
+    uint64_t address = c->decode ? c->start_address : 0;
+    const char *p = c->begin;
+    while ((p = skip_to_token(p, c->end)) < c->end) {
+        const char *e = token_end(p, c->end);
+        if (*p == '@') {
+            uint64_t a = 0;
+            if (e - p < 2 || e - p > 17 || parse_hex_word(p + 1, e, &a, 1, &c->unknown) != 0) {
+                c->result = -1;
+                c->error_at = p;
+                return NULL;
+            }
+            address = a;
+            c->has_address = 1;
+        } else if (!c->decode) {
+            address++;
+        } else {
+            if (address >= job->frame_begin && address < job->frame_end) {
+                if (parse_hex_word(p, e, words, word_count, &c->unknown) != 0) {
+                    c->result = -1;
+                    c->error_at = p;
+                    return NULL;
+                }
+                if (store_beat(job, address - job->frame_begin, words)) {
+                    c->stored++;
+                } else {
+                    c->duplicate++;
+                }
+            }
+            address++;
+        }
+        p = e;
+    }
+    c->end_address = address;
+    return NULL;
+}
+
+// 구간들을 스레드로 나누어 한 단계 실행
+static void run_hex_chunks(HexChunk *chunks, int count) {
+    pthread_t tids[HEX_MAX_THREADS];
+    int started = 1;
+    for (int t = 1; t < count; t++, started++) {
+        if (pthread_create(&tids[t], NULL, hex_read_worker, &chunks[t]) != 0) {
+            break;
+        }
+    }
+    // 스레드를 만들지 못한 구간은 호출 스레드에서 처리
+    for (int t = started; t < count; t++) {
+        hex_read_worker(&chunks[t]);
+    }
+    hex_read_worker(&chunks[0]);
+    for (int t = 1; t < started; t++) {
+        pthread_join(tids[t], NULL);
+    }
+}
+
+static int has_block_comment(const char *data, size_t size) {
+    const char *p = data, *end = data + size;
+    while ((p = (const char *)memchr(p, '/', (size_t)(end - p))) != NULL && p + 1 < end) {
+        if (p[1] == '*') {
+            return 1;
+        }
+        p++;
+    }
+    return 0;
+}
+
+// 덤프 첫 줄 형식 주석 (hexdump_rgbg 출력) 해석
+// 반환값: 1 헤더 있음, 0 없음
+static int parse_hex_header(const char *data, size_t size, int *width, int *height,
+                            HexDumpOptions *layout, int *order) {
+    char line[256];
+    size_t len = 0;
+    while (len < size && len < sizeof(line) - 1 && data[len] != '\n') {
+        line[len] = data[len];
+        len++;
+    }
+    line[len] = '\0';
+    char first[16];
+    int w, h, bits, ppc, beat, ord;
+    if (sscanf(line, "// rgbg %dx%d bits=%d ppc=%d beat=%d %15s order=%d",
+               &w, &h, &bits, &ppc, &beat, first, &ord) != 7) {
+        return 0;
+    }
+    *width = w;
+    *height = h;
+    layout->bits = bits;
+    layout->pixels_per_beat = ppc;
+    layout->beat_bits = beat;
+    layout->lsb_first = strcmp(first, "lsb-first") == 0;
+    *order = ord & 1;
+    return 1;
+}
+
+int hexdump_read_rgbg(const char *filename, int width, int height, int frame,
+                      const HexDumpOptions *opt, RGBGArray *rgbg) {
+    memset(rgbg, 0, sizeof(*rgbg));
+#ifdef _WIN32
+    (void)filename; (void)width; (void)height; (void)frame; (void)opt;
+    log_error("hex 덤프 읽기는 이 플랫폼에서 지원하지 않습니다\n");
+    return -1;
+#else
+    pthread_once(&hex_values_once, init_hex_values);
+
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        log_error("파일을 열 수 없습니다: %s\n", filename);
+        return -1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        log_error("빈 hex 덤프: %s\n", filename);
+        close(fd);
+        return -1;
+    }
+    size_t size = (size_t)st.st_size;
+    const char *data = (const char *)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        log_error("hex 덤프 매핑 실패: %s\n", filename);
+        return -1;
+    }
+    madvise((void *)data, size, MADV_SEQUENTIAL);
+
+    // 형식 주석이 있으면 그 레이아웃 사용, 없으면 옵션 값
+    HexDumpOptions layout = *opt;
+    int order = ip_ports.por_rgbg_order & 1;
+    int header_width = 0, header_height = 0;
+    if (parse_hex_header(data, size, &header_width, &header_height, &layout, &order)) {
+        if ((width > 0 && width != header_width) || (height > 0 && height != header_height)) {
+            log_error("hex 덤프 크기(%d x %d)가 지정한 크기(%d x %d)와 다릅니다: %s\n",
+                      header_width, header_height, width, height, filename);
+            munmap((void *)data, size);
+            return -1;
+        }
+        width = header_width;
+        height = header_height;
+    }
+
+    HexReadJob job;
+    job.width = width;
+    job.height = height;
+    job.bits = layout.bits;
+    job.fields = layout.pixels_per_beat * 2;
+    job.beat_bits = layout.beat_bits > 0 ? layout.beat_bits : job.fields * job.bits;
+    job.lsb_first = layout.lsb_first;
+    if (width <= 0 || height <= 0 || frame < 0) {
+        log_error("hex 덤프는 크기가 필요합니다 (형식 주석 없음): %s\n", filename);
+        munmap((void *)data, size);
+        return -1;
+    }
+    if ((job.bits != 8 && job.bits != 10 && job.bits != 12 && job.bits != 16) ||
+        layout.pixels_per_beat < 1 || job.beat_bits < job.fields * job.bits ||
+        job.beat_bits > HEX_MAX_BEAT_BITS) {
+        log_error("잘못된 hex 덤프 형식: bits=%d, ppc=%d, beat=%d\n",
+                  job.bits, layout.pixels_per_beat, job.beat_bits);
+        munmap((void *)data, size);
+        return -1;
+    }
+    job.beats_per_row = ((size_t)width + layout.pixels_per_beat - 1) / layout.pixels_per_beat;
+    uint64_t frame_beats = (uint64_t)job.beats_per_row * height;
+    job.frame_begin = frame_beats * (uint64_t)frame;
+    job.frame_end = job.frame_begin + frame_beats;
+    if (alloc_rgbg(rgbg, width, height, job.bits) != 0) {
+        munmap((void *)data, size);
+        return -1;
+    }
+    rgbg->order = order;
+    job.rgbg = rgbg;
+    job.written = (uint8_t *)calloc((size_t)frame_beats, 1);
+    if (!job.written) {
+        log_error("메모리 할당 실패\n");
+        free_rgbg(rgbg);
+        munmap((void *)data, size);
+        return -1;
+    }
+
+    // 줄 경계로 구간 분할 (블록 주석이 구간을 넘을 수 있으면 한 구간으로 처리)
+    int count = layout.threads > 0 ? layout.threads : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (count < 1) count = 1;
+    if (count > HEX_MAX_THREADS) count = HEX_MAX_THREADS;
+    if ((size_t)count > size / HEX_MIN_CHUNK + 1) count = (int)(size / HEX_MIN_CHUNK + 1);
+    if (count > 1 && has_block_comment(data, size)) count = 1;
+    HexChunk chunks[HEX_MAX_THREADS];
+    const char *end = data + size;
+    const char *p = data;
+    for (int t = 0; t < count; t++) {
+        memset(&chunks[t], 0, sizeof(HexChunk));
+        chunks[t].job = &job;
+        chunks[t].begin = p;
+        const char *split = t == count - 1 ? end : data + size * (t + 1) / count;
+        if (split < p) split = p;
+        const char *nl = split < end ? (const char *)memchr(split, '\n', (size_t)(end - split)) : NULL;
+        p = (t == count - 1 || !nl) ? end : nl + 1;
+        chunks[t].end = p;
+    }
+
+    // 1단계: 구간별 주소 수 -> 구간 시작 주소
+    int result = 0;
+    if (count > 1) {
+        run_hex_chunks(chunks, count);
+    }
+    for (int t = 0; t < count; t++) {
+        if (chunks[t].result != 0) {
+            result = -1;
+            break;
+        }
+        if (t > 0) {
+            const HexChunk *prev = &chunks[t - 1];
+            chunks[t].start_address = prev->has_address ? prev->end_address
+                                                        : prev->start_address + prev->end_address;
+        }
+        chunks[t].decode = 1;
+        chunks[t].has_address = 0;
+        chunks[t].unknown = 0;
+    }
+
+    // 2단계: 값 해석 및 저장
+    uint64_t stored = 0, duplicate = 0, unknown = 0;
+    if (result == 0) {
+        run_hex_chunks(chunks, count);
+        for (int t = 0; t < count; t++) {
+            if (chunks[t].result != 0) {
+                result = -1;
+                break;
+            }
+            stored += chunks[t].stored;
+            duplicate += chunks[t].duplicate;
+            unknown += chunks[t].unknown;
+        }
+    }
+    for (int t = 0; t < count && result != 0; t++) {
+        if (chunks[t].error_at) {
+            const char *at = chunks[t].error_at;
+            const char *e = token_end(at, end);
+            log_error("hex 덤프 형식 오류: %s (오프셋 %zu, '%.*s')\n", filename, (size_t)(at - data),
+                      (int)(e - at > 40 ? 40 : e - at), at);
+            break;
+        }
+    }
+    // 빠진 beat와 중복 주소는 따로 보고 (둘 다 있으면 둘 다 출력)
+    int parsed = result == 0;
+    if (parsed && stored != frame_beats) {
+        uint64_t hole = 0;
+        while (hole < frame_beats && job.written[hole]) {
+            hole++;
+        }
+        log_error("hex 덤프 프레임 %d 빠진 beat %llu개 (첫 위치: 행 %llu, beat %llu): %s\n", frame,
+                  (unsigned long long)(frame_beats - stored),
+                  (unsigned long long)(hole / job.beats_per_row),
+                  (unsigned long long)(hole % job.beats_per_row), filename);
+        result = -1;
+    }
+    if (parsed && duplicate > 0) {
+        log_error("hex 덤프 프레임 %d 중복 주소 %llu개: %s\n", frame,
+                  (unsigned long long)duplicate, filename);
+        result = -1;
+    }
+    if (result == 0 && unknown > 0) {
+        log_error("경고: hex 덤프에 x/z 자리 %llu개 (0으로 읽음): %s\n", (unsigned long long)unknown, filename);
+    }
+    free(job.written);
+    munmap((void *)data, size);
+    if (result != 0) {
+        free_rgbg(rgbg);
+    }
+    return result;
+#endif
+}
+
+// ============================================================
+// 명령행
+// ============================================================
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+int hexdump_main(int argc, char *argv[]) {
+    if (argc < 3) {
+        log_info("사용법: %s --hex <BMP> [옵션]\n", argv[0]);
+        log_info("  출력: test_out/hex/<이름>_rgb.hex (입력 벡터), <이름>_rgbg.hex (기대 출력)\n");
+        log_info("  --depth D       내부 비트 깊이 (8/10/12/16, 기본 8)\n");
+        log_info("  --bits B        서브픽셀 필드 비트 수 (8/10/12/16, 기본 = 내부 비트 깊이)\n");
+        log_info("  --ppc N         클럭(beat)당 픽셀 수 (기본 1)\n");
+        log_info("  --beat W        beat 비트 폭 (기본 = 필드 합계, 크면 상위 비트 0)\n");
+        log_info("  --lsb-first     첫 서브픽셀을 최하위 필드에 배치 (기본: 최상위)\n");
+        log_info("  --stage S       rgb, rgbg, all (기본 all)\n");
+        log_info("  --threads N     포맷 스레드 수 (기본 CPU 수)\n");
+        log_info("  --no-header     형식 주석 줄 생략\n");
+        return 1;
+    }
+
+    const char *filename = argv[2];
+    HexDumpOptions opt;
+    hexdump_default_options(&opt);
+    int depth = 8;
+    const char *stage = "all";
+    for (int i = 3; i < argc; i++) {
+        if (strcmp(argv[i], "--depth") == 0 && i + 1 < argc) {
+            depth = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--bits") == 0 && i + 1 < argc) {
+            opt.bits = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--ppc") == 0 && i + 1 < argc) {
+            opt.pixels_per_beat = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--beat") == 0 && i + 1 < argc) {
+            opt.beat_bits = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--lsb-first") == 0) {
+            opt.lsb_first = 1;
+        } else if (strcmp(argv[i], "--stage") == 0 && i + 1 < argc) {
+            stage = argv[++i];
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            opt.threads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--no-header") == 0) {
+            opt.header = 0;
+        } else {
+            log_error("알 수 없는 옵션: %s\n", argv[i]);
+            return 1;
+        }
+    }
+    int want_rgb = strcmp(stage, "rgb") == 0 || strcmp(stage, "all") == 0;
+    int want_rgbg = strcmp(stage, "rgbg") == 0 || strcmp(stage, "all") == 0;
+    if (!want_rgb && !want_rgbg) {
+        log_error("알 수 없는 단계: %s (rgb, rgbg, all)\n", stage);
+        return 1;
+    }
+
+    RGBArray rgb;
+    RGBGArray rgbg;
+    if (read_bmp_depth(filename, &rgb, depth) != 0) {
+        return 1;
+    }
+    if (rgb_to_rgbg(&rgb, &rgbg) != 0) {
+        free_rgb(&rgb);
+        return 1;
+    }
+
+    // 입력 파일명에서 경로와 확장자 제거
+    char name[256];
+    const char *base = strrchr(filename, '/');
+    snprintf(name, sizeof(name), "%s", base ? base + 1 : filename);
+    char *dot = strrchr(name, '.');
+    if (dot) {
+        *dot = '\0';
+    }
+
+    int result = 0;
+    char path[512];
+    if (want_rgb) {
+        snprintf(path, sizeof(path), "test_out/hex/%s_rgb.hex", name);
+        double start = now_seconds();
+        result |= hexdump_rgb(path, &rgb, &opt);
+        log_info("  시간: %.1f ms\n", (now_seconds() - start) * 1000.0);
+    }
+    if (want_rgbg) {
+        snprintf(path, sizeof(path), "test_out/hex/%s_rgbg.hex", name);
+        double start = now_seconds();
+        result |= hexdump_rgbg(path, &rgbg, &opt);
+        log_info("  시간: %.1f ms\n", (now_seconds() - start) * 1000.0);
+    }
+
+    free_rgb(&rgb);
+    free_rgbg(&rgbg);
+    return result == 0 ? 0 : 1;
+}
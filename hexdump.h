@@ -0,0 +1,42 @@
+#ifndef HEXDUMP_H
+#define HEXDUMP_H
+
+#include "image_io.h"
+
+// 테스트벤치용 $readmemh 호환 16진수 벡터 덤프
+// 한 줄 = 한 beat (pixels_per_beat 픽셀의 서브픽셀 필드를 이어 붙인 값)
+// 행 끝에서 남는 픽셀 자리는 0으로 채우며, 줄 길이가 고정이므로 행 구간별로 병렬 포맷 후 pwrite
+
+typedef struct {
+    int bits;               // 서브픽셀 필드 비트 수 (0 = 배열 비트 깊이)
+    int pixels_per_beat;    // 클럭당 픽셀 수 (기본 1)
+    int beat_bits;          // beat 비트 폭 (0 = 필드 합계, 크면 상위 비트 0 채움)
+    int lsb_first;          // 1: 첫 서브픽셀을 최하위 필드에 배치 (기본 0: 최상위 필드)
+    int threads;            // 포맷 스레드 수 (0 = CPU 수)
+    int header;             // 1: 첫 줄에 형식 주석 (// ...) 출력
+} HexDumpOptions;
+
+void hexdump_default_options(HexDumpOptions *opt);
+
+// RGBG 배열 덤프 (픽셀당 서브픽셀 2개, 저장된 순서 그대로)
+// 반환값: 0 성공, -1 실패
+int hexdump_rgbg(const char *filename, const RGBGArray *rgbg, const HexDumpOptions *opt);
+
+// RGB 배열 덤프 (픽셀당 [R, G, B] 3개, RGBG 변환 입력 벡터)
+// 반환값: 0 성공, -1 실패
+int hexdump_rgb(const char *filename, const RGBArray *rgb, const HexDumpOptions *opt);
+
+// hex 덤프를 RGBG 배열로 읽기 (RTL $writememh 출력 등)
+// '//', '/* */' 주석과 '@주소' 지시자를 처리하며 주소 = beat 번호 (프레임 n은 n * 프레임 beat 수부터)
+// 첫 줄에 hexdump_rgbg 형식 주석이 있으면 그 크기/레이아웃/서브픽셀 순서를 사용하고,
+// 없으면 width/height와 opt(bits, pixels_per_beat, beat_bits, lsb_first)를 사용 (순서는 por_rgbg_order)
+// 파일은 mmap 후 줄 경계 구간으로 나누어 opt->threads 스레드로 해석
+// 반환값: 0 성공, -1 실패
+int hexdump_read_rgbg(const char *filename, int width, int height, int frame,
+                      const HexDumpOptions *opt, RGBGArray *rgbg);
+
+// --hex 명령행 처리
+// 반환값: 0 성공, 1 실패
+int hexdump_main(int argc, char *argv[]);
+
+#endif // HEXDUMP_H
@@ -2,7 +2,29 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+#include <dirent.h>
 #include "config.h"
+#include "image_io.h"
+#include "sequence.h"
+#include "ctc_tables.h"
+#include "regscript.h"
+#include "hash.h"
+#include "cache.h"
+#include "golden.h"
+#include "compare.h"
+#include "hexdump.h"
+#include "server.h"
+#include "ctcmodel.h"
+#include "log.h"
+#include "outq.h"
+#include "ctcz.h"
+#include "pattern.h"
+#include "preview.h"
+#include "sweep.h"
+#include "tune.h"
+#include "perfctr.h"
 #ifdef _WIN32
 #include <direct.h>
 #include <io.h>
@@ -11,8 +33,22 @@
 #else
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/mman.h>
+#include <fcntl.h>
 #include <unistd.h>
 #endif
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <tmmintrin.h>
+#define RAW_HAVE_SSSE3 1
+#else
+#define RAW_HAVE_SSSE3 0
+#endif
+
+// read_bmp가 한 번에 읽는 픽셀 데이터 크기 (행 단위로 내림, 최소 1행)
+#define BMP_READ_CHUNK (1 << 20)
 
 #pragma pack(push, 1)
 // BMP 파일 헤더 구조체
@@ -40,57 +76,108 @@ typedef struct {
 } BMPInfoHeader;
 #pragma pack(pop)
 
-// RGB 배열 구조체
-typedef struct {
-    uint8_t *r;
-    uint8_t *g;
-    uint8_t *b;
-    int width;
-    int height;
-} RGBArray;
-
-// RGBG 배열 구조체
-typedef struct {
-    uint8_t *data;
-    int width;
-    int height;
-} RGBGArray;
-
-// BMP 파일 읽기 함수
-int read_bmp(const char *filename, RGBArray *rgb) {
-    FILE *file = fopen(filename, "rb");
-    if (!file) {
-        printf("파일을 열 수 없습니다: %s\n", filename);
-        return -1;
-    }
-
-    BMPFileHeader fileHeader;
-    BMPInfoHeader infoHeader;
-
+// BMP 파일/정보 헤더 읽기 및 검증 (24비트만 지원)
+static int read_bmp_headers(FILE *file, BMPFileHeader *fileHeader, BMPInfoHeader *infoHeader) {
     // 파일 헤더 읽기
-    if (fread(&fileHeader, sizeof(BMPFileHeader), 1, file) != 1) {
-        printf("파일 헤더 읽기 실패\n");
-        fclose(file);
+    if (fread(fileHeader, sizeof(BMPFileHeader), 1, file) != 1) {
+        log_error("파일 헤더 읽기 실패\n");
         return -1;
     }
 
     // BMP 파일인지 확인
-    if (fileHeader.type != 0x4D42) { // 'BM'
-        printf("BMP 파일이 아닙니다\n");
-        fclose(file);
+    if (fileHeader->type != 0x4D42) { // 'BM'
+        log_error("BMP 파일이 아닙니다\n");
         return -1;
     }
 
     // 정보 헤더 읽기
-    if (fread(&infoHeader, sizeof(BMPInfoHeader), 1, file) != 1) {
-        printf("정보 헤더 읽기 실패\n");
-        fclose(file);
+    if (fread(infoHeader, sizeof(BMPInfoHeader), 1, file) != 1) {
+        log_error("정보 헤더 읽기 실패\n");
         return -1;
     }
 
     // 24비트 BMP만 지원
-    if (infoHeader.bitCount != 24) {
-        printf("24비트 BMP만 지원합니다. 현재: %d비트\n", infoHeader.bitCount);
+    if (infoHeader->bitCount != 24) {
+        log_error("24비트 BMP만 지원합니다. 현재: %d비트\n", infoHeader->bitCount);
+        return -1;
+    }
+    return 0;
+}
+
+// ============================================================
+// 3채널 인터리브 -> 평면 분리 (BMP BGR 행, RGB24 스트림)
+// ============================================================
+
+static void deinterleave3_scalar(const uint8_t *src, uint8_t *p0, uint8_t *p1, uint8_t *p2,
+                                 size_t start, size_t n) {
+    for (size_t i = start; i < n; i++) {
+        p0[i] = src[i * 3 + 0];
+        p1[i] = src[i * 3 + 1];
+        p2[i] = src[i * 3 + 2];
+    }
+}
+
+#if RAW_HAVE_SSSE3
+// 48바이트(16픽셀)씩 로드 3번 -> 평면별로 pshufb 3번 + OR
+// 평면 k의 바이트 위치 3i + k가 세 로드 중 어디에 있는지로 셔플 마스크가 나뉨 (-1 위치는 0)
+__attribute__((target("ssse3")))
+static void deinterleave3_ssse3(const uint8_t *src, uint8_t *p0, uint8_t *p1, uint8_t *p2, size_t n) {
+    const __m128i m00 = _mm_setr_epi8(0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i m01 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14, -1, -1, -1, -1, -1);
+    const __m128i m02 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 4, 7, 10, 13);
+    const __m128i m10 = _mm_setr_epi8(1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i m11 = _mm_setr_epi8(-1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15, -1, -1, -1, -1, -1);
+    const __m128i m12 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, 5, 8, 11, 14);
+    const __m128i m20 = _mm_setr_epi8(2, 5, 8, 11, 14, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i m21 = _mm_setr_epi8(-1, -1, -1, -1, -1, 1, 4, 7, 10, 13, -1, -1, -1, -1, -1, -1);
+    const __m128i m22 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 3, 6, 9, 12, 15);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const uint8_t *s = src + i * 3;
+        __m128i a = _mm_loadu_si128((const __m128i *)(s + 0));
+        __m128i b = _mm_loadu_si128((const __m128i *)(s + 16));
+        __m128i c = _mm_loadu_si128((const __m128i *)(s + 32));
+        __m128i v0 = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, m00), _mm_shuffle_epi8(b, m01)),
+                                  _mm_shuffle_epi8(c, m02));
+        __m128i v1 = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, m10), _mm_shuffle_epi8(b, m11)),
+                                  _mm_shuffle_epi8(c, m12));
+        __m128i v2 = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(a, m20), _mm_shuffle_epi8(b, m21)),
+                                  _mm_shuffle_epi8(c, m22));
+        _mm_storeu_si128((__m128i *)(p0 + i), v0);
+        _mm_storeu_si128((__m128i *)(p1 + i), v1);
+        _mm_storeu_si128((__m128i *)(p2 + i), v2);
+    }
+    deinterleave3_scalar(src, p0, p1, p2, i, n);
+}
+#endif
+
+// 3바이트 픽셀 n개를 바이트 순서대로 평면 3개로 분리 (BMP: p0 = B, p1 = G, p2 = R)
+void deinterleave_rgb24_row(const uint8_t *src, uint8_t *p0, uint8_t *p1, uint8_t *p2, size_t n) {
+#if RAW_HAVE_SSSE3
+    static int has_ssse3 = -1;
+    if (has_ssse3 < 0) {
+        has_ssse3 = __builtin_cpu_supports("ssse3") ? 1 : 0;
+    }
+    if (has_ssse3) {
+        deinterleave3_ssse3(src, p0, p1, p2, n);
+        return;
+    }
+#endif
+    deinterleave3_scalar(src, p0, p1, p2, 0, n);
+}
+
+// BMP 파일 읽기 함수
+int read_bmp(const char *filename, RGBArray *rgb) {
+    memset(rgb, 0, sizeof(*rgb));
+    FILE *file = fopen(filename, "rb");
+    if (!file) {
+        log_error("파일을 열 수 없습니다: %s\n", filename);
+        return -1;
+    }
+
+    BMPFileHeader fileHeader;
+    BMPInfoHeader infoHeader;
+    if (read_bmp_headers(file, &fileHeader, &infoHeader) != 0) {
         fclose(file);
         return -1;
     }
@@ -98,16 +185,24 @@ int read_bmp(const char *filename, RGBArray *rgb) {
     int width = infoHeader.width;
     int height = abs(infoHeader.height); // 높이는 음수일 수 있음 (top-down)
     int isTopDown = infoHeader.height < 0;
+    if (width <= 0 || height <= 0) {
+        log_error("잘못된 이미지 크기: %d x %d\n", width, height);
+        fclose(file);
+        return -1;
+    }
 
-    // RGB 배열 메모리 할당
+    // RGB 배열 메모리 할당 (크기는 size_t로 계산하여 큰 이미지에서도 넘치지 않음)
+    size_t pixels = (size_t)width * (size_t)height;
     rgb->width = width;
     rgb->height = height;
-    rgb->r = (uint8_t *)malloc(width * height * sizeof(uint8_t));
-    rgb->g = (uint8_t *)malloc(width * height * sizeof(uint8_t));
-    rgb->b = (uint8_t *)malloc(width * height * sizeof(uint8_t));
+    rgb->depth = 8;
+    rgb->r = (uint8_t *)malloc(pixels * sizeof(uint8_t));
+    rgb->g = (uint8_t *)malloc(pixels * sizeof(uint8_t));
+    rgb->b = (uint8_t *)malloc(pixels * sizeof(uint8_t));
 
     if (!rgb->r || !rgb->g || !rgb->b) {
-        printf("메모리 할당 실패\n");
+        log_error("메모리 할당 실패\n");
+        free_rgb(rgb);
         fclose(file);
         return -1;
     }
@@ -116,36 +211,140 @@ int read_bmp(const char *filename, RGBArray *rgb) {
     fseek(file, fileHeader.offset, SEEK_SET);
 
     // 행당 바이트 수 계산 (4바이트 정렬)
-    int rowSize = ((width * 3 + 3) / 4) * 4;
+    size_t rowSize = (((size_t)width * 3 + 3) / 4) * 4;
 
-    // 픽셀 데이터 읽기
-    uint8_t *rowBuffer = (uint8_t *)malloc(rowSize);
+    // 픽셀 데이터 읽기: 여러 행을 한 번에 읽고 행마다 평면으로 분리
+    // (행 끝 패딩은 행 간격으로 건너뛰고, bottom-up 뒤집기는 행 단위 목적지 계산으로 처리)
+    size_t chunkRows = BMP_READ_CHUNK / rowSize;
+    if (chunkRows < 1) chunkRows = 1;
+    if (chunkRows > (size_t)height) chunkRows = (size_t)height;
+    uint8_t *rowBuffer = (uint8_t *)malloc(rowSize * chunkRows);
     if (!rowBuffer) {
-        printf("행 버퍼 할당 실패\n");
+        log_error("행 버퍼 할당 실패\n");
+        free_rgb(rgb);
         fclose(file);
         return -1;
     }
 
-    for (int y = 0; y < height; y++) {
-        size_t bytesRead = fread(rowBuffer, 1, rowSize, file);
-        if (bytesRead != (size_t)rowSize) {
-            printf("픽셀 데이터 읽기 실패\n");
+    for (int y = 0; y < height; y += (int)chunkRows) {
+        size_t rows = (size_t)(height - y) < chunkRows ? (size_t)(height - y) : chunkRows;
+        size_t bytesRead = fread(rowBuffer, 1, rowSize * rows, file);
+        if (bytesRead != rowSize * rows) {
+            log_error("픽셀 데이터 읽기 실패\n");
             free(rowBuffer);
+            free_rgb(rgb);
             fclose(file);
             return -1;
         }
 
-        int yIndex = isTopDown ? y : (height - 1 - y); // bottom-up인 경우 역순
-
-        for (int x = 0; x < width; x++) {
-            int pixelIndex = yIndex * width + x;
-            int bufferIndex = x * 3;
+        for (size_t i = 0; i < rows; i++) {
+            int fileRow = y + (int)i;
+            int yIndex = isTopDown ? fileRow : (height - 1 - fileRow); // bottom-up인 경우 역순
+            size_t rowOffset = (size_t)yIndex * width;
 
             // BMP는 BGR 순서로 저장됨
-            rgb->b[pixelIndex] = rowBuffer[bufferIndex + 0];
-            rgb->g[pixelIndex] = rowBuffer[bufferIndex + 1];
-            rgb->r[pixelIndex] = rowBuffer[bufferIndex + 2];
+            deinterleave_rgb24_row(rowBuffer + i * rowSize, rgb->b + rowOffset, rgb->g + rowOffset,
+                                   rgb->r + rowOffset, (size_t)width);
+        }
+    }
+
+    free(rowBuffer);
+    fclose(file);
+    return 0;
+}
+
+// BMP 파일 크기만 읽기
+int read_bmp_size(const char *filename, int *width, int *height) {
+    FILE *file = fopen(filename, "rb");
+    if (!file) {
+        log_error("파일을 열 수 없습니다: %s\n", filename);
+        return -1;
+    }
+    BMPFileHeader fileHeader;
+    BMPInfoHeader infoHeader;
+    int result = read_bmp_headers(file, &fileHeader, &infoHeader);
+    fclose(file);
+    if (result == 0) {
+        *width = infoHeader.width;
+        *height = abs(infoHeader.height);
+    }
+    return result;
+}
+
+// 파일의 offset 위치에서 size 바이트 읽기 (스트림 위치를 바꾸지 않음)
+static int read_at(FILE *file, void *buffer, size_t size, long long offset) {
+#ifdef _WIN32
+    if (_fseeki64(file, offset, SEEK_SET) != 0) {
+        return -1;
+    }
+    return fread(buffer, 1, size, file) == size ? 0 : -1;
+#else
+    return pread(fileno(file), buffer, size, (off_t)offset) == (ssize_t)size ? 0 : -1;
+#endif
+}
+
+// BMP 파일에서 (x, y, w, h) 영역만 읽기
+// 영역에 해당하는 행의 해당 열 구간만 읽으므로 큰 이미지의 일부를 빠르게 확인할 수 있음
+int read_bmp_roi(const char *filename, RGBArray *rgb, int x, int y, int w, int h) {
+    memset(rgb, 0, sizeof(*rgb));
+    FILE *file = fopen(filename, "rb");
+    if (!file) {
+        log_error("파일을 열 수 없습니다: %s\n", filename);
+        return -1;
+    }
+
+    BMPFileHeader fileHeader;
+    BMPInfoHeader infoHeader;
+    if (read_bmp_headers(file, &fileHeader, &infoHeader) != 0) {
+        fclose(file);
+        return -1;
+    }
+
+    int width = infoHeader.width;
+    int height = abs(infoHeader.height);
+    int isTopDown = infoHeader.height < 0;
+    if (x < 0 || y < 0 || w <= 0 || h <= 0 || x + w > width || y + h > height) {
+        log_error("영역이 이미지 범위를 벗어납니다: %d,%d,%d,%d (이미지 %d x %d)\n",
+                  x, y, w, h, width, height);
+        fclose(file);
+        return -1;
+    }
+
+    size_t pixels = (size_t)w * h;
+    rgb->width = w;
+    rgb->height = h;
+    rgb->depth = 8;
+    rgb->x0 = x;
+    rgb->y0 = y;
+    rgb->r = (uint8_t *)malloc(pixels);
+    rgb->g = (uint8_t *)malloc(pixels);
+    rgb->b = (uint8_t *)malloc(pixels);
+    uint8_t *rowBuffer = (uint8_t *)malloc((size_t)w * 3);
+    if (!rgb->r || !rgb->g || !rgb->b || !rowBuffer) {
+        log_error("메모리 할당 실패\n");
+        free(rowBuffer);
+        free_rgb(rgb);
+        fclose(file);
+        return -1;
+    }
+
+    // 행당 바이트 수 계산 (4바이트 정렬)
+    long long rowSize = (((long long)width * 3 + 3) / 4) * 4;
+    for (int row = 0; row < h; row++) {
+        int imageRow = y + row;
+        long long fileRow = isTopDown ? imageRow : (height - 1 - imageRow); // bottom-up인 경우 역순
+        long long offset = (long long)fileHeader.offset + fileRow * rowSize + (long long)x * 3;
+        if (read_at(file, rowBuffer, (size_t)w * 3, offset) != 0) {
+            log_error("픽셀 데이터 읽기 실패\n");
+            free(rowBuffer);
+            free_rgb(rgb);
+            fclose(file);
+            return -1;
         }
+
+        size_t rowOffset = (size_t)row * w;
+        // BMP는 BGR 순서로 저장됨
+        deinterleave_rgb24_row(rowBuffer, rgb->b + rowOffset, rgb->g + rowOffset, rgb->r + rowOffset, (size_t)w);
     }
 
     free(rowBuffer);
@@ -153,69 +352,439 @@ int read_bmp(const char *filename, RGBArray *rgb) {
     return 0;
 }
 
+// ============================================================
+// 비트 깊이 변환 커널
+// ============================================================
+// 8bit는 uint8_t 평면, 10/12/16bit는 uint16_t 평면에 저장
+// 스케일 공식은 PPM 저장과 동일: dst = (src * dst_max) / src_max (내림)
+// 깊이 조합별로 상수를 넣어 호출하므로 컴파일 시점에 특수화되어 벡터화됨
+
+static int is_valid_depth(int depth) {
+    return depth == 8 || depth == 10 || depth == 12 || depth == 16;
+}
+
+static inline void expand_row_u8_const(const uint8_t *src, uint16_t *dst,
+                                       size_t n, uint32_t dst_max) {
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = (uint16_t)((src[i] * dst_max) / 255u);
+    }
+}
+
+static inline void rescale_row_u16_const(const uint16_t *src, uint16_t *dst, size_t n,
+                                         uint32_t src_max, uint32_t dst_max) {
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = (uint16_t)((src[i] * dst_max) / src_max);
+    }
+}
+
+static inline void reduce_row_u16_const(const uint16_t *src, uint8_t *dst,
+                                        size_t n, uint32_t src_max) {
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = (uint8_t)((src[i] * 255u) / src_max);
+    }
+}
+
+// 8bit -> 10/12/16bit
+static void expand_row_u8(const uint8_t *src, uint16_t *dst, size_t n, int dst_depth) {
+    switch (dst_depth) {
+    case 10: expand_row_u8_const(src, dst, n, 1023u); break;
+    case 12: expand_row_u8_const(src, dst, n, 4095u); break;
+    default: expand_row_u8_const(src, dst, n, 65535u); break;
+    }
+}
+
+// 10/12/16bit -> 10/12/16bit
+static void rescale_row_u16(const uint16_t *src, uint16_t *dst, size_t n,
+                            int src_depth, int dst_depth) {
+    switch (src_depth * 100 + dst_depth) {
+    case 1012: rescale_row_u16_const(src, dst, n, 1023u, 4095u); break;
+    case 1016: rescale_row_u16_const(src, dst, n, 1023u, 65535u); break;
+    case 1210: rescale_row_u16_const(src, dst, n, 4095u, 1023u); break;
+    case 1216: rescale_row_u16_const(src, dst, n, 4095u, 65535u); break;
+    case 1610: rescale_row_u16_const(src, dst, n, 65535u, 1023u); break;
+    case 1612: rescale_row_u16_const(src, dst, n, 65535u, 4095u); break;
+    default:   memcpy(dst, src, n * sizeof(uint16_t)); break;
+    }
+}
+
+// 10/12/16bit -> 8bit
+static void reduce_row_u16(const uint16_t *src, uint8_t *dst, size_t n, int src_depth) {
+    switch (src_depth) {
+    case 10: reduce_row_u16_const(src, dst, n, 1023u); break;
+    case 12: reduce_row_u16_const(src, dst, n, 4095u); break;
+    default: reduce_row_u16_const(src, dst, n, 65535u); break;
+    }
+}
+
+// 한 평면을 src_depth -> dst_depth로 변환 (깊이가 같으면 복사)
+static void convert_plane_depth(const uint8_t *src8, const uint16_t *src16, int src_depth,
+                                uint8_t *dst8, uint16_t *dst16, int dst_depth, size_t n) {
+    if (src_depth == 8 && dst_depth == 8) {
+        memcpy(dst8, src8, n);
+    } else if (src_depth == 8) {
+        expand_row_u8(src8, dst16, n, dst_depth);
+    } else if (dst_depth == 8) {
+        reduce_row_u16(src16, dst8, n, src_depth);
+    } else {
+        rescale_row_u16(src16, dst16, n, src_depth, dst_depth);
+    }
+}
+
+// RGB 배열을 지정한 비트 깊이로 변환한 복사본 생성
+int rgb_convert_depth(const RGBArray *src, RGBArray *dst, int depth) {
+    memset(dst, 0, sizeof(*dst));
+    if (!is_valid_depth(depth) || !is_valid_depth(src->depth)) {
+        log_error("지원하지 않는 비트 깊이: %d -> %d (8/10/12/16)\n", src->depth, depth);
+        return -1;
+    }
+
+    size_t pixels = (size_t)src->width * src->height;
+    dst->width = src->width;
+    dst->height = src->height;
+    dst->depth = depth;
+    dst->x0 = src->x0;
+    dst->y0 = src->y0;
+    if (depth == 8) {
+        dst->r = (uint8_t *)malloc(pixels);
+        dst->g = (uint8_t *)malloc(pixels);
+        dst->b = (uint8_t *)malloc(pixels);
+    } else {
+        dst->r16 = (uint16_t *)malloc(pixels * sizeof(uint16_t));
+        dst->g16 = (uint16_t *)malloc(pixels * sizeof(uint16_t));
+        dst->b16 = (uint16_t *)malloc(pixels * sizeof(uint16_t));
+    }
+    if ((depth == 8 && (!dst->r || !dst->g || !dst->b)) ||
+        (depth != 8 && (!dst->r16 || !dst->g16 || !dst->b16))) {
+        log_error("메모리 할당 실패\n");
+        free_rgb(dst);
+        return -1;
+    }
+
+    convert_plane_depth(src->r, src->r16, src->depth, dst->r, dst->r16, depth, pixels);
+    convert_plane_depth(src->g, src->g16, src->depth, dst->g, dst->g16, depth, pixels);
+    convert_plane_depth(src->b, src->b16, src->depth, dst->b, dst->b16, depth, pixels);
+    return 0;
+}
+
+// RGB 배열의 비트 깊이를 변환 (기존 평면은 해제됨)
+int rgb_set_depth(RGBArray *rgb, int depth) {
+    if (rgb->depth == depth) {
+        return 0;
+    }
+    RGBArray converted;
+    if (rgb_convert_depth(rgb, &converted, depth) != 0) {
+        return -1;
+    }
+    free_rgb(rgb);
+    *rgb = converted;
+    return 0;
+}
+
+// BMP 파일을 읽고 지정한 비트 깊이로 변환
+int read_bmp_depth(const char *filename, RGBArray *rgb, int depth) {
+    if (!is_valid_depth(depth)) {
+        log_error("지원하지 않는 비트 깊이: %d (8/10/12/16)\n", depth);
+        return -1;
+    }
+    if (read_bmp(filename, rgb) != 0) {
+        return -1;
+    }
+    if (rgb_set_depth(rgb, depth) != 0) {
+        free_rgb(rgb);
+        return -1;
+    }
+    return 0;
+}
+
 // RGB 배열을 RGBG 배열로 변환
 // RGBG 배열 구조:
 //   Even row (y=0, 2, 4, ...): [R, G], [G, B], [R, G], [G, B] ...
 //   Odd row  (y=1, 3, 5, ...): [B, G], [R, G], [B, G], [R, G] ...
-// 각 픽셀은 2바이트로 저장됨
-int rgb_to_rgbg(RGBArray *rgb, RGBGArray *rgbg) {
-    rgbg->width = rgb->width;
-    rgbg->height = rgb->height;
-    
-    // RGBG 패턴: 각 픽셀을 2바이트로 저장
-    // Even row: [R, G], [G, B] 반복
-    // Odd row:  [B, G], [R, G] 반복
-    int size = rgb->width * rgb->height * 2; // 각 픽셀당 2바이트
-    rgbg->data = (uint8_t *)malloc(size);
-    
-    if (!rgbg->data) {
-        printf("RGBG 배열 메모리 할당 실패\n");
+// 각 픽셀은 서브픽셀 2개로 저장됨 (8bit: 2바이트, 10/12/16bit: uint16_t 2개)
+
+// 저장 타입별 행 변환 커널 생성 (uint8_t / uint16_t)
+// odd_col: 첫 픽셀이 패널 홀수 열 (ROI/타일이 홀수 열에서 시작)
+#define DEFINE_RGB_TO_RGBG_ROW(NAME, PIXEL_T)                                  \
+static void NAME(const PIXEL_T *r, const PIXEL_T *g, const PIXEL_T *b,         \
+                 PIXEL_T *dst, int width, int even_row, int odd_col) {         \
+    int x = 0;                                                                 \
+    if (odd_col && width > 0) {                                                \
+        /* 홀수 열 픽셀 하나를 먼저 배치: Even row [G, B], Odd row [R, G] */    \
+        dst[0] = even_row ? g[0] : r[0];                                       \
+        dst[1] = even_row ? b[0] : g[0];                                       \
+        x = 1;                                                                 \
+    }                                                                          \
+    if (even_row) {                                                            \
+        /* Even row: [R, G], [G, B] 반복 */                                    \
+        for (; x + 1 < width; x += 2) {                                        \
+            dst[x * 2 + 0] = r[x];                                             \
+            dst[x * 2 + 1] = g[x];                                             \
+            dst[x * 2 + 2] = g[x + 1];                                         \
+            dst[x * 2 + 3] = b[x + 1];                                         \
+        }                                                                      \
+        if (x < width) {                                                       \
+            dst[x * 2 + 0] = r[x];                                             \
+            dst[x * 2 + 1] = g[x];                                             \
+        }                                                                      \
+    } else {                                                                   \
+        /* Odd row: [B, G], [R, G] 반복 */                                     \
+        for (; x + 1 < width; x += 2) {                                        \
+            dst[x * 2 + 0] = b[x];                                             \
+            dst[x * 2 + 1] = g[x];                                             \
+            dst[x * 2 + 2] = r[x + 1];                                         \
+            dst[x * 2 + 3] = g[x + 1];                                         \
+        }                                                                      \
+        if (x < width) {                                                       \
+            dst[x * 2 + 0] = b[x];                                             \
+            dst[x * 2 + 1] = g[x];                                             \
+        }                                                                      \
+    }                                                                          \
+}
+
+DEFINE_RGB_TO_RGBG_ROW(rgb_to_rgbg_row_u8, uint8_t)
+DEFINE_RGB_TO_RGBG_ROW(rgb_to_rgbg_row_u16, uint16_t)
+
+// ============================================================
+// RGBG 배치 검증
+// ============================================================
+// 각 픽셀의 서브픽셀 2개를 원본 RGB 평면에서 다시 골라 비교
+//   슬롯 0: 짝수 열이면 a0, 홀수 열이면 b0 / 슬롯 1: 짝수 열이면 a1, 홀수 열이면 b1
+//   Even row: a0 = R, b0 = G, a1 = G, b1 = B   (= [R, G], [G, B])
+//   Odd row : a0 = B, b0 = R, a1 = G, b1 = G   (= [B, G], [R, G])
+// SSE2는 8픽셀씩 기대값을 만들어 한 번에 비교하고, 다른 픽셀이 있는 블록만 스칼라로 다시 셈
+
+#define DEFINE_RGBG_VERIFY_SCALAR(NAME, PIXEL_T)                               \
+static int NAME(const PIXEL_T *a0, const PIXEL_T *b0, const PIXEL_T *a1,      \
+                const PIXEL_T *b1, const PIXEL_T *dst, int begin, int end,     \
+                int odd_col, int *first) {                                     \
+    int count = 0;                                                             \
+    for (int x = begin; x < end; x++) {                                        \
+        int even_col = ((x + odd_col) & 1) == 0;                               \
+        PIXEL_T s0 = even_col ? a0[x] : b0[x];                                 \
+        PIXEL_T s1 = even_col ? a1[x] : b1[x];                                 \
+        if (dst[x * 2] != s0 || dst[x * 2 + 1] != s1) {                        \
+            if (count++ == 0) {                                                \
+                *first = x;                                                    \
+            }                                                                  \
+        }                                                                      \
+    }                                                                          \
+    return count;                                                              \
+}
+
+DEFINE_RGBG_VERIFY_SCALAR(verify_rgbg_row_u8_scalar, uint8_t)
+DEFINE_RGBG_VERIFY_SCALAR(verify_rgbg_row_u16_scalar, uint16_t)
+
+// 한 행의 다른 픽셀 수 (first: 첫 번째 다른 픽셀 열, 없으면 그대로)
+static int verify_rgbg_row_u8(const uint8_t *a0, const uint8_t *b0, const uint8_t *a1, const uint8_t *b1,
+                              const uint8_t *dst, int width, int odd_col, int *first) {
+    int count = 0;
+    int x = 0;
+#if defined(__SSE2__)
+    // 짝수 열(odd_col이면 홀수 번째 픽셀) 위치의 바이트가 0xFF인 선택 마스크
+    const __m128i sel = odd_col ? _mm_set1_epi16((short)0xFF00) : _mm_set1_epi16(0x00FF);
+    for (; x + 8 <= width; x += 8) {
+        __m128i va0 = _mm_loadl_epi64((const __m128i *)(a0 + x));
+        __m128i vb0 = _mm_loadl_epi64((const __m128i *)(b0 + x));
+        __m128i va1 = _mm_loadl_epi64((const __m128i *)(a1 + x));
+        __m128i vb1 = _mm_loadl_epi64((const __m128i *)(b1 + x));
+        __m128i s0 = _mm_or_si128(_mm_and_si128(sel, va0), _mm_andnot_si128(sel, vb0));
+        __m128i s1 = _mm_or_si128(_mm_and_si128(sel, va1), _mm_andnot_si128(sel, vb1));
+        __m128i expect = _mm_unpacklo_epi8(s0, s1);
+        __m128i got = _mm_loadu_si128((const __m128i *)(dst + x * 2));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(expect, got)) != 0xFFFF) {
+            int block_first = x;
+            int n = verify_rgbg_row_u8_scalar(a0, b0, a1, b1, dst, x, x + 8, odd_col, &block_first);
+            if (count == 0) {
+                *first = block_first;
+            }
+            count += n;
+        }
+    }
+#endif
+    if (x < width) {
+        int tail_first = x;
+        int n = verify_rgbg_row_u8_scalar(a0, b0, a1, b1, dst, x, width, odd_col, &tail_first);
+        if (count == 0 && n > 0) {
+            *first = tail_first;
+        }
+        count += n;
+    }
+    return count;
+}
+
+static int verify_rgbg_row_u16(const uint16_t *a0, const uint16_t *b0, const uint16_t *a1, const uint16_t *b1,
+                               const uint16_t *dst, int width, int odd_col, int *first) {
+    int count = 0;
+    int x = 0;
+#if defined(__SSE2__)
+    const __m128i sel = odd_col ? _mm_set1_epi32((int)0xFFFF0000u) : _mm_set1_epi32(0x0000FFFF);
+    for (; x + 8 <= width; x += 8) {
+        __m128i va0 = _mm_loadu_si128((const __m128i *)(a0 + x));
+        __m128i vb0 = _mm_loadu_si128((const __m128i *)(b0 + x));
+        __m128i va1 = _mm_loadu_si128((const __m128i *)(a1 + x));
+        __m128i vb1 = _mm_loadu_si128((const __m128i *)(b1 + x));
+        __m128i s0 = _mm_or_si128(_mm_and_si128(sel, va0), _mm_andnot_si128(sel, vb0));
+        __m128i s1 = _mm_or_si128(_mm_and_si128(sel, va1), _mm_andnot_si128(sel, vb1));
+        __m128i lo = _mm_cmpeq_epi16(_mm_unpacklo_epi16(s0, s1), _mm_loadu_si128((const __m128i *)(dst + x * 2)));
+        __m128i hi = _mm_cmpeq_epi16(_mm_unpackhi_epi16(s0, s1), _mm_loadu_si128((const __m128i *)(dst + x * 2 + 8)));
+        if (_mm_movemask_epi8(_mm_and_si128(lo, hi)) != 0xFFFF) {
+            int block_first = x;
+            int n = verify_rgbg_row_u16_scalar(a0, b0, a1, b1, dst, x, x + 8, odd_col, &block_first);
+            if (count == 0) {
+                *first = block_first;
+            }
+            count += n;
+        }
+    }
+#endif
+    if (x < width) {
+        int tail_first = x;
+        int n = verify_rgbg_row_u16_scalar(a0, b0, a1, b1, dst, x, width, odd_col, &tail_first);
+        if (count == 0 && n > 0) {
+            *first = tail_first;
+        }
+        count += n;
+    }
+    return count;
+}
+
+// [y_begin, y_end) 행 검증 (크기/범위는 호출자가 확인)
+static int64_t verify_rgbg_rows(const RGBArray *rgb, const RGBGArray *rgbg, int y_begin, int y_end,
+                                int *first_x, int *first_y) {
+    int64_t count = 0;
+    int odd_col = rgbg->x0 & 1;
+    for (int y = y_begin; y < y_end; y++) {
+        size_t row = (size_t)y * rgb->width;
+        int even_row = ((rgbg->y0 + y + rgbg->order) & 1) == 0;
+        int first = 0;
+        int n;
+        if (rgb->depth == 8) {
+            const uint8_t *r = rgb->r + row, *g = rgb->g + row, *b = rgb->b + row;
+            n = even_row ? verify_rgbg_row_u8(r, g, g, b, rgbg->data + row * 2, rgb->width, odd_col, &first)
+                         : verify_rgbg_row_u8(b, r, g, g, rgbg->data + row * 2, rgb->width, odd_col, &first);
+        } else {
+            const uint16_t *r = rgb->r16 + row, *g = rgb->g16 + row, *b = rgb->b16 + row;
+            n = even_row ? verify_rgbg_row_u16(r, g, g, b, rgbg->data16 + row * 2, rgb->width, odd_col, &first)
+                         : verify_rgbg_row_u16(b, r, g, g, rgbg->data16 + row * 2, rgb->width, odd_col, &first);
+        }
+        if (n > 0 && count == 0) {
+            *first_x = first;
+            *first_y = y;
+        }
+        count += n;
+    }
+    return count;
+}
+
+// RGBG 배열 전체를 원본 RGB 배열과 비교 (서브픽셀 순서 / 시작 위치는 RGBG 배열 값)
+int64_t rgbg_verify(const RGBArray *rgb, const RGBGArray *rgbg, int *first_x, int *first_y) {
+    int fx = -1, fy = -1;
+    if (rgbg->width != rgb->width || rgbg->height != rgb->height || rgbg->depth != rgb->depth ||
+        (rgb->depth == 8 ? !rgbg->data : !rgbg->data16)) {
+        log_error("RGBG 배열 크기/비트 깊이가 RGB 배열과 다릅니다\n");
         return -1;
     }
+    int64_t count = verify_rgbg_rows(rgb, rgbg, 0, rgb->height, &fx, &fy);
+    if (first_x) *first_x = fx;
+    if (first_y) *first_y = fy;
+    return count;
+}
 
-    for (int y = 0; y < rgb->height; y++) {
-        for (int x = 0; x < rgb->width; x++) {
-            int pixelIndex = y * rgb->width + x;
-            int rgbgIndex = pixelIndex * 2; // 각 픽셀당 2바이트
+// 할당된 RGBG 배열의 [y_begin, y_end) 행만 변환 (크기/비트 깊이가 RGB 배열과 같아야 함)
+int rgb_to_rgbg_rows(RGBArray *rgb, RGBGArray *rgbg, int y_begin, int y_end) {
+    if (rgbg->width != rgb->width || rgbg->height != rgb->height ||
+        rgbg->depth != rgb->depth || (!rgbg->data && !rgbg->data16)) {
+        log_error("RGBG 배열 크기/비트 깊이가 RGB 배열과 다릅니다\n");
+        return -1;
+    }
+    if (y_begin < 0 || y_end > rgb->height || y_begin > y_end) {
+        log_error("잘못된 행 범위: %d ~ %d\n", y_begin, y_end);
+        return -1;
+    }
 
-            if (y % 2 == 0) {
-                // Even row: [R, G], [G, B] 패턴
-                if (x % 2 == 0) {
-                    // 짝수 열: [R, G]
-                    rgbg->data[rgbgIndex + 0] = rgb->r[pixelIndex];
-                    rgbg->data[rgbgIndex + 1] = rgb->g[pixelIndex];
-                } else {
-                    // 홀수 열: [G, B]
-                    rgbg->data[rgbgIndex + 0] = rgb->g[pixelIndex];
-                    rgbg->data[rgbgIndex + 1] = rgb->b[pixelIndex];
-                }
-            } else {
-                // Odd row: [B, G], [R, G] 패턴
-                if (x % 2 == 0) {
-                    // 짝수 열: [B, G]
-                    rgbg->data[rgbgIndex + 0] = rgb->b[pixelIndex];
-                    rgbg->data[rgbgIndex + 1] = rgb->g[pixelIndex];
-                } else {
-                    // 홀수 열: [R, G]
-                    rgbg->data[rgbgIndex + 0] = rgb->r[pixelIndex];
-                    rgbg->data[rgbgIndex + 1] = rgb->g[pixelIndex];
-                }
-            }
+    // 행/열 패턴은 패널 기준 위치로 결정 (ROI/타일도 전체 프레임과 같은 패턴)
+    int odd_col = rgbg->x0 & 1;
+    for (int y = y_begin; y < y_end; y++) {
+        size_t rowOffset = (size_t)y * rgb->width;
+        int even_row = ((rgbg->y0 + y + rgbg->order) & 1) == 0;
+        if (rgb->depth == 8) {
+            rgb_to_rgbg_row_u8(rgb->r + rowOffset, rgb->g + rowOffset, rgb->b + rowOffset,
+                               rgbg->data + rowOffset * 2, rgb->width, even_row, odd_col);
+        } else {
+            rgb_to_rgbg_row_u16(rgb->r16 + rowOffset, rgb->g16 + rowOffset, rgb->b16 + rowOffset,
+                                rgbg->data16 + rowOffset * 2, rgb->width, even_row, odd_col);
         }
     }
 
+#ifdef CTC_DEBUG
+    // 디버그 빌드 (make DEBUG=1): 변환한 행을 모두 다시 검증
+    int first_x = -1, first_y = -1;
+    int64_t mismatches = verify_rgbg_rows(rgb, rgbg, y_begin, y_end, &first_x, &first_y);
+    if (mismatches != 0) {
+        log_error("RGBG 배치 검증 실패: %lld 픽셀 불일치, 첫 위치 (%d, %d)\n",
+                  (long long)mismatches, first_x, first_y);
+        return -1;
+    }
+#endif
+    return 0;
+}
+
+// 할당된 RGBG 배열에 변환 (크기/비트 깊이가 RGB 배열과 같아야 함)
+// 시퀀스 처리처럼 같은 버퍼를 프레임마다 재사용할 때 사용
+int rgb_to_rgbg_into(RGBArray *rgb, RGBGArray *rgbg) {
+    rgbg->order = ip_ports.por_rgbg_order & 1;
+    rgbg->x0 = rgb->x0;
+    rgbg->y0 = rgb->y0;
+    return rgb_to_rgbg_rows(rgb, rgbg, 0, rgb->height);
+}
+
+// RGBG 배열 할당 (변환은 하지 않음)
+int alloc_rgbg(RGBGArray *rgbg, int width, int height, int depth) {
+    memset(rgbg, 0, sizeof(*rgbg));
+    rgbg->width = width;
+    rgbg->height = height;
+    rgbg->order = ip_ports.por_rgbg_order & 1;
+    rgbg->depth = depth;
+
+    // RGBG 패턴: 각 픽셀을 서브픽셀 2개로 저장
+    // Even row: [R, G], [G, B] 반복
+    // Odd row:  [B, G], [R, G] 반복
+    size_t size = (size_t)width * height * 2; // 각 픽셀당 서브픽셀 2개
+    if (depth == 8) {
+        rgbg->data = (uint8_t *)malloc(size);
+    } else {
+        rgbg->data16 = (uint16_t *)malloc(size * sizeof(uint16_t));
+    }
+
+    if (!rgbg->data && !rgbg->data16) {
+        log_error("RGBG 배열 메모리 할당 실패\n");
+        return -1;
+    }
     return 0;
 }
 
+int rgb_to_rgbg(RGBArray *rgb, RGBGArray *rgbg) {
+    if (alloc_rgbg(rgbg, rgb->width, rgb->height, rgb->depth) != 0) {
+        return -1;
+    }
+    return rgb_to_rgbg_into(rgb, rgbg);
+}
+
 // RGB 배열 해제
 void free_rgb(RGBArray *rgb) {
     if (rgb) {
         free(rgb->r);
         free(rgb->g);
         free(rgb->b);
+        free(rgb->r16);
+        free(rgb->g16);
+        free(rgb->b16);
         rgb->r = NULL;
         rgb->g = NULL;
         rgb->b = NULL;
+        rgb->r16 = NULL;
+        rgb->g16 = NULL;
+        rgb->b16 = NULL;
     }
 }
 
@@ -223,31 +792,101 @@ void free_rgb(RGBArray *rgb) {
 void free_rgbg(RGBGArray *rgbg) {
     if (rgbg) {
         free(rgbg->data);
+        free(rgbg->data16);
         rgbg->data = NULL;
+        rgbg->data16 = NULL;
+    }
+}
+
+// RGB 배열의 채널 값 (c: 0=R, 1=G, 2=B)
+static unsigned rgb_sample(const RGBArray *rgb, int c, size_t index) {
+    if (rgb->depth == 8) {
+        const uint8_t *plane = (c == 0) ? rgb->r : (c == 1) ? rgb->g : rgb->b;
+        return plane[index];
     }
+    const uint16_t *plane16 = (c == 0) ? rgb->r16 : (c == 1) ? rgb->g16 : rgb->b16;
+    return plane16[index];
+}
+
+// RGBG 배열의 서브픽셀 값
+static unsigned rgbg_sample(const RGBGArray *rgbg, size_t index) {
+    return rgbg->depth == 8 ? rgbg->data[index] : rgbg->data16[index];
 }
 
 // RGB 배열 정보 출력
 void print_rgb_info(RGBArray *rgb, const char *filename) {
-    printf("파일: %s\n", filename);
-    printf("크기: %d x %d\n", rgb->width, rgb->height);
-    printf("첫 번째 픽셀 (R, G, B): (%d, %d, %d)\n", 
-           rgb->r[0], rgb->g[0], rgb->b[0]);
-    printf("마지막 픽셀 (R, G, B): (%d, %d, %d)\n", 
-           rgb->r[rgb->width * rgb->height - 1], 
-           rgb->g[rgb->width * rgb->height - 1], 
-           rgb->b[rgb->width * rgb->height - 1]);
+    size_t last = (size_t)rgb->width * rgb->height - 1;
+    log_info("파일: %s\n", filename);
+    log_info("크기: %d x %d (%dbit)\n", rgb->width, rgb->height, rgb->depth);
+    log_info("첫 번째 픽셀 (R, G, B): (%u, %u, %u)\n", 
+             rgb_sample(rgb, 0, 0), rgb_sample(rgb, 1, 0), rgb_sample(rgb, 2, 0));
+    log_info("마지막 픽셀 (R, G, B): (%u, %u, %u)\n", 
+             rgb_sample(rgb, 0, last), rgb_sample(rgb, 1, last), rgb_sample(rgb, 2, last));
 }
 
 // RGBG 배열 정보 출력
 void print_rgbg_info(RGBGArray *rgbg, const char *filename) {
-    printf("RGBG 배열 - 파일: %s\n", filename);
-    printf("크기: %d x %d\n", rgbg->width, rgbg->height);
-    printf("첫 번째 픽셀 (2바이트): [%d, %d]\n", 
-           rgbg->data[0], rgbg->data[1]);
+    log_info("RGBG 배열 - 파일: %s\n", filename);
+    log_info("크기: %d x %d (%dbit)\n", rgbg->width, rgbg->height, rgbg->depth);
+    log_info("첫 번째 픽셀 (서브픽셀 2개): [%u, %u]\n", 
+             rgbg_sample(rgbg, 0), rgbg_sample(rgbg, 1));
     if (rgbg->width > 1) {
-        printf("두 번째 픽셀 (2바이트): [%d, %d]\n", 
-               rgbg->data[2], rgbg->data[3]);
+        log_info("두 번째 픽셀 (서브픽셀 2개): [%u, %u]\n", 
+                 rgbg_sample(rgbg, 2), rgbg_sample(rgbg, 3));
+    }
+}
+
+// 샘플 하나의 비트 깊이 변환 (8bit 출력 포함, 행 단위 변환 함수와 같은 반올림)
+static inline unsigned scale_sample(unsigned v, int src_depth, int dst_depth) {
+    return src_depth == dst_depth ? v : (v * ((1u << dst_depth) - 1)) / ((1u << src_depth) - 1);
+}
+
+// RGBG 배열의 한 행을 지정한 비트 수의 샘플로 변환 (PPM/RAW 저장 공용)
+void rgbg_row_to_samples(const RGBGArray *rgbg, int y, uint16_t *dst, int bits) {
+    size_t n = (size_t)rgbg->width * 2;
+    if (bits == 8) {
+        for (size_t i = 0; i < n; i++) {
+            dst[i] = (uint16_t)scale_sample(rgbg_sample(rgbg, (size_t)y * n + i), rgbg->depth, 8);
+        }
+    } else if (rgbg->depth == 8) {
+        expand_row_u8(rgbg->data + (size_t)y * n, dst, n, bits);
+    } else {
+        rescale_row_u16(rgbg->data16 + (size_t)y * n, dst, n, rgbg->depth, bits);
+    }
+}
+
+// RGB 배열의 한 행을 [R, G, B] 순서의 지정한 비트 수 샘플로 변환 (행당 width * 3)
+void rgb_row_to_samples(const RGBArray *rgb, int y, uint16_t *dst, int bits) {
+    size_t base = (size_t)y * rgb->width;
+    for (int x = 0; x < rgb->width; x++) {
+        for (int c = 0; c < 3; c++) {
+            dst[x * 3 + c] = (uint16_t)scale_sample(rgb_sample(rgb, c, base + x), rgb->depth, bits);
+        }
+    }
+}
+
+// 서브픽셀 샘플 한 행을 PPM RGB 3채널(16bit 빅엔디안) 행으로 배치
+//   Even row: [R, G] → [R, G, 0], [G, B] → [0, G, B]
+//   Odd row:  [B, G] → [0, G, B], [R, G] → [R, G, 0]
+// odd_col: 첫 픽셀이 패널 홀수 열 (ROI/타일)
+static void place_samples_to_ppm_row(const uint16_t *samples, uint8_t *ppmRow,
+                                     int width, int even_row, int odd_col) {
+    for (int x = 0; x < width; x++) {
+        uint16_t ch1 = samples[x * 2 + 0];
+        uint16_t ch2 = samples[x * 2 + 1];
+        uint16_t rgb3[3] = {0, 0, 0};
+        int even_col = ((x + odd_col) % 2) == 0;
+        if (even_row) {
+            if (even_col) { rgb3[0] = ch1; rgb3[1] = ch2; }   // [R, G]
+            else          { rgb3[1] = ch1; rgb3[2] = ch2; }   // [G, B]
+        } else {
+            if (even_col) { rgb3[2] = ch1; rgb3[1] = ch2; }   // [B, G]
+            else          { rgb3[0] = ch1; rgb3[1] = ch2; }   // [R, G]
+        }
+        for (int c = 0; c < 3; c++) {
+            ppmRow[x * 6 + c * 2 + 0] = (uint8_t)(rgb3[c] >> 8);
+            ppmRow[x * 6 + c * 2 + 1] = (uint8_t)(rgb3[c] & 0xFF);
+        }
     }
 }
 
@@ -308,18 +947,12 @@ static int create_directory(const char *path) {
     return 0;
 }
 
-// RGBG 배열을 10bit PPM 파일로 저장
-int save_rgbg_to_ppm_10bit(RGBGArray *rgbg, const char *filename) {
-    if (!rgbg || !rgbg->data) {
-        printf("유효하지 않은 RGBG 배열\n");
-        return -1;
-    }
-
-    // 디렉토리 생성
+// 파일 경로의 상위 디렉토리 생성
+static int ensure_parent_directory(const char *filename) {
     char dir_path[1024];
     strncpy(dir_path, filename, sizeof(dir_path) - 1);
     dir_path[sizeof(dir_path) - 1] = '\0';
-    
+
     char *last_slash = strrchr(dir_path, '/');
     if (!last_slash) {
         last_slash = strrchr(dir_path, '\\');
@@ -327,228 +960,716 @@ int save_rgbg_to_ppm_10bit(RGBGArray *rgbg, const char *filename) {
     if (last_slash) {
         *last_slash = '\0';
         if (create_directory(dir_path) != 0) {
-            printf("디렉토리 생성 실패: %s\n", dir_path);
+            log_error("디렉토리 생성 실패: %s\n", dir_path);
             return -1;
         }
     }
+    return 0;
+}
 
-    FILE *file = fopen(filename, "wb");
+int make_parent_directory(const char *filename) {
+    return ensure_parent_directory(filename);
+}
+
+// RGBG 배열을 10/12bit PPM 형식으로 출력
+// RGBG 배열을 RGB 3채널 형식으로 변환하여 저장
+// Even row: [R, G, 0], [0, G, B]
+// Odd row:  [0, G, B], [R, G, 0]
+int write_rgbg_ppm(OutputSink *sink, RGBGArray *rgbg, int bits) {
+    if (!rgbg || (!rgbg->data && !rgbg->data16)) {
+        log_error("유효하지 않은 RGBG 배열\n");
+        return -1;
+    }
+
+    // PPM 헤더 작성 (P6 형식, 10bit = 최대값 1023, 12bit = 최대값 4095)
+    sink_printf(sink, "P6\n%d %d\n%d\n", rgbg->width, rgbg->height, (1 << bits) - 1);
+
+    size_t samples = (size_t)rgbg->width * 2;
+    uint16_t *sampleBuffer = (uint16_t *)malloc(samples * sizeof(uint16_t));
+    uint8_t *ppmRow = (uint8_t *)malloc((size_t)rgbg->width * 6);
+    if (!sampleBuffer || !ppmRow) {
+        log_error("행 버퍼 할당 실패\n");
+        free(sampleBuffer);
+        free(ppmRow);
+        return -1;
+    }
+
+    // 서브픽셀을 출력 비트 수로 변환한 뒤 빅엔디안 RGB 행으로 배치 (PPM은 빅엔디안)
+    int result = 0;
+    for (int y = 0; y < rgbg->height && result == 0; y++) {
+        rgbg_row_to_samples(rgbg, y, sampleBuffer, bits);
+        place_samples_to_ppm_row(sampleBuffer, ppmRow, rgbg->width,
+                                 ((rgbg->y0 + y + rgbg->order) % 2) == 0, rgbg->x0 & 1);
+        result = sink_write(sink, ppmRow, (size_t)rgbg->width * 6);
+    }
+
+    free(sampleBuffer);
+    free(ppmRow);
+    if (result != 0) {
+        log_error("PPM 데이터 쓰기 실패\n");
+    }
+    return result;
+}
+
+// RGBG 배열을 10/12bit PPM 파일로 저장 (공용 구현)
+static int save_rgbg_to_ppm(RGBGArray *rgbg, const char *filename, int bits) {
+    OutputSink sink;
+    if (ensure_parent_directory(filename) != 0 || sink_open_file(&sink, filename) != 0) {
+        return -1;
+    }
+    int result = write_rgbg_ppm(&sink, rgbg, bits);
+    if (sink_close(&sink) != 0 || result != 0) {
+        return -1;
+    }
+    log_debug("%dbit PPM 파일 저장 완료: %s\n", bits, filename);
+    return 0;
+}
+
+// RGBG 배열을 10bit PPM 파일로 저장
+int save_rgbg_to_ppm_10bit(RGBGArray *rgbg, const char *filename) {
+    return save_rgbg_to_ppm(rgbg, filename, 10);
+}
+
+// RGBG 배열을 12bit PPM 파일로 저장
+int save_rgbg_to_ppm_12bit(RGBGArray *rgbg, const char *filename) {
+    return save_rgbg_to_ppm(rgbg, filename, 12);
+}
+
+// ============================================================
+// 스트라이프 단위 처리 (out-of-core)
+// ============================================================
+// 큰 이미지를 가로 스트라이프(stripe_rows 행)로 나누어 처리하여 메모리 사용량을
+// 스트라이프 크기로 제한함. 입력 BMP와 출력 PPM은 스트라이프 구간만 mmap으로 매핑하고,
+// 출력 파일은 먼저 전체 크기로 늘려 두고 각 스트라이프가 자기 위치에 직접 씀
+// 결과는 전체 프레임 처리(save_rgbg_to_ppm_10bit/12bit)와 바이트 단위로 같음
+
+#ifndef _WIN32
+// 파일의 [offset, offset + length) 구간을 매핑 (offset은 페이지 경계로 내려 맞춤)
+// 반환값: offset 위치의 포인터 (실패 시 NULL), *base/*map_len은 munmap용
+static uint8_t *map_window(int fd, uint64_t offset, size_t length, int writable,
+                           void **base, size_t *map_len) {
+    uint64_t page = (uint64_t)sysconf(_SC_PAGESIZE);
+    uint64_t aligned = offset - offset % page;
+    *map_len = length + (size_t)(offset - aligned);
+    *base = mmap(NULL, *map_len, writable ? (PROT_READ | PROT_WRITE) : PROT_READ,
+                 MAP_SHARED, fd, (off_t)aligned);
+    if (*base == MAP_FAILED) {
+        *base = NULL;
+        return NULL;
+    }
+    return (uint8_t *)*base + (offset - aligned);
+}
+
+// 출력 PPM 파일 생성: 헤더를 쓰고 전체 크기로 늘림
+// 반환값: 파일 디스크립터 (실패 시 -1), *header_len은 픽셀 데이터 시작 위치
+static int create_ppm_for_stripes(const char *filename, int width, int height, int bits,
+                                  uint64_t *header_len) {
+    if (ensure_parent_directory(filename) != 0) {
+        return -1;
+    }
+    int fd = open(filename, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        log_error("파일을 생성할 수 없습니다: %s\n", filename);
+        return -1;
+    }
+    char header[64];
+    int len = snprintf(header, sizeof(header), "P6\n%d %d\n%d\n", width, height, (1 << bits) - 1);
+    uint64_t total = (uint64_t)len + (uint64_t)width * (uint64_t)height * 6;
+    if (write(fd, header, (size_t)len) != len || ftruncate(fd, (off_t)total) != 0) {
+        log_error("PPM 파일 크기 설정 실패: %s\n", filename);
+        close(fd);
+        return -1;
+    }
+    *header_len = (uint64_t)len;
+    return fd;
+}
+#endif
+
+// BMP 파일을 스트라이프 단위로 10bit / 12bit PPM으로 변환
+int process_bmp_stripes(const char *filename, int depth, int stripe_rows,
+                        const char *ppm_10bit, const char *ppm_12bit) {
+#ifdef _WIN32
+    (void)filename; (void)depth; (void)stripe_rows; (void)ppm_10bit; (void)ppm_12bit;
+    log_error("스트라이프 처리는 이 플랫폼에서 지원하지 않습니다\n");
+    return -1;
+#else
+    if (!is_valid_depth(depth) || stripe_rows <= 0) {
+        log_error("잘못된 스트라이프 옵션: depth=%d, rows=%d\n", depth, stripe_rows);
+        return -1;
+    }
+
+    FILE *file = fopen(filename, "rb");
     if (!file) {
-        printf("파일을 생성할 수 없습니다: %s\n", filename);
+        log_error("파일을 열 수 없습니다: %s\n", filename);
+        return -1;
+    }
+    BMPFileHeader fileHeader;
+    BMPInfoHeader infoHeader;
+    int header_ok = read_bmp_headers(file, &fileHeader, &infoHeader);
+    fclose(file);
+    if (header_ok != 0) {
+        return -1;
+    }
+
+    int width = infoHeader.width;
+    int height = abs(infoHeader.height);
+    int isTopDown = infoHeader.height < 0;
+    uint64_t rowSize = (((uint64_t)width * 3 + 3) / 4) * 4;
+    if (width <= 0 || height <= 0) {
+        log_error("잘못된 이미지 크기: %d x %d\n", width, height);
         return -1;
     }
+    if (stripe_rows > height) {
+        stripe_rows = height;
+    }
 
-    // PPM 헤더 작성 (P6 형식, 10bit = 최대값 1023)
-    // RGBG 배열을 RGB 3채널 형식으로 변환하여 저장
-    // Even row: [R, G, 0], [0, G, B]
-    // Odd row:  [0, G, B], [R, G, 0]
-    fprintf(file, "P6\n%d %d\n1023\n", rgbg->width, rgbg->height);
+    const char *outputs[2] = { ppm_10bit, ppm_12bit };
+    const int output_bits[2] = { 10, 12 };
+    int out_fd[2] = { -1, -1 };
+    uint64_t out_header[2] = { 0, 0 };
+    int in_fd = open(filename, O_RDONLY);
+    int result = (in_fd >= 0) ? 0 : -1;
+    for (int k = 0; k < 2 && result == 0; k++) {
+        out_fd[k] = create_ppm_for_stripes(outputs[k], width, height, output_bits[k], &out_header[k]);
+        result = (out_fd[k] >= 0) ? 0 : -1;
+    }
 
-    // RGBG 배열을 RGB 3채널 형식으로 변환하여 저장
-    for (int y = 0; y < rgbg->height; y++) {
-        for (int x = 0; x < rgbg->width; x++) {
-            int pixelIndex = y * rgbg->width + x;
-            int rgbgIndex = pixelIndex * 2; // 각 픽셀당 2바이트
+    // 스트라이프 버퍼 (모든 스트라이프에서 재사용, 마지막 스트라이프는 행 수만 줄임)
+    RGBArray rgb;
+    RGBGArray rgbg;
+    memset(&rgb, 0, sizeof(rgb));
+    memset(&rgbg, 0, sizeof(rgbg));
+    size_t samples = (size_t)width * 2;
+    uint16_t *sampleBuffer = (uint16_t *)malloc(samples * sizeof(uint16_t));
+    if (!sampleBuffer) {
+        result = -1;
+    }
 
-            // RGBG 배열에서 2바이트 가져오기
-            uint8_t ch1 = rgbg->data[rgbgIndex + 0];
-            uint8_t ch2 = rgbg->data[rgbgIndex + 1];
+    for (int y0 = 0; y0 < height && result == 0; y0 += stripe_rows) {
+        int rows = (y0 + stripe_rows > height) ? height - y0 : stripe_rows;
+        log_trace("스트라이프 행 %d ~ %d\n", y0, y0 + rows - 1);
 
-            // RGB 3채널로 변환
-            uint8_t r, g, b;
-            if (y % 2 == 0) {
-                // Even row: [R, G, 0], [0, G, B]
-                if (x % 2 == 0) {
-                    // 짝수 열: [R, G] → [R, G, 0]
-                    r = ch1; // R
-                    g = ch2; // G
-                    b = 0;   // 0
-                } else {
-                    // 홀수 열: [G, B] → [0, G, B]
-                    r = 0;   // 0
-                    g = ch1; // G
-                    b = ch2; // B
-                }
-            } else {
-                // Odd row: [0, G, B], [R, G, 0]
-                if (x % 2 == 0) {
-                    // 짝수 열: [B, G] → [0, G, B]
-                    r = 0;   // 0
-                    g = ch2; // G
-                    b = ch1; // B
-                } else {
-                    // 홀수 열: [R, G] → [R, G, 0]
-                    r = ch1; // R
-                    g = ch2; // G
-                    b = 0;   // 0
-                }
+        // 1. 입력 창 매핑 (bottom-up이면 스트라이프의 마지막 행이 파일에서 먼저 옴)
+        uint64_t first_file_row = isTopDown ? (uint64_t)y0 : (uint64_t)(height - y0 - rows);
+        void *in_base;
+        size_t in_len;
+        const uint8_t *in = map_window(in_fd, fileHeader.offset + first_file_row * rowSize,
+                                       (size_t)(rowSize * (uint64_t)rows), 0, &in_base, &in_len);
+        if (!in) {
+            log_error("입력 매핑 실패 (행 %d)\n", y0);
+            result = -1;
+            break;
+        }
+
+        if (rgb.depth != 8 || rgb.height != rows) {
+            free_rgb(&rgb);
+            size_t pixels = (size_t)width * rows;
+            rgb.r = (uint8_t *)malloc(pixels);
+            rgb.g = (uint8_t *)malloc(pixels);
+            rgb.b = (uint8_t *)malloc(pixels);
+            if (!rgb.r || !rgb.g || !rgb.b) {
+                log_error("스트라이프 메모리 할당 실패\n");
+                munmap(in_base, in_len);
+                result = -1;
+                break;
             }
+        }
+        rgb.width = width;
+        rgb.height = rows;
+        rgb.depth = 8;
+        rgb.x0 = 0;
+        rgb.y0 = y0; // 스트라이프 시작 행 패리티 유지
+        for (int row = 0; row < rows; row++) {
+            uint64_t file_row = isTopDown ? (uint64_t)row : (uint64_t)(rows - 1 - row);
+            const uint8_t *src = in + file_row * rowSize;
+            size_t offset = (size_t)row * width;
+            // BMP는 BGR 순서로 저장됨
+            deinterleave_rgb24_row(src, rgb.b + offset, rgb.g + offset, rgb.r + offset, (size_t)width);
+        }
+        munmap(in_base, in_len);
 
-            // 8bit (0-255)를 10bit (0-1023)로 확장
-            // 공식: 10bit_value = (8bit_value * 1023) / 255
-            uint16_t r_10bit = (uint16_t)((r * 1023) / 255);
-            uint16_t g_10bit = (uint16_t)((g * 1023) / 255);
-            uint16_t b_10bit = (uint16_t)((b * 1023) / 255);
+        // 2. 비트 깊이 변환 + RGBG 변환
+        if (rgb_set_depth(&rgb, depth) != 0) {
+            result = -1;
+            break;
+        }
+        if (rgbg.height != rows || rgbg.depth != depth) {
+            free_rgbg(&rgbg);
+            if (alloc_rgbg(&rgbg, width, rows, depth) != 0) {
+                result = -1;
+                break;
+            }
+        }
+        if (rgb_to_rgbg_into(&rgb, &rgbg) != 0) {
+            result = -1;
+            break;
+        }
 
-            // 빅엔디안으로 16bit 값 저장 (PPM은 빅엔디안)
-            uint8_t r_high = (r_10bit >> 8) & 0xFF;
-            uint8_t r_low = r_10bit & 0xFF;
-            uint8_t g_high = (g_10bit >> 8) & 0xFF;
-            uint8_t g_low = g_10bit & 0xFF;
-            uint8_t b_high = (b_10bit >> 8) & 0xFF;
-            uint8_t b_low = b_10bit & 0xFF;
+        // 3. 출력 창 매핑 후 PPM 행 직접 쓰기
+        for (int k = 0; k < 2 && result == 0; k++) {
+            uint64_t row_bytes = (uint64_t)width * 6;
+            void *out_base;
+            size_t out_len;
+            uint8_t *out = map_window(out_fd[k], out_header[k] + (uint64_t)y0 * row_bytes,
+                                      (size_t)(row_bytes * (uint64_t)rows), 1, &out_base, &out_len);
+            if (!out) {
+                log_error("출력 매핑 실패: %s (행 %d)\n", outputs[k], y0);
+                result = -1;
+                break;
+            }
+            for (int row = 0; row < rows; row++) {
+                rgbg_row_to_samples(&rgbg, row, sampleBuffer, output_bits[k]);
+                place_samples_to_ppm_row(sampleBuffer, out + (size_t)row * row_bytes, width,
+                                         ((rgbg.y0 + row + rgbg.order) % 2) == 0, rgbg.x0 & 1);
+            }
+            munmap(out_base, out_len);
+        }
+    }
 
-            // RGB 순서로 저장 (각 채널당 2바이트)
-            fwrite(&r_high, 1, 1, file);
-            fwrite(&r_low, 1, 1, file);
-            fwrite(&g_high, 1, 1, file);
-            fwrite(&g_low, 1, 1, file);
-            fwrite(&b_high, 1, 1, file);
-            fwrite(&b_low, 1, 1, file);
+    free(sampleBuffer);
+    free_rgb(&rgb);
+    free_rgbg(&rgbg);
+    if (in_fd >= 0) {
+        close(in_fd);
+    }
+    for (int k = 0; k < 2; k++) {
+        if (out_fd[k] >= 0) {
+            close(out_fd[k]);
+            if (result == 0) {
+                log_debug("%dbit PPM 파일 저장 완료: %s\n", output_bits[k], outputs[k]);
+            }
         }
     }
+    return result;
+#endif
+}
 
-    fclose(file);
-    printf("10bit PPM 파일 저장 완료: %s\n", filename);
-    return 0;
+// ============================================================
+// 패킹 RAW (RAW10/RAW12) 입출력
+// ============================================================
+// 파일 구조: 16바이트 헤더 + 행 단위 패킹 데이터
+//   헤더: "RGBG" 매직(4) + version(1) + bits(1) + order(1) + flags(1)
+//         + width(4, LE) + height(4, LE)
+//     order: 첫 행의 패턴 (0 = Even row 패턴으로 시작, ROI/타일은 시작 행 패리티 포함)
+//     flags bit0: 첫 열이 패널 홀수 열 (ROI/타일이 홀수 열에서 시작)
+//   데이터: 각 행의 네이티브 서브픽셀(픽셀당 2개)을 순서대로 패킹
+//     RAW10: 샘플 4개 -> 5바이트 [s0>>2][s1>>2][s2>>2][s3>>2][하위 2비트 x4]
+//     RAW12: 샘플 2개 -> 3바이트 [s0>>4][s1>>4][하위 4비트 x2]
+//   행 끝의 남는 샘플은 0으로 채워서 그룹을 완성함
+// PPM 저장 대비 1/3 이하 크기 (1080x2392 RAW10 기준 약 6.5MB)
+
+#define RAW_HEADER_SIZE 16
+#define RAW_VERSION 1
+#define RAW_FLAG_ODD_COL 0x01
+
+// 행당 패킹 바이트 수 계산
+static size_t raw_row_bytes(int width, int bits) {
+    size_t samples = (size_t)width * 2;
+    if (bits == 10) {
+        return ((samples + 3) / 4) * 5;
+    }
+    return ((samples + 1) / 2) * 3;
 }
 
-// RGBG 배열을 12bit PPM 파일로 저장
-int save_rgbg_to_ppm_12bit(RGBGArray *rgbg, const char *filename) {
-    if (!rgbg || !rgbg->data) {
-        printf("유효하지 않은 RGBG 배열\n");
-        return -1;
+static void put_le32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v & 0xFF);
+    p[1] = (uint8_t)((v >> 8) & 0xFF);
+    p[2] = (uint8_t)((v >> 16) & 0xFF);
+    p[3] = (uint8_t)((v >> 24) & 0xFF);
+}
+
+static uint32_t get_le32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+           ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// 샘플 n개(4의 배수로 0 패딩됨)를 RAW10으로 패킹
+static void pack_raw10_row(const uint16_t *src, uint8_t *dst, size_t n) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    // 샘플 8개(그룹 2개) -> 10바이트
+    const __m128i lo_mask = _mm_set1_epi16(0x3);
+    const __m128i mul_pair = _mm_setr_epi16(1, 4, 1, 4, 1, 4, 1, 4);
+    const __m128i mul_quad = _mm_setr_epi16(1, 16, 1, 16, 1, 16, 1, 16);
+    for (; i + 8 <= n; i += 8) {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i hi = _mm_packus_epi16(_mm_srli_epi16(s, 2), _mm_setzero_si128());
+        // 하위 2비트 4개를 1바이트로 결합: (l0 + 4*l1) + 16*(l2 + 4*l3)
+        __m128i pair = _mm_madd_epi16(_mm_and_si128(s, lo_mask), mul_pair);
+        __m128i quad = _mm_madd_epi16(_mm_packs_epi32(pair, pair), mul_quad);
+        uint8_t hi_bytes[16];
+        _mm_storeu_si128((__m128i *)hi_bytes, hi);
+        memcpy(dst, hi_bytes, 4);
+        dst[4] = (uint8_t)_mm_cvtsi128_si32(quad);
+        memcpy(dst + 5, hi_bytes + 4, 4);
+        dst[9] = (uint8_t)_mm_cvtsi128_si32(_mm_srli_si128(quad, 4));
+        dst += 10;
+    }
+#endif
+    for (; i < n; i += 4) {
+        dst[0] = (uint8_t)(src[i + 0] >> 2);
+        dst[1] = (uint8_t)(src[i + 1] >> 2);
+        dst[2] = (uint8_t)(src[i + 2] >> 2);
+        dst[3] = (uint8_t)(src[i + 3] >> 2);
+        dst[4] = (uint8_t)((src[i + 0] & 0x3) | ((src[i + 1] & 0x3) << 2) |
+                           ((src[i + 2] & 0x3) << 4) | ((src[i + 3] & 0x3) << 6));
+        dst += 5;
     }
+}
 
-    // 디렉토리 생성
-    char dir_path[1024];
-    strncpy(dir_path, filename, sizeof(dir_path) - 1);
-    dir_path[sizeof(dir_path) - 1] = '\0';
-    
-    char *last_slash = strrchr(dir_path, '/');
-    if (!last_slash) {
-        last_slash = strrchr(dir_path, '\\');
+// 샘플 n개(2의 배수로 0 패딩됨)를 RAW12로 패킹
+static void pack_raw12_row(const uint16_t *src, uint8_t *dst, size_t n) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    // 샘플 8개(그룹 4개) -> 12바이트
+    const __m128i lo_mask = _mm_set1_epi16(0xF);
+    const __m128i mul_pair = _mm_setr_epi16(1, 16, 1, 16, 1, 16, 1, 16);
+    for (; i + 8 <= n; i += 8) {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i hi = _mm_packus_epi16(_mm_srli_epi16(s, 4), _mm_setzero_si128());
+        // 하위 4비트 2개를 1바이트로 결합: l0 + 16*l1
+        __m128i pair = _mm_madd_epi16(_mm_and_si128(s, lo_mask), mul_pair);
+        uint8_t hi_bytes[16];
+        uint32_t lo_bytes[4];
+        _mm_storeu_si128((__m128i *)hi_bytes, hi);
+        _mm_storeu_si128((__m128i *)lo_bytes, pair);
+        for (int g = 0; g < 4; g++) {
+            dst[0] = hi_bytes[g * 2 + 0];
+            dst[1] = hi_bytes[g * 2 + 1];
+            dst[2] = (uint8_t)lo_bytes[g];
+            dst += 3;
+        }
     }
-    if (last_slash) {
-        *last_slash = '\0';
-        if (create_directory(dir_path) != 0) {
-            printf("디렉토리 생성 실패: %s\n", dir_path);
-            return -1;
+#endif
+    for (; i < n; i += 2) {
+        dst[0] = (uint8_t)(src[i + 0] >> 4);
+        dst[1] = (uint8_t)(src[i + 1] >> 4);
+        dst[2] = (uint8_t)((src[i + 0] & 0xF) | ((src[i + 1] & 0xF) << 4));
+        dst += 3;
+    }
+}
+
+// 스칼라 언패킹 (SSSE3 미지원 환경 및 행 끝 처리용)
+static void unpack_raw_row_scalar(const uint8_t *src, uint16_t *dst,
+                                  size_t start, size_t n, int bits) {
+    if (bits == 10) {
+        for (size_t i = start; i < n; i += 4) {
+            const uint8_t *g = src + (i / 4) * 5;
+            dst[i + 0] = (uint16_t)((g[0] << 2) | ((g[4] >> 0) & 0x3));
+            dst[i + 1] = (uint16_t)((g[1] << 2) | ((g[4] >> 2) & 0x3));
+            dst[i + 2] = (uint16_t)((g[2] << 2) | ((g[4] >> 4) & 0x3));
+            dst[i + 3] = (uint16_t)((g[3] << 2) | ((g[4] >> 6) & 0x3));
+        }
+    } else {
+        for (size_t i = start; i < n; i += 2) {
+            const uint8_t *g = src + (i / 2) * 3;
+            dst[i + 0] = (uint16_t)((g[0] << 4) | (g[2] & 0xF));
+            dst[i + 1] = (uint16_t)((g[1] << 4) | (g[2] >> 4));
         }
     }
+}
 
-    FILE *file = fopen(filename, "wb");
-    if (!file) {
-        printf("파일을 생성할 수 없습니다: %s\n", filename);
+#if RAW_HAVE_SSSE3
+// RAW10/RAW12 언패킹 (pshufb로 바이트 재배치 후 16bit 레인에서 비트 결합)
+__attribute__((target("ssse3")))
+static void unpack_raw_row_ssse3(const uint8_t *src, uint16_t *dst,
+                                 size_t n, size_t src_bytes, int bits) {
+    size_t i = 0;
+    if (bits == 10) {
+        // 16바이트 로드 중 10바이트(그룹 2개) 사용 -> 샘플 8개
+        const __m128i hi_shuf = _mm_setr_epi8(0, -1, 1, -1, 2, -1, 3, -1,
+                                              5, -1, 6, -1, 7, -1, 8, -1);
+        const __m128i lo_shuf = _mm_setr_epi8(4, -1, 4, -1, 4, -1, 4, -1,
+                                              9, -1, 9, -1, 9, -1, 9, -1);
+        const __m128i lo_mul = _mm_setr_epi16(64, 16, 4, 1, 64, 16, 4, 1);
+        for (; i + 8 <= n && (i / 4) * 5 + 16 <= src_bytes; i += 8) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(src + (i / 4) * 5));
+            __m128i hi = _mm_slli_epi16(_mm_shuffle_epi8(v, hi_shuf), 2);
+            __m128i lo = _mm_mullo_epi16(_mm_shuffle_epi8(v, lo_shuf), lo_mul);
+            lo = _mm_and_si128(_mm_srli_epi16(lo, 6), _mm_set1_epi16(0x3));
+            _mm_storeu_si128((__m128i *)(dst + i), _mm_or_si128(hi, lo));
+        }
+    } else {
+        // 16바이트 로드 중 12바이트(그룹 4개) 사용 -> 샘플 8개
+        const __m128i hi_shuf = _mm_setr_epi8(0, -1, 1, -1, 3, -1, 4, -1,
+                                              6, -1, 7, -1, 9, -1, 10, -1);
+        const __m128i lo_shuf = _mm_setr_epi8(2, -1, 2, -1, 5, -1, 5, -1,
+                                              8, -1, 8, -1, 11, -1, 11, -1);
+        const __m128i lo_mul = _mm_setr_epi16(16, 1, 16, 1, 16, 1, 16, 1);
+        for (; i + 8 <= n && (i / 2) * 3 + 16 <= src_bytes; i += 8) {
+            __m128i v = _mm_loadu_si128((const __m128i *)(src + (i / 2) * 3));
+            __m128i hi = _mm_slli_epi16(_mm_shuffle_epi8(v, hi_shuf), 4);
+            __m128i lo = _mm_mullo_epi16(_mm_shuffle_epi8(v, lo_shuf), lo_mul);
+            lo = _mm_and_si128(_mm_srli_epi16(lo, 4), _mm_set1_epi16(0xF));
+            _mm_storeu_si128((__m128i *)(dst + i), _mm_or_si128(hi, lo));
+        }
+    }
+    unpack_raw_row_scalar(src, dst, i, n, bits);
+}
+#endif
+
+// 패킹된 행을 샘플 n개(패딩 포함)로 언패킹
+static void unpack_raw_row(const uint8_t *src, uint16_t *dst,
+                           size_t n, size_t src_bytes, int bits) {
+#if RAW_HAVE_SSSE3
+    static int has_ssse3 = -1;
+    if (has_ssse3 < 0) {
+        has_ssse3 = __builtin_cpu_supports("ssse3") ? 1 : 0;
+    }
+    if (has_ssse3) {
+        unpack_raw_row_ssse3(src, dst, n, src_bytes, bits);
+        return;
+    }
+#endif
+    (void)src_bytes;
+    unpack_raw_row_scalar(src, dst, 0, n, bits);
+}
+
+// RGBG 배열 한 프레임을 출력 대상에 패킹 RAW(헤더 포함)로 쓰기
+// 시퀀스 출력처럼 여러 프레임을 한 파일에 이어 쓸 때 사용
+int write_rgbg_raw(OutputSink *sink, RGBGArray *rgbg, int bits) {
+    if (!rgbg || (!rgbg->data && !rgbg->data16)) {
+        log_error("유효하지 않은 RGBG 배열\n");
+        return -1;
+    }
+    if (bits != 10 && bits != 12) {
+        log_error("지원하지 않는 RAW 비트 수: %d (10 또는 12)\n", bits);
+        return -1;
+    }
+
+    // 헤더 작성
+    uint8_t header[RAW_HEADER_SIZE];
+    memcpy(header, "RGBG", 4);
+    header[4] = RAW_VERSION;
+    header[5] = (uint8_t)bits;
+    header[6] = (uint8_t)((rgbg->order + rgbg->y0) & 1);
+    header[7] = (uint8_t)((rgbg->x0 & 1) ? RAW_FLAG_ODD_COL : 0);
+    put_le32(header + 8, (uint32_t)rgbg->width);
+    put_le32(header + 12, (uint32_t)rgbg->height);
+    if (sink_write(sink, header, RAW_HEADER_SIZE) != 0) {
+        log_error("RAW 헤더 쓰기 실패\n");
         return -1;
     }
 
-    // PPM 헤더 작성 (P6 형식, 12bit = 최대값 4095)
-    // RGBG 배열을 RGB 3채널 형식으로 변환하여 저장
-    // Even row: [R, G, 0], [0, G, B]
-    // Odd row:  [0, G, B], [R, G, 0]
-    fprintf(file, "P6\n%d %d\n4095\n", rgbg->width, rgbg->height);
+    // 행 단위 패킹: 저장 깊이 -> 10/12bit 변환 후 패킹
+    size_t samples = (size_t)rgbg->width * 2;
+    size_t padded = (samples + 3) & ~(size_t)3;
+    size_t row_bytes = raw_row_bytes(rgbg->width, bits);
+    uint16_t *sampleBuffer = (uint16_t *)calloc(padded, sizeof(uint16_t));
+    uint8_t *rowBuffer = (uint8_t *)malloc(row_bytes);
+    if (!sampleBuffer || !rowBuffer) {
+        log_error("행 버퍼 할당 실패\n");
+        free(sampleBuffer);
+        free(rowBuffer);
+        return -1;
+    }
 
-    // RGBG 배열을 RGB 3채널 형식으로 변환하여 저장
+    int result = 0;
     for (int y = 0; y < rgbg->height; y++) {
-        for (int x = 0; x < rgbg->width; x++) {
-            int pixelIndex = y * rgbg->width + x;
-            int rgbgIndex = pixelIndex * 2; // 각 픽셀당 2바이트
+        rgbg_row_to_samples(rgbg, y, sampleBuffer, bits);
+        if (bits == 10) {
+            pack_raw10_row(sampleBuffer, rowBuffer, padded);
+        } else {
+            pack_raw12_row(sampleBuffer, rowBuffer, samples);
+        }
+        if (sink_write(sink, rowBuffer, row_bytes) != 0) {
+            log_error("RAW 데이터 쓰기 실패\n");
+            result = -1;
+            break;
+        }
+    }
 
-            // RGBG 배열에서 2바이트 가져오기
-            uint8_t ch1 = rgbg->data[rgbgIndex + 0];
-            uint8_t ch2 = rgbg->data[rgbgIndex + 1];
+    free(sampleBuffer);
+    free(rowBuffer);
+    return result;
+}
 
-            // RGB 3채널로 변환
-            uint8_t r, g, b;
-            if (y % 2 == 0) {
-                // Even row: [R, G, 0], [0, G, B]
-                if (x % 2 == 0) {
-                    // 짝수 열: [R, G] → [R, G, 0]
-                    r = ch1; // R
-                    g = ch2; // G
-                    b = 0;   // 0
-                } else {
-                    // 홀수 열: [G, B] → [0, G, B]
-                    r = 0;   // 0
-                    g = ch1; // G
-                    b = ch2; // B
-                }
-            } else {
-                // Odd row: [0, G, B], [R, G, 0]
-                if (x % 2 == 0) {
-                    // 짝수 열: [B, G] → [0, G, B]
-                    r = 0;   // 0
-                    g = ch2; // G
-                    b = ch1; // B
-                } else {
-                    // 홀수 열: [R, G] → [R, G, 0]
-                    r = ch1; // R
-                    g = ch2; // G
-                    b = 0;   // 0
-                }
-            }
+// RGBG 배열을 패킹 RAW 파일로 저장
+int save_rgbg_to_raw(RGBGArray *rgbg, const char *filename, int bits) {
+    if (ensure_parent_directory(filename) != 0) {
+        return -1;
+    }
 
-            // 8bit (0-255)를 12bit (0-4095)로 확장
-            // 공식: 12bit_value = (8bit_value * 4095) / 255
-            uint16_t r_12bit = (uint16_t)((r * 4095) / 255);
-            uint16_t g_12bit = (uint16_t)((g * 4095) / 255);
-            uint16_t b_12bit = (uint16_t)((b * 4095) / 255);
+    OutputSink sink;
+    if (sink_open_file(&sink, filename) != 0) {
+        return -1;
+    }
 
-            // 빅엔디안으로 16bit 값 저장 (PPM은 빅엔디안)
-            uint8_t r_high = (r_12bit >> 8) & 0xFF;
-            uint8_t r_low = r_12bit & 0xFF;
-            uint8_t g_high = (g_12bit >> 8) & 0xFF;
-            uint8_t g_low = g_12bit & 0xFF;
-            uint8_t b_high = (b_12bit >> 8) & 0xFF;
-            uint8_t b_low = b_12bit & 0xFF;
+    int result = write_rgbg_raw(&sink, rgbg, bits);
+    if (sink_close(&sink) != 0) {
+        result = -1;
+    }
+    if (result == 0) {
+        log_debug("RAW%d 파일 저장 완료: %s\n", bits, filename);
+    }
+    return result;
+}
 
-            // RGB 순서로 저장 (각 채널당 2바이트)
-            fwrite(&r_high, 1, 1, file);
-            fwrite(&r_low, 1, 1, file);
-            fwrite(&g_high, 1, 1, file);
-            fwrite(&g_low, 1, 1, file);
-            fwrite(&b_high, 1, 1, file);
-            fwrite(&b_low, 1, 1, file);
-        }
+// RAW 파일 헤더 읽기 및 검증
+static int read_raw_header(FILE *in, const char *filename,
+                           int *bits, int *order, int *odd_col, int *width, int *height) {
+    uint8_t header[RAW_HEADER_SIZE];
+    if (fread(header, 1, RAW_HEADER_SIZE, in) != RAW_HEADER_SIZE ||
+        memcmp(header, "RGBG", 4) != 0) {
+        log_error("RAW 파일이 아닙니다: %s\n", filename);
+        return -1;
     }
 
-    fclose(file);
-    printf("12bit PPM 파일 저장 완료: %s\n", filename);
+    *bits = header[5];
+    *order = header[6] & 1;
+    *odd_col = (header[7] & RAW_FLAG_ODD_COL) ? 1 : 0;
+    *width = (int)get_le32(header + 8);
+    *height = (int)get_le32(header + 12);
+    if (header[4] != RAW_VERSION || (*bits != 10 && *bits != 12) ||
+        *width <= 0 || *height <= 0) {
+        log_error("지원하지 않는 RAW 헤더: version=%d, bits=%d, %d x %d\n",
+                  header[4], *bits, *width, *height);
+        return -1;
+    }
     return 0;
 }
 
-// RGB 배열을 8bit BMP 파일로 저장
-int save_rgb_to_bmp_8bit(RGBArray *rgb, const char *filename) {
-    if (!rgb || !rgb->r || !rgb->g || !rgb->b) {
-        printf("유효하지 않은 RGB 배열\n");
+// 패킹 RAW 파일을 RGBG 배열로 읽기 (비트 깊이 = RAW 비트 수)
+int read_raw(const char *filename, RGBGArray *rgbg) {
+    memset(rgbg, 0, sizeof(*rgbg));
+    FILE *in = fopen(filename, "rb");
+    if (!in) {
+        log_error("파일을 열 수 없습니다: %s\n", filename);
         return -1;
     }
 
-    // 입력 파일명에서 파일명만 추출
-    const char *base_name = strrchr(filename, '/');
-    if (!base_name) {
-        base_name = strrchr(filename, '\\');
+    int bits, order, odd_col, width, height;
+    if (read_raw_header(in, filename, &bits, &order, &odd_col, &width, &height) != 0) {
+        fclose(in);
+        return -1;
     }
-    if (base_name) {
-        base_name++; // 슬래시 다음부터
-    } else {
-        base_name = filename; // 경로가 없으면 전체를 파일명으로 사용
+
+    size_t samples = (size_t)width * 2;
+    size_t padded = (samples + 3) & ~(size_t)3;
+    size_t row_bytes = raw_row_bytes(width, bits);
+    uint8_t *rowBuffer = (uint8_t *)malloc(row_bytes);
+    uint16_t *sampleBuffer = (uint16_t *)malloc(padded * sizeof(uint16_t));
+    rgbg->data16 = (uint16_t *)malloc(samples * (size_t)height * sizeof(uint16_t));
+    if (!rowBuffer || !sampleBuffer || !rgbg->data16) {
+        log_error("RAW 버퍼 할당 실패\n");
+        free(rowBuffer);
+        free(sampleBuffer);
+        free_rgbg(rgbg);
+        fclose(in);
+        return -1;
     }
+    rgbg->width = width;
+    rgbg->height = height;
+    rgbg->order = order;
+    rgbg->depth = bits;
+    rgbg->x0 = odd_col; // 열 패리티만 보존됨
 
-    // test_out/img 경로로 저장 경로 생성
-    char output_path[1024];
-    snprintf(output_path, sizeof(output_path), "test_out/img/%s", base_name);
+    int result = 0;
+    for (int y = 0; y < height; y++) {
+        if (fread(rowBuffer, 1, row_bytes, in) != row_bytes) {
+            log_error("RAW 데이터 읽기 실패: %s\n", filename);
+            result = -1;
+            break;
+        }
+        unpack_raw_row(rowBuffer, sampleBuffer,
+                       bits == 10 ? padded : samples, row_bytes, bits);
+        memcpy(rgbg->data16 + (size_t)y * samples, sampleBuffer, samples * sizeof(uint16_t));
+    }
 
-    // test_out/img 디렉토리 생성
-    if (create_directory("test_out/img") != 0) {
-        printf("디렉토리 생성 실패: test_out/img\n");
+    free(rowBuffer);
+    free(sampleBuffer);
+    fclose(in);
+    if (result != 0) {
+        free_rgbg(rgbg);
+    }
+    return result;
+}
+
+// 패킹 RAW 파일을 PPM 파일로 변환
+// RAW의 비트 수를 그대로 PPM 최대값으로 사용 (10bit -> 1023, 12bit -> 4095)
+int convert_raw_to_ppm(const char *raw_filename, const char *ppm_filename) {
+    FILE *in = fopen(raw_filename, "rb");
+    if (!in) {
+        log_error("파일을 열 수 없습니다: %s\n", raw_filename);
         return -1;
     }
 
-    FILE *file = fopen(output_path, "wb");
-    if (!file) {
-        printf("파일을 생성할 수 없습니다: %s\n", output_path);
+    int bits, order, odd_col, width, height;
+    if (read_raw_header(in, raw_filename, &bits, &order, &odd_col, &width, &height) != 0) {
+        fclose(in);
+        return -1;
+    }
+
+    if (ensure_parent_directory(ppm_filename) != 0) {
+        fclose(in);
+        return -1;
+    }
+
+    FILE *out = fopen(ppm_filename, "wb");
+    if (!out) {
+        log_error("파일을 생성할 수 없습니다: %s\n", ppm_filename);
+        fclose(in);
+        return -1;
+    }
+
+    fprintf(out, "P6\n%d %d\n%d\n", width, height, (1 << bits) - 1);
+
+    size_t samples = (size_t)width * 2;
+    size_t padded = (samples + 3) & ~(size_t)3;
+    size_t row_bytes = raw_row_bytes(width, bits);
+    uint8_t *rowBuffer = (uint8_t *)malloc(row_bytes);
+    uint16_t *sampleBuffer = (uint16_t *)malloc(padded * sizeof(uint16_t));
+    uint8_t *ppmRow = (uint8_t *)malloc((size_t)width * 6);
+    if (!rowBuffer || !sampleBuffer || !ppmRow) {
+        log_error("행 버퍼 할당 실패\n");
+        free(rowBuffer);
+        free(sampleBuffer);
+        free(ppmRow);
+        fclose(in);
+        fclose(out);
+        return -1;
+    }
+
+    int result = 0;
+    for (int y = 0; y < height; y++) {
+        if (fread(rowBuffer, 1, row_bytes, in) != row_bytes) {
+            log_error("RAW 데이터 읽기 실패: %s\n", raw_filename);
+            result = -1;
+            break;
+        }
+        unpack_raw_row(rowBuffer, sampleBuffer,
+                       bits == 10 ? padded : samples, row_bytes, bits);
+
+        // 서브픽셀을 RGB 3채널 위치로 배치 (PPM 저장과 동일한 배치)
+        place_samples_to_ppm_row(sampleBuffer, ppmRow, width, ((y + order) % 2) == 0, odd_col);
+        fwrite(ppmRow, 1, (size_t)width * 6, out);
+    }
+
+    free(rowBuffer);
+    free(sampleBuffer);
+    free(ppmRow);
+    fclose(in);
+    fclose(out);
+    if (result == 0) {
+        log_debug("RAW%d -> PPM 변환 완료: %s\n", bits, ppm_filename);
+    }
+    return result;
+}
+
+// RGB 배열을 8bit 팔레트 BMP 형식으로 출력
+int write_rgb_bmp_8bit(OutputSink *sink, RGBArray *rgb) {
+    if (rgb && rgb->depth != 8 && rgb->r16) {
+        // 10/12/16bit 배열은 8bit로 줄인 복사본으로 저장
+        RGBArray rgb8;
+        if (rgb_convert_depth(rgb, &rgb8, 8) != 0) {
+            return -1;
+        }
+        int result = write_rgb_bmp_8bit(sink, &rgb8);
+        free_rgb(&rgb8);
+        return result;
+    }
+    if (!rgb || !rgb->r || !rgb->g || !rgb->b) {
+        log_error("유효하지 않은 RGB 배열\n");
         return -1;
     }
 
@@ -556,8 +1677,8 @@ int save_rgb_to_bmp_8bit(RGBArray *rgb, const char *filename) {
     int height = rgb->height;
 
     // 행당 바이트 수 계산 (4바이트 정렬)
-    int rowSize = ((width + 3) / 4) * 4;
-    int imageSize = rowSize * height;
+    size_t rowSize = (((size_t)width + 3) / 4) * 4;
+    uint64_t imageSize = (uint64_t)rowSize * (uint64_t)height;
     int paletteSize = 256 * 4; // 256색 * 4바이트 (BGR + reserved)
 
     // 팔레트 생성 (6-6-6 비트 양자화를 사용하여 256색 생성)
@@ -594,16 +1715,15 @@ int save_rgb_to_bmp_8bit(RGBArray *rgb, const char *filename) {
 
     // RGB 값을 팔레트 인덱스로 변환하는 함수
     // 가장 가까운 팔레트 색상을 찾음
-    uint8_t *indexData = (uint8_t *)malloc(width * height);
+    uint8_t *indexData = (uint8_t *)malloc((size_t)width * (size_t)height);
     if (!indexData) {
-        printf("인덱스 데이터 메모리 할당 실패\n");
-        fclose(file);
+        log_error("인덱스 데이터 메모리 할당 실패\n");
         return -1;
     }
 
     for (int y = 0; y < height; y++) {
         for (int x = 0; x < width; x++) {
-            int pixelIndex = y * width + x;
+            size_t pixelIndex = (size_t)y * width + x;
             uint8_t r = rgb->r[pixelIndex];
             uint8_t g = rgb->g[pixelIndex];
             uint8_t b = rgb->b[pixelIndex];
@@ -631,7 +1751,9 @@ int save_rgb_to_bmp_8bit(RGBArray *rgb, const char *filename) {
     // BMP 파일 헤더 작성
     BMPFileHeader fileHeader;
     fileHeader.type = 0x4D42; // 'BM'
-    fileHeader.size = sizeof(BMPFileHeader) + sizeof(BMPInfoHeader) + paletteSize + imageSize;
+    // 4GB를 넘는 BMP는 크기 필드를 표현할 수 없으므로 0으로 기록 (BI_RGB에서 허용)
+    uint64_t fileSize = sizeof(BMPFileHeader) + sizeof(BMPInfoHeader) + paletteSize + imageSize;
+    fileHeader.size = fileSize <= UINT32_MAX ? (uint32_t)fileSize : 0;
     fileHeader.reserved1 = 0;
     fileHeader.reserved2 = 0;
     fileHeader.offset = sizeof(BMPFileHeader) + sizeof(BMPInfoHeader) + paletteSize;
@@ -644,87 +1766,198 @@ int save_rgb_to_bmp_8bit(RGBArray *rgb, const char *filename) {
     infoHeader.planes = 1;
     infoHeader.bitCount = 8;
     infoHeader.compression = 0; // BI_RGB
-    infoHeader.imageSize = imageSize;
+    infoHeader.imageSize = imageSize <= UINT32_MAX ? (uint32_t)imageSize : 0;
     infoHeader.xPixelsPerM = 0;
     infoHeader.yPixelsPerM = 0;
     infoHeader.colorsUsed = 256;
     infoHeader.colorsImportant = 256;
 
     // 헤더 쓰기
-    fwrite(&fileHeader, sizeof(BMPFileHeader), 1, file);
-    fwrite(&infoHeader, sizeof(BMPInfoHeader), 1, file);
+    sink_write(sink, &fileHeader, sizeof(BMPFileHeader));
+    sink_write(sink, &infoHeader, sizeof(BMPInfoHeader));
 
     // 팔레트 쓰기
-    fwrite(palette, 1, paletteSize, file);
+    sink_write(sink, palette, paletteSize);
 
     // 픽셀 데이터 쓰기 (bottom-up, 행은 역순)
     uint8_t *rowBuffer = (uint8_t *)malloc(rowSize);
     if (!rowBuffer) {
-        printf("행 버퍼 할당 실패\n");
+        log_error("행 버퍼 할당 실패\n");
         free(indexData);
-        fclose(file);
         return -1;
     }
 
-    for (int y = height - 1; y >= 0; y--) {
+    int result = 0;
+    for (int y = height - 1; y >= 0 && result == 0; y--) {
         // 행 데이터 복사
         for (int x = 0; x < width; x++) {
-            int pixelIndex = y * width + x;
+            size_t pixelIndex = (size_t)y * width + x;
             rowBuffer[x] = indexData[pixelIndex];
         }
         // 패딩 추가
-        for (int x = width; x < rowSize; x++) {
+        for (size_t x = (size_t)width; x < rowSize; x++) {
             rowBuffer[x] = 0;
         }
-        fwrite(rowBuffer, 1, rowSize, file);
+        result = sink_write(sink, rowBuffer, rowSize);
     }
 
     free(rowBuffer);
     free(indexData);
-    fclose(file);
-    printf("8bit BMP 파일 저장 완료: %s\n", output_path);
-    return 0;
+    if (result != 0) {
+        log_error("BMP 데이터 쓰기 실패\n");
+    }
+    return result;
 }
 
-// 256GRAY.bmp 파일을 이용한 RGB, RGBG 배열 변환 테스트 함수
-int test_256gray_bmp(void) {
-    const char *filename = "test_img/1080x2392/256GRAY.bmp";
-    RGBArray rgb;
-    RGBGArray rgbg;
-
-    printf("========================================\n");
-    printf("256GRAY.bmp 변환 테스트 시작\n");
-    printf("========================================\n\n");
-
-    // BMP 파일 읽기
-    printf("[1/4] BMP 파일 읽는 중: %s\n", filename);
-    if (read_bmp(filename, &rgb) != 0) {
-        printf("오류: BMP 파일 읽기 실패\n");
+// RGB 배열을 24bit BMP 형식으로 출력 대상에 쓰기 (bottom-up, 팔레트 양자화 없음)
+int write_rgb_bmp24(OutputSink *sink, const RGBArray *rgb) {
+    if (rgb && rgb->depth != 8 && rgb->r16) {
+        RGBArray rgb8;
+        if (rgb_convert_depth(rgb, &rgb8, 8) != 0) {
+            return -1;
+        }
+        int result = write_rgb_bmp24(sink, &rgb8);
+        free_rgb(&rgb8);
+        return result;
+    }
+    if (!rgb || !rgb->r || !rgb->g || !rgb->b) {
+        log_error("유효하지 않은 RGB 배열\n");
         return -1;
     }
-    printf("✓ BMP 파일 읽기 성공\n\n");
 
-    // RGB 배열 정보 출력
-    printf("[2/4] RGB 배열 정보:\n");
-    print_rgb_info(&rgb, filename);
-    printf("\n");
+    int width = rgb->width;
+    int height = rgb->height;
+    size_t rowSize = (((size_t)width * 3 + 3) / 4) * 4;
+    uint64_t imageSize = (uint64_t)rowSize * (uint64_t)height;
+    uint64_t fileSize = sizeof(BMPFileHeader) + sizeof(BMPInfoHeader) + imageSize;
+
+    BMPFileHeader fileHeader;
+    BMPInfoHeader infoHeader;
+    memset(&fileHeader, 0, sizeof(fileHeader));
+    memset(&infoHeader, 0, sizeof(infoHeader));
+    fileHeader.type = 0x4D42; // 'BM'
+    fileHeader.size = fileSize <= UINT32_MAX ? (uint32_t)fileSize : 0;
+    fileHeader.offset = sizeof(BMPFileHeader) + sizeof(BMPInfoHeader);
+    infoHeader.size = sizeof(BMPInfoHeader);
+    infoHeader.width = width;
+    infoHeader.height = height; // 양수 = bottom-up
+    infoHeader.planes = 1;
+    infoHeader.bitCount = 24;
+    infoHeader.compression = 0; // BI_RGB
+    infoHeader.imageSize = imageSize <= UINT32_MAX ? (uint32_t)imageSize : 0;
+    sink_write(sink, &fileHeader, sizeof(BMPFileHeader));
+    sink_write(sink, &infoHeader, sizeof(BMPInfoHeader));
+
+    uint8_t *rowBuffer = (uint8_t *)calloc(rowSize, 1);
+    if (!rowBuffer) {
+        log_error("행 버퍼 할당 실패\n");
+        return -1;
+    }
+    int result = 0;
+    for (int y = height - 1; y >= 0 && result == 0; y--) {
+        size_t rowOffset = (size_t)y * width;
+        for (int x = 0; x < width; x++) {
+            // BMP는 BGR 순서로 저장됨
+            rowBuffer[x * 3 + 0] = rgb->b[rowOffset + x];
+            rowBuffer[x * 3 + 1] = rgb->g[rowOffset + x];
+            rowBuffer[x * 3 + 2] = rgb->r[rowOffset + x];
+        }
+        result = sink_write(sink, rowBuffer, rowSize);
+    }
+    free(rowBuffer);
+    if (result != 0) {
+        log_error("BMP 데이터 쓰기 실패\n");
+    }
+    return result;
+}
+
+// RGB 배열을 8bit BMP 파일로 저장 (test_out/img/<파일명>)
+int save_rgb_to_bmp_8bit(RGBArray *rgb, const char *filename) {
+    // 입력 파일명에서 파일명만 추출
+    const char *base_name = strrchr(filename, '/');
+    if (!base_name) {
+        base_name = strrchr(filename, '\\');
+    }
+    if (base_name) {
+        base_name++; // 슬래시 다음부터
+    } else {
+        base_name = filename; // 경로가 없으면 전체를 파일명으로 사용
+    }
+
+    // test_out/img 경로로 저장 경로 생성
+    char output_path[1024];
+    snprintf(output_path, sizeof(output_path), "test_out/img/%s", base_name);
+
+    // test_out/img 디렉토리 생성
+    if (create_directory("test_out/img") != 0) {
+        log_error("디렉토리 생성 실패: test_out/img\n");
+        return -1;
+    }
+
+    OutputSink sink;
+    if (sink_open_file(&sink, output_path) != 0) {
+        return -1;
+    }
+    int result = write_rgb_bmp_8bit(&sink, rgb);
+    if (sink_close(&sink) != 0 || result != 0) {
+        return -1;
+    }
+    log_debug("8bit BMP 파일 저장 완료: %s\n", output_path);
+    return 0;
+}
+
+// 테스트 입력 BMP 읽기 (파일이 없으면 같은 용도의 합성 패턴으로 대체)
+static int read_test_input(const char *filename, const char *pattern, RGBArray *rgb) {
+    PatternSpec spec;
+    if (access(filename, 0) == 0) {
+        return read_bmp(filename, rgb);
+    }
+    log_info("  %s 없음 -> 합성 패턴 %s 사용\n", filename, pattern);
+    if (pattern_parse(pattern, &spec) != 0) {
+        return -1;
+    }
+    return pattern_generate_rgb(&spec, 8, rgb);
+}
+
+// 256GRAY.bmp 파일을 이용한 RGB, RGBG 배열 변환 테스트 함수
+int test_256gray_bmp(void) {
+    const char *filename = "test_img/1080x2392/256GRAY.bmp";
+    RGBArray rgb;
+    RGBGArray rgbg;
+
+    log_info("========================================\n");
+    log_info("256GRAY.bmp 변환 테스트 시작\n");
+    log_info("========================================\n\n");
+
+    // BMP 파일 읽기
+    log_info("[1/4] BMP 파일 읽는 중: %s\n", filename);
+    if (read_test_input(filename, "bars,1080x2392", &rgb) != 0) {
+        log_error("오류: BMP 파일 읽기 실패\n");
+        return -1;
+    }
+    log_info("✓ BMP 파일 읽기 성공\n\n");
+
+    // RGB 배열 정보 출력
+    log_info("[2/4] RGB 배열 정보:\n");
+    print_rgb_info(&rgb, filename);
+    log_info("\n");
 
     // RGBG 배열 생성
-    printf("[3/4] RGBG 배열 생성 중...\n");
+    log_info("[3/4] RGBG 배열 생성 중...\n");
     if (rgb_to_rgbg(&rgb, &rgbg) != 0) {
-        printf("오류: RGBG 배열 생성 실패\n");
+        log_error("오류: RGBG 배열 생성 실패\n");
         free_rgb(&rgb);
         return -1;
     }
-    printf("✓ RGBG 배열 생성 성공\n\n");
+    log_info("✓ RGBG 배열 생성 성공\n\n");
 
     // RGBG 배열 정보 출력
-    printf("[4/4] RGBG 배열 정보:\n");
+    log_info("[4/4] RGBG 배열 정보:\n");
     print_rgbg_info(&rgbg, filename);
-    printf("\n");
+    log_info("\n");
 
     // 샘플 픽셀 값 출력 (처음 5개, 중간 5개, 마지막 5개)
-    printf("RGB 배열 샘플 픽셀 값:\n");
+    log_debug("RGB 배열 샘플 픽셀 값:\n");
     int total_pixels = rgb.width * rgb.height;
     int sample_indices[] = {0, 1, 2, 3, 4, 
                             total_pixels / 2, total_pixels / 2 + 1, total_pixels / 2 + 2,
@@ -734,49 +1967,49 @@ int test_256gray_bmp(void) {
     for (int i = 0; i < num_samples; i++) {
         int idx = sample_indices[i];
         if (idx < total_pixels) {
-            printf("  픽셀[%d]: R=%3d, G=%3d, B=%3d\n", 
-                   idx, rgb.r[idx], rgb.g[idx], rgb.b[idx]);
+            log_debug("  픽셀[%d]: R=%3d, G=%3d, B=%3d\n", 
+                      idx, rgb.r[idx], rgb.g[idx], rgb.b[idx]);
         }
     }
-    printf("\n");
+    log_debug("\n");
 
-    printf("RGBG 배열 샘플 픽셀 값:\n");
+    log_debug("RGBG 배열 샘플 픽셀 값:\n");
     for (int i = 0; i < num_samples; i++) {
         int idx = sample_indices[i];
         if (idx < total_pixels) {
             int rgbg_idx = idx * 2; // 각 픽셀당 2바이트
             int y = idx / rgb.width;
             int x = idx % rgb.width;
-            printf("  픽셀[%d] (%d,%d): [%3d, %3d]", 
-                   idx, y, x,
-                   rgbg.data[rgbg_idx], 
-                   rgbg.data[rgbg_idx + 1]);
+            log_debug("  픽셀[%d] (%d,%d): [%3d, %3d]", 
+                      idx, y, x,
+                      rgbg.data[rgbg_idx], 
+                      rgbg.data[rgbg_idx + 1]);
             // 패턴 설명
             if (y % 2 == 0) {
                 if (x % 2 == 0) {
-                    printf(" → Even row, 짝수 열: [R, G]");
+                    log_debug(" → Even row, 짝수 열: [R, G]");
                 } else {
-                    printf(" → Even row, 홀수 열: [G, B]");
+                    log_debug(" → Even row, 홀수 열: [G, B]");
                 }
             } else {
                 if (x % 2 == 0) {
-                    printf(" → Odd row, 짝수 열: [B, G]");
+                    log_debug(" → Odd row, 짝수 열: [B, G]");
                 } else {
-                    printf(" → Odd row, 홀수 열: [R, G]");
+                    log_debug(" → Odd row, 홀수 열: [R, G]");
                 }
             }
-            printf("\n");
+            log_debug("\n");
         }
     }
-    printf("\n");
+    log_debug("\n");
 
     // 메모리 해제
     free_rgb(&rgb);
     free_rgbg(&rgbg);
 
-    printf("========================================\n");
-    printf("테스트 완료!\n");
-    printf("========================================\n");
+    log_info("========================================\n");
+    log_info("테스트 완료!\n");
+    log_info("========================================\n");
     return 0;
 }
 
@@ -786,101 +2019,160 @@ int verify_rgbg_structure(void) {
     RGBArray rgb;
     RGBGArray rgbg;
 
-    printf("========================================\n");
-    printf("RGBG 배열 구조 확인 테스트\n");
-    printf("========================================\n\n");
+    log_info("========================================\n");
+    log_info("RGBG 배열 구조 확인 테스트\n");
+    log_info("========================================\n\n");
 
     // BMP 파일 읽기
-    printf("[1/3] BMP 파일 읽는 중: %s\n", filename);
-    if (read_bmp(filename, &rgb) != 0) {
-        printf("오류: BMP 파일 읽기 실패\n");
+    log_info("[1/3] BMP 파일 읽는 중: %s\n", filename);
+    if (read_test_input(filename, "bars,1080x2392", &rgb) != 0) {
+        log_error("오류: BMP 파일 읽기 실패\n");
         return -1;
     }
-    printf("✓ BMP 파일 읽기 성공 (크기: %d x %d)\n\n", rgb.width, rgb.height);
+    log_info("✓ BMP 파일 읽기 성공 (크기: %d x %d)\n\n", rgb.width, rgb.height);
 
     // RGBG 배열 생성
-    printf("[2/3] RGBG 배열 생성 중...\n");
+    log_info("[2/3] RGBG 배열 생성 중...\n");
     if (rgb_to_rgbg(&rgb, &rgbg) != 0) {
-        printf("오류: RGBG 배열 생성 실패\n");
+        log_error("오류: RGBG 배열 생성 실패\n");
         free_rgb(&rgb);
         return -1;
     }
-    printf("✓ RGBG 배열 생성 성공\n\n");
+    log_info("✓ RGBG 배열 생성 성공\n\n");
 
     // RGBG 배열 구조 확인 (2x2 그리드 패턴 확인)
-    printf("[3/3] RGBG 배열 구조 확인:\n");
-    printf("예상 패턴 (2x2 그리드):\n");
-    printf("  Even row (y=0): [R, G]  [G, B]  [R, G]  [G, B] ...\n");
-    printf("  Odd row  (y=1): [B, G]  [R, G]  [B, G]  [R, G] ...\n\n");
+    log_info("[3/3] RGBG 배열 구조 확인:\n");
+    log_debug("예상 패턴 (2x2 그리드):\n");
+    log_debug("  Even row (y=0): [R, G]  [G, B]  [R, G]  [G, B] ...\n");
+    log_debug("  Odd row  (y=1): [B, G]  [R, G]  [B, G]  [R, G] ...\n\n");
 
     // 처음 4개 픽셀 (2x2 그리드) 확인
-    printf("처음 2x2 그리드 픽셀 값:\n");
+    log_debug("처음 2x2 그리드 픽셀 값:\n");
     for (int y = 0; y < 2 && y < rgb.height; y++) {
         for (int x = 0; x < 2 && x < rgb.width; x++) {
             int pixelIndex = y * rgb.width + x;
             int rgbgIndex = pixelIndex * 2; // 각 픽셀당 2바이트
             
-            printf("  위치 (%d, %d):\n", y, x);
-            printf("    원본 RGB: R=%3d, G=%3d, B=%3d\n", 
-                   rgb.r[pixelIndex], rgb.g[pixelIndex], rgb.b[pixelIndex]);
-            printf("    RGBG 배열: [%3d, %3d]\n",
-                   rgbg.data[rgbgIndex + 0],
-                   rgbg.data[rgbgIndex + 1]);
+            log_debug("  위치 (%d, %d):\n", y, x);
+            log_debug("    원본 RGB: R=%3d, G=%3d, B=%3d\n", 
+                      rgb.r[pixelIndex], rgb.g[pixelIndex], rgb.b[pixelIndex]);
+            log_debug("    RGBG 배열: [%3d, %3d]\n",
+                      rgbg.data[rgbgIndex + 0],
+                      rgbg.data[rgbgIndex + 1]);
             
             // 패턴 확인
             if (y % 2 == 0) {
                 if (x % 2 == 0) {
-                    printf("    → Even row, 짝수 열: [R, G] 형태 ✓\n");
+                    log_debug("    → Even row, 짝수 열: [R, G] 형태 ✓\n");
                 } else {
-                    printf("    → Even row, 홀수 열: [G, B] 형태 ✓\n");
+                    log_debug("    → Even row, 홀수 열: [G, B] 형태 ✓\n");
                 }
             } else {
                 if (x % 2 == 0) {
-                    printf("    → Odd row, 짝수 열: [B, G] 형태 ✓\n");
+                    log_debug("    → Odd row, 짝수 열: [B, G] 형태 ✓\n");
                 } else {
-                    printf("    → Odd row, 홀수 열: [R, G] 형태 ✓\n");
+                    log_debug("    → Odd row, 홀수 열: [R, G] 형태 ✓\n");
                 }
             }
-            printf("\n");
+            log_debug("\n");
         }
     }
 
     // 실제 저장된 값 확인 (더 많은 샘플)
-    printf("실제 저장된 값 (처음 10개 픽셀):\n");
+    log_debug("실제 저장된 값 (처음 10개 픽셀):\n");
     for (int i = 0; i < 10 && i < rgb.width * rgb.height; i++) {
         int rgbgIndex = i * 2; // 각 픽셀당 2바이트
         int y = i / rgb.width;
         int x = i % rgb.width;
         
-        printf("  픽셀[%d] (%d,%d): [%3d, %3d]",
-               i, y, x,
-               rgbg.data[rgbgIndex + 0],
-               rgbg.data[rgbgIndex + 1]);
+        log_debug("  픽셀[%d] (%d,%d): [%3d, %3d]",
+                  i, y, x,
+                  rgbg.data[rgbgIndex + 0],
+                  rgbg.data[rgbgIndex + 1]);
         
         if (y % 2 == 0) {
             if (x % 2 == 0) {
-                printf(" → Even row, 짝수 열: [R, G]");
+                log_debug(" → Even row, 짝수 열: [R, G]");
             } else {
-                printf(" → Even row, 홀수 열: [G, B]");
+                log_debug(" → Even row, 홀수 열: [G, B]");
             }
         } else {
             if (x % 2 == 0) {
-                printf(" → Odd row, 짝수 열: [B, G]");
+                log_debug(" → Odd row, 짝수 열: [B, G]");
             } else {
-                printf(" → Odd row, 홀수 열: [R, G]");
+                log_debug(" → Odd row, 홀수 열: [R, G]");
             }
         }
-        printf("\n");
+        log_debug("\n");
+    }
+
+    // 전체 프레임 검증: 모든 픽셀을 원본 RGB와 비교
+    int failures = 0;
+    int first_x, first_y;
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    int64_t mismatches = rgbg_verify(&rgb, &rgbg, &first_x, &first_y);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double verify_ms = (double)(t1.tv_sec - t0.tv_sec) * 1e3 + (double)(t1.tv_nsec - t0.tv_nsec) * 1e-6;
+    log_info("\n전체 프레임 검증 (%d x %d): 불일치 %lld 픽셀 %s (%.2f ms)\n", rgb.width, rgb.height,
+             (long long)mismatches, mismatches == 0 ? "✓" : "✗", verify_ms);
+    if (mismatches != 0) {
+        log_error("  첫 불일치 위치: (%d, %d)\n", first_x, first_y);
+        failures++;
+    }
+
+    // 검증기 확인: 마지막 행 근처 샘플 하나를 바꾸면 그 위치 하나만 검출되어야 함
+    if (rgb.width >= 3 && rgb.height >= 2) {
+        int bad_x = rgb.width - 3, bad_y = rgb.height - 2;
+        size_t k = ((size_t)bad_y * rgb.width + bad_x) * 2 + 1;
+        rgbg.data[k] ^= 0x01;
+        mismatches = rgbg_verify(&rgb, &rgbg, &first_x, &first_y);
+        rgbg.data[k] ^= 0x01;
+        int detected = mismatches == 1 && first_x == bad_x && first_y == bad_y;
+        log_info("오류 삽입 (%d, %d): 검출 %lld 픽셀, 위치 (%d, %d) %s\n", bad_x, bad_y,
+                 (long long)mismatches, first_x, first_y, detected ? "✓" : "✗");
+        failures += !detected;
+    }
+
+    // 반대 서브픽셀 순서 / 홀수 시작 위치 / 12bit 배열도 같은 검증
+    // (회색 입력은 순서를 바꿔도 값이 같으므로 R 채널만 있는 그라데이션 사용)
+    int saved_order = ip_ports.por_rgbg_order;
+    PatternSpec spec;
+    RGBArray rgb16;
+    RGBGArray other;
+    ip_ports.por_rgbg_order = !(saved_order & 1);
+    pattern_parse("ramp,ch=r", &spec);
+    spec.width = rgb.width;
+    spec.height = rgb.height;
+    if (pattern_generate_rgb(&spec, 12, &rgb16) == 0) {
+        rgb16.x0 = 1;
+        rgb16.y0 = 3;
+        if (rgb_to_rgbg(&rgb16, &other) == 0) {
+            mismatches = rgbg_verify(&rgb16, &other, &first_x, &first_y);
+            other.order = !other.order;
+            int64_t swapped = rgbg_verify(&rgb16, &other, &first_x, &first_y);
+            int ok = mismatches == 0 && (swapped > 0 || rgb.height < 2);
+            log_info("12bit / 반대 순서 / 시작 (1, 3): 불일치 %lld 픽셀, 순서를 바꾸면 %lld 픽셀 %s\n",
+                     (long long)mismatches, (long long)swapped, ok ? "✓" : "✗");
+            failures += !ok;
+            free_rgbg(&other);
+        } else {
+            failures++;
+        }
+        free_rgb(&rgb16);
+    } else {
+        failures++;
     }
+    ip_ports.por_rgbg_order = saved_order;
 
     // 메모리 해제
     free_rgb(&rgb);
     free_rgbg(&rgbg);
 
-    printf("\n========================================\n");
-    printf("구조 확인 완료!\n");
-    printf("========================================\n");
-    return 0;
+    log_info("\n========================================\n");
+    log_info(failures ? "구조 확인 실패!\n" : "구조 확인 완료!\n");
+    log_info("========================================\n");
+    return failures ? -1 : 0;
 }
 
 // save_rgbg_to_ppm_10bit, save_rgbg_to_ppm_12bit 함수 테스트
@@ -889,300 +2181,3720 @@ int test_ppm_save_functions(void) {
     RGBArray rgb;
     RGBGArray rgbg;
 
-    printf("========================================\n");
-    printf("PPM 저장 함수 테스트 시작\n");
-    printf("========================================\n\n");
+    log_info("========================================\n");
+    log_info("PPM 저장 함수 테스트 시작\n");
+    log_info("========================================\n\n");
 
     // BMP 파일 읽기
-    printf("[1/5] BMP 파일 읽는 중: %s\n", filename);
-    if (read_bmp(filename, &rgb) != 0) {
-        printf("오류: BMP 파일 읽기 실패\n");
+    log_info("[1/5] BMP 파일 읽는 중: %s\n", filename);
+    if (read_test_input(filename, "bars,1080x2392", &rgb) != 0) {
+        log_error("오류: BMP 파일 읽기 실패\n");
         return -1;
     }
-    printf("✓ BMP 파일 읽기 성공 (크기: %d x %d)\n\n", rgb.width, rgb.height);
+    log_info("✓ BMP 파일 읽기 성공 (크기: %d x %d)\n\n", rgb.width, rgb.height);
 
     // RGBG 배열 생성
-    printf("[2/5] RGBG 배열 생성 중...\n");
+    log_info("[2/5] RGBG 배열 생성 중...\n");
     if (rgb_to_rgbg(&rgb, &rgbg) != 0) {
-        printf("오류: RGBG 배열 생성 실패\n");
+        log_error("오류: RGBG 배열 생성 실패\n");
         free_rgb(&rgb);
         return -1;
     }
-    printf("✓ RGBG 배열 생성 성공\n\n");
+    log_info("✓ RGBG 배열 생성 성공\n\n");
 
     // 샘플 픽셀 값 확인
-    printf("[3/5] 샘플 픽셀 값 확인:\n");
+    log_info("[3/5] 샘플 픽셀 값 확인:\n");
     int sample_idx = 0;
     int rgbg_idx = sample_idx * 2; // 각 픽셀당 2바이트
     int y = sample_idx / rgb.width;
     int x = sample_idx % rgb.width;
-    printf("  원본 RGB[0] (%d,%d): R=%3d, G=%3d, B=%3d\n", 
-           y, x, rgb.r[sample_idx], rgb.g[sample_idx], rgb.b[sample_idx]);
-    printf("  RGBG[0] (%d,%d): [%3d, %3d]", y, x,
-           rgbg.data[rgbg_idx], rgbg.data[rgbg_idx + 1]);
+    log_debug("  원본 RGB[0] (%d,%d): R=%3d, G=%3d, B=%3d\n", 
+              y, x, rgb.r[sample_idx], rgb.g[sample_idx], rgb.b[sample_idx]);
+    log_debug("  RGBG[0] (%d,%d): [%3d, %3d]", y, x,
+              rgbg.data[rgbg_idx], rgbg.data[rgbg_idx + 1]);
     if (y % 2 == 0) {
         if (x % 2 == 0) {
-            printf(" → Even row, 짝수 열: [R, G]\n");
+            log_debug(" → Even row, 짝수 열: [R, G]\n");
         } else {
-            printf(" → Even row, 홀수 열: [G, B]\n");
+            log_debug(" → Even row, 홀수 열: [G, B]\n");
         }
     } else {
         if (x % 2 == 0) {
-            printf(" → Odd row, 짝수 열: [B, G]\n");
+            log_debug(" → Odd row, 짝수 열: [B, G]\n");
         } else {
-            printf(" → Odd row, 홀수 열: [R, G]\n");
+            log_debug(" → Odd row, 홀수 열: [R, G]\n");
         }
     }
-    printf("\n");
+    log_debug("\n");
 
     // 10bit PPM 저장 테스트
     const char *ppm_10bit_file = "test_out/img/test_256GRAY_10bit.ppm";
-    printf("[4/5] 10bit PPM 파일 저장 테스트: %s\n", ppm_10bit_file);
+    log_info("[4/5] 10bit PPM 파일 저장 테스트: %s\n", ppm_10bit_file);
     if (save_rgbg_to_ppm_10bit(&rgbg, ppm_10bit_file) != 0) {
-        printf("오류: 10bit PPM 저장 실패\n");
+        log_error("오류: 10bit PPM 저장 실패\n");
         free_rgb(&rgb);
         free_rgbg(&rgbg);
         return -1;
     }
-    printf("✓ 10bit PPM 저장 성공\n\n");
+    log_info("✓ 10bit PPM 저장 성공\n\n");
 
     // 12bit PPM 저장 테스트
     const char *ppm_12bit_file = "test_out/img/test_256GRAY_12bit.ppm";
-    printf("[5/5] 12bit PPM 파일 저장 테스트: %s\n", ppm_12bit_file);
+    log_info("[5/5] 12bit PPM 파일 저장 테스트: %s\n", ppm_12bit_file);
     if (save_rgbg_to_ppm_12bit(&rgbg, ppm_12bit_file) != 0) {
-        printf("오류: 12bit PPM 저장 실패\n");
+        log_error("오류: 12bit PPM 저장 실패\n");
         free_rgb(&rgb);
         free_rgbg(&rgbg);
         return -1;
     }
-    printf("✓ 12bit PPM 저장 성공\n\n");
-
-    // 저장된 파일 검증 (파일 크기 확인)
-    FILE *file;
-    long file_size;
-    
-    file = fopen(ppm_10bit_file, "rb");
-    if (file) {
-        fseek(file, 0, SEEK_END);
-        file_size = ftell(file);
-        fclose(file);
-        // PPM 헤더 + 픽셀 데이터 (각 픽셀당 6바이트: R 2바이트 + G 2바이트 + B 2바이트)
-        long expected_size = 15 + (rgbg.width * rgbg.height * 6); // 헤더 약 15바이트 + 픽셀 데이터
-        printf("  10bit PPM 파일 크기: %ld bytes (예상: 약 %ld bytes, RGB 3채널)\n", 
-               file_size, expected_size);
-    }
-
-    file = fopen(ppm_12bit_file, "rb");
-    if (file) {
-        fseek(file, 0, SEEK_END);
-        file_size = ftell(file);
-        fclose(file);
-        long expected_size = 15 + (rgbg.width * rgbg.height * 6);
-        printf("  12bit PPM 파일 크기: %ld bytes (예상: 약 %ld bytes, RGB 3채널)\n", 
-               file_size, expected_size);
-    }
+    log_info("✓ 12bit PPM 저장 성공\n\n");
 
-    // 저장된 파일의 헤더 확인
-    printf("\n저장된 PPM 파일 헤더 확인:\n");
-    char header[64];
-    file = fopen(ppm_10bit_file, "rb");
-    if (file) {
-        if (fgets(header, sizeof(header), file)) {
-            printf("  10bit PPM 첫 줄: %s", header);
-        }
-        if (fgets(header, sizeof(header), file)) {
-            printf("  10bit PPM 크기: %s", header);
-        }
-        if (fgets(header, sizeof(header), file)) {
-            printf("  10bit PPM 최대값: %s", header);
+    // 저장 결과 검증: 같은 쓰기 함수를 메모리 / 해시 출력 대상으로 실행하여 확인
+    // (저장한 파일을 다시 열어 읽지 않음)
+    int failures = 0;
+    OutputSink mem[2];
+    const int bits_list[2] = { 10, 12 };
+    for (int k = 0; k < 2; k++) {
+        OutputSink hashed;
+        sink_init_memory(&mem[k]);
+        if (write_rgbg_ppm(&mem[k], &rgbg, bits_list[k]) != 0 || sink_init_hash(&hashed) != 0) {
+            log_error("오류: %dbit PPM 메모리 출력 실패\n", bits_list[k]);
+            free_rgb(&rgb);
+            free_rgbg(&rgbg);
+            sink_free(&mem[k]);
+            return -1;
         }
-        fclose(file);
-    }
+        write_rgbg_ppm(&hashed, &rgbg, bits_list[k]);
 
-    file = fopen(ppm_12bit_file, "rb");
-    if (file) {
-        if (fgets(header, sizeof(header), file)) {
-            printf("  12bit PPM 첫 줄: %s", header);
-        }
-        if (fgets(header, sizeof(header), file)) {
-            printf("  12bit PPM 크기: %s", header);
+        // PPM 헤더 + 픽셀 데이터 (각 픽셀당 6바이트: R 2바이트 + G 2바이트 + B 2바이트)
+        char header[64];
+        int header_len = snprintf(header, sizeof(header), "P6\n%d %d\n%d\n",
+                                  rgbg.width, rgbg.height, (1 << bits_list[k]) - 1);
+        uint64_t expected_size = (uint64_t)header_len + (uint64_t)rgbg.width * rgbg.height * 6;
+        int header_ok = mem[k].size >= (uint64_t)header_len &&
+                        memcmp(mem[k].data, header, (size_t)header_len) == 0;
+        log_info("  %dbit PPM: %llu bytes (예상: %llu bytes, RGB 3채널), 헤더 \"P6 %d %d %d\" %s\n",
+                 bits_list[k], (unsigned long long)mem[k].size, (unsigned long long)expected_size,
+                 rgbg.width, rgbg.height, (1 << bits_list[k]) - 1, header_ok ? "✓" : "✗");
+        if (mem[k].size != expected_size || !header_ok) {
+            failures++;
         }
-        if (fgets(header, sizeof(header), file)) {
-            printf("  12bit PPM 최대값: %s", header);
+
+        // 해시 출력 대상 결과 = 메모리 내용 해시 (골든 비교에 사용하는 값)
+        if (hashed.size != mem[k].size || sink_hash(&hashed) != sink_hash(&mem[k])) {
+            log_error("  ✗ %dbit PPM 해시 출력 불일치\n", bits_list[k]);
+            failures++;
         }
-        fclose(file);
+        sink_free(&hashed);
     }
 
-    // 저장된 PPM 파일의 패턴 확인 (처음 몇 개 픽셀)
-    printf("\n저장된 PPM 파일 패턴 확인 (처음 4개 픽셀):\n");
-    printf("예상 패턴:\n");
-    printf("  Even row (y=0): [R, G, 0]  [0, G, B]  [R, G, 0]  [0, G, B] ...\n");
-    printf("  Odd row  (y=1): [0, G, B]  [R, G, 0]  [0, G, B]  [R, G, 0] ...\n\n");
+    // 출력된 PPM의 패턴 확인 (처음 몇 개 픽셀)
+    log_debug("\n출력된 PPM 패턴 확인 (처음 4개 픽셀):\n");
+    log_debug("예상 패턴:\n");
+    log_debug("  Even row (y=0): [R, G, 0]  [0, G, B]  [R, G, 0]  [0, G, B] ...\n");
+    log_debug("  Odd row  (y=1): [0, G, B]  [R, G, 0]  [0, G, B]  [R, G, 0] ...\n\n");
 
-    file = fopen(ppm_10bit_file, "rb");
-    if (file) {
-        // 헤더 건너뛰기
-        if (fgets(header, sizeof(header), file) == NULL) goto cleanup_header; // P6
-        if (fgets(header, sizeof(header), file) == NULL) goto cleanup_header; // 크기
-        if (fgets(header, sizeof(header), file) == NULL) goto cleanup_header; // 최대값
-        
-        // 처음 4개 픽셀 읽기 (각 픽셀당 RGB 3채널 * 2바이트 = 6바이트)
-        for (int i = 0; i < 4 && i < rgbg.width * rgbg.height; i++) {
-            int y = i / rgbg.width;
-            int x = i % rgbg.width;
-            uint8_t r_bytes[2], g_bytes[2], b_bytes[2];
-            
-            if (fread(r_bytes, 1, 2, file) != 2) break;
-            if (fread(g_bytes, 1, 2, file) != 2) break;
-            if (fread(b_bytes, 1, 2, file) != 2) break;
-            
-            // 빅엔디안으로 10bit 값 읽기
-            uint16_t r_10bit = (r_bytes[0] << 8) | r_bytes[1];
-            uint16_t g_10bit = (g_bytes[0] << 8) | g_bytes[1];
-            uint16_t b_10bit = (b_bytes[0] << 8) | b_bytes[1];
-            
-            // 10bit를 8bit로 변환 (확인용)
-            uint8_t r = (r_10bit * 255) / 1023;
-            uint8_t g = (g_10bit * 255) / 1023;
-            uint8_t b = (b_10bit * 255) / 1023;
-            
-            printf("  픽셀[%d] (%d,%d): [R=%3d, G=%3d, B=%3d]", i, y, x, r, g, b);
-            
-            if (y % 2 == 0) {
-                if (x % 2 == 0) {
-                    printf(" → Even row, 짝수 열: [R, G, 0]");
-                    if (b == 0) printf(" ✓");
-                } else {
-                    printf(" → Even row, 홀수 열: [0, G, B]");
-                    if (r == 0) printf(" ✓");
-                }
+    // 헤더 다음부터 각 픽셀당 RGB 3채널 * 2바이트 = 6바이트 (빅엔디안)
+    const uint8_t *pixels = mem[0].data + (mem[0].size - (uint64_t)rgbg.width * rgbg.height * 6);
+    for (int i = 0; i < 4 && i < rgbg.width * rgbg.height; i++) {
+        int y = i / rgbg.width;
+        int x = i % rgbg.width;
+        const uint8_t *p = pixels + (size_t)i * 6;
+        uint16_t r_10bit = (uint16_t)((p[0] << 8) | p[1]);
+        uint16_t g_10bit = (uint16_t)((p[2] << 8) | p[3]);
+        uint16_t b_10bit = (uint16_t)((p[4] << 8) | p[5]);
+
+        // 10bit를 8bit로 변환 (확인용)
+        uint8_t r = (r_10bit * 255) / 1023;
+        uint8_t g = (g_10bit * 255) / 1023;
+        uint8_t b = (b_10bit * 255) / 1023;
+
+        log_debug("  픽셀[%d] (%d,%d): [R=%3d, G=%3d, B=%3d]", i, y, x, r, g, b);
+
+        if (y % 2 == 0) {
+            if (x % 2 == 0) {
+                log_debug(" → Even row, 짝수 열: [R, G, 0]");
+                if (b == 0) log_debug(" ✓");
             } else {
-                if (x % 2 == 0) {
-                    printf(" → Odd row, 짝수 열: [0, G, B]");
-                    if (r == 0) printf(" ✓");
-                } else {
-                    printf(" → Odd row, 홀수 열: [R, G, 0]");
-                    if (b == 0) printf(" ✓");
-                }
+                log_debug(" → Even row, 홀수 열: [0, G, B]");
+                if (r == 0) log_debug(" ✓");
+            }
+        } else {
+            if (x % 2 == 0) {
+                log_debug(" → Odd row, 짝수 열: [0, G, B]");
+                if (r == 0) log_debug(" ✓");
+            } else {
+                log_debug(" → Odd row, 홀수 열: [R, G, 0]");
+                if (b == 0) log_debug(" ✓");
             }
-            printf("\n");
         }
-        cleanup_header:
-        fclose(file);
+        log_debug("\n");
     }
+    sink_free(&mem[0]);
+    sink_free(&mem[1]);
 
     // 메모리 해제
     free_rgb(&rgb);
     free_rgbg(&rgbg);
 
-    printf("\n========================================\n");
-    printf("PPM 저장 함수 테스트 완료!\n");
-    printf("========================================\n");
-    return 0;
+    log_info("\n========================================\n");
+    log_info("PPM 저장 함수 테스트 완료!\n");
+    log_info("========================================\n");
+    return failures ? -1 : 0;
 }
 
-int main(int argc, char *argv[]) {
-    // config.txt 파일 로드
-    if (load_config("config.txt") != 0) {
-        printf("경고: config.txt 파일을 읽을 수 없습니다. 기본값을 사용합니다.\n");
-    }
-    
-    // 테스트 모드: 인자가 없으면 256GRAY.bmp 테스트 실행
-    if (argc == 1) {
-        return test_256gray_bmp();
-    }
-    
-    // 테스트 모드: --test-ppm 옵션으로 PPM 저장 함수 테스트
-    if (argc == 2 && strcmp(argv[1], "--test-ppm") == 0) {
-        return test_ppm_save_functions();
+// 파일 전체를 메모리로 읽기 (테스트 비교용)
+static uint8_t *read_whole_file(const char *filename, long *size) {
+    FILE *file = fopen(filename, "rb");
+    if (!file) {
+        return NULL;
     }
-    
-    // 테스트 모드: --verify-rgbg 옵션으로 RGBG 구조 확인
-    if (argc == 2 && strcmp(argv[1], "--verify-rgbg") == 0) {
-        return verify_rgbg_structure();
+    fseek(file, 0, SEEK_END);
+    *size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t *buffer = (uint8_t *)malloc(*size > 0 ? (size_t)*size : 1);
+    if (buffer && fread(buffer, 1, (size_t)*size, file) != (size_t)*size) {
+        free(buffer);
+        buffer = NULL;
     }
-    
-    // 테스트 모드: --print-config 옵션으로 config 값 출력
-    if (argc == 2 && strcmp(argv[1], "--print-config") == 0) {
-        print_config();
-        return 0;
+    fclose(file);
+    return buffer;
+}
+
+// 테스트용 8bit RGB 배열 생성 (0~255 전체 값이 나오도록 채움)
+static int make_test_rgb(RGBArray *rgb, int width, int height) {
+    memset(rgb, 0, sizeof(*rgb));
+    rgb->width = width;
+    rgb->height = height;
+    rgb->depth = 8;
+    rgb->r = (uint8_t *)malloc((size_t)width * height);
+    rgb->g = (uint8_t *)malloc((size_t)width * height);
+    rgb->b = (uint8_t *)malloc((size_t)width * height);
+    if (!rgb->r || !rgb->g || !rgb->b) {
+        log_error("오류: 테스트 RGB 배열 할당 실패\n");
+        free_rgb(rgb);
+        return -1;
     }
-    
-    if (argc < 2) {
-        printf("사용법: %s [옵션] [<BMP 파일 경로>]\n", argv[0]);
-        printf("  인자 없음: test_img/1080x2392/256GRAY.bmp 테스트 실행\n");
-        printf("  --test-ppm: PPM 저장 함수 테스트 실행\n");
-        printf("  --verify-rgbg: RGBG 배열 구조 확인\n");
-        printf("  --print-config: config 값 출력\n");
-        printf("  인자 있음: 지정한 BMP 파일 처리\n");
-        printf("예시:\n");
-        printf("  %s\n", argv[0]);
-        printf("  %s --test-ppm\n", argv[0]);
-        printf("  %s --verify-rgbg\n", argv[0]);
-        printf("  %s --print-config\n", argv[0]);
-        printf("  %s test_img/1080x2392/CT_W.bmp\n", argv[0]);
-        return 1;
+    for (int i = 0; i < width * height; i++) {
+        rgb->r[i] = (uint8_t)(i * 7);
+        rgb->g[i] = (uint8_t)(i * 13 + 5);
+        rgb->b[i] = (uint8_t)(255 - i * 3);
     }
+    return 0;
+}
 
-    const char *filename = argv[1];
+// save_rgbg_to_raw, convert_raw_to_ppm 함수 테스트
+// RAW -> PPM 변환 결과가 save_rgbg_to_ppm_10bit/12bit 결과와 바이트 단위로 같은지 확인
+int test_raw_pack_functions(void) {
+    // 홀수 너비로 행 끝 패딩 경로까지 확인
+    const int width = 61;
+    const int height = 9;
     RGBArray rgb;
     RGBGArray rgbg;
+    int failed = 0;
 
-    // BMP 파일 읽기
-    printf("BMP 파일 읽는 중: %s\n", filename);
-    if (read_bmp(filename, &rgb) != 0) {
-        return 1;
+    log_info("========================================\n");
+    log_info("RAW10/RAW12 패킹 테스트 시작\n");
+    log_info("========================================\n\n");
+
+    if (make_test_rgb(&rgb, width, height) != 0) {
+        return -1;
     }
 
-    // RGB 배열 정보 출력
-    print_rgb_info(&rgb, filename);
+    if (rgb_to_rgbg(&rgb, &rgbg) != 0) {
+        log_error("오류: RGBG 배열 생성 실패\n");
+        free_rgb(&rgb);
+        return -1;
+    }
 
-    // RGBG 배열 생성
-    printf("\nRGBG 배열 생성 중...\n");
+    const int bits_list[2] = {10, 12};
+    for (int t = 0; t < 2; t++) {
+        int bits = bits_list[t];
+        char raw_file[128], ppm_file[128], ref_file[128];
+        snprintf(raw_file, sizeof(raw_file), "test_out/img/test_raw%d.raw", bits);
+        snprintf(ppm_file, sizeof(ppm_file), "test_out/img/test_raw%d_to_ppm.ppm", bits);
+        snprintf(ref_file, sizeof(ref_file), "test_out/img/test_raw%d_ref.ppm", bits);
+
+        log_info("[%d/2] RAW%d 저장 및 PPM 변환\n", t + 1, bits);
+        if (save_rgbg_to_raw(&rgbg, raw_file, bits) != 0 ||
+            convert_raw_to_ppm(raw_file, ppm_file) != 0) {
+            failed = 1;
+            continue;
+        }
+        int ref_ok = (bits == 10) ? save_rgbg_to_ppm_10bit(&rgbg, ref_file)
+                                  : save_rgbg_to_ppm_12bit(&rgbg, ref_file);
+        if (ref_ok != 0) {
+            failed = 1;
+            continue;
+        }
+
+        long raw_size = 0, ppm_size = 0, ref_size = 0;
+        uint8_t *raw_data = read_whole_file(raw_file, &raw_size);
+        uint8_t *ppm_data = read_whole_file(ppm_file, &ppm_size);
+        uint8_t *ref_data = read_whole_file(ref_file, &ref_size);
+        long expected_raw = RAW_HEADER_SIZE + (long)raw_row_bytes(width, bits) * height;
+
+        log_info("  RAW 파일 크기: %ld bytes (예상: %ld bytes)\n", raw_size, expected_raw);
+        log_info("  PPM 파일 크기: %ld bytes\n", ref_size);
+        if (raw_size != expected_raw) {
+            log_error("  ✗ RAW 파일 크기 불일치\n");
+            failed = 1;
+        }
+        if (!ppm_data || !ref_data || ppm_size != ref_size ||
+            memcmp(ppm_data, ref_data, (size_t)ref_size) != 0) {
+            log_error("  ✗ RAW -> PPM 변환 결과가 PPM 저장 결과와 다름\n");
+            failed = 1;
+        } else {
+            log_info("  ✓ RAW -> PPM 변환 결과 일치\n");
+        }
+        log_info("\n");
+        free(raw_data);
+        free(ppm_data);
+        free(ref_data);
+    }
+
+    free_rgb(&rgb);
+    free_rgbg(&rgbg);
+
+    log_info("========================================\n");
+    log_info(failed ? "RAW 패킹 테스트 실패!\n" : "RAW 패킹 테스트 완료!\n");
+    log_info("========================================\n");
+    return failed ? -1 : 0;
+}
+
+// 10/12bit 내부 파이프라인 테스트
+// 1) 8bit -> 10/12bit 확장 후 변환한 PPM이 8bit 경로의 PPM과 같은지 확인
+// 2) 10/12bit RGBG 배열의 RAW 저장/읽기 결과가 원본과 같은지 확인
+// 3) 8bit -> 16bit -> 8bit 변환이 원본을 보존하는지 확인
+int test_depth_pipeline(void) {
+    const int width = 61;
+    const int height = 9;
+    RGBArray rgb;
+    RGBGArray rgbg;
+    int failed = 0;
+
+    log_info("========================================\n");
+    log_info("10/12bit 내부 파이프라인 테스트 시작\n");
+    log_info("========================================\n\n");
+
+    if (make_test_rgb(&rgb, width, height) != 0) {
+        return -1;
+    }
     if (rgb_to_rgbg(&rgb, &rgbg) != 0) {
+        log_error("오류: RGBG 배열 생성 실패\n");
         free_rgb(&rgb);
-        return 1;
+        return -1;
     }
 
-    // RGBG 배열 정보 출력
-    print_rgbg_info(&rgbg, filename);
+    const int depth_list[2] = {10, 12};
+    for (int t = 0; t < 2; t++) {
+        int depth = depth_list[t];
+        RGBArray rgbD;
+        RGBGArray rgbgD, rgbgRaw;
+        char ref_file[128], out_file[128], raw_file[128];
+        snprintf(ref_file, sizeof(ref_file), "test_out/img/test_depth%d_ref.ppm", depth);
+        snprintf(out_file, sizeof(out_file), "test_out/img/test_depth%d_out.ppm", depth);
+        snprintf(raw_file, sizeof(raw_file), "test_out/img/test_depth%d.raw", depth);
 
-    // RGBG 배열을 PPM 파일로 저장 (예시)
-    // 실제 사용 시에는 원하는 파일명으로 변경하세요
-    char output_filename_10bit[512];
-    char output_filename_12bit[512];
-    char *base_name = strrchr(filename, '/');
-    if (!base_name) base_name = strrchr(filename, '\\');
-    if (base_name) base_name++;
-    else base_name = (char *)filename;
-    
-    // 확장자 제거
-    char name_without_ext[256];
-    strncpy(name_without_ext, base_name, sizeof(name_without_ext) - 1);
-    name_without_ext[sizeof(name_without_ext) - 1] = '\0';
-    char *dot = strrchr(name_without_ext, '.');
-    if (dot) *dot = '\0';
-    
-    snprintf(output_filename_10bit, sizeof(output_filename_10bit), 
-             "test_out/img/%.200s_10bit.ppm", name_without_ext);
-    snprintf(output_filename_12bit, sizeof(output_filename_12bit), 
-             "test_out/img/%.200s_12bit.ppm", name_without_ext);
-    
-    printf("\nPPM 파일 저장 중...\n");
-    save_rgbg_to_ppm_10bit(&rgbg, output_filename_10bit);
-    save_rgbg_to_ppm_12bit(&rgbg, output_filename_12bit);
+        log_info("[%d/3] %dbit 파이프라인\n", t + 1, depth);
+        if (rgb_convert_depth(&rgb, &rgbD, depth) != 0) {
+            failed = 1;
+            continue;
+        }
+        if (rgb_to_rgbg(&rgbD, &rgbgD) != 0) {
+            free_rgb(&rgbD);
+            failed = 1;
+            continue;
+        }
 
-    // RGB 배열을 8bit BMP로 저장
-    char output_filename_8bit[512];
-    snprintf(output_filename_8bit, sizeof(output_filename_8bit), 
-             "test_out/img/%.200s_8bit.bmp", name_without_ext);
-    printf("\n8bit BMP 파일 저장 중...\n");
-    save_rgb_to_bmp_8bit(&rgb, output_filename_8bit);
+        int save_ok = (depth == 10)
+            ? (save_rgbg_to_ppm_10bit(&rgbg, ref_file) == 0 && save_rgbg_to_ppm_10bit(&rgbgD, out_file) == 0)
+            : (save_rgbg_to_ppm_12bit(&rgbg, ref_file) == 0 && save_rgbg_to_ppm_12bit(&rgbgD, out_file) == 0);
+        long ref_size = 0, out_size = 0;
+        uint8_t *ref_data = save_ok ? read_whole_file(ref_file, &ref_size) : NULL;
+        uint8_t *out_data = save_ok ? read_whole_file(out_file, &out_size) : NULL;
+        if (!ref_data || !out_data || ref_size != out_size ||
+            memcmp(ref_data, out_data, (size_t)ref_size) != 0) {
+            log_error("  ✗ %dbit 경로 PPM이 8bit 경로 PPM과 다름\n", depth);
+            failed = 1;
+        } else {
+            log_info("  ✓ %dbit 경로 PPM 일치\n", depth);
+        }
+        free(ref_data);
+        free(out_data);
+
+        size_t samples = (size_t)width * height * 2;
+        if (save_rgbg_to_raw(&rgbgD, raw_file, depth) != 0 || read_raw(raw_file, &rgbgRaw) != 0) {
+            failed = 1;
+        } else {
+            if (rgbgRaw.depth != depth ||
+                memcmp(rgbgRaw.data16, rgbgD.data16, samples * sizeof(uint16_t)) != 0) {
+                log_error("  ✗ RAW%d 저장/읽기 결과가 원본과 다름\n", depth);
+                failed = 1;
+            } else {
+                log_info("  ✓ RAW%d 저장/읽기 결과 일치\n", depth);
+            }
+            free_rgbg(&rgbgRaw);
+        }
+        log_info("\n");
+
+        free_rgb(&rgbD);
+        free_rgbg(&rgbgD);
+    }
+
+    log_info("[3/3] 8bit -> 16bit -> 8bit 변환\n");
+    RGBArray rgb16, rgb8;
+    if (rgb_convert_depth(&rgb, &rgb16, 16) != 0 || rgb_convert_depth(&rgb16, &rgb8, 8) != 0) {
+        failed = 1;
+    } else {
+        size_t pixels = (size_t)width * height;
+        if (memcmp(rgb8.r, rgb.r, pixels) != 0 || memcmp(rgb8.g, rgb.g, pixels) != 0 ||
+            memcmp(rgb8.b, rgb.b, pixels) != 0) {
+            log_error("  ✗ 8bit 값이 보존되지 않음\n");
+            failed = 1;
+        } else {
+            log_info("  ✓ 8bit 값 보존\n");
+        }
+        free_rgb(&rgb8);
+    }
+    free_rgb(&rgb16);
+    log_info("\n");
 
-    // 메모리 해제
     free_rgb(&rgb);
     free_rgbg(&rgbg);
 
-    printf("\n완료!\n");
+    log_info("========================================\n");
+    log_info(failed ? "10/12bit 파이프라인 테스트 실패!\n" : "10/12bit 파이프라인 테스트 완료!\n");
+    log_info("========================================\n");
+    return failed ? -1 : 0;
+}
+
+// 레지스터 쓰기 -> 파생 테이블 무효화 테스트
+// 각 쓰기 후 해당 레지스터를 읽는 테이블만 재계산되는지 확인
+int test_register_tables(void) {
+    int failed = 0;
+
+    log_info("========================================\n");
+    log_info("레지스터 스크립트 / 파생 테이블 무효화 테스트 시작\n");
+    log_info("========================================\n\n");
+
+    ctc_tables_init();
+    int rebuilt = ctc_tables_refresh();
+    log_info("[1/4] 첫 계산: %d개 테이블\n", rebuilt);
+    if (rebuilt != CTC_TABLE_COUNT || ctc_tables_refresh() != 0) {
+        log_error("  ✗ 첫 계산 후에도 무효화된 테이블이 남음\n");
+        failed = 1;
+    }
+
+    // 이름, 새 값 오프셋, 재계산되어야 하는 테이블 비트마스크
+    struct {
+        const char *name;
+        int delta;
+        uint32_t expect;
+    } cases[] = {
+        { "por_dbv",                   0x40, (1u << CTC_TABLE_DBV_GAIN) | (1u << CTC_TABLE_LINE_GAIN) },
+        { "por_fcon",                  1,    (1u << CTC_TABLE_FREQ_GAIN) | (1u << CTC_TABLE_LINE_GAIN) },
+        { "reg_ctc_nor_vol_g_y3",      1,    1u << CTC_TABLE_NOR_VOL_G },
+        { "reg_ctc_gamma_gray_idx_x4", 1,    (1u << CTC_TABLE_NOR_VOL_R) | (1u << CTC_TABLE_NOR_VOL_G) |
+                                             (1u << CTC_TABLE_NOR_VOL_B) },
+        { "reg_ctc_lctc_lut_posi_53",  1,    1u << CTC_TABLE_LCTC_LUT },
+        { "reg_ctc_th_gray",           1,    0 },
+    };
+    log_info("[2/4] 레지스터별 재계산 테이블\n");
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        int value;
+        unsigned before[CTC_TABLE_COUNT];
+        for (int id = 0; id < CTC_TABLE_COUNT; id++) {
+            before[id] = ctc_table_rebuild_count(id);
+        }
+        reg_read_by_name(cases[i].name, &value);
+        reg_write_by_name(cases[i].name, value + cases[i].delta);
+        reg_write_by_name(cases[i].name, value + cases[i].delta); // 같은 값은 무효화하지 않음
+        ctc_tables_refresh();
+
+        uint32_t mask = 0;
+        for (int id = 0; id < CTC_TABLE_COUNT; id++) {
+            if (ctc_table_rebuild_count(id) != before[id]) {
+                mask |= 1u << id;
+            }
+        }
+        if (mask != cases[i].expect) {
+            log_error("  ✗ %-26s: 재계산 0x%03X (예상 0x%03X)\n", cases[i].name, mask, cases[i].expect);
+            failed = 1;
+        } else {
+            log_info("  ✓ %-26s: 재계산 0x%03X\n", cases[i].name, mask);
+        }
+    }
+
+    log_info("[3/4] 스크립트 램프 적용\n");
+    const char *script_file = "test_out/regs_test.txt";
+    FILE *fp = (ensure_parent_directory(script_file) == 0) ? fopen(script_file, "w") : NULL;
+    if (!fp) {
+        log_error("  ✗ 스크립트 파일 생성 실패\n");
+        return -1;
+    }
+    fprintf(fp, "# 0~4 프레임 DBV 램프\n0-4 por_dbv = 0..400\n2 reg_ctc_actc_lut_posi_00 = 5 // 한 번 쓰기\n");
+    fclose(fp);
+
+    RegScript script;
+    if (regscript_load(&script, script_file) != 0) {
+        return -1;
+    }
+    const int expect_dbv[6] = {0, 100, 200, 300, 400, 400};
+    const int expect_writes[6] = {1, 1, 2, 1, 1, 0};
+    for (int frame = 0; frame < 6; frame++) {
+        int writes = regscript_apply(&script, frame);
+        int dbv;
+        reg_read_by_name("por_dbv", &dbv);
+        if (writes != expect_writes[frame] || dbv != expect_dbv[frame]) {
+            log_error("  ✗ 프레임 %d: 쓰기 %d, por_dbv %d (예상 %d, %d)\n",
+                      frame, writes, dbv, expect_writes[frame], expect_dbv[frame]);
+            failed = 1;
+        }
+    }
+    if (!failed) {
+        log_info("  ✓ 프레임별 쓰기 및 램프 값 일치\n");
+    }
+    regscript_free(&script);
+
+    // registers_list.csv 기본값 / Width 비트 수 / page-addr 인덱스
+    log_info("[4/4] 기본값 / 비트 수\n");
+    config_load_defaults();
+    int th_gray, dbv, order, missing;
+    reg_read_by_name("reg_ctc_th_gray", &th_gray);
+    reg_read_by_name("por_dbv", &dbv);
+    int ok = th_gray == 0x20 && dbv == 0x200 && reg_value_at(0x05, 0x08) == 0x20 &&
+             reg_read_by_addr(0x05, 0xFF, &missing) != 0;
+    reg_write_by_name("reg_ctc_th_gray", 0x1A5);
+    reg_write_by_name("por_rgbg_order", 3);
+    reg_read_by_name("reg_ctc_th_gray", &th_gray);
+    reg_read_by_name("por_rgbg_order", &order);
+    ok = ok && th_gray == 0xA5 && order == 1;
+    config_load_defaults();
+    failed |= !ok;
+    if (ok) {
+        log_info("  ✓ 기본값 / 비트 수 자르기 (레지스터 파일 %zu bytes)\n", sizeof(RegFile_t));
+    } else {
+        log_error("  ✗ 기본값 / 비트 수: th_gray 0x%X, por_dbv 0x%X, por_rgbg_order %d\n", th_gray, dbv, order);
+    }
+    log_info("\n");
+
+    log_info("========================================\n");
+    log_info(failed ? "레지스터 테이블 테스트 실패!\n" : "레지스터 테이블 테스트 완료!\n");
+    log_info("========================================\n");
+    return failed ? -1 : 0;
+}
+
+// 테스트용 24비트 BMP 쓰기 (top_down이면 높이를 음수로 저장)
+static int write_test_bmp24(const char *filename, const RGBArray *rgb, int top_down) {
+    if (ensure_parent_directory(filename) != 0) {
+        return -1;
+    }
+    FILE *file = fopen(filename, "wb");
+    if (!file) {
+        log_error("파일을 생성할 수 없습니다: %s\n", filename);
+        return -1;
+    }
+
+    int rowSize = ((rgb->width * 3 + 3) / 4) * 4;
+    BMPFileHeader fileHeader;
+    BMPInfoHeader infoHeader;
+    memset(&fileHeader, 0, sizeof(fileHeader));
+    memset(&infoHeader, 0, sizeof(infoHeader));
+    fileHeader.type = 0x4D42; // 'BM'
+    fileHeader.offset = sizeof(BMPFileHeader) + sizeof(BMPInfoHeader);
+    fileHeader.size = fileHeader.offset + (uint32_t)rowSize * rgb->height;
+    infoHeader.size = sizeof(BMPInfoHeader);
+    infoHeader.width = rgb->width;
+    infoHeader.height = top_down ? -rgb->height : rgb->height;
+    infoHeader.planes = 1;
+    infoHeader.bitCount = 24;
+    infoHeader.imageSize = (uint32_t)rowSize * rgb->height;
+    fwrite(&fileHeader, sizeof(fileHeader), 1, file);
+    fwrite(&infoHeader, sizeof(infoHeader), 1, file);
+
+    uint8_t *rowBuffer = (uint8_t *)calloc((size_t)rowSize, 1);
+    if (!rowBuffer) {
+        fclose(file);
+        return -1;
+    }
+    for (int i = 0; i < rgb->height; i++) {
+        int y = top_down ? i : rgb->height - 1 - i;
+        for (int x = 0; x < rgb->width; x++) {
+            size_t index = (size_t)y * rgb->width + x;
+            rowBuffer[x * 3 + 0] = rgb->b[index];
+            rowBuffer[x * 3 + 1] = rgb->g[index];
+            rowBuffer[x * 3 + 2] = rgb->r[index];
+        }
+        fwrite(rowBuffer, 1, (size_t)rowSize, file);
+    }
+    free(rowBuffer);
+    fclose(file);
+    return 0;
+}
+
+// crop 배열이 full 배열의 (x, y) 위치 부분과 같은지 행 단위로 비교 (8bit)
+static int rgbg_matches_crop(const RGBGArray *full, const RGBGArray *crop, int x, int y) {
+    for (int row = 0; row < crop->height; row++) {
+        const uint8_t *expect = full->data + ((size_t)(y + row) * full->width + x) * 2;
+        const uint8_t *actual = crop->data + (size_t)row * crop->width * 2;
+        if (memcmp(expect, actual, (size_t)crop->width * 2) != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// ROI/타일/스트라이프 읽기 테스트
+// bottom-up/top-down BMP에서 여러 영역(홀수 시작 위치 포함)을 읽어 전체 프레임 결과의 해당 부분과 비교
+int test_roi_tiles(void) {
+    const int width = 61;
+    const int height = 9;
+    const char *bu_file = "test_out/img/test_roi_bottomup.bmp";
+    const char *td_file = "test_out/img/test_roi_topdown.bmp";
+    RGBArray rgb;
+    int failed = 0;
+
+    log_info("========================================\n");
+    log_info("ROI / 타일 읽기 테스트 시작\n");
+    log_info("========================================\n\n");
+
+    // 테스트 BMP 생성 (같은 내용의 bottom-up / top-down 24비트 BMP)
+    if (make_test_rgb(&rgb, width, height) != 0) {
+        return -1;
+    }
+    if (write_test_bmp24(bu_file, &rgb, 0) != 0 || write_test_bmp24(td_file, &rgb, 1) != 0) {
+        log_error("오류: 테스트 BMP 생성 실패\n");
+        free_rgb(&rgb);
+        return -1;
+    }
+
+    // 전체 읽기: 행 패딩(61 * 3 = 183 -> 184바이트) / 뒤집기 / 16픽셀 블록 뒤 나머지 열 확인
+    for (int f = 0; f < 2; f++) {
+        RGBArray read_back;
+        size_t pixels = (size_t)width * height;
+        int ok = read_bmp(f == 0 ? bu_file : td_file, &read_back) == 0;
+        ok = ok && memcmp(read_back.r, rgb.r, pixels) == 0 && memcmp(read_back.g, rgb.g, pixels) == 0 &&
+             memcmp(read_back.b, rgb.b, pixels) == 0;
+        if (ok) {
+            free_rgb(&read_back);
+        }
+        log_info("  %s read_bmp %s = 원본\n", ok ? "✓" : "✗", f == 0 ? "bottom-up" : "top-down");
+        failed |= !ok;
+    }
+
+    // 평면 분리 커널: 모든 나머지 길이 (0 ~ 50픽셀)
+    {
+        uint8_t src[50 * 3], planes[3][50];
+        int ok = 1;
+        for (int i = 0; i < (int)sizeof(src); i++) {
+            src[i] = (uint8_t)(i * 7 + 1);
+        }
+        for (int n = 0; n <= 50 && ok; n++) {
+            memset(planes, 0xEE, sizeof(planes));
+            deinterleave_rgb24_row(src, planes[0], planes[1], planes[2], (size_t)n);
+            for (int i = 0; i < 50 && ok; i++) {
+                for (int c = 0; c < 3; c++) {
+                    ok = ok && planes[c][i] == (i < n ? src[i * 3 + c] : 0xEE);
+                }
+            }
+        }
+        log_info("  %s BGR 평면 분리 (0 ~ 50픽셀, 끝 이후 미기록)\n\n", ok ? "✓" : "✗");
+        failed |= !ok;
+    }
+    free_rgb(&rgb);
+
+    // 비교 기준: 전체 프레임 RGBG
+    RGBArray full_rgb;
+    RGBGArray full;
+    if (read_bmp(bu_file, &full_rgb) != 0 || rgb_to_rgbg(&full_rgb, &full) != 0) {
+        return -1;
+    }
+
+    // 영역 목록: 16x4 타일 격자 + 홀수 위치에서 시작하는 영역
+    int rois[64][4];
+    int roi_count = 0;
+    for (int ty = 0; ty < height; ty += 4) {
+        for (int tx = 0; tx < width; tx += 16) {
+            rois[roi_count][0] = tx;
+            rois[roi_count][1] = ty;
+            rois[roi_count][2] = (tx + 16 > width) ? width - tx : 16;
+            rois[roi_count][3] = (ty + 4 > height) ? height - ty : 4;
+            roi_count++;
+        }
+    }
+    const int odd_rois[4][4] = { {3, 1, 20, 5}, {1, 0, 1, 1}, {58, 8, 3, 1}, {0, 0, 61, 9} };
+    for (int i = 0; i < 4; i++) {
+        memcpy(rois[roi_count++], odd_rois[i], sizeof(odd_rois[i]));
+    }
+
+    const char *files[2] = { bu_file, td_file };
+    for (int f = 0; f < 2; f++) {
+        log_info("[%d/4] %s 영역 %d개\n", f + 1, f == 0 ? "bottom-up" : "top-down", roi_count);
+        int mismatch = 0;
+        for (int i = 0; i < roi_count; i++) {
+            RGBArray roi;
+            RGBGArray roi_rgbg;
+            if (read_bmp_roi(files[f], &roi, rois[i][0], rois[i][1], rois[i][2], rois[i][3]) != 0 ||
+                rgb_to_rgbg(&roi, &roi_rgbg) != 0) {
+                mismatch++;
+                continue;
+            }
+            if (!rgbg_matches_crop(&full, &roi_rgbg, rois[i][0], rois[i][1])) {
+                log_error("  ✗ 영역 %d,%d,%d,%d 불일치\n", rois[i][0], rois[i][1], rois[i][2], rois[i][3]);
+                mismatch++;
+            }
+            free_rgb(&roi);
+            free_rgbg(&roi_rgbg);
+        }
+        if (mismatch) {
+            failed = 1;
+        } else {
+            log_info("  ✓ 모든 영역이 전체 프레임 결과와 일치\n");
+        }
+    }
+
+    // 홀수 위치 영역의 PPM / RAW 저장 결과가 전체 PPM의 해당 부분과 같은지 확인
+    log_info("[3/4] 홀수 위치 영역 PPM / RAW 저장\n");
+    {
+        const int x = 3, y = 1, w = 20, h = 5;
+        const char *full_ppm = "test_out/img/test_roi_full_10bit.ppm";
+        const char *roi_ppm = "test_out/img/test_roi_crop_10bit.ppm";
+        const char *roi_raw = "test_out/img/test_roi_crop.raw";
+        const char *raw_ppm = "test_out/img/test_roi_crop_raw.ppm";
+        RGBArray roi;
+        RGBGArray roi_rgbg;
+        long full_size = 0, roi_size = 0, raw_size = 0;
+        uint8_t *full_data = NULL, *roi_data = NULL, *raw_data = NULL;
+        if (read_bmp_roi(td_file, &roi, x, y, w, h) == 0 && rgb_to_rgbg(&roi, &roi_rgbg) == 0) {
+            if (save_rgbg_to_ppm_10bit(&full, full_ppm) == 0 &&
+                save_rgbg_to_ppm_10bit(&roi_rgbg, roi_ppm) == 0 &&
+                save_rgbg_to_raw(&roi_rgbg, roi_raw, 10) == 0 &&
+                convert_raw_to_ppm(roi_raw, raw_ppm) == 0) {
+                full_data = read_whole_file(full_ppm, &full_size);
+                roi_data = read_whole_file(roi_ppm, &roi_size);
+                raw_data = read_whole_file(raw_ppm, &raw_size);
+            }
+            free_rgb(&roi);
+            free_rgbg(&roi_rgbg);
+        }
+
+        int ok = full_data && roi_data && raw_data && roi_size == raw_size &&
+                 memcmp(roi_data, raw_data, (size_t)roi_size) == 0;
+        if (ok) {
+            // 헤더 길이: 전체 "P6\n61 9\n1023\n", 영역 "P6\n20 5\n1023\n"
+            size_t full_header = (size_t)full_size - (size_t)width * height * 6;
+            size_t roi_header = (size_t)roi_size - (size_t)w * h * 6;
+            for (int row = 0; row < h && ok; row++) {
+                ok = memcmp(full_data + full_header + ((size_t)(y + row) * width + x) * 6,
+                            roi_data + roi_header + (size_t)row * w * 6, (size_t)w * 6) == 0;
+            }
+        }
+        if (ok) {
+            log_info("  ✓ 영역 PPM = 전체 PPM 부분, RAW 왕복 결과 일치\n");
+        } else {
+            log_error("  ✗ 영역 PPM/RAW 결과가 전체 프레임과 다름\n");
+            failed = 1;
+        }
+        free(full_data);
+        free(roi_data);
+        free(raw_data);
+    }
+
+    // 스트라이프 처리 결과가 전체 프레임 PPM과 같은지 확인 (홀수 행 단위로 나누어 패리티 확인)
+    log_info("[4/4] 스트라이프 처리 (3행 / 4행 단위)\n");
+    {
+        const char *full_ppm = "test_out/img/test_roi_full_10bit.ppm";
+        const char *stripe_10 = "test_out/img/test_roi_stripe_10bit.ppm";
+        const char *stripe_12 = "test_out/img/test_roi_stripe_12bit.ppm";
+        const char *stripe_files[2] = { td_file, bu_file };
+        const int stripe_rows[2] = { 3, 4 };
+        for (int k = 0; k < 2; k++) {
+            long full_size = 0, stripe_size = 0;
+            uint8_t *full_data = NULL, *stripe_data = NULL;
+            if (process_bmp_stripes(stripe_files[k], 8, stripe_rows[k], stripe_10, stripe_12) == 0) {
+                full_data = read_whole_file(full_ppm, &full_size);
+                stripe_data = read_whole_file(stripe_10, &stripe_size);
+            }
+            if (full_data && stripe_data && full_size == stripe_size &&
+                memcmp(full_data, stripe_data, (size_t)full_size) == 0) {
+                log_info("  ✓ %s %d행 스트라이프 PPM = 전체 PPM\n",
+                         k == 0 ? "top-down" : "bottom-up", stripe_rows[k]);
+            } else {
+                log_error("  ✗ %s %d행 스트라이프 PPM이 전체 PPM과 다름\n",
+                          k == 0 ? "top-down" : "bottom-up", stripe_rows[k]);
+                failed = 1;
+            }
+            free(full_data);
+            free(stripe_data);
+        }
+    }
+    log_info("\n");
+
+    free_rgb(&full_rgb);
+    free_rgbg(&full);
+
+    log_info("========================================\n");
+    log_info(failed ? "ROI / 타일 테스트 실패!\n" : "ROI / 타일 테스트 완료!\n");
+    log_info("========================================\n");
+    return failed ? -1 : 0;
+}
+
+// --compare 비교 커널 테스트
+// 같은 RGBG를 PPM / 패킹 RAW로 저장하여 읽은 결과가 일치하는지, 알려진 오차를 넣었을 때
+// 불일치 수 / 채널 / 최대 오차 / 히스토그램 / 비트맵이 기대값과 같은지 확인
+int test_compare(void) {
+    const int width = 37;   // 샘플 수가 8의 배수가 아닌 행 (SIMD 뒤쪽 스칼라 처리 포함)
+    const int height = 9;
+    const char *ppm_file = "test_out/img/test_compare_12bit.ppm";
+    const char *raw_file = "test_out/img/test_compare_raw12.raw";
+    int failed = 0;
+
+    log_info("========================================\n");
+    log_info("비교 커널 테스트 시작\n");
+    log_info("========================================\n\n");
+
+    // 홀수 열에서 시작하는 영역으로 만들어 위상 처리까지 확인
+    RGBArray rgb;
+    RGBGArray rgbg;
+    if (make_test_rgb(&rgb, width, height) != 0) {
+        return -1;
+    }
+    rgb.x0 = 1;
+    if (rgb_to_rgbg(&rgb, &rgbg) != 0) {
+        free_rgb(&rgb);
+        return -1;
+    }
+    free_rgb(&rgb);
+    int saved = save_rgbg_to_ppm_12bit(&rgbg, ppm_file) == 0 &&
+                save_rgbg_to_raw(&rgbg, raw_file, 12) == 0;
+    free_rgbg(&rgbg);
+    if (!saved) {
+        return -1;
+    }
+
+    CompareImage a, b;
+    if (compare_load(ppm_file, NULL, &a) != 0) {
+        return -1;
+    }
+    if (compare_load(raw_file, NULL, &b) != 0) {
+        compare_free(&a);
+        return -1;
+    }
+
+    size_t stride = ((size_t)width + 7) / 8;
+    uint8_t *bitmap = (uint8_t *)malloc(stride * height);
+    CompareResult r;
+    if (!bitmap || compare_images(&a, &b, bitmap, &r) != 0) {
+        free(bitmap);
+        compare_free(&a);
+        compare_free(&b);
+        return -1;
+    }
+    int ok = a.phase == b.phase && r.mismatches == 0 && r.samples == (uint64_t)width * height * 2;
+    log_info("  %s PPM(12bit) = RAW12 (위상 %d / %d, 샘플 %llu)\n", ok ? "✓" : "✗",
+             a.phase, b.phase, (unsigned long long)r.samples);
+    failed += !ok;
+
+    // 알려진 오차: (0, 0) R/B 샘플 5, (3, 2) G 샘플 300, (36, 8) R/B 샘플 1 (행 끝 스칼라 구간)
+    const int points[3][3] = { { 0, 0, 0 }, { 3, 2, 1 }, { 36, 8, 0 } };
+    const int errors[3] = { 5, 300, 1 };
+    uint64_t expected_hist[3][COMPARE_HIST_BINS];
+    memset(expected_hist, 0, sizeof(expected_hist));
+    uint64_t expected_sse = 0;
+    for (int k = 0; k < 3; k++) {
+        int x = points[k][0], y = points[k][1], s = points[k][2];
+        uint16_t *v = &b.samples[((size_t)y * width + x) * 2 + s];
+        *v = (uint16_t)(*v > 4095 - errors[k] ? *v - errors[k] : *v + errors[k]);
+        int c = s ? 1 : ((((x + y + b.phase) & 1) == 0) ? 0 : 2);
+        int bin = 0;
+        for (int e = errors[k]; e; e >>= 1) {
+            bin++;
+        }
+        expected_hist[c][bin]++;
+        expected_sse += (uint64_t)errors[k] * errors[k];
+    }
+    compare_images(&a, &b, bitmap, &r);
+    ok = r.mismatches == 3 && r.mismatch_pixels == 3 && r.max_error == 300 &&
+         r.channel_sse[0] + r.channel_sse[1] + r.channel_sse[2] == expected_sse;
+    for (int c = 0; c < 3; c++) {
+        for (int k = 1; k < COMPARE_HIST_BINS; k++) {
+            ok &= r.histogram[c][k] == expected_hist[c][k];
+        }
+        ok &= r.histogram[c][0] + r.channel_mismatches[c] == r.channel_samples[c];
+    }
+    for (int k = 0; k < 3; k++) {
+        int x = points[k][0], y = points[k][1];
+        ok &= (bitmap[(size_t)y * stride + x / 8] >> (7 - x % 8)) & 1;
+    }
+    log_info("  %s 오차 3개: 불일치 %llu, 픽셀 %llu, 최대 오차 %d, PSNR %.2f dB\n", ok ? "✓" : "✗",
+             (unsigned long long)r.mismatches, (unsigned long long)r.mismatch_pixels, r.max_error,
+             compare_psnr(&r, 12, -1));
+    failed += !ok;
+
+    // 모든 샘플에 오차를 넣고 단순 계산 결과와 비교 (SIMD 누적 확인)
+    uint64_t ref_mismatch = 0, ref_sse = 0;
+    int ref_max = 0;
+    for (size_t i = 0; i < (size_t)width * height * 2; i++) {
+        int e = (int)(((uint32_t)i * 2654435761u) >> 7) % 41 - 20;
+        int v = (int)a.samples[i] + e;
+        b.samples[i] = (uint16_t)(v < 0 ? 0 : (v > 4095 ? 4095 : v));
+        int d = abs((int)b.samples[i] - (int)a.samples[i]);
+        ref_mismatch += d != 0;
+        ref_sse += (uint64_t)d * d;
+        ref_max = d > ref_max ? d : ref_max;
+    }
+    compare_images(&a, &b, bitmap, &r);
+    ok = r.mismatches == ref_mismatch && r.max_error == ref_max &&
+         r.channel_sse[0] + r.channel_sse[1] + r.channel_sse[2] == ref_sse;
+    log_info("  %s 전체 오차: 불일치 %llu / %llu, 최대 오차 %d / %d\n", ok ? "✓" : "✗",
+             (unsigned long long)r.mismatches, (unsigned long long)ref_mismatch, r.max_error, ref_max);
+    failed += !ok;
+
+    free(bitmap);
+    compare_free(&a);
+    compare_free(&b);
+
+    log_info("\n========================================\n");
+    log_info(failed ? "비교 커널 테스트 실패!\n" : "비교 커널 테스트 완료!\n");
+    log_info("========================================\n");
+    return failed ? -1 : 0;
+}
+
+// 기준 hex 포맷: beat 하나를 비트 단위로 배치하여 16진수 문자열로 변환
+static void reference_hex_beat(const uint16_t *fields, int count, int bits, int beat_bits,
+                               int lsb_first, char *out) {
+    uint8_t bit[1024];
+    memset(bit, 0, sizeof(bit));
+    for (int k = 0; k < count; k++) {
+        int pos = (lsb_first ? k : count - 1 - k) * bits;
+        for (int i = 0; i < bits; i++) {
+            bit[pos + i] = (uint8_t)((fields[k] >> i) & 1);
+        }
+    }
+    int digits = (beat_bits + 3) / 4;
+    for (int d = 0; d < digits; d++) {
+        int nibble = 0;
+        for (int i = 3; i >= 0; i--) {
+            nibble = nibble * 2 + bit[(digits - 1 - d) * 4 + i];
+        }
+        out[d] = "0123456789abcdef"[nibble];
+    }
+    out[digits] = '\0';
+}
+
+// 덤프 파일을 기준 포맷과 줄 단위로 비교 (헤더 줄은 건너뜀)
+static int check_hex_file(const char *filename, const uint16_t *samples, int width, int height,
+                          int subpixels, const HexDumpOptions *opt, int bits) {
+    FILE *file = fopen(filename, "r");
+    if (!file) {
+        return -1;
+    }
+    int fields = opt->pixels_per_beat * subpixels;
+    int beat_bits = opt->beat_bits > 0 ? opt->beat_bits : fields * bits;
+    int beats = (width + opt->pixels_per_beat - 1) / opt->pixels_per_beat;
+    uint16_t padded[64];
+    char line[300], expect[300];
+    int result = 0;
+    if (opt->header && !fgets(line, sizeof(line), file)) {
+        result = -1;
+    }
+    for (int y = 0; y < height && result == 0; y++) {
+        for (int b = 0; b < beats && result == 0; b++) {
+            for (int k = 0; k < fields; k++) {
+                int i = b * fields + k;
+                padded[k] = i < width * subpixels ? samples[(size_t)y * width * subpixels + i] : 0;
+            }
+            reference_hex_beat(padded, fields, bits, beat_bits, opt->lsb_first, expect);
+            strcat(expect, "\n");
+            if (!fgets(line, sizeof(line), file) || strcmp(line, expect) != 0) {
+                log_info("    %s: 행 %d beat %d 불일치 (기대 %s", filename, y, b, expect);
+                result = -1;
+            }
+        }
+    }
+    if (result == 0 && fgets(line, sizeof(line), file)) {
+        result = -1; // 남는 줄
+    }
+    fclose(file);
+    return result;
+}
+
+// --hex 테스트벤치 벡터 덤프 테스트
+// 행 끝이 beat 중간에서 끝나는 폭으로 필드 비트 수 / 클럭당 픽셀 수 / beat 폭 / 필드 순서 /
+// 스레드 수 조합을 덤프하여 비트 단위 기준 포맷과 같은지 확인
+int test_hex_dump(void) {
+    const int width = 13;
+    const int height = 7;
+    const char *rgbg_file = "test_out/hex/test_hex_rgbg.hex";
+    const char *rgb_file = "test_out/hex/test_hex_rgb.hex";
+    int failed = 0;
+
+    log_info("========================================\n");
+    log_info("hex 덤프 테스트 시작\n");
+    log_info("========================================\n\n");
+
+    RGBArray rgb;
+    RGBGArray rgbg;
+    if (make_test_rgb(&rgb, width, height) != 0) {
+        return -1;
+    }
+    if (rgb_to_rgbg(&rgb, &rgbg) != 0) {
+        free_rgb(&rgb);
+        return -1;
+    }
+
+    // { bits, ppc, beat, lsb_first, threads, header }
+    const HexDumpOptions cases[] = {
+        { 10, 1, 0,   0, 1, 1 },
+        { 10, 2, 0,   0, 3, 1 },
+        { 10, 3, 96,  1, 2, 0 },
+        { 12, 4, 0,   0, 4, 1 },
+        { 16, 2, 0,   1, 1, 0 },
+        { 8,  5, 126, 0, 2, 1 },
+    };
+    uint16_t *samples = (uint16_t *)malloc((size_t)width * height * 3 * sizeof(uint16_t));
+    if (!samples) {
+        free_rgb(&rgb);
+        free_rgbg(&rgbg);
+        return -1;
+    }
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        const HexDumpOptions *opt = &cases[c];
+        for (int y = 0; y < height; y++) {
+            rgbg_row_to_samples(&rgbg, y, samples + (size_t)y * width * 2, opt->bits);
+        }
+        int ok = hexdump_rgbg(rgbg_file, &rgbg, opt) == 0 &&
+                 check_hex_file(rgbg_file, samples, width, height, 2, opt, opt->bits) == 0;
+        // 다시 읽은 배열이 덤프한 샘플과 같은지 (형식 주석이 없으면 옵션 레이아웃 사용)
+        RGBGArray back;
+        if (ok && hexdump_read_rgbg(rgbg_file, width, height, 0, opt, &back) == 0) {
+            uint16_t row[64];
+            for (int y = 0; y < height; y++) {
+                rgbg_row_to_samples(&back, y, row, opt->bits);
+                ok &= memcmp(row, samples + (size_t)y * width * 2, (size_t)width * 2 * sizeof(uint16_t)) == 0;
+            }
+            ok &= back.order == rgbg.order;
+            free_rgbg(&back);
+        } else {
+            ok = 0;
+        }
+        for (int y = 0; y < height; y++) {
+            rgb_row_to_samples(&rgb, y, samples + (size_t)y * width * 3, opt->bits);
+        }
+        ok &= hexdump_rgb(rgb_file, &rgb, opt) == 0 &&
+              check_hex_file(rgb_file, samples, width, height, 3, opt, opt->bits) == 0;
+        log_info("  %s bits=%d ppc=%d beat=%d %s 스레드 %d\n", ok ? "✓" : "✗", opt->bits,
+                 opt->pixels_per_beat, opt->beat_bits, opt->lsb_first ? "lsb-first" : "msb-first",
+                 opt->threads);
+        failed += !ok;
+    }
+
+    // 필드 합계보다 좁은 beat는 거부
+    HexDumpOptions narrow = cases[0];
+    narrow.beat_bits = 16;
+    int ok = hexdump_rgbg(rgbg_file, &rgbg, &narrow) != 0;
+    log_info("  %s 좁은 beat 폭 거부\n", ok ? "✓" : "✗");
+    failed += !ok;
+
+    // 여러 프레임 덤프: 주석, '@주소' (프레임 순서 바꿈), '_' 구분자가 섞인 파일을 여러 구간으로 나누어 읽기
+    const char *multi_file = "test_out/hex/test_hex_frames.hex";
+    const int mw = 64, mh = 48, frames = 4;
+    const int frame_order[4] = { 0, 1, 3, 2 };
+    FILE *file = fopen(multi_file, "w");
+    ok = file != NULL;
+    for (int i = 0; i < frames && file; i++) {
+        int f = frame_order[i];
+        fprintf(file, "// frame %d\n", f);
+        if (f != i) {
+            fprintf(file, "@%x\n", f * mw * mh);
+        }
+        for (int a = 0; a < mw * mh; a++) {
+            unsigned s0 = (unsigned)(f * 131 + a * 7) & 0x3FF;
+            unsigned s1 = (unsigned)(f * 17 + a * 3 + 5) & 0x3FF;
+            unsigned beat = (s0 << 10) | s1;
+            if (a % 5 == 0) {
+                fprintf(file, "%x_%04x // %d\n", beat >> 16, beat & 0xFFFF, a);
+            } else {
+                fprintf(file, "%05x\n", beat);
+            }
+        }
+    }
+    if (file) {
+        fclose(file);
+    }
+    HexDumpOptions multi;
+    hexdump_default_options(&multi);
+    multi.bits = 10;
+    multi.threads = 4;
+    for (int f = 0; f < frames && ok; f++) {
+        RGBGArray back;
+        if (hexdump_read_rgbg(multi_file, mw, mh, f, &multi, &back) != 0) {
+            ok = 0;
+            break;
+        }
+        for (int a = 0; a < mw * mh; a++) {
+            ok &= back.data16[a * 2] == ((f * 131 + a * 7) & 0x3FF) &&
+                  back.data16[a * 2 + 1] == ((f * 17 + a * 3 + 5) & 0x3FF);
+        }
+        free_rgbg(&back);
+    }
+    log_info("  %s 여러 프레임 / @주소 / 주석 읽기 (%d 프레임, 4구간)\n", ok ? "✓" : "✗", frames);
+    failed += !ok;
+
+    // 블록 주석 처리, 읽는 프레임 안의 잘못된 문자는 오류 (프레임 밖 값은 해석하지 않음)
+    file = fopen(multi_file, "w");
+    if (file) {
+        fprintf(file, "/* 0g000\n */ 0g002\n00001\n");
+        fclose(file);
+    }
+    RGBGArray bad;
+    HexDumpOptions one = multi;
+    one.threads = 1;
+    ok = file != NULL && hexdump_read_rgbg(multi_file, 1, 1, 0, &one, &bad) != 0;
+    log_info("  %s 잘못된 hex 문자 거부\n", ok ? "✓" : "✗");
+    failed += !ok;
+
+    // 같은 beat를 두 번 쓰고 다른 beat를 빠뜨린 덤프 (저장 수는 프레임 크기와 같음)
+    file = fopen(multi_file, "w");
+    if (file) {
+        fprintf(file, "00001\n@0\n00002\n");
+        fclose(file);
+    }
+    ok = file != NULL && hexdump_read_rgbg(multi_file, 1, 2, 0, &one, &bad) != 0;
+    log_info("  %s 중복 주소 / 빠진 beat 거부\n", ok ? "✓" : "✗");
+    failed += !ok;
+
+    free(samples);
+    free_rgb(&rgb);
+    free_rgbg(&rgbg);
+
+    log_info("\n========================================\n");
+    log_info(failed ? "hex 덤프 테스트 실패!\n" : "hex 덤프 테스트 완료!\n");
+    log_info("========================================\n");
+    return failed ? -1 : 0;
+}
+
+// 응답이 기대 문자열로 시작하는지 확인
+static int expect_response(const char *request, const char *expected, char *response, size_t size) {
+    server_handle_line(request, response, size);
+    int ok = strncmp(response, expected, strlen(expected)) == 0;
+    log_info("  %s %s -> %s\n", ok ? "✓" : "✗", request, response);
+    return ok;
+}
+
+// --serve 요청 처리 테스트 (소켓/파이프 없이 요청 한 줄씩 처리)
+// 레지스터 읽기/쓰기, 요청별 덮어쓰기 복원, 출력 해시가 직접 저장한 결과와 같은지 확인
+int test_server(void) {
+    const char *bmp_file = "test_out/img/test_server.bmp";
+    const char *ppm_file = "test_out/img/test_server_10bit.ppm";
+    char response[4096];
+    int failed = 0;
+
+    log_info("========================================\n");
+    log_info("서버 요청 처리 테스트 시작\n");
+    log_info("========================================\n\n");
+
+    RGBArray rgb;
+    if (make_test_rgb(&rgb, 33, 17) != 0) {
+        return -1;
+    }
+    int saved = write_test_bmp24(bmp_file, &rgb, 0) == 0;
+    free_rgb(&rgb);
+    if (!saved || read_bmp(bmp_file, &rgb) != 0) {
+        return -1;
+    }
+
+    // 기대 해시: 현재 순서와 반대 순서의 10bit PPM
+    uint64_t expected[2];
+    int order = ip_ports.por_rgbg_order;
+    for (int k = 0; k < 2; k++) {
+        ip_ports.por_rgbg_order = k ? !order : order;
+        RGBGArray rgbg;
+        OutputSink sink;
+        if (rgb_to_rgbg(&rgb, &rgbg) != 0 || sink_init_hash(&sink) != 0) {
+            free_rgb(&rgb);
+            return -1;
+        }
+        write_rgbg_ppm(&sink, &rgbg, 10);
+        sink_close(&sink);
+        expected[k] = sink_hash(&sink);
+        sink_free(&sink);
+        free_rgbg(&rgbg);
+    }
+    ip_ports.por_rgbg_order = order;
+    free_rgb(&rgb);
+
+    char request[512], expect[256];
+    failed += !expect_response("1 ping", "1 ok", response, sizeof(response));
+
+    snprintf(request, sizeof(request), "2 process in=%s ppm10=%s hash=ppm10", bmp_file, ppm_file);
+    snprintf(expect, sizeof(expect), "2 ok size=33x17 ppm10=%016llx/", (unsigned long long)expected[0]);
+    failed += !expect_response(request, expect, response, sizeof(response));
+    // 저장한 파일을 메모리 출력으로 옮겨 같은 방식으로 해시
+    OutputSink file_sink;
+    sink_init_memory(&file_sink);
+    FILE *file = fopen(ppm_file, "rb");
+    char chunk[4096];
+    size_t got;
+    while (file && (got = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        sink_write(&file_sink, chunk, got);
+    }
+    int ok = file != NULL && sink_hash(&file_sink) == expected[0];
+    if (file) {
+        fclose(file);
+    }
+    sink_free(&file_sink);
+    log_info("  %s 저장한 파일 해시 = 응답 해시\n", ok ? "✓" : "✗");
+    failed += !ok;
+
+    snprintf(request, sizeof(request), "3 process in=%s reg.por_rgbg_order=%d hash=ppm10", bmp_file, !order);
+    snprintf(expect, sizeof(expect), "3 ok size=33x17 ppm10=%016llx/", (unsigned long long)expected[1]);
+    failed += !expect_response(request, expect, response, sizeof(response));
+    snprintf(expect, sizeof(expect), "4 ok por_rgbg_order=%d", order);
+    failed += !expect_response("4 get por_rgbg_order", expect, response, sizeof(response));
+
+    snprintf(request, sizeof(request), "5 set por_rgbg_order=%d", !order);
+    failed += !expect_response(request, "5 ok", response, sizeof(response));
+    snprintf(request, sizeof(request), "6 process in=%s hash=ppm10", bmp_file);
+    snprintf(expect, sizeof(expect), "6 ok size=33x17 ppm10=%016llx/", (unsigned long long)expected[1]);
+    failed += !expect_response(request, expect, response, sizeof(response));
+    snprintf(request, sizeof(request), "7 set por_rgbg_order=%d", order);
+    failed += !expect_response(request, "7 ok", response, sizeof(response));
+
+    failed += !expect_response("8 process ppm10=x.ppm", "8 error", response, sizeof(response));
+    failed += !expect_response("9 set no_such_reg=1", "9 error", response, sizeof(response));
+    failed += !expect_response("10 frobnicate", "10 error", response, sizeof(response));
+    failed += !expect_response("11 stats", "11 ok jobs=4 errors=3 input_hits=2", response, sizeof(response));
+    ok = server_handle_line("12 quit", response, sizeof(response)) == 1 &&
+         server_handle_line("13 shutdown", response, sizeof(response)) == 2;
+    log_info("  %s quit / shutdown 상태\n", ok ? "✓" : "✗");
+    failed += !ok;
+
+    log_info("\n========================================\n");
+    log_info(failed ? "서버 요청 처리 테스트 실패!\n" : "서버 요청 처리 테스트 완료!\n");
+    log_info("========================================\n");
+    return failed ? -1 : 0;
+}
+
+// 호출자 버퍼 RGBG 결과가 기준 RGBG 배열과 같은지 확인
+static int rgbg_buffer_matches(const CtcBuffer *buffer, const RGBGArray *ref) {
+    for (int y = 0; y < ref->height; y++) {
+        for (int x = 0; x < ref->width; x++) {
+            for (int c = 0; c < 2; c++) {
+                const uint8_t *p = (const uint8_t *)buffer->data + (ptrdiff_t)y * buffer->row_stride +
+                                   (ptrdiff_t)x * buffer->pixel_stride + (ptrdiff_t)c * buffer->channel_stride;
+                size_t i = ((size_t)y * ref->width + x) * 2 + c;
+                unsigned v = buffer->bits == 8 ? *p : *(const uint16_t *)p;
+                if (v != (ref->depth == 8 ? ref->data[i] : ref->data16[i])) {
+                    return 0;
+                }
+            }
+        }
+    }
+    return 1;
+}
+
+// libctcmodel C API 테스트
+// 행 패딩 / 평면(C, H, W) / 16bit 호출자 버퍼에서 변환한 결과가 기존 변환과 같은지,
+// 메모리 인코딩이 저장 함수와 같은 바이트열인지, 컨텍스트별 레지스터가 분리되는지 확인
+int test_ctcmodel(void) {
+    const int width = 37;
+    const int height = 11;
+    int failed = 0;
+
+    log_info("========================================\n");
+    log_info("libctcmodel API 테스트 시작\n");
+    log_info("========================================\n\n");
+
+    // API 호출은 전역 레지스터를 컨텍스트 값으로 바꾸므로 테스트 후 복원
+    IpPorts_t saved_ports = ip_ports;
+    RegFile_t saved_regs = regfile;
+
+    CtcContext *ctx = ctc_create();
+    RGBArray rgb8, rgb12;
+    RGBGArray ref8, ref12;
+    if (!ctx || make_test_rgb(&rgb8, width, height) != 0) {
+        ctc_destroy(ctx);
+        return -1;
+    }
+    rgb8.x0 = 1;    // 홀수 열 시작 (ROI)
+    rgb8.y0 = 3;
+    if (rgb_convert_depth(&rgb8, &rgb12, 12) != 0) {
+        free_rgb(&rgb8);
+        ctc_destroy(ctx);
+        return -1;
+    }
+    rgb12.x0 = rgb8.x0;
+    rgb12.y0 = rgb8.y0;
+    rgb_to_rgbg(&rgb8, &ref8);
+    rgb_to_rgbg(&rgb12, &ref12);
+
+    // 1. 행 패딩이 있는 (H, W, 3) 8bit 입력 -> 행 패딩이 있는 (H, W, 2) 출력
+    ptrdiff_t in_stride = width * 3 + 5, out_stride = width * 2 + 3;
+    uint8_t *in = (uint8_t *)calloc((size_t)in_stride * height, 1);
+    uint8_t *out = (uint8_t *)calloc((size_t)out_stride * height, 1);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            size_t i = (size_t)y * width + x;
+            in[y * in_stride + x * 3 + 0] = rgb8.r[i];
+            in[y * in_stride + x * 3 + 1] = rgb8.g[i];
+            in[y * in_stride + x * 3 + 2] = rgb8.b[i];
+        }
+    }
+    CtcBuffer src = { in, width, height, 3, 8, in_stride, 3, 1, rgb8.x0, rgb8.y0 };
+    CtcBuffer dst = { out, width, height, 2, 8, out_stride, 2, 1, 0, 0 };
+    int ok = ctc_rgb_to_rgbg(ctx, &src, &dst) == 0 && rgbg_buffer_matches(&dst, &ref8);
+    log_info("  %s 8bit (H, W, C) 행 패딩 버퍼\n", ok ? "✓" : "✗");
+    failed += !ok;
+
+    // 2. 평면 (C, H, W) 12bit 입력 -> 평면 (C, H, W) 출력 (행 복사 경로)
+    size_t plane = (size_t)width * height;
+    uint16_t *in16 = (uint16_t *)malloc(plane * 3 * sizeof(uint16_t));
+    uint16_t *out16 = (uint16_t *)calloc(plane * 2, sizeof(uint16_t));
+    memcpy(in16, rgb12.r16, plane * sizeof(uint16_t));
+    memcpy(in16 + plane, rgb12.g16, plane * sizeof(uint16_t));
+    memcpy(in16 + plane * 2, rgb12.b16, plane * sizeof(uint16_t));
+    CtcBuffer src16 = { in16, width, height, 3, 12, width * 2, 2, (ptrdiff_t)(plane * 2), rgb12.x0, rgb12.y0 };
+    CtcBuffer dst16 = { out16, width, height, 2, 12, width * 2, 2, (ptrdiff_t)(plane * 2), 0, 0 };
+    ok = ctc_rgb_to_rgbg(ctx, &src16, &dst16) == 0 && rgbg_buffer_matches(&dst16, &ref12);
+    log_info("  %s 12bit 평면 (C, H, W) 버퍼\n", ok ? "✓" : "✗");
+    failed += !ok;
+
+    // 3. 메모리 인코딩 = 저장 함수 출력 (크기 조회 포함)
+    OutputSink sink;
+    sink_init_memory(&sink);
+    write_rgbg_ppm(&sink, &ref8, 10);
+    sink_close(&sink);
+    size_t size = 0;
+    ok = ctc_encode(ctx, &dst, CTC_FORMAT_PPM10, NULL, 0, &size) != 0 && size == sink.size;
+    uint8_t *encoded = (uint8_t *)malloc(size ? size : 1);
+    ok &= encoded && ctc_encode(ctx, &dst, CTC_FORMAT_PPM10, encoded, size, &size) == 0 &&
+          memcmp(encoded, sink.data, size) == 0;
+    log_info("  %s PPM10 메모리 인코딩 (%zu bytes)\n", ok ? "✓" : "✗", size);
+    failed += !ok;
+    free(encoded);
+    sink_free(&sink);
+
+    // 4. 컨텍스트별 레지스터 분리
+    CtcContext *other = ctc_create();
+    int order = -1, other_order = -1;
+    ok = other && ctc_set_register(other, "por_rgbg_order", !(saved_ports.por_rgbg_order & 1)) == 0 &&
+         ctc_get_register(ctx, "por_rgbg_order", &order) == 0 &&
+         ctc_get_register(other, "por_rgbg_order", &other_order) == 0 &&
+         order == saved_ports.por_rgbg_order && other_order == !(saved_ports.por_rgbg_order & 1);
+    uint8_t *flipped = (uint8_t *)calloc((size_t)out_stride * height, 1);
+    CtcBuffer dst_other = dst;
+    dst_other.data = flipped;
+    ok &= ctc_rgb_to_rgbg(other, &src, &dst_other) == 0 && !rgbg_buffer_matches(&dst_other, &ref8);
+    ok &= ctc_set_register(ctx, "no_such_reg", 1) != 0 && ctc_last_error(ctx)[0] != '\0';
+    log_info("  %s 컨텍스트 레지스터 분리 (%d / %d), 오류 메시지\n", ok ? "✓" : "✗", order, other_order);
+    failed += !ok;
+
+    // 5. 잘못된 버퍼 거부
+    CtcBuffer bad = dst;
+    bad.bits = 12;
+    ok = ctc_rgb_to_rgbg(ctx, &src, &bad) != 0;
+    log_info("  %s 비트 수가 다른 버퍼 거부: %s\n", ok ? "✓" : "✗", ctc_last_error(ctx));
+    failed += !ok;
+
+    free(flipped);
+    free(in);
+    free(out);
+    free(in16);
+    free(out16);
+    free_rgb(&rgb8);
+    free_rgb(&rgb12);
+    free_rgbg(&ref8);
+    free_rgbg(&ref12);
+    ctc_destroy(other);
+    ctc_destroy(ctx);
+    ip_ports = saved_ports;
+    regfile = saved_regs;
+    ctc_tables_invalidate_all();
+
+    log_info("\n========================================\n");
+    log_info(failed ? "libctcmodel API 테스트 실패!\n" : "libctcmodel API 테스트 완료!\n");
+    log_info("========================================\n");
+    return failed ? -1 : 0;
+}
+
+// 로그 테스트 스레드 (스레드 번호와 순번을 메시지에 기록)
+typedef struct {
+    int id;
+    int count;
+} LogTestThread;
+
+static void *log_test_thread(void *arg) {
+    const LogTestThread *t = (const LogTestThread *)arg;
+    for (int i = 0; i < t->count; i++) {
+        log_info("log-test %d %d\n", t->id, i);
+    }
+    return NULL;
+}
+
+// 레벨 로그 테스트
+// 여러 스레드가 링 크기보다 많이 기록해도 스레드별 순서가 유지되고 누락이 없는지,
+// 링보다 긴 메시지와 레벨 필터 / 컴파일 상한이 동작하는지 출력을 임시 파일로 받아 확인
+int test_log(void) {
+    enum { THREADS = 4, MESSAGES = 20000, BIG = 40000 };
+    int failed = 0;
+
+    log_info("========================================\n");
+    log_info("레벨 로그 테스트 시작\n");
+    log_info("========================================\n\n");
+
+    FILE *capture = tmpfile();
+    char *big = (char *)malloc(BIG + 1);
+    char *line = (char *)malloc(BIG + 64);
+    if (!capture || !big || !line) {
+        log_error("오류: 테스트 버퍼 / 임시 파일 생성 실패\n");
+        if (capture) {
+            fclose(capture);
+        }
+        free(big);
+        free(line);
+        return -1;
+    }
+    memset(big, 'x', BIG);
+    big[BIG] = '\0';
+    int saved_level = log_level;
+    log_level = LOG_LEVEL_INFO;
+    log_set_output(capture);
+
+    // 스레드 THREADS개 + 현재 스레드가 동시에 기록 (현재 스레드 번호 = THREADS)
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    pthread_t threads[THREADS];
+    LogTestThread args[THREADS];
+    int started = 0;
+    for (int i = 0; i < THREADS; i++) {
+        args[i].id = i;
+        args[i].count = MESSAGES;
+        if (pthread_create(&threads[i], NULL, log_test_thread, &args[i]) != 0) {
+            break;
+        }
+        started++;
+    }
+    LogTestThread self = { THREADS, MESSAGES };
+    log_test_thread(&self);
+    for (int i = 0; i < started; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    log_info("log-big %s\n", big);
+
+    log_level = LOG_LEVEL_QUIET;
+    log_info("log-filtered info\n");
+    log_error("log-error\n");
+    log_level = LOG_LEVEL_INFO;
+    log_debug("log-filtered debug\n");
+    log_level = LOG_LEVEL_TRACE;
+    log_trace("log-trace\n");
+    log_set_output(stdout);
+    log_level = saved_level;
+
+    int next[THREADS + 1] = { 0 };
+    int order_errors = 0;
+    int big_ok = 0, errors = 0, filtered = 0, traced = 0;
+    rewind(capture);
+    while (fgets(line, BIG + 64, capture)) {
+        int id, n;
+        if (sscanf(line, "log-test %d %d", &id, &n) == 2 && id >= 0 && id <= THREADS) {
+            if (n != next[id]) {
+                order_errors++;
+            }
+            next[id] = n + 1;
+        } else if (strncmp(line, "log-big ", 8) == 0) {
+            big_ok = strlen(line) == 8 + BIG + 1 && strspn(line + 8, "x") == BIG;
+        } else if (strcmp(line, "log-error\n") == 0) {
+            errors++;
+        } else if (strncmp(line, "log-filtered", 12) == 0) {
+            filtered++;
+        } else if (strcmp(line, "log-trace\n") == 0) {
+            traced++;
+        }
+    }
+    fclose(capture);
+    free(big);
+    free(line);
+
+    int complete = started == THREADS && order_errors == 0;
+    for (int i = 0; i <= THREADS; i++) {
+        complete = complete && next[i] == MESSAGES;
+    }
+    double elapsed = (double)(t1.tv_sec - t0.tv_sec) + (double)(t1.tv_nsec - t0.tv_nsec) * 1e-9;
+    int ok = complete;
+    failed |= !ok;
+    log_info("  %s 스레드 %d개 x 메시지 %d개 순서 / 누락 없음 (%.0f ns/메시지)\n", ok ? "✓" : "✗",
+             THREADS + 1, MESSAGES, elapsed * 1e9 / ((THREADS + 1) * MESSAGES));
+    ok = big_ok;
+    failed |= !ok;
+    log_info("  %s 링보다 긴 메시지 (%d bytes)\n", ok ? "✓" : "✗", BIG);
+    ok = errors == 1 && filtered == 0;
+    failed |= !ok;
+    log_info("  %s 레벨 필터 (quiet에서 오류만, info에서 debug 제외)\n", ok ? "✓" : "✗");
+    ok = traced == (LOG_MAX_LEVEL >= LOG_LEVEL_TRACE ? 1 : 0);
+    failed |= !ok;
+    log_info("  %s 컴파일 상한 LOG_MAX_LEVEL=%d (trace %s)\n", ok ? "✓" : "✗", LOG_MAX_LEVEL,
+             LOG_MAX_LEVEL >= LOG_LEVEL_TRACE ? "출력" : "제거");
+
+    log_info("\n========================================\n");
+    log_info(failed ? "레벨 로그 테스트 실패!\n" : "레벨 로그 테스트 완료!\n");
+    log_info("========================================\n");
+    return failed ? -1 : 0;
+}
+
+// 비동기 출력 큐 테스트 (방식별로 동기 저장 결과와 바이트 비교, 역순 구간 쓰기, 제출 실패)
+int test_outq(void) {
+    enum { CHUNKS = 16, CHUNK = 4099 };
+    static const OutQueueBackend backends[] = { OUTQ_AUTO, OUTQ_PWRITE, OUTQ_SYNC };
+    static const char *const kinds[] = { "10bit.ppm", "12bit.ppm", "8bit.bmp" };
+    int failed = 0;
+
+    log_info("========================================\n");
+    log_info("비동기 출력 큐 테스트 시작\n");
+    log_info("========================================\n\n");
+
+    // 기준 출력 (동기 저장)
+    RGBArray rgb;
+    RGBGArray rgbg;
+    if (make_test_rgb(&rgb, 301, 203) != 0) {
+        return -1;
+    }
+    if (rgb_to_rgbg(&rgb, &rgbg) != 0) {
+        free_rgb(&rgb);
+        return -1;
+    }
+    char ref[3][128];
+    for (int k = 0; k < 3; k++) {
+        snprintf(ref[k], sizeof(ref[k]), "test_out/outq/ref_%s", kinds[k]);
+    }
+    if (save_rgbg_to_ppm_10bit(&rgbg, ref[0]) != 0 || save_rgbg_to_ppm_12bit(&rgbg, ref[1]) != 0) {
+        free_rgb(&rgb);
+        free_rgbg(&rgbg);
+        return -1;
+    }
+    OutputSink ref_bmp;
+    if (sink_open_file(&ref_bmp, ref[2]) != 0) {
+        free_rgb(&rgb);
+        free_rgbg(&rgbg);
+        return -1;
+    }
+    int ref_ok = write_rgb_bmp_8bit(&ref_bmp, &rgb) == 0;
+    ref_ok = sink_close(&ref_bmp) == 0 && ref_ok;
+
+    for (int b = 0; b < (int)(sizeof(backends) / sizeof(backends[0])) && ref_ok; b++) {
+        // 깊이 2에 파일 6개 제출 (제출 대기 경로 포함)
+        OutQueue *q = outq_create(2, backends[b]);
+        if (!q) {
+            failed = 1;
+            break;
+        }
+        const char *name = outq_backend_name(q);
+        int submitted = 1;
+        char path[6][128];
+        for (int i = 0; i < 6; i++) {
+            OutputSink sink;
+            sink_init_memory(&sink);
+            int k = i % 3;
+            snprintf(path[i], sizeof(path[i]), "test_out/outq/%s_%d_%s", name, i, kinds[k]);
+            int encoded = (k == 2) ? write_rgb_bmp_8bit(&sink, &rgb)
+                                   : write_rgbg_ppm(&sink, &rgbg, k == 0 ? 10 : 12);
+            submitted &= encoded == 0 && outq_submit_file(q, path[i], &sink) == 0;
+            sink_free(&sink);
+        }
+        submitted &= outq_drain(q) == 0;
+        int same = submitted;
+        for (int i = 0; i < 6 && same; i++) {
+            long size_a = 0, size_b = 0;
+            uint8_t *a = read_whole_file(ref[i % 3], &size_a);
+            uint8_t *c = read_whole_file(path[i], &size_b);
+            same = a && c && size_a == size_b && memcmp(a, c, (size_t)size_a) == 0;
+            free(a);
+            free(c);
+        }
+        failed |= !same;
+        log_info("  %s %-8s 파일 6개 (깊이 2) = 동기 저장 결과\n", same ? "✓" : "✗", name);
+
+        // 열린 파일에 구간을 역순으로 제출 (완료 순서와 관계없이 제자리에 기록)
+        char stream_path[128];
+        snprintf(stream_path, sizeof(stream_path), "test_out/outq/%s_stream.bin", name);
+        FILE *stream = fopen(stream_path, "wb");
+        int ok = stream != NULL;
+        for (int c = CHUNKS - 1; c >= 0 && ok; c--) {
+            uint8_t *chunk = (uint8_t *)malloc(CHUNK);
+            if (!chunk) {
+                ok = 0;
+                break;
+            }
+            memset(chunk, 'a' + c, CHUNK);
+            ok = outq_write_at(q, fileno(stream), (uint64_t)c * CHUNK, chunk, CHUNK) == 0;
+        }
+        ok = outq_drain(q) == 0 && ok;
+        if (stream) {
+            fclose(stream);
+        }
+        long size = 0;
+        uint8_t *data = ok ? read_whole_file(stream_path, &size) : NULL;
+        ok = data && size == (long)CHUNKS * CHUNK;
+        for (long i = 0; ok && i < size; i++) {
+            ok = data[i] == 'a' + i / CHUNK;
+        }
+        free(data);
+        failed |= !ok;
+        log_info("  %s %-8s 역순 구간 쓰기 %d x %d bytes\n", ok ? "✓" : "✗", name, CHUNKS, CHUNK);
+
+        // 빈 파일 / 만들 수 없는 경로
+        OutputSink empty;
+        sink_init_memory(&empty);
+        snprintf(path[0], sizeof(path[0]), "test_out/outq/%s_empty.bin", name);
+        ok = outq_submit_file(q, path[0], &empty) == 0;
+        sink_init_memory(&empty);
+        sink_write(&empty, "x", 1);
+        ok = ok && outq_submit_file(q, "test_out/outq/no_such_dir/x.bin", &empty) != 0;
+        sink_free(&empty);
+        ok = outq_destroy(q) == 0 && ok;
+        data = read_whole_file(path[0], &size);
+        ok = ok && data && size == 0;
+        free(data);
+        failed |= !ok;
+        log_info("  %s %-8s 빈 파일 / 생성 실패 보고\n", ok ? "✓" : "✗", name);
+    }
+    failed |= !ref_ok;
+    free_rgb(&rgb);
+    free_rgbg(&rgbg);
+
+    log_info("\n========================================\n");
+    log_info(failed ? "비동기 출력 큐 테스트 실패!\n" : "비동기 출력 큐 테스트 완료!\n");
+    log_info("========================================\n");
+    return failed ? -1 : 0;
+}
+
+// 테스트용 RGBG 배열 채우기 (0: 잡음, 1: 가로 그라데이션 + 64행 띠, 2: 평탄)
+static void fill_test_rgbg(RGBGArray *rgbg, int pattern, uint32_t seed) {
+    unsigned mask = (1u << rgbg->depth) - 1;
+    size_t n = (size_t)rgbg->width * 2;
+    for (int y = 0; y < rgbg->height; y++) {
+        for (size_t i = 0; i < n; i++) {
+            unsigned v;
+            if (pattern == 0) {
+                seed = seed * 1664525u + 1013904223u;
+                v = seed >> 8;
+            } else if (pattern == 1) {
+                v = (unsigned)((i >> 2) + (size_t)(y / 64) * 40 + (i & 1) * 97) << (rgbg->depth - 8);
+            } else {
+                v = mask - 3;
+            }
+            if (rgbg->depth == 8) {
+                rgbg->data[(size_t)y * n + i] = (uint8_t)(v & mask);
+            } else {
+                rgbg->data16[(size_t)y * n + i] = (uint16_t)(v & mask);
+            }
+        }
+    }
+}
+
+// 두 RGBG 배열의 10bit PPM 출력이 같은지 (순서/ROI 위상까지 확인)
+static int same_ppm_output(RGBGArray *a, RGBGArray *b) {
+    OutputSink sa, sb;
+    sink_init_memory(&sa);
+    sink_init_memory(&sb);
+    int same = write_rgbg_ppm(&sa, a, 10) == 0 && write_rgbg_ppm(&sb, b, 10) == 0 &&
+               sa.size == sb.size && memcmp(sa.data, sb.data, (size_t)sa.size) == 0;
+    sink_free(&sa);
+    sink_free(&sb);
+    return same;
+}
+
+// .ctcz 코덱 테스트 (깊이/크기/위상별 왕복, 잡음 크기 상한, 긴 0 구간, 손상 데이터, 속도)
+int test_ctcz(void) {
+    static const int depths[] = { 8, 10, 12, 16 };
+    static const int widths[] = { 1, 3, 301 };
+    int failed = 0;
+
+    log_info("========================================\n");
+    log_info(".ctcz 코덱 테스트 시작\n");
+    log_info("========================================\n\n");
+
+    // [1/4] RGBG 왕복: 깊이 x 너비 x 패턴 x ROI 위상
+    int cases = 0, bad = 0;
+    for (int d = 0; d < 4; d++) {
+        for (int w = 0; w < 3; w++) {
+            for (int pattern = 0; pattern < 3; pattern++) {
+                RGBGArray src, out;
+                RGBArray unused;
+                if (alloc_rgbg(&src, widths[w], 7, depths[d]) != 0) {
+                    return -1;
+                }
+                fill_test_rgbg(&src, pattern, (uint32_t)(d * 31 + w * 7 + pattern));
+                src.order = (pattern + w) & 1;
+                src.x0 = w;
+                src.y0 = d;
+                OutputSink sink;
+                sink_init_memory(&sink);
+                int ok = write_rgbg_ctcz(&sink, &src) == 0 &&
+                         ctcz_decode(sink.data, (size_t)sink.size, &out, &unused) == CTCZ_KIND_RGBG;
+                if (ok) {
+                    size_t bytes = (size_t)src.width * src.height * 2 * (src.depth == 8 ? 1 : 2);
+                    ok = out.depth == src.depth &&
+                         memcmp(src.depth == 8 ? (void *)src.data : (void *)src.data16,
+                                out.depth == 8 ? (void *)out.data : (void *)out.data16, bytes) == 0 &&
+                         same_ppm_output(&src, &out);
+                    free_rgbg(&out);
+                }
+                sink_free(&sink);
+                free_rgbg(&src);
+                cases++;
+                bad += !ok;
+            }
+        }
+    }
+    failed |= bad != 0;
+    log_info("  %s [1/4] RGBG 왕복 %d가지 (8/10/12/16bit, 너비 1/3/301, 잡음/그라데이션/평탄, 홀수 ROI)\n",
+             bad ? "✗" : "✓", cases);
+
+    // [2/4] RGB 왕복 + 잡음 행은 원본 크기를 넘지 않음
+    RGBArray rgb, rgb_out;
+    RGBGArray unused_rgbg;
+    if (make_test_rgb(&rgb, 301, 203) != 0) {
+        return -1;
+    }
+    int ok = 1;
+    for (int depth = 8; depth <= 16 && ok; depth += 8) {
+        RGBArray src;
+        ok = rgb_convert_depth(&rgb, &src, depth) == 0;
+        OutputSink sink;
+        sink_init_memory(&sink);
+        ok = ok && write_rgb_ctcz(&sink, &src) == 0 &&
+             ctcz_decode(sink.data, (size_t)sink.size, &unused_rgbg, &rgb_out) == CTCZ_KIND_RGB;
+        size_t n = (size_t)src.width * src.height;
+        size_t bytes = (depth == 8) ? n : n * 2;
+        if (ok) {
+            ok = depth == 8
+                ? memcmp(src.r, rgb_out.r, bytes) == 0 && memcmp(src.g, rgb_out.g, bytes) == 0 &&
+                  memcmp(src.b, rgb_out.b, bytes) == 0
+                : memcmp(src.r16, rgb_out.r16, bytes) == 0 && memcmp(src.g16, rgb_out.g16, bytes) == 0 &&
+                  memcmp(src.b16, rgb_out.b16, bytes) == 0;
+            free_rgb(&rgb_out);
+        }
+        // 상한: 헤더 + 행마다 모드 바이트 + 원본 샘플
+        ok = ok && sink.size <= 20 + (uint64_t)src.height * 3 * (1 + src.width * (depth == 8 ? 1 : 2));
+        sink_free(&sink);
+        free_rgb(&src);
+    }
+    failed |= !ok;
+    log_info("  %s [2/4] RGB 왕복 8/16bit, 크기 상한 (원본 + 행당 1바이트)\n", ok ? "✓" : "✗");
+
+    // [3/4] 손상 / 잘린 데이터 거부
+    OutputSink sink;
+    sink_init_memory(&sink);
+    ok = write_rgb_ctcz(&sink, &rgb) == 0;
+    int rejected = 0;
+    if (ok) {
+        rejected += ctcz_decode(sink.data, (size_t)sink.size - 1, &unused_rgbg, &rgb_out) < 0;
+        rejected += ctcz_decode(sink.data, 10, &unused_rgbg, &rgb_out) < 0;
+        sink.data[4] = 99;
+        rejected += ctcz_decode(sink.data, (size_t)sink.size, &unused_rgbg, &rgb_out) < 0;
+    }
+    sink_free(&sink);
+    free_rgb(&rgb);
+    ok = ok && rejected == 3;
+    failed |= !ok;
+    log_info("  %s [3/4] 잘린 데이터 / 짧은 헤더 / 잘못된 버전 거부\n", ok ? "✓" : "✗");
+
+    // [4/4] 1080x2392 10bit 압축 비율 / 속도 (PPM 10bit 대비)
+    RGBGArray big, big_out;
+    RGBArray unused;
+    if (alloc_rgbg(&big, 1080, 2392, 10) != 0) {
+        return -1;
+    }
+    static const char *const names[] = { "잡음", "그라데이션", "평탄" };
+    double ppm_bytes = 15.0 + (double)big.width * big.height * 6;
+    ok = 1;
+    for (int pattern = 0; pattern < 3 && ok; pattern++) {
+        fill_test_rgbg(&big, pattern, 1);
+        sink_init_memory(&sink);
+        struct timespec t0, t1, t2;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        ok = write_rgbg_ctcz(&sink, &big) == 0;
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        ok = ok && ctcz_decode(sink.data, (size_t)sink.size, &big_out, &unused) == CTCZ_KIND_RGBG;
+        clock_gettime(CLOCK_MONOTONIC, &t2);
+        ok = ok && memcmp(big.data16, big_out.data16, (size_t)big.width * big.height * 2 * sizeof(uint16_t)) == 0;
+        double enc = (double)(t1.tv_sec - t0.tv_sec) + (double)(t1.tv_nsec - t0.tv_nsec) * 1e-9;
+        double dec = (double)(t2.tv_sec - t1.tv_sec) + (double)(t2.tv_nsec - t1.tv_nsec) * 1e-9;
+        log_info("  %s [4/4] %-10s %9llu bytes (PPM 대비 1/%.1f), 압축 %.0f MB/s, 복원 %.0f MB/s (PPM 기준)\n",
+                 ok ? "✓" : "✗", names[pattern], (unsigned long long)sink.size,
+                 ppm_bytes / (double)sink.size, ppm_bytes / enc / 1e6, ppm_bytes / dec / 1e6);
+        if (ok) {
+            free_rgbg(&big_out);
+        }
+        sink_free(&sink);
+    }
+    free_rgbg(&big);
+    failed |= !ok;
+
+    log_info("\n========================================\n");
+    log_info(failed ? ".ctcz 코덱 테스트 실패!\n" : ".ctcz 코덱 테스트 완료!\n");
+    log_info("========================================\n");
+    return failed ? -1 : 0;
+}
+
+// 합성 패턴 테스트 (지정 해석, RGBG 직접 생성 = RGB 생성 후 변환, 패턴 값, 생성 속도)
+int test_pattern(void) {
+    int failed = 0;
+    log_info("========================================\n");
+    log_info("합성 패턴 테스트 시작\n");
+    log_info("========================================\n\n");
+
+    // [1/4] 지정 해석 / 잘못된 지정 거부
+    static const char *const bad[] = {
+        "stripes,64x64", "gray,0x64", "gray,64x", "gray,64x64,fg=256", "gray,64x64,ch=rx",
+        "window,64x64,size=101", "checker,64x64,size=0", "gray,64x64,zz=1", ""
+    };
+    PatternSpec spec;
+    int ok = pattern_parse("window,1080x2392,size=25,bg=32,ch=rg", &spec) == 0 &&
+             spec.kind == PATTERN_WINDOW && spec.width == 1080 && spec.height == 2392 &&
+             spec.size == 25 && spec.fg == 255 && spec.bg == 32 &&
+             spec.channels == (PATTERN_CH_R | PATTERN_CH_G);
+    ok = ok && pattern_parse("256gray", &spec) == 0 && spec.kind == PATTERN_BARS && spec.width == 0;
+    int rejected = 0;
+    for (int i = 0; i < (int)(sizeof(bad) / sizeof(bad[0])); i++) {
+        rejected += pattern_parse(bad[i], &spec) != 0;
+    }
+    ok = ok && rejected == (int)(sizeof(bad) / sizeof(bad[0]));
+    failed |= !ok;
+    log_info("  %s [1/4] 지정 해석, 잘못된 지정 %d/%d개 거부\n", ok ? "✓" : "✗",
+             rejected, (int)(sizeof(bad) / sizeof(bad[0])));
+
+    // [2/4] RGBG 직접 생성 = RGB 생성 후 rgb_to_rgbg (깊이 / 서브픽셀 순서 / 홀수 시작 위치)
+    static const char *const specs[] = {
+        "gray,37x29,fg=200", "ramp,37x29,ch=rb", "bars,37x29", "window,37x29,size=40,bg=16,ch=g",
+        "hlines,37x29,size=2", "vlines,37x29,size=3", "checker,37x29,size=4,fg=128",
+        "subpixel,37x29,ch=r", "subpixel,37x29,ch=b", "subpixel,37x29,x=5,y=6,ch=rgb"
+    };
+    int saved_order = ip_ports.por_rgbg_order;
+    int cases = 0, mismatches = 0;
+    for (int i = 0; i < (int)(sizeof(specs) / sizeof(specs[0])); i++) {
+        for (int depth = 8; depth <= 12; depth += 4) {
+            for (int variant = 0; variant < 4; variant++) {
+                RGBArray rgb;
+                RGBGArray expected, direct;
+                ip_ports.por_rgbg_order = variant & 1;
+                if (pattern_parse(specs[i], &spec) != 0 || pattern_generate_rgb(&spec, depth, &rgb) != 0) {
+                    mismatches++;
+                    continue;
+                }
+                rgb.x0 = (variant & 2) ? 7 : 0;
+                rgb.y0 = (variant & 2) ? 3 : 0;
+                pattern_fill_rgb(&spec, &rgb);
+                if (rgb_to_rgbg(&rgb, &expected) != 0 ||
+                    alloc_rgbg(&direct, rgb.width, rgb.height, depth) != 0) {
+                    free_rgb(&rgb);
+                    ip_ports.por_rgbg_order = saved_order;
+                    return -1;
+                }
+                direct.x0 = rgb.x0;
+                direct.y0 = rgb.y0;
+                size_t bytes = (size_t)rgb.width * rgb.height * 2 * (depth == 8 ? 1 : sizeof(uint16_t));
+                if (pattern_fill_rgbg(&spec, &direct) != 0 ||
+                    memcmp(depth == 8 ? (void *)expected.data : (void *)expected.data16,
+                           depth == 8 ? (void *)direct.data : (void *)direct.data16, bytes) != 0) {
+                    log_error("  불일치: %s (%dbit, 순서 %d, 시작 (%d, %d))\n",
+                              specs[i], depth, variant & 1, rgb.x0, rgb.y0);
+                    mismatches++;
+                }
+                cases++;
+                free_rgb(&rgb);
+                free_rgbg(&expected);
+                free_rgbg(&direct);
+            }
+        }
+    }
+    ip_ports.por_rgbg_order = saved_order;
+
+    // C API: 평면 (C, H, W) RGB 버퍼 / (H, W, 2) RGBG 버퍼
+    CtcContext *ctx = ctc_create();
+    uint8_t planar[3 * 29 * 37];
+    uint16_t packed[29 * 37 * 2];
+    CtcBuffer rgb_buf = { planar, 37, 29, 3, 8, 37, 1, 37 * 29, 0, 0 };
+    CtcBuffer rgbg_buf = { packed, 37, 29, 2, 12, 37 * 2 * 2, 2 * 2, 2, 0, 0 };
+    RGBArray api_rgb;
+    RGBGArray api_rgbg;
+    if (!ctx || pattern_parse(specs[6], &spec) != 0 || pattern_generate_rgb(&spec, 8, &api_rgb) != 0) {
+        ctc_destroy(ctx);
+        return -1;
+    }
+    if (pattern_generate_rgbg(&spec, 12, &api_rgbg) != 0) {
+        free_rgb(&api_rgb);
+        ctc_destroy(ctx);
+        return -1;
+    }
+    if (ctc_pattern(ctx, "checker,size=4,fg=128", &rgb_buf) != 0 ||
+        memcmp(planar, api_rgb.r, 37 * 29) != 0 || memcmp(planar + 37 * 29, api_rgb.g, 37 * 29) != 0 ||
+        memcmp(planar + 37 * 29 * 2, api_rgb.b, 37 * 29) != 0 ||
+        ctc_pattern(ctx, specs[6], &rgbg_buf) != 0 ||
+        memcmp(packed, api_rgbg.data16, sizeof(packed)) != 0 ||
+        ctc_pattern(ctx, "checker,64x64", &rgb_buf) == 0) {
+        log_error("  C API ctc_pattern 결과 불일치\n");
+        mismatches++;
+    }
+    free_rgb(&api_rgb);
+    free_rgbg(&api_rgbg);
+    ctc_destroy(ctx);
+
+    ok = mismatches == 0;
+    failed |= !ok;
+    log_info("  %s [2/4] RGBG 직접 생성 = RGB 생성 후 변환 (%d개 조합), C API ctc_pattern\n",
+             ok ? "✓" : "✗", cases);
+
+    // [3/4] 패턴 값: 256단계 띠, 체커보드 칸, 단일 서브픽셀 (RGBG에서 0이 아닌 샘플 1개)
+    RGBArray rgb;
+    ok = pattern_parse("bars,64x512", &spec) == 0 && pattern_generate_rgb(&spec, 8, &rgb) == 0;
+    for (int y = 0; ok && y < rgb.height; y++) {
+        size_t i = (size_t)y * rgb.width + (size_t)(y % rgb.width);
+        ok = rgb.r[i] == y / 2 && rgb.g[i] == y / 2 && rgb.b[i] == y / 2;
+    }
+    if (rgb.r) {
+        free_rgb(&rgb);
+    }
+    if (ok) {
+        ok = pattern_parse("checker,40x24,size=8,fg=100,bg=20", &spec) == 0 &&
+             pattern_generate_rgb(&spec, 12, &rgb) == 0;
+        for (int y = 0; ok && y < rgb.height; y++) {
+            for (int x = 0; ok && x < rgb.width; x++) {
+                uint16_t want = ((x / 8 + y / 8) & 1) ? (20 * 4095) / 255 : (100 * 4095) / 255;
+                ok = rgb.g16[(size_t)y * rgb.width + x] == want;
+            }
+        }
+        if (rgb.r16) {
+            free_rgb(&rgb);
+        }
+    }
+    static const char *const single[] = { "subpixel,33x17,ch=r", "subpixel,33x17,ch=g", "subpixel,33x17,ch=b" };
+    for (int i = 0; ok && i < 3; i++) {
+        RGBGArray rgbg;
+        ok = pattern_parse(single[i], &spec) == 0 && pattern_generate_rgbg(&spec, 10, &rgbg) == 0;
+        int lit = 0;
+        for (size_t k = 0; ok && k < (size_t)rgbg.width * rgbg.height * 2; k++) {
+            if (rgbg.data16[k] != 0) {
+                lit += rgbg.data16[k] == 1023 ? 1 : 100;
+            }
+        }
+        if (ok) {
+            free_rgbg(&rgbg);
+        }
+        ok = ok && lit == 1;
+    }
+    failed |= !ok;
+    log_info("  %s [3/4] 256단계 띠 / 체커보드 / 단일 서브픽셀 값\n", ok ? "✓" : "✗");
+
+    // [4/4] 1080x2392 10bit 생성 속도 (RGB / RGBG)
+    static const char *const names[] = {
+        "gray", "ramp", "bars", "window", "hlines", "vlines", "checker", "subpixel"
+    };
+    ok = 1;
+    for (int i = 0; i < (int)(sizeof(names) / sizeof(names[0])) && ok; i++) {
+        char text[64];
+        RGBGArray rgbg;
+        struct timespec t0, t1, t2;
+        snprintf(text, sizeof(text), "%s,1080x2392", names[i]);
+        ok = pattern_parse(text, &spec) == 0;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        ok = ok && pattern_generate_rgb(&spec, 10, &rgb) == 0;
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        ok = ok && pattern_generate_rgbg(&spec, 10, &rgbg) == 0;
+        clock_gettime(CLOCK_MONOTONIC, &t2);
+        if (ok) {
+            free_rgb(&rgb);
+            free_rgbg(&rgbg);
+        }
+        double rgb_ms = (double)(t1.tv_sec - t0.tv_sec) * 1e3 + (double)(t1.tv_nsec - t0.tv_nsec) * 1e-6;
+        double rgbg_ms = (double)(t2.tv_sec - t1.tv_sec) * 1e3 + (double)(t2.tv_nsec - t1.tv_nsec) * 1e-6;
+        log_info("  %s [4/4] %-9s RGB %6.2f ms, RGBG %6.2f ms\n", ok ? "✓" : "✗", names[i], rgb_ms, rgbg_ms);
+    }
+    failed |= !ok;
+
+    log_info("\n========================================\n");
+    log_info(failed ? "합성 패턴 테스트 실패!\n" : "합성 패턴 테스트 완료!\n");
+    log_info("========================================\n");
+    return failed ? -1 : 0;
+}
+
+// 미리보기 기준 구현 (정의대로 픽셀마다 계산, test_preview 비교용)
+static unsigned preview_ref_sample(const RGBGArray *rgbg, int x, int y, int slot) {
+    size_t i = ((size_t)y * rgbg->width + x) * 2 + slot;
+    return rgbg->depth == 8 ? rgbg->data[i] : rgbg->data16[i];
+}
+
+static void preview_ref_pixel(const RGBGArray *rgbg, int scale, int ox, int oy, unsigned out[3]) {
+    int w = rgbg->width, h = rgbg->height;
+    if (scale == 1) {
+        int x = ox, y = oy;
+        int is_r = ((rgbg->y0 + y + rgbg->order) & 1) == ((rgbg->x0 + x) & 1);
+        int xl = x > 0 ? x - 1 : (w > 1 ? 1 : 0);
+        int xr = x < w - 1 ? x + 1 : (w > 1 ? w - 2 : 0);
+        unsigned hor = (preview_ref_sample(rgbg, xl, y, 0) + preview_ref_sample(rgbg, xr, y, 0) + 1) >> 1;
+        unsigned ver = hor;
+        if (h > 1) {
+            int yu = y > 0 ? y - 1 : 1;
+            int yd = y < h - 1 ? y + 1 : h - 2;
+            ver = (preview_ref_sample(rgbg, x, yu, 0) + preview_ref_sample(rgbg, x, yd, 0) + 1) >> 1;
+        }
+        unsigned p = preview_ref_sample(rgbg, x, y, 0);
+        unsigned q = (hor + ver + 1) >> 1;
+        out[0] = is_r ? p : q;
+        out[1] = preview_ref_sample(rgbg, x, y, 1);
+        out[2] = is_r ? q : p;
+        return;
+    }
+    unsigned sum[3] = { 0, 0, 0 }, cnt[3] = { 0, 0, 0 };
+    for (int y = oy * scale; y < (oy + 1) * scale && y < h; y++) {
+        for (int x = ox * scale; x < (ox + 1) * scale && x < w; x++) {
+            int is_r = ((rgbg->y0 + y + rgbg->order) & 1) == ((rgbg->x0 + x) & 1);
+            sum[is_r ? 0 : 2] += preview_ref_sample(rgbg, x, y, 0);
+            cnt[is_r ? 0 : 2]++;
+            sum[1] += preview_ref_sample(rgbg, x, y, 1);
+            cnt[1]++;
+        }
+    }
+    for (int k = 0; k < 3; k++) {
+        int c = cnt[k] ? k : 1;
+        out[k] = (sum[c] + cnt[c] / 2) / cnt[c];
+    }
+}
+
+// 미리보기 결과를 기준 구현과 비교, 스레드 1개 / 3개 결과가 같은지도 확인
+// 반환값: 불일치 픽셀 수 (-1 실패)
+static int64_t preview_check(const RGBGArray *rgbg, int scale) {
+    RGBArray one, three;
+    if (rgbg_to_rgb_preview(rgbg, &one, scale, 1) != 0) {
+        return -1;
+    }
+    if (rgbg_to_rgb_preview(rgbg, &three, scale, 3) != 0) {
+        free_rgb(&one);
+        return -1;
+    }
+    int64_t bad = 0;
+    for (int oy = 0; oy < one.height; oy++) {
+        for (int ox = 0; ox < one.width; ox++) {
+            size_t i = (size_t)oy * one.width + ox;
+            unsigned want[3];
+            preview_ref_pixel(rgbg, scale, ox, oy, want);
+            unsigned got[3] = {
+                one.depth == 8 ? one.r[i] : one.r16[i],
+                one.depth == 8 ? one.g[i] : one.g16[i],
+                one.depth == 8 ? one.b[i] : one.b16[i]
+            };
+            unsigned other[3] = {
+                one.depth == 8 ? three.r[i] : three.r16[i],
+                one.depth == 8 ? three.g[i] : three.g16[i],
+                one.depth == 8 ? three.b[i] : three.b16[i]
+            };
+            if (memcmp(got, want, sizeof(got)) != 0 || memcmp(got, other, sizeof(got)) != 0) {
+                if (bad == 0) {
+                    log_error("  불일치 (%d, %d) 배율 %d: (%u, %u, %u) 기대 (%u, %u, %u)\n", ox, oy, scale,
+                              got[0], got[1], got[2], want[0], want[1], want[2]);
+                }
+                bad++;
+            }
+        }
+    }
+    free_rgb(&one);
+    free_rgb(&three);
+    return bad;
+}
+
+// RGBG -> RGB 미리보기 테스트 (단색 복원, 기준 구현 일치, 스레드 수 무관, 속도)
+int test_preview(void) {
+    int failed = 0;
+    log_info("========================================\n");
+    log_info("RGBG 미리보기 테스트 시작\n");
+    log_info("========================================\n\n");
+
+    // [1/4] 단색 입력은 모든 배율 / 깊이 / 순서 / 시작 위치에서 그대로 복원
+    int saved_order = ip_ports.por_rgbg_order;
+    int ok = 1;
+    for (int depth = 8; depth <= 12 && ok; depth += 4) {
+        for (int variant = 0; variant < 4 && ok; variant++) {
+            PatternSpec spec;
+            RGBGArray rgbg;
+            ip_ports.por_rgbg_order = variant & 1;
+            ok = pattern_parse("gray,37x29,fg=200", &spec) == 0 && pattern_generate_rgbg(&spec, depth, &rgbg) == 0;
+            if (!ok) {
+                break;
+            }
+            rgbg.x0 = (variant & 2) ? 1 : 0;
+            rgbg.y0 = (variant & 2) ? 3 : 0;
+            unsigned level = depth == 8 ? 200 : rgbg.data16[1];
+            for (int scale = 1; scale <= 5 && ok; scale += 2) {
+                RGBArray rgb;
+                ok = rgbg_to_rgb_preview(&rgbg, &rgb, scale, 0) == 0;
+                for (size_t i = 0; ok && i < (size_t)rgb.width * rgb.height; i++) {
+                    ok = depth == 8 ? (rgb.r[i] == level && rgb.g[i] == level && rgb.b[i] == level)
+                                    : (rgb.r16[i] == level && rgb.g16[i] == level && rgb.b16[i] == level);
+                }
+                if (rgb.width > 0) {
+                    free_rgb(&rgb);
+                }
+            }
+            free_rgbg(&rgbg);
+        }
+    }
+    ip_ports.por_rgbg_order = saved_order;
+    failed |= !ok;
+    log_info("  %s [1/4] 단색 복원 (8/12bit, 순서 0/1, 홀수 시작 위치, 배율 1/3/5)\n", ok ? "✓" : "✗");
+
+    // [2/4] 임의 데이터: 전체 해상도 = 기준 구현 (SIMD 본체 + 나머지, 가장자리, 1행/1열), 스레드 수 무관
+    // [3/4] 임의 데이터: 면적 렌더링 = 기준 구현 (나누어떨어지지 않는 크기 포함)
+    static const int sizes[][2] = { { 37, 100 }, { 64, 48 }, { 1, 1 }, { 2, 1 }, { 1, 5 }, { 37, 1 }, { 3, 2 } };
+    uint32_t seed = 12345;
+    int64_t bad_full = 0, bad_area = 0;
+    for (int s = 0; s < (int)(sizeof(sizes) / sizeof(sizes[0])); s++) {
+        for (int depth = 8; depth <= 12; depth += 4) {
+            for (int variant = 0; variant < 4; variant++) {
+                RGBGArray rgbg;
+                if (alloc_rgbg(&rgbg, sizes[s][0], sizes[s][1], depth) != 0) {
+                    return -1;
+                }
+                rgbg.order = variant & 1;
+                rgbg.x0 = (variant & 2) ? 5 : 0;
+                rgbg.y0 = (variant & 2) ? 1 : 0;
+                for (size_t i = 0; i < (size_t)rgbg.width * rgbg.height * 2; i++) {
+                    seed = seed * 1103515245u + 12345u;
+                    if (depth == 8) {
+                        rgbg.data[i] = (uint8_t)(seed >> 24);
+                    } else {
+                        rgbg.data16[i] = (uint16_t)((seed >> 16) & 0xFFF);
+                    }
+                }
+                int64_t bad = preview_check(&rgbg, 1);
+                bad_full += bad < 0 ? 1 : bad;
+                for (int scale = 2; scale <= 5; scale++) {
+                    bad = preview_check(&rgbg, scale);
+                    bad_area += bad < 0 ? 1 : bad;
+                }
+                free_rgbg(&rgbg);
+            }
+        }
+    }
+    failed |= bad_full != 0 || bad_area != 0;
+    log_info("  %s [2/4] 전체 해상도 = 기준 구현, 스레드 1/3개 같음 (불일치 %lld)\n",
+             bad_full == 0 ? "✓" : "✗", (long long)bad_full);
+    log_info("  %s [3/4] 면적 렌더링 배율 2~5 = 기준 구현 (불일치 %lld)\n",
+             bad_area == 0 ? "✓" : "✗", (long long)bad_area);
+
+    // [4/4] 1080x2392 10bit 속도 / 24bit BMP 크기
+    PatternSpec spec;
+    RGBGArray rgbg;
+    if (pattern_parse("ramp,1080x2392", &spec) != 0 || pattern_generate_rgbg(&spec, 10, &rgbg) != 0) {
+        return -1;
+    }
+    static const int modes[][2] = { { 1, 1 }, { 1, 0 }, { 4, 1 }, { 4, 0 } };
+    ok = 1;
+    for (int m = 0; m < 4 && ok; m++) {
+        RGBArray rgb;
+        struct timespec t0, t1;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        ok = rgbg_to_rgb_preview(&rgbg, &rgb, modes[m][0], modes[m][1]) == 0;
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        if (!ok) {
+            break;
+        }
+        double ms = (double)(t1.tv_sec - t0.tv_sec) * 1e3 + (double)(t1.tv_nsec - t0.tv_nsec) * 1e-6;
+        log_info("  %s [4/4] 배율 %d, 스레드 %s: %dx%d %.2f ms\n", "✓", modes[m][0],
+                 modes[m][1] ? "1개" : "CPU 수", rgb.width, rgb.height, ms);
+        free_rgb(&rgb);
+    }
+    OutputSink sink;
+    sink_init_memory(&sink);
+    size_t row_bytes = ((size_t)270 * 3 + 3) & ~(size_t)3;
+    ok = ok && write_rgbg_preview(&sink, &rgbg, 4) == 0 && sink.size == 54 + row_bytes * 598;
+    sink_free(&sink);
+    free_rgbg(&rgbg);
+    failed |= !ok;
+    log_info("  %s [4/4] 배율 4 미리보기 24bit BMP 크기\n", ok ? "✓" : "✗");
+
+    log_info("\n========================================\n");
+    log_info(failed ? "RGBG 미리보기 테스트 실패!\n" : "RGBG 미리보기 테스트 완료!\n");
+    log_info("========================================\n");
+    return failed ? -1 : 0;
+}
+
+// 스윕 결과 파일에서 상태가 ok인 줄 수
+static int count_sweep_rows(const char *path) {
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        return -1;
+    }
+    char line[4096];
+    int rows = 0;
+    while (fgets(line, sizeof(line), file)) {
+        rows += line[0] != '#' && strstr(line, "\tok\t") != NULL;
+    }
+    fclose(file);
+    return rows;
+}
+
+// 매니페스트 스윕 테스트 (작업 분할, 중단 후 이어서 실행, 합치기 = 단일 실행 결과)
+int test_sweep(void) {
+    const char *dir = "test_out/sweep_test";
+    char manifest_path[256], single_dir[256], shard_dir[256], path[512];
+    int failed = 0;
+    log_info("========================================\n");
+    log_info("스윕 테스트 시작\n");
+    log_info("========================================\n\n");
+
+    snprintf(manifest_path, sizeof(manifest_path), "%s/sweep.txt", dir);
+    snprintf(single_dir, sizeof(single_dir), "%s/single", dir);
+    snprintf(shard_dir, sizeof(shard_dir), "%s/shards", dir);
+    FILE *file = NULL;
+    if (make_parent_directory(manifest_path) == 0) {
+        file = fopen(manifest_path, "w");
+    }
+    if (!file) {
+        log_error("테스트 매니페스트를 만들 수 없습니다: %s\n", manifest_path);
+        return -1;
+    }
+    fprintf(file, "# 테스트 스윕\n");
+    fprintf(file, "image pattern:bars,64x48\n");
+    fprintf(file, "image pattern:checker,37x29,size=4   # 홀수 크기\n");
+    fprintf(file, "axis por_dbv = 1000, 8000..16000:8000\n");
+    fprintf(file, "axis por_rgbg_order = 0..1\n");
+    fprintf(file, "depth 10\n");
+    fclose(file);
+    for (int shard = 0; shard < 3; shard++) {
+        snprintf(path, sizeof(path), "%s/shard_%dof3.tsv", shard_dir, shard);
+        remove(path);
+    }
+    snprintf(path, sizeof(path), "%s/shard_0of1.tsv", single_dir);
+    remove(path);
+
+    // [1/4] 매니페스트 해석: 작업 수, 작업 번호 -> 설정 점 (마지막 축이 가장 안쪽), 잘못된 매니페스트 거부
+    SweepManifest m;
+    if (sweep_load(manifest_path, &m) != 0) {
+        return -1;
+    }
+    int image, values[SWEEP_MAX_AXES];
+    sweep_job_point(&m, 7, &image, values);
+    int ok = m.jobs == 12 && m.points == 6 && m.depth == 10 && image == 1 &&
+             values[0] == 1000 && values[1] == 1;
+    static const char *const bad[] = {
+        "axis no_such_reg = 1\nimage a.bmp\n", "image a.bmp\naxis por_dbv = 5..1\n",
+        "image a.bmp\naxis por_dbv = \n", "image a.bmp\nfoo\n", "axis por_fcon = 1\n"
+    };
+    char bad_path[256];
+    snprintf(bad_path, sizeof(bad_path), "%s/bad.txt", dir);
+    int rejected = 0;
+    for (int i = 0; i < (int)(sizeof(bad) / sizeof(bad[0])); i++) {
+        SweepManifest bad_m;
+        file = fopen(bad_path, "w");
+        if (file) {
+            fputs(bad[i], file);
+            fclose(file);
+        }
+        rejected += sweep_load(bad_path, &bad_m) != 0;
+    }
+    ok = ok && rejected == (int)(sizeof(bad) / sizeof(bad[0]));
+    failed |= !ok;
+    log_info("  %s [1/4] 매니페스트 해석 (작업 %lld개), 잘못된 매니페스트 %d/%d개 거부\n", ok ? "✓" : "✗",
+             (long long)m.jobs, rejected, (int)(sizeof(bad) / sizeof(bad[0])));
+
+    // [2/4] 단일 실행 (0/1) 후 다시 실행하면 모두 건너뜀
+    SweepStats stats;
+    ok = sweep_run(&m, single_dir, 0, 1, 0, &stats) == 0 && stats.run == 12;
+    ok = ok && sweep_run(&m, single_dir, 0, 1, 0, &stats) == 0 && stats.run == 0 && stats.skipped == 12;
+    failed |= !ok;
+    log_info("  %s [2/4] 단일 실행 12개, 다시 실행 시 모두 건너뜀\n", ok ? "✓" : "✗");
+
+    // [3/4] 3개 샤드: 샤드 1은 2개 처리 후 중단 + 쓰다 만 줄 -> 이어서 실행하면 남은 작업만 처리
+    int64_t resumed = 0;
+    ok = 1;
+    for (int shard = 0; shard < 3 && ok; shard++) {
+        ok = sweep_run(&m, shard_dir, shard, 3, shard == 1 ? 2 : 0, &stats) == 0 && stats.shard_jobs == 4;
+    }
+    snprintf(path, sizeof(path), "%s/shard_1of3.tsv", shard_dir);
+    file = fopen(path, "a");
+    if (file) {
+        fputs("7\tpattern:bars,64x48\tpor_dbv=", file);
+        fclose(file);
+    }
+    SweepStats merge_stats;
+    char report[512];
+    snprintf(report, sizeof(report), "%s/report.tsv", shard_dir);
+    int incomplete = sweep_merge(&m, shard_dir, report, &merge_stats);
+    ok = ok && incomplete == 1 && merge_stats.missing == 2;
+    ok = ok && sweep_run(&m, shard_dir, 1, 3, 0, &stats) == 0 && stats.skipped == 2 && stats.run == 2;
+    resumed = stats.run;
+    ok = ok && count_sweep_rows(path) == 4;
+    // 샤드 수를 바꾼 실행 결과(shard_1of2)가 같이 있으면 합치기에서 겹치는 작업 결과를 비교
+    ok = ok && sweep_run(&m, shard_dir, 1, 2, 0, &stats) == 0 && stats.run == 6;
+    snprintf(path, sizeof(path), "%s/shard_1of2.tsv", shard_dir);
+    failed |= !ok;
+    log_info("  %s [3/4] 샤드 3개, 중단된 샤드 이어서 %lld개만 처리, 중단 시 빠진 작업 검출\n",
+             ok ? "✓" : "✗", (long long)resumed);
+
+    // [4/4] 합치기 = 단일 실행 결과 (ms 열 제외), 매니페스트가 바뀌면 이어서 실행하지 않음
+    char single_report[512];
+    snprintf(single_report, sizeof(single_report), "%s/report.tsv", single_dir);
+    ok = sweep_merge(&m, shard_dir, report, &merge_stats) == 0 && merge_stats.merged == 12 &&
+         merge_stats.conflicts == 0 && sweep_merge(&m, single_dir, single_report, &stats) == 0;
+    remove(path);
+    FILE *a = fopen(report, "r");
+    FILE *b = fopen(single_report, "r");
+    char line_a[4096], line_b[4096];
+    int lines = 0;
+    while (ok && a && b && fgets(line_a, sizeof(line_a), a)) {
+        ok = fgets(line_b, sizeof(line_b), b) != NULL;
+        char *tab_a = strrchr(line_a, '\t'), *tab_b = ok ? strrchr(line_b, '\t') : NULL;
+        if (line_a[0] != '#' && tab_a && tab_b) {
+            ok = tab_a - line_a == tab_b - line_b && memcmp(line_a, line_b, (size_t)(tab_a - line_a)) == 0;
+            lines++;
+        }
+    }
+    ok = ok && a && b && lines == 12;
+    if (a) fclose(a);
+    if (b) fclose(b);
+    SweepManifest changed = m;
+    changed.fingerprint ^= 1;
+    ok = ok && sweep_run(&changed, single_dir, 0, 1, 0, &stats) != 0;
+    failed |= !ok;
+    log_info("  %s [4/4] 샤드 합치기 = 단일 실행 (%d줄), 다른 매니페스트 결과 파일 거부\n", ok ? "✓" : "✗", lines);
+    sweep_free(&m);
+
+    log_info("\n========================================\n");
+    log_info(failed ? "스윕 테스트 실패!\n" : "스윕 테스트 완료!\n");
+    log_info("========================================\n");
+    return failed ? -1 : 0;
+}
+
+// 튜닝 테스트 비용: R nega 라인 게인 0~2 (파생 테이블)와 목표 게인의 제곱 오차 + por_rgbg_order와 3의 제곱 오차
+// (por_rgbg_order는 1bit이므로 최소 비용은 (3 - 1)^2 = 4)
+static double tune_test_cost(void *arg) {
+    const int *target = (const int *)arg;
+    double cost = 0;
+    for (int k = 0; k < 3; k++) {
+        double d = ctc_tables.line_gain[0][0][k] - target[k];
+        cost += d * d;
+    }
+    int order;
+    reg_read_by_name("por_rgbg_order", &order);
+    return cost + (double)(order - 3) * (order - 3);
+}
+
+// 레지스터 자동 튜닝 테스트 (비트 수 범위, 병렬 좌표 하강 수렴, 작업 프로세스 수 무관, 기준 출력 비용)
+int test_tune(void) {
+    const char *dir = "test_out/tune_test";
+    int failed = 0;
+    log_info("========================================\n");
+    log_info("레지스터 튜닝 테스트 시작\n");
+    log_info("========================================\n\n");
+    ctc_tables_init();
+
+    // [1/4] 파라미터 범위: registers_list.csv 비트 수, 패턴 확장, 범위 지정, 없는 이름 거부
+    TuneProblem problem;
+    memset(&problem, 0, sizeof(problem));
+    problem.max_evals = TUNE_DEFAULT_MAX_EVALS;
+    int ok = tune_add_param(&problem, "reg_ctc_line_r_nega_gain*", 0, -1) == 6 &&
+             tune_add_param(&problem, "por_dbv", 0, -1) == 1 &&
+             tune_add_param(&problem, "reg_ctc_th_gray", 16, 1000) == 1 &&
+             tune_add_param(&problem, "reg_ctc_line_r_nega_gain0", 0, -1) == 0 &&
+             tune_add_param(&problem, "reg_no_such_*", 0, -1) < 0 &&
+             tune_add_param(&problem, "por_rgbg_order", 2, 3) < 0;
+    ok = ok && problem.param_count == 8 && problem.params[0].max == 255 &&
+         problem.params[6].max == 16383 && problem.params[7].min == 16 && problem.params[7].max == 255;
+    failed |= !ok;
+    log_info("  %s [1/4] 파라미터 범위 (비트 수, 패턴 확장, 범위 지정, 잘못된 지정 거부)\n", ok ? "✓" : "✗");
+
+    // [2/4] 파생 테이블 비용: 숨긴 레지스터 값의 라인 게인으로 수렴, 1bit 레지스터는 범위 안 최적값
+    static const int hidden[3] = { 37, 200, 90 };
+    static const char *const names[3] = {
+        "reg_ctc_line_r_nega_gain0", "reg_ctc_line_r_nega_gain1", "reg_ctc_line_r_nega_gain2"
+    };
+    int saved[3], target[3];
+    for (int k = 0; k < 3; k++) {
+        reg_read_by_name(names[k], &saved[k]);
+        reg_write_by_name(names[k], hidden[k]);
+    }
+    ctc_tables_refresh();
+    for (int k = 0; k < 3; k++) {
+        target[k] = ctc_tables.line_gain[0][0][k];
+        reg_write_by_name(names[k], saved[k]);
+    }
+    ctc_tables_refresh();
+    memset(&problem, 0, sizeof(problem));
+    problem.max_evals = TUNE_DEFAULT_MAX_EVALS;
+    for (int k = 0; k < 3; k++) {
+        tune_add_param(&problem, names[k], 0, -1);
+    }
+    tune_add_param(&problem, "por_rgbg_order", 0, -1);
+    TuneResult one, many;
+    ok = tune_run(&problem, tune_test_cost, target, 1, &one) == 0 && one.cost == 4.0 && one.values[3] == 1;
+    int restored = 1;
+    for (int k = 0; k < 3; k++) {
+        int value;
+        reg_read_by_name(names[k], &value);
+        restored &= value == saved[k];
+    }
+    ok = ok && restored;
+    failed |= !ok;
+    log_info("  %s [2/4] 파생 테이블 비용 %.0f -> %.0f (평가 %d회, 단계 %d), 레지스터 시작 값 복원\n",
+             ok ? "✓" : "✗", one.start_cost, one.cost, one.evals, one.rounds);
+
+    // [3/4] 작업 프로세스 3개 = 현재 프로세스 평가 (같은 후보, 같은 결과)
+    ok = tune_run(&problem, tune_test_cost, target, 3, &many) == 0 && many.workers == 3 &&
+         many.cost == one.cost && many.evals == one.evals && many.rounds == one.rounds &&
+         memcmp(many.values, one.values, (size_t)problem.param_count * sizeof(int)) == 0;
+    failed |= !ok;
+    log_info("  %s [3/4] 작업 프로세스 %d개 = 현재 프로세스 결과 (%.3f초 / %.3f초)\n", ok ? "✓" : "✗",
+             many.workers, many.seconds, one.seconds);
+
+    // [4/4] 기준 출력 비용: 작업 프로세스에서 계산한 MSE = 현재 프로세스 계산, 최적 값 config 저장 / 로드
+    // (비교 형식은 서브픽셀 순서와 무관하고 현재 모델 출력은 CTC 레지스터를 쓰지 않으므로 비용은 평탄)
+    char ref_path[256], tune_path[256], out_path[256];
+    snprintf(ref_path, sizeof(ref_path), "%s/ref_10bit.ppm", dir);
+    snprintf(tune_path, sizeof(tune_path), "%s/tune.txt", dir);
+    snprintf(out_path, sizeof(out_path), "%s/best_config.txt", dir);
+    PatternSpec spec;
+    RGBArray rgb;
+    RGBGArray rgbg;
+    if (pattern_parse("checker,37x29,size=4,fg=200,bg=30", &spec) != 0 ||
+        pattern_generate_rgb(&spec, 10, &rgb) != 0) {
+        return -1;
+    }
+    ok = rgb_to_rgbg(&rgb, &rgbg) == 0;
+    free_rgb(&rgb);
+    if (ok) {
+        ok = save_rgbg_to_ppm_10bit(&rgbg, ref_path) == 0;
+        free_rgbg(&rgbg);
+    }
+    FILE *file = ok ? fopen(tune_path, "w") : NULL;
+    if (file) {
+        fprintf(file, "# 테스트 튜닝\n");
+        fprintf(file, "target pattern:checker,size=4,fg=200,bg=30 %s\n", ref_path);
+        fprintf(file, "target pattern:checker,size=4,fg=210,bg=30 %s   # 오차 있음\n", ref_path);
+        fprintf(file, "param por_rgbg_order\n");
+        fprintf(file, "param reg_ctc_th_gray = 0..3\n");
+        fprintf(file, "max-evals 50\n");
+        fclose(file);
+    }
+    int saved_gray = 0;
+    reg_read_by_name("reg_ctc_th_gray", &saved_gray);
+    double expected = -1.0;
+    ok = file && tune_load(tune_path, &problem) == 0;
+    if (ok) {
+        expected = tune_output_cost(&problem);
+        ok = expected > 0 && tune_run(&problem, tune_output_cost, &problem, 3, &one) == 0 &&
+             one.start_cost == expected && one.cost == expected && one.moves == 0 && one.evals <= 50 &&
+             tune_save_config(&problem, &one, out_path) == 0;
+        tune_free(&problem);
+    }
+    int gray = -1;
+    ok = ok && load_config(out_path) == 0 && reg_read_by_name("reg_ctc_th_gray", &gray) == 0 && gray == 3;
+    reg_write_by_name("reg_ctc_th_gray", saved_gray);
+    failed |= !ok;
+    log_info("  %s [4/4] 기준 출력 MSE %.3f (작업 프로세스 = 현재 프로세스), 최적 값 config 저장 / 로드\n",
+             ok ? "✓" : "✗", expected);
+
+    log_info("\n========================================\n");
+    log_info(failed ? "레지스터 튜닝 테스트 실패!\n" : "레지스터 튜닝 테스트 완료!\n");
+    log_info("========================================\n");
+    return failed ? -1 : 0;
+}
+
+// test_perf 측정 대상: RGBG 변환을 repeat번 실행
+// 반환값: 0 성공, -1 실패
+static int perf_test_work(const RGBArray *rgb, int repeat) {
+    for (int k = 0; k < repeat; k++) {
+        RGBGArray rgbg;
+        if (rgb_to_rgbg((RGBArray *)rgb, &rgbg) != 0) {
+            return -1;
+        }
+        free_rgbg(&rgbg);
+    }
+    return 0;
+}
+
+typedef struct {
+    const RGBArray *rgb;
+    int result;
+} PerfTestThread;
+
+static void *perf_test_thread(void *arg) {
+    PerfTestThread *t = (PerfTestThread *)arg;
+    PerfScope scope;
+    perf_begin(&scope, PERF_STAGE_RGBG, 5);
+    t->result = perf_test_work(t->rgb, 1);
+    perf_end(&scope);
+    return NULL;
+}
+
+int test_perf(void) {
+    int failed = 0;
+    log_info("========================================\n");
+    log_info("단계별 성능 카운터 테스트 시작\n");
+    log_info("========================================\n\n");
+
+    PatternSpec spec;
+    RGBArray rgb;
+    if (pattern_parse("bars,512x384", &spec) != 0 || pattern_generate_rgb(&spec, 8, &rgb) != 0) {
+        return -1;
+    }
+
+    // [1/4] 꺼져 있으면 측정하지 않음
+    PerfScope scope;
+    PerfSample sample, total;
+    perf_enable(PERF_OFF);
+    perf_begin(&scope, PERF_STAGE_RGBG, 0);
+    int ok = perf_test_work(&rgb, 1) == 0;
+    perf_end(&scope);
+    perf_total_sample(PERF_STAGE_RGBG, &total);
+    ok = ok && !perf_enabled() && total.calls == 0;
+    failed |= !ok;
+    log_info("  %s [1/4] 꺼짐: 측정 없음\n", ok ? "✓" : "✗");
+
+    // [2/4] 시간만: 프레임 기록, 보고 후 비움, 전체 누적 유지
+    ok = perf_enable(PERF_TIME_ONLY) == 0 && perf_enabled();
+    perf_begin(&scope, PERF_STAGE_RGBG, PERF_FRAME_CURRENT);
+    ok = ok && perf_test_work(&rgb, 1) == 0;
+    perf_end(&scope);
+    perf_frame_sample(0, PERF_STAGE_RGBG, &sample);
+    ok = ok && sample.calls == 1 && sample.seconds > 0.0 && sample.count[PERF_INSTRUCTIONS] == 0;
+    perf_frame_report(PERF_FRAME_CURRENT);
+    perf_frame_sample(0, PERF_STAGE_RGBG, &sample);
+    perf_total_sample(PERF_STAGE_RGBG, &total);
+    ok = ok && sample.calls == 0 && total.calls == 1;
+    failed |= !ok;
+    log_info("  %s [2/4] 시간만: 프레임별 기록 / 보고 후 비움 (%.3f ms)\n", ok ? "✓" : "✗", total.seconds * 1e3);
+
+    // [3/4] 하드웨어 카운터: 작업량 2배 -> 명령 수 약 2배 (사용할 수 없으면 시간만 측정으로 대체)
+    unsigned available = perf_enable(PERF_COUNTERS);
+    PerfSample once, twice;
+    perf_begin(&scope, PERF_STAGE_RGBG, 0);
+    ok = perf_test_work(&rgb, 1) == 0;
+    perf_end(&scope);
+    perf_begin(&scope, PERF_STAGE_RGBG, 1);
+    ok = ok && perf_test_work(&rgb, 2) == 0;
+    perf_end(&scope);
+    perf_frame_sample(0, PERF_STAGE_RGBG, &once);
+    perf_frame_sample(1, PERF_STAGE_RGBG, &twice);
+    ok = ok && once.calls == 1 && twice.calls == 1 && once.seconds > 0.0;
+    if (available & (1u << PERF_INSTRUCTIONS)) {
+        double ratio = (double)twice.count[PERF_INSTRUCTIONS] / (double)(once.count[PERF_INSTRUCTIONS] + 1);
+        ok = ok && once.count[PERF_INSTRUCTIONS] > 0 && ratio > 1.7 && ratio < 2.3;
+        log_info("  %s [3/4] 하드웨어 카운터: 명령 수 %llu -> %llu (x%.2f)\n", ok ? "✓" : "✗",
+                 (unsigned long long)once.count[PERF_INSTRUCTIONS],
+                 (unsigned long long)twice.count[PERF_INSTRUCTIONS], ratio);
+    } else {
+        ok = ok && perf_enabled() && once.count[PERF_INSTRUCTIONS] == 0;
+        log_info("  %s [3/4] 하드웨어 카운터 사용 불가: 시간만 측정으로 대체 (%.3f ms -> %.3f ms)\n",
+                 ok ? "✓" : "✗", once.seconds * 1e3, twice.seconds * 1e3);
+    }
+    failed |= !ok;
+
+    // [4/4] 다른 스레드의 단계 구간 (스레드마다 카운터를 따로 열고 같은 프레임 기록에 합침)
+    PerfTestThread arg = { &rgb, -1 };
+    pthread_t thread;
+    ok = pthread_create(&thread, NULL, perf_test_thread, &arg) == 0;
+    if (ok) {
+        pthread_join(thread, NULL);
+    }
+    perf_frame_sample(5, PERF_STAGE_RGBG, &sample);
+    perf_total_sample(PERF_STAGE_RGBG, &total);
+    ok = ok && arg.result == 0 && sample.calls == 1 && total.calls == 3;
+    if (available & (1u << PERF_INSTRUCTIONS)) {
+        ok = ok && sample.count[PERF_INSTRUCTIONS] > 0;
+    }
+    failed |= !ok;
+    log_info("  %s [4/4] 다른 스레드 구간 기록 (%.3f ms)\n", ok ? "✓" : "✗", sample.seconds * 1e3);
+
+    log_info("\n");
+    perf_frame_report(1);
+    perf_report();
+    perf_enable(PERF_OFF);
+    free_rgb(&rgb);
+
+    log_info("\n========================================\n");
+    log_info(failed ? "단계별 성능 카운터 테스트 실패!\n" : "단계별 성능 카운터 테스트 완료!\n");
+    log_info("========================================\n");
+    return failed ? -1 : 0;
+}
+
+// test_seq: 몇 행만 바뀌는 RGB24 스트림 생성
+// 프레임 f: 기본 그라데이션에 (f * 5) % height 행과 마지막 행을 프레임마다 다른 값으로 채움
+// 반환값: 이전 프레임과 같은 행 수 합계 (프레임 1부터, 프레임 skip_frame 제외), -1 실패
+static long long seq_test_write_stream(const char *path, int width, int height, int frames, int skip_frame) {
+    size_t frame_bytes = (size_t)width * height * 3;
+    uint8_t *cur = (uint8_t *)malloc(frame_bytes);
+    uint8_t *prev = (uint8_t *)malloc(frame_bytes);
+    FILE *file = (cur && prev && make_parent_directory(path) == 0) ? fopen(path, "wb") : NULL;
+    long long same_rows = -1;
+    if (file) {
+        same_rows = 0;
+        for (int f = 0; f < frames; f++) {
+            for (int y = 0; y < height; y++) {
+                int changed = (y == (f * 5) % height) || y == height - 1;
+                for (int x = 0; x < width; x++) {
+                    uint8_t *px = cur + ((size_t)y * width + x) * 3;
+                    px[0] = changed ? (uint8_t)(40 * f + x) : (uint8_t)(x * 7 + y);
+                    px[1] = changed ? (uint8_t)(255 - 30 * f) : (uint8_t)(y * 9);
+                    px[2] = changed ? (uint8_t)(f * 61 + y) : (uint8_t)(x ^ y);
+                }
+                if (f > 0 && f != skip_frame &&
+                    memcmp(cur + (size_t)y * width * 3, prev + (size_t)y * width * 3, (size_t)width * 3) == 0) {
+                    same_rows++;
+                }
+            }
+            if (fwrite(cur, 1, frame_bytes, file) != frame_bytes) {
+                same_rows = -1;
+                break;
+            }
+            uint8_t *tmp = prev;
+            prev = cur;
+            cur = tmp;
+        }
+        if (fclose(file) != 0) {
+            same_rows = -1;
+        }
+    }
+    free(cur);
+    free(prev);
+    return same_rows;
+}
+
+int test_seq(void) {
+    const char *dir = "test_out/seq_test";
+    const int width = 37, height = 24, frames = 6, reg_frame = 3;
+    int failed = 0;
+    log_info("========================================\n");
+    log_info("시퀀스 처리 테스트 시작\n");
+    log_info("========================================\n\n");
+
+    char input[256], regs[256];
+    snprintf(input, sizeof(input), "%s/stream.rgb", dir);
+    snprintf(regs, sizeof(regs), "%s/regs.txt", dir);
+    long long same_rows = seq_test_write_stream(input, width, height, frames, -1);
+    long long same_rows_reg = seq_test_write_stream(input, width, height, frames, reg_frame);
+    FILE *file = same_rows > 0 ? fopen(regs, "w") : NULL;
+    if (!file) {
+        log_error("테스트 입력을 만들 수 없습니다: %s\n", dir);
+        return -1;
+    }
+    fprintf(file, "%d por_rgbg_order = 1\n", reg_frame);
+    fclose(file);
+    int saved_order = 0;
+    reg_read_by_name("por_rgbg_order", &saved_order);
+
+    // 경우별: 깊이, 출력 형식, 레지스터 스크립트
+    static const struct {
+        int depth;
+        const char *ext;
+        int with_regs;
+    } cases[4] = {
+        { 8, "raw", 0 },
+        { 10, "bin", 0 },
+        { 8, "raw", 1 },
+        { 10, "bin", 1 },
+    };
+    for (int c = 0; c < 4; c++) {
+        char out_skip[256], out_full[256];
+        snprintf(out_skip, sizeof(out_skip), "%s/out%d_skip.%s", dir, c, cases[c].ext);
+        snprintf(out_full, sizeof(out_full), "%s/out%d_full.%s", dir, c, cases[c].ext);
+
+        SequenceOptions opt;
+        sequence_default_options(&opt);
+        opt.width = width;
+        opt.height = height;
+        opt.depth = cases[c].depth;
+        opt.reg_script = cases[c].with_regs ? regs : NULL;
+        SequenceStats skip_stats, full_stats;
+        reg_write_by_name("por_rgbg_order", saved_order);
+        int ok = run_sequence(input, out_skip, &opt, &skip_stats) == 0;
+        opt.skip_rows = 0;
+        reg_write_by_name("por_rgbg_order", saved_order);
+        ok = ok && run_sequence(input, out_full, &opt, &full_stats) == 0;
+
+        long size_skip = 0, size_full = 0;
+        uint8_t *data_skip = ok ? read_whole_file(out_skip, &size_skip) : NULL;
+        uint8_t *data_full = ok ? read_whole_file(out_full, &size_full) : NULL;
+        int same = data_skip && data_full && size_skip == size_full && size_skip > 0 &&
+                   memcmp(data_skip, data_full, (size_t)size_skip) == 0;
+        free(data_skip);
+        free(data_full);
+
+        // 레지스터를 쓴 프레임은 이전 프레임 출력을 재사용하지 않음
+        long long expected = cases[c].with_regs ? same_rows_reg : same_rows;
+        ok = ok && same && skip_stats.frames == frames && full_stats.frames == frames &&
+             skip_stats.rows_skipped == expected && full_stats.rows_skipped == 0 &&
+             skip_stats.rows_converted + skip_stats.rows_skipped == (long long)frames * height;
+        failed |= !ok;
+        log_info("  %s [%d/4] %dbit %s%s: 건너뛰기 / 전체 변환 출력 동일, 재사용 %lld행 (예상 %lld)\n",
+                 ok ? "✓" : "✗", c + 1, cases[c].depth, cases[c].ext,
+                 cases[c].with_regs ? " + 레지스터 스크립트" : "", skip_stats.rows_skipped, expected);
+    }
+    reg_write_by_name("por_rgbg_order", saved_order);
+    ctc_tables_refresh();
+
+    log_info("\n========================================\n");
+    log_info(failed ? "시퀀스 처리 테스트 실패!\n" : "시퀀스 처리 테스트 완료!\n");
+    log_info("========================================\n");
+    return failed ? -1 : 0;
+}
+
+// test_golden: test_out/golden에서 prefix로 시작하는 파일 수 (remove이면 삭제)
+// last: 마지막으로 찾은 파일 이름 (NULL 가능)
+static int golden_test_outputs(const char *prefix, int remove_files, char *last, size_t last_size) {
+    DIR *d = opendir("test_out/golden");
+    if (!d) {
+        return 0;
+    }
+    int count = 0;
+    struct dirent *entry;
+    while ((entry = readdir(d)) != NULL) {
+        if (strncmp(entry->d_name, prefix, strlen(prefix)) != 0) {
+            continue;
+        }
+        count++;
+        if (last) {
+            snprintf(last, last_size, "%s", entry->d_name);
+        }
+        if (remove_files) {
+            char path[512];
+            snprintf(path, sizeof(path), "test_out/golden/%.200s", entry->d_name);
+            remove(path);
+        }
+    }
+    closedir(d);
+    return count;
+}
+
+int test_golden(void) {
+    const char *input = "test_out/golden_test/golden_test_in.bmp";
+    const char *manifest = "test_out/golden_test/golden.txt";
+    const char *prefix = "golden_test_in";
+    int failed = 0;
+    log_info("========================================\n");
+    log_info("골든 회귀 비교 테스트 시작\n");
+    log_info("========================================\n\n");
+
+    // 입력 BMP (홀수 크기 패턴), 이전 실행의 매니페스트 / 불일치 출력 삭제
+    PatternSpec spec;
+    RGBArray rgb;
+    OutputSink sink;
+    if (pattern_parse("window,37x29,size=40", &spec) != 0 || pattern_generate_rgb(&spec, 8, &rgb) != 0) {
+        return -1;
+    }
+    int written = make_parent_directory(input) == 0 && sink_open_file(&sink, input) == 0;
+    if (written) {
+        written = write_rgb_bmp24(&sink, &rgb) == 0;
+        written = sink_close(&sink) == 0 && written;
+    }
+    free_rgb(&rgb);
+    if (!written) {
+        log_error("테스트 입력을 만들 수 없습니다: %s\n", input);
+        return -1;
+    }
+    remove(manifest);
+    golden_test_outputs(prefix, 1, NULL, 0);
+
+    // [1/3] --update: 모든 출력 기록, 종료 코드 0
+    char *update_argv[] = { "image_io_test", "--golden", (char *)manifest, "--update", (char *)input };
+    int code = golden_main(5, update_argv);
+    GoldenDb db;
+    int ok = code == 0 && golden_load(manifest, &db) == 0;
+    int entries = ok ? db.count : 0;
+    ok = ok && entries > 0 && golden_test_outputs(prefix, 0, NULL, 0) == 0;
+    failed |= !ok;
+    log_info("  %s [1/3] --update: 항목 %d개 기록, 종료 코드 %d\n", ok ? "✓" : "✗", entries, code);
+
+    // [2/3] 같은 입력 비교: 모두 일치, 종료 코드 0, 저장한 출력 없음
+    char *check_argv[] = { "image_io_test", "--golden", (char *)manifest, (char *)input };
+    code = golden_main(4, check_argv);
+    ok = ok && code == 0 && golden_test_outputs(prefix, 0, NULL, 0) == 0;
+    failed |= !ok;
+    log_info("  %s [2/3] 같은 입력: 모두 일치, 종료 코드 %d\n", ok ? "✓" : "✗", code);
+
+    // [3/3] 항목 하나의 해시 변경: 종료 코드 1, 그 출력만 test_out/golden에 저장
+    char tampered[256] = "";
+    if (ok) {
+        snprintf(tampered, sizeof(tampered), "%s", db.entries[entries / 2].name);
+        db.entries[entries / 2].hash ^= 1;
+        ok = golden_save(manifest, &db) == 0;
+    }
+    if (entries > 0) {
+        golden_free(&db);
+    }
+    char saved[256] = "";
+    code = ok ? golden_main(4, check_argv) : -1;
+    int outputs = golden_test_outputs(prefix, 0, saved, sizeof(saved));
+    ok = ok && code == 1 && outputs == 1 && strcmp(saved, tampered) == 0;
+    failed |= !ok;
+    log_info("  %s [3/3] 해시 변경: 종료 코드 %d, 저장한 출력 %d개 (%s)\n", ok ? "✓" : "✗", code, outputs, saved);
+
+    log_info("\n========================================\n");
+    log_info(failed ? "골든 회귀 비교 테스트 실패!\n" : "골든 회귀 비교 테스트 완료!\n");
+    log_info("========================================\n");
+    return failed ? -1 : 0;
+}
+
+// 공유 라이브러리 빌드(make lib)에서는 명령행 처리(main과 main 전용 함수) 제외
+#ifndef CTC_NO_MAIN
+
+// 입력 파일 경로에서 확장자를 제외한 파일명 추출
+static void get_name_without_ext(const char *filename, char *out, size_t out_size) {
+    const char *base_name = strrchr(filename, '/');
+    if (!base_name) base_name = strrchr(filename, '\\');
+    if (base_name) base_name++;
+    else base_name = filename;
+
+    strncpy(out, base_name, out_size - 1);
+    out[out_size - 1] = '\0';
+    char *dot = strrchr(out, '.');
+    if (dot) *dot = '\0';
+}
+
+// BMP 파일을 읽어 RGBG 패킹 RAW 파일(test_out/img/<이름>_raw<bits>.raw)로 저장
+static int save_bmp_as_raw(const char *filename, int bits) {
+    RGBArray rgb;
+    RGBGArray rgbg;
+
+    log_info("BMP 파일 읽는 중: %s\n", filename);
+    if (read_bmp(filename, &rgb) != 0) {
+        return -1;
+    }
+    if (rgb_to_rgbg(&rgb, &rgbg) != 0) {
+        free_rgb(&rgb);
+        return -1;
+    }
+
+    char name_without_ext[256];
+    char output_filename[512];
+    get_name_without_ext(filename, name_without_ext, sizeof(name_without_ext));
+    snprintf(output_filename, sizeof(output_filename),
+             "test_out/img/%.200s_raw%d.raw", name_without_ext, bits);
+
+    int result = save_rgbg_to_raw(&rgbg, output_filename, bits);
+    free_rgb(&rgb);
+    free_rgbg(&rgbg);
+    return result;
+}
+
+// BMP 파일의 (x, y, w, h) 영역만 읽어 변환하고 영역 결과만 저장
+// 출력: test_out/img/<이름>_<tag>_10bit.ppm, _12bit.ppm, _8bit.bmp
+static int process_bmp_region(const char *filename, int depth, int x, int y, int w, int h,
+                              const char *tag) {
+    RGBArray rgb;
+    RGBGArray rgbg;
+    if (read_bmp_roi(filename, &rgb, x, y, w, h) != 0) {
+        return -1;
+    }
+    if (rgb_set_depth(&rgb, depth) != 0 || rgb_to_rgbg(&rgb, &rgbg) != 0) {
+        free_rgb(&rgb);
+        return -1;
+    }
+
+    char name_without_ext[256];
+    char output_filename[512];
+    get_name_without_ext(filename, name_without_ext, sizeof(name_without_ext));
+    int result = 0;
+    snprintf(output_filename, sizeof(output_filename),
+             "test_out/img/%.200s_%.64s_10bit.ppm", name_without_ext, tag);
+    result |= save_rgbg_to_ppm_10bit(&rgbg, output_filename);
+    snprintf(output_filename, sizeof(output_filename),
+             "test_out/img/%.200s_%.64s_12bit.ppm", name_without_ext, tag);
+    result |= save_rgbg_to_ppm_12bit(&rgbg, output_filename);
+    snprintf(output_filename, sizeof(output_filename),
+             "test_out/img/%.200s_%.64s_8bit.bmp", name_without_ext, tag);
+    result |= save_rgb_to_bmp_8bit(&rgb, output_filename);
+
+    free_rgb(&rgb);
+    free_rgbg(&rgbg);
+    return result == 0 ? 0 : -1;
+}
+
+// --roi x,y,w,h 또는 --tile WxH 처리 (roi가 NULL이면 타일 단위로 전체 이미지 처리)
+static int process_bmp_tiles(const char *filename, int depth, const char *roi, const char *tile) {
+    if (!is_valid_depth(depth)) {
+        log_error("지원하지 않는 비트 깊이: %d (8/10/12/16)\n", depth);
+        return -1;
+    }
+    char tag[64];
+    if (roi) {
+        int x, y, w, h;
+        if (sscanf(roi, "%d,%d,%d,%d", &x, &y, &w, &h) != 4) {
+            log_error("잘못된 영역: %s (예: 0,0,256,256)\n", roi);
+            return -1;
+        }
+        snprintf(tag, sizeof(tag), "roi_%d_%d_%dx%d", x, y, w, h);
+        return process_bmp_region(filename, depth, x, y, w, h, tag);
+    }
+
+    int tile_w, tile_h, width, height;
+    if (sscanf(tile, "%dx%d", &tile_w, &tile_h) != 2 || tile_w <= 0 || tile_h <= 0) {
+        log_error("잘못된 타일 크기: %s (예: 256x256)\n", tile);
+        return -1;
+    }
+    if (read_bmp_size(filename, &width, &height) != 0) {
+        return -1;
+    }
+    for (int y = 0; y < height; y += tile_h) {
+        for (int x = 0; x < width; x += tile_w) {
+            int w = (x + tile_w > width) ? width - x : tile_w;
+            int h = (y + tile_h > height) ? height - y : tile_h;
+            snprintf(tag, sizeof(tag), "tile_%d_%d", x, y);
+            log_trace("타일 %d,%d (%d x %d)\n", x, y, w, h);
+            if (process_bmp_region(filename, depth, x, y, w, h, tag) != 0) {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+// ============================================================
+// 단계 결과 캐시 연동 (--cache)
+// ============================================================
+// 단계별 키: RGBG 변환 = 입력 픽셀 해시 + 비트 깊이 + por_rgbg_order
+//            PPM 저장 = RGBG 키 + 출력 비트 수, 8bit BMP = 입력 픽셀 해시
+
+// RGBG 변환 단계가 읽는 레지스터
+static const CacheRegRange rgbg_stage_regs[] = {
+    { 0x01, 0x01, 0x01 },   // por_rgbg_order
+};
+
+// RGB 배열 픽셀 해시 (크기/비트 깊이 포함)
+static uint64_t hash_rgb_pixels(const RGBArray *rgb) {
+    int dims[3] = { rgb->width, rgb->height, rgb->depth };
+    uint64_t h = hash64(dims, sizeof(dims), 0);
+    size_t pixels = (size_t)rgb->width * rgb->height;
+    if (rgb->depth == 8) {
+        h = hash64(rgb->r, pixels, h);
+        h = hash64(rgb->g, pixels, h);
+        h = hash64(rgb->b, pixels, h);
+    } else {
+        h = hash64(rgb->r16, pixels * sizeof(uint16_t), h);
+        h = hash64(rgb->g16, pixels * sizeof(uint16_t), h);
+        h = hash64(rgb->b16, pixels * sizeof(uint16_t), h);
+    }
+    return h;
+}
+
+// RGBG 변환 (캐시에 같은 입력/레지스터 결과가 있으면 읽어서 사용)
+// 캐시 항목: int 6개 (width, height, depth, order, x0, y0) + 네이티브 샘플
+static int cached_rgb_to_rgbg(RGBArray *rgb, RGBGArray *rgbg, uint64_t key) {
+    void *blob = NULL;
+    size_t blob_size = 0;
+    if (cache_load_blob(key, "rgbg", &blob, &blob_size) == 0) {
+        int header[6];
+        size_t sample_bytes = (size_t)rgb->width * rgb->height * 2 * (rgb->depth == 8 ? 1 : sizeof(uint16_t));
+        if (blob_size == sizeof(header) + sample_bytes) {
+            memcpy(header, blob, sizeof(header));
+            if (header[0] == rgb->width && header[1] == rgb->height && header[2] == rgb->depth &&
+                alloc_rgbg(rgbg, rgb->width, rgb->height, rgb->depth) == 0) {
+                rgbg->order = header[3];
+                rgbg->x0 = header[4];
+                rgbg->y0 = header[5];
+                memcpy(rgbg->depth == 8 ? (void *)rgbg->data : (void *)rgbg->data16,
+                       (uint8_t *)blob + sizeof(header), sample_bytes);
+                free(blob);
+                log_debug("RGBG 변환: 캐시 사용\n");
+                return 0;
+            }
+        }
+        free(blob);
+    }
+
+    if (rgb_to_rgbg(rgb, rgbg) != 0) {
+        return -1;
+    }
+    int header[6] = { rgbg->width, rgbg->height, rgbg->depth, rgbg->order, rgbg->x0, rgbg->y0 };
+    size_t sample_bytes = (size_t)rgbg->width * rgbg->height * 2 * (rgbg->depth == 8 ? 1 : sizeof(uint16_t));
+    uint8_t *entry = (uint8_t *)malloc(sizeof(header) + sample_bytes);
+    if (entry) {
+        memcpy(entry, header, sizeof(header));
+        memcpy(entry + sizeof(header), rgbg->depth == 8 ? (void *)rgbg->data : (void *)rgbg->data16,
+               sample_bytes);
+        cache_store_blob(key, "rgbg", entry, sizeof(header) + sample_bytes);
+        free(entry);
+    }
+    return 0;
+}
+
+// 단계 결과 파일 저장 (캐시 hit이면 캐시 항목을 복사, miss이면 저장 후 캐시에 추가)
+// 캐시 복사에 실패하면 직접 저장, 캐시 추가 실패는 출력에 영향이 없으므로 무시
+// 반환값: 0 성공, -1 실패 (저장 실패)
+static int cached_save_file(uint64_t key, const char *stage, const char *filename,
+                            int (*save)(void *arg, const char *filename), void *arg) {
+    if (ensure_parent_directory(filename) == 0 && cache_fetch_file(key, stage, filename) == 0) {
+        log_debug("캐시에서 복사: %s\n", filename);
+        return 0;
+    }
+    if (save(arg, filename) != 0) {
+        return -1;
+    }
+    cache_store_file(key, stage, filename);
+    return 0;
+}
+
+static int save_ppm10_cb(void *arg, const char *filename) {
+    return save_rgbg_to_ppm_10bit((RGBGArray *)arg, filename);
+}
+
+static int save_ppm12_cb(void *arg, const char *filename) {
+    return save_rgbg_to_ppm_12bit((RGBGArray *)arg, filename);
+}
+
+static int save_bmp8_cb(void *arg, const char *filename) {
+    return save_rgb_to_bmp_8bit((RGBArray *)arg, filename);
+}
+
+// 메모리로 인코딩한 뒤 출력 큐에 제출 (파일 쓰기는 큐에서 비동기로 처리)
+// 반환값: 0 성공, -1 실패
+static int queue_rgbg_ppm(OutQueue *outq, RGBGArray *rgbg, int bits, const char *filename) {
+    OutputSink sink;
+    sink_init_memory(&sink);
+    int result = -1;
+    if (ensure_parent_directory(filename) == 0 && write_rgbg_ppm(&sink, rgbg, bits) == 0) {
+        result = outq_submit_file(outq, filename, &sink);
+    }
+    sink_free(&sink);
+    return result;
+}
+
+static int queue_rgb_bmp_8bit(OutQueue *outq, RGBArray *rgb, const char *filename) {
+    OutputSink sink;
+    sink_init_memory(&sink);
+    int result = -1;
+    if (ensure_parent_directory(filename) == 0 && write_rgb_bmp_8bit(&sink, rgb) == 0) {
+        result = outq_submit_file(outq, filename, &sink);
+    }
+    sink_free(&sink);
+    return result;
+}
+
+static int queue_ctcz(OutQueue *outq, const RGBGArray *rgbg, const RGBArray *rgb, const char *filename) {
+    OutputSink sink;
+    sink_init_memory(&sink);
+    int result = -1;
+    if (ensure_parent_directory(filename) == 0 &&
+        (rgbg ? write_rgbg_ctcz(&sink, rgbg) : write_rgb_ctcz(&sink, rgb)) == 0) {
+        result = outq_submit_file(outq, filename, &sink);
+    }
+    sink_free(&sink);
+    return result;
+}
+
+static int queue_rgbg_preview(OutQueue *outq, const RGBGArray *rgbg, int scale, const char *filename) {
+    OutputSink sink;
+    sink_init_memory(&sink);
+    int result = -1;
+    if (ensure_parent_directory(filename) == 0 && write_rgbg_preview(&sink, rgbg, scale) == 0) {
+        result = outq_submit_file(outq, filename, &sink);
+    }
+    sink_free(&sink);
+    return result;
+}
+
+// 읽어 둔 RGB 배열 한 프레임 처리 (10/12bit PPM, 8bit BMP 저장, rgb는 해제됨)
+// filename: 정보 출력용 입력 이름, name_without_ext: 출력 파일명 앞부분
+// preview > 0이면 RGBG 배열을 복원한 1/preview 크기 미리보기 BMP도 저장 (<이름>_preview.bmp)
+// ctcz이면 대신 RGBG / RGB 배열을 .ctcz 무손실 압축 파일 2개로 저장 (--unctcz로 원래 출력 복원)
+// outq가 있으면 출력은 큐에 제출하고 바로 반환 (쓰기 완료는 outq_destroy에서 확인)
+// 반환값: 0 성공, -1 실패
+static int process_rgb_frame(RGBArray *rgb_in, const char *filename, const char *name_without_ext,
+                             int ctcz, int preview, OutQueue *outq) {
+    RGBArray rgb = *rgb_in;
+    RGBGArray rgbg;
+    memset(rgb_in, 0, sizeof(*rgb_in));
+
+    // RGB 배열 정보 출력
+    print_rgb_info(&rgb, filename);
+
+    // RGBG 배열 생성
+    log_info("\nRGBG 배열 생성 중...\n");
+    uint64_t input_hash = 0, rgbg_key = 0;
+    int converted;
+    PerfScope scope;
+    perf_begin(&scope, PERF_STAGE_RGBG, PERF_FRAME_CURRENT);
+    if (cache_enabled()) {
+        input_hash = hash_rgb_pixels(&rgb);
+        rgbg_key = cache_stage_key(input_hash, "rgbg", rgbg_stage_regs,
+                                   (int)(sizeof(rgbg_stage_regs) / sizeof(rgbg_stage_regs[0])), 0);
+        converted = cached_rgb_to_rgbg(&rgb, &rgbg, rgbg_key);
+    } else {
+        converted = rgb_to_rgbg(&rgb, &rgbg);
+    }
+    perf_end(&scope);
+    if (converted != 0) {
+        free_rgb(&rgb);
+        return -1;
+    }
+
+    // RGBG 배열 정보 출력
+    print_rgbg_info(&rgbg, filename);
+
+    int preview_result = 0;
+    if (preview > 0) {
+        char out_preview[512];
+        snprintf(out_preview, sizeof(out_preview), "test_out/img/%.200s_preview.bmp", name_without_ext);
+        log_info("\n미리보기 BMP 저장 중 (1/%d)...\n", preview);
+        preview_result = outq ? queue_rgbg_preview(outq, &rgbg, preview, out_preview)
+                              : save_rgbg_preview(&rgbg, out_preview, preview);
+    }
+
+    if (ctcz) {
+        char out_rgbg[512], out_rgb[512];
+        snprintf(out_rgbg, sizeof(out_rgbg), "test_out/img/%.200s_rgbg.ctcz", name_without_ext);
+        snprintf(out_rgb, sizeof(out_rgb), "test_out/img/%.200s_rgb.ctcz", name_without_ext);
+        log_info("\nCTCZ 파일 저장 중...\n");
+        int result = outq ? queue_ctcz(outq, &rgbg, NULL, out_rgbg) | queue_ctcz(outq, NULL, &rgb, out_rgb)
+                          : save_rgbg_to_ctcz(&rgbg, out_rgbg) | save_rgb_to_ctcz(&rgb, out_rgb);
+        free_rgb(&rgb);
+        free_rgbg(&rgbg);
+        return result | preview_result;
+    }
+
+    // RGBG 배열을 PPM 파일로 저장 (예시)
+    // 실제 사용 시에는 원하는 파일명으로 변경하세요
+    char output_filename_10bit[512];
+    char output_filename_12bit[512];
+    
+    snprintf(output_filename_10bit, sizeof(output_filename_10bit), 
+             "test_out/img/%.200s_10bit.ppm", name_without_ext);
+    snprintf(output_filename_12bit, sizeof(output_filename_12bit), 
+             "test_out/img/%.200s_12bit.ppm", name_without_ext);
+    
+    int result = preview_result;
+    log_info("\nPPM 파일 저장 중...\n");
+    perf_begin(&scope, PERF_STAGE_PACK, PERF_FRAME_CURRENT);
+    if (cache_enabled()) {
+        result |= cached_save_file(cache_stage_key(rgbg_key, "ppm", NULL, 0, 10), "ppm10",
+                                   output_filename_10bit, save_ppm10_cb, &rgbg);
+        result |= cached_save_file(cache_stage_key(rgbg_key, "ppm", NULL, 0, 12), "ppm12",
+                                   output_filename_12bit, save_ppm12_cb, &rgbg);
+    } else if (outq) {
+        result |= queue_rgbg_ppm(outq, &rgbg, 10, output_filename_10bit);
+        result |= queue_rgbg_ppm(outq, &rgbg, 12, output_filename_12bit);
+    } else {
+        result |= save_rgbg_to_ppm_10bit(&rgbg, output_filename_10bit);
+        result |= save_rgbg_to_ppm_12bit(&rgbg, output_filename_12bit);
+    }
+    perf_end(&scope);
+
+    // RGB 배열을 8bit BMP로 저장
+    char output_filename_8bit[512];
+    snprintf(output_filename_8bit, sizeof(output_filename_8bit), 
+             "test_out/img/%.200s_8bit.bmp", name_without_ext);
+    log_info("\n8bit BMP 파일 저장 중...\n");
+    perf_begin(&scope, PERF_STAGE_BMP8, PERF_FRAME_CURRENT);
+    if (cache_enabled()) {
+        result |= cached_save_file(cache_stage_key(input_hash, "bmp8", NULL, 0, 0), "bmp8",
+                                   output_filename_8bit, save_bmp8_cb, &rgb);
+        log_info("\n");
+        cache_print_stats();
+    } else if (outq) {
+        result |= queue_rgb_bmp_8bit(outq, &rgb, output_filename_8bit);
+    } else {
+        result |= save_rgb_to_bmp_8bit(&rgb, output_filename_8bit);
+    }
+    perf_end(&scope);
+
+    // 메모리 해제
+    free_rgb(&rgb);
+    free_rgbg(&rgbg);
+    return result;
+}
+
+// BMP 파일 하나를 전체 프레임으로 처리 (--perf이면 끝난 뒤 프레임 단계별 카운터 출력)
+// 반환값: 0 성공, -1 실패
+static int process_bmp_file(const char *filename, int depth, int ctcz, int preview, OutQueue *outq) {
+    RGBArray rgb;
+
+    // BMP 파일 읽기
+    log_info("BMP 파일 읽는 중: %s\n", filename);
+    PerfScope scope;
+    perf_begin(&scope, PERF_STAGE_READ, PERF_FRAME_CURRENT);
+    int result = read_bmp_depth(filename, &rgb, depth);
+    perf_end(&scope);
+    if (result != 0) {
+        perf_frame_report(PERF_FRAME_CURRENT);
+        return -1;
+    }
+    char name_without_ext[256];
+    get_name_without_ext(filename, name_without_ext, sizeof(name_without_ext));
+    result = process_rgb_frame(&rgb, filename, name_without_ext, ctcz, preview, outq);
+    perf_frame_report(PERF_FRAME_CURRENT);
+    return result;
+}
+
+// --pattern 지정 패턴을 생성하여 BMP 파일과 같이 처리 (출력 이름: pattern_<이름>_<W>x<H>)
+// 반환값: 0 성공, -1 실패
+static int process_pattern(const char *text, int depth, int ctcz, int preview, OutQueue *outq) {
+    PatternSpec spec;
+    RGBArray rgb;
+    if (pattern_parse(text, &spec) != 0) {
+        return -1;
+    }
+    if (spec.width <= 0) {
+        log_error("--pattern에는 크기가 필요합니다: %s (예: bars,1080x2392)\n", text);
+        return -1;
+    }
+    log_info("패턴 생성 중: %s\n", text);
+    if (pattern_generate_rgb(&spec, depth, &rgb) != 0) {
+        return -1;
+    }
+    char name[256];
+    snprintf(name, sizeof(name), "pattern_%s_%dx%d", pattern_name(spec.kind), spec.width, spec.height);
+    int result = process_rgb_frame(&rgb, text, name, ctcz, preview, outq);
+    perf_frame_report(PERF_FRAME_CURRENT);
+    return result;
+}
+
+// test_cache: 디렉토리 안의 파일 삭제 (이전 실행의 캐시 항목)
+static void cache_test_clear(const char *dir) {
+    DIR *d = opendir(dir);
+    if (!d) {
+        return;
+    }
+    struct dirent *entry;
+    while ((entry = readdir(d)) != NULL) {
+        if (entry->d_name[0] == '.' && (entry->d_name[1] == '\0' || strcmp(entry->d_name, "..") == 0)) {
+            continue;
+        }
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%.200s", dir, entry->d_name);
+        remove(path);
+    }
+    closedir(d);
+}
+
+// test_cache: 패턴 한 프레임을 캐시 사용 경로로 처리 (출력 이름 cache_test_<name>)
+static int cache_test_frame(const char *name) {
+    PatternSpec spec;
+    RGBArray rgb;
+    if (pattern_parse("window,64x48,size=30", &spec) != 0 || pattern_generate_rgb(&spec, 10, &rgb) != 0) {
+        return -1;
+    }
+    char out_name[64];
+    snprintf(out_name, sizeof(out_name), "cache_test_%s", name);
+    return process_rgb_frame(&rgb, "cache_test", out_name, 0, 0, NULL);
+}
+
+// test_cache: 두 실행의 출력 파일 3개가 같은지 확인
+static int cache_test_same_outputs(const char *a, const char *b) {
+    static const char *const suffixes[3] = { "10bit.ppm", "12bit.ppm", "8bit.bmp" };
+    int same = 1;
+    for (int k = 0; k < 3; k++) {
+        char path_a[256], path_b[256];
+        snprintf(path_a, sizeof(path_a), "test_out/img/cache_test_%s_%s", a, suffixes[k]);
+        snprintf(path_b, sizeof(path_b), "test_out/img/cache_test_%s_%s", b, suffixes[k]);
+        long size_a = 0, size_b = 0;
+        uint8_t *data_a = read_whole_file(path_a, &size_a);
+        uint8_t *data_b = read_whole_file(path_b, &size_b);
+        same &= data_a && data_b && size_a == size_b && memcmp(data_a, data_b, (size_t)size_a) == 0;
+        free(data_a);
+        free(data_b);
+    }
+    return same;
+}
+
+int test_cache(void) {
+    const char *dir = "test_out/cache_test";
+    int failed = 0;
+    log_info("========================================\n");
+    log_info("단계 결과 캐시 테스트 시작\n");
+    log_info("========================================\n\n");
+
+    cache_test_clear(dir);
+    if (cache_open(dir, (uint64_t)64 << 20) != 0) {
+        return -1;
+    }
+    int saved_order = 0;
+    reg_read_by_name("por_rgbg_order", &saved_order);
+
+    // [1/5] 빈 캐시: 모든 단계 miss 후 저장
+    int result = cache_test_frame("a");
+    CacheStats first = cache_stats();
+    int ok = result == 0 && first.hits == 0 && first.misses == 4 && first.stores == 4;
+    failed |= !ok;
+    log_info("  %s [1/5] 빈 캐시: miss %u, 저장 %u\n", ok ? "✓" : "✗", first.misses, first.stores);
+
+    // [2/5] 같은 입력 / 레지스터: 모든 단계 hit, 출력은 캐시 없이 만든 출력과 같음
+    result = cache_test_frame("b");
+    CacheStats second = cache_stats();
+    ok = result == 0 && second.hits == first.hits + 4 && second.misses == first.misses &&
+         cache_test_same_outputs("a", "b");
+    failed |= !ok;
+    log_info("  %s [2/5] 같은 입력: hit %u, 출력 동일\n", ok ? "✓" : "✗", second.hits - first.hits);
+
+    // [3/5] por_rgbg_order 변경: RGBG / PPM 단계는 miss, RGB만 읽는 8bit BMP 단계는 hit
+    reg_write_by_name("por_rgbg_order", !saved_order);
+    result = cache_test_frame("c");
+    reg_write_by_name("por_rgbg_order", saved_order);
+    CacheStats third = cache_stats();
+    ok = result == 0 && third.misses == second.misses + 3 && third.hits == second.hits + 1;
+    failed |= !ok;
+    log_info("  %s [3/5] por_rgbg_order 변경: miss %u, hit %u\n", ok ? "✓" : "✗",
+             third.misses - second.misses, third.hits - second.hits);
+
+    // [4/5] 출력 파일을 만들 수 없으면 (캐시 복사, 직접 저장 모두 실패) 프레임 처리 실패
+    const char *blocked = "test_out/img/cache_test_d_10bit.ppm";
+    remove(blocked);
+    ok = mkdir(blocked, 0755) == 0;
+    if (ok) {
+        log_info("  (다음 파일 생성 오류는 의도한 것)\n");
+        result = cache_test_frame("d");
+        ok = result != 0;
+        rmdir(blocked);
+    }
+    failed |= !ok;
+    log_info("  %s [4/5] 저장 실패는 프레임 처리 실패로 보고\n", ok ? "✓" : "✗");
+
+    // [5/5] 크기 제한: 같은 초 안에 저장한 항목도 먼저 쓴 항목부터 삭제, 방금 저장한 항목은 제한보다 커도 유지
+    cache_test_clear(dir);
+    ok = cache_open(dir, 1000) == 0;
+    static uint8_t blob[2000];
+    void *loaded = NULL;
+    size_t loaded_size = 0;
+    ok = ok && cache_store_blob(1, "lru", blob, 600) == 0 && cache_store_blob(2, "lru", blob, 600) == 0;
+    ok = ok && cache_load_blob(1, "lru", &loaded, &loaded_size) != 0 &&
+         cache_load_blob(2, "lru", &loaded, &loaded_size) == 0;
+    free(loaded);
+    loaded = NULL;
+    ok = ok && cache_store_blob(3, "lru", blob, sizeof(blob)) == 0 &&
+         cache_load_blob(3, "lru", &loaded, &loaded_size) == 0 && loaded_size == sizeof(blob) &&
+         cache_load_blob(2, "lru", &loaded, &loaded_size) != 0;
+    free(loaded);
+    failed |= !ok;
+    log_info("  %s [5/5] 크기 제한: 오래된 항목부터 삭제, 방금 저장한 항목 유지 (삭제 %u)\n", ok ? "✓" : "✗",
+             cache_stats().evictions);
+
+    log_info("\n========================================\n");
+    log_info(failed ? "단계 결과 캐시 테스트 실패!\n" : "단계 결과 캐시 테스트 완료!\n");
+    log_info("========================================\n");
+    return failed ? -1 : 0;
+}
+
+// --log-level 옵션 처리 (위치와 관계없이 인자 목록에서 제거, 없으면 환경 변수 CTC_LOG_LEVEL)
+// 반환값: 0 성공, -1 실패
+static int take_log_level(int *argc, char *argv[], int *level) {
+    const char *env = getenv("CTC_LOG_LEVEL");
+    *level = LOG_LEVEL_INFO;
+    if (env && log_parse_level(env) >= 0) {
+        *level = log_parse_level(env);
+    }
+    for (int i = 1; i < *argc; i++) {
+        if (strcmp(argv[i], "--log-level") != 0) {
+            continue;
+        }
+        if (i + 1 >= *argc || log_parse_level(argv[i + 1]) < 0) {
+            log_error("잘못된 로그 레벨: %s (quiet, info, debug, trace)\n", i + 1 < *argc ? argv[i + 1] : "");
+            return -1;
+        }
+        *level = log_parse_level(argv[i + 1]);
+        memmove(&argv[i], &argv[i + 2], (size_t)(*argc - i - 2) * sizeof(char *));
+        *argc -= 2;
+        argv[*argc] = NULL;
+        i--;
+    }
+    if (*level > LOG_MAX_LEVEL) {
+        log_error("경고: 이 빌드는 %d 레벨까지만 출력합니다 (make LOG_MAX_LEVEL=%d)\n", LOG_MAX_LEVEL, *level);
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    // 로그 writer 시작 (이후 출력은 모두 로그 링을 거쳐 출력)
+    int level;
+    if (take_log_level(&argc, argv, &level) != 0) {
+        return 1;
+    }
+    log_init(level);
+
+    // --serve 옵션: 상주 서버 (config는 서버에서 로드, 파이프 모드에서는 로드 출력도 stderr로)
+    if (argc >= 2 && strcmp(argv[1], "--serve") == 0) {
+        return server_main(argc, argv);
+    }
+
+    // config.txt 파일 로드
+    if (load_config("config.txt") != 0) {
+        log_error("경고: config.txt 파일을 읽을 수 없습니다. 기본값을 사용합니다.\n");
+    }
+    
+    // --seq 옵션: 프레임 시퀀스 처리 (RAW RGB / Y4M / BMP 시퀀스)
+    if (argc >= 2 && strcmp(argv[1], "--seq") == 0) {
+        return sequence_main(argc, argv);
+    }
+
+    // --golden 옵션: 출력 해시를 매니페스트와 비교 (불일치한 출력만 파일로 저장)
+    if (argc >= 2 && strcmp(argv[1], "--golden") == 0) {
+        return golden_main(argc, argv);
+    }
+
+    // --sweep 옵션: 매니페스트 스윕 (이미지 x 레지스터 설정 점, --shard i/N으로 여러 호스트에 분할)
+    if (argc >= 2 && strcmp(argv[1], "--sweep") == 0) {
+        return sweep_main(argc, argv);
+    }
+
+    // --tune 옵션: 기준 출력 대비 오차를 줄이는 레지스터 값 탐색 (병렬 좌표 하강)
+    if (argc >= 2 && strcmp(argv[1], "--tune") == 0) {
+        return tune_main(argc, argv);
+    }
+
+    // --compare 옵션: 두 출력(PPM / 패킹 RAW / RGBG 덤프) 비교 (RTL 덤프 검증)
+    if (argc >= 2 && strcmp(argv[1], "--compare") == 0) {
+        return compare_main(argc, argv);
+    }
+
+    // --hex 옵션: 테스트벤치용 $readmemh 벡터 덤프 (RGB 입력 / RGBG 기대 출력)
+    if (argc >= 2 && strcmp(argv[1], "--hex") == 0) {
+        return hexdump_main(argc, argv);
+    }
+
+    // 테스트 모드: 인자가 없으면 256GRAY.bmp 테스트 실행
+    if (argc == 1) {
+        return test_256gray_bmp();
+    }
+    
+    // 테스트 모드: --test-ppm 옵션으로 PPM 저장 함수 테스트
+    if (argc == 2 && strcmp(argv[1], "--test-ppm") == 0) {
+        return test_ppm_save_functions();
+    }
+    
+    // 테스트 모드: --verify-rgbg 옵션으로 RGBG 구조 확인
+    if (argc == 2 && strcmp(argv[1], "--verify-rgbg") == 0) {
+        return verify_rgbg_structure();
+    }
+    
+    // 테스트 모드: --test-raw 옵션으로 RAW10/RAW12 패킹 테스트
+    if (argc == 2 && strcmp(argv[1], "--test-raw") == 0) {
+        return test_raw_pack_functions();
+    }
+
+    // 테스트 모드: --test-depth 옵션으로 10/12bit 내부 파이프라인 테스트
+    if (argc == 2 && strcmp(argv[1], "--test-depth") == 0) {
+        return test_depth_pipeline();
+    }
+
+    // 테스트 모드: --test-roi 옵션으로 ROI / 타일 읽기 테스트
+    if (argc == 2 && strcmp(argv[1], "--test-roi") == 0) {
+        return test_roi_tiles();
+    }
+
+    // 테스트 모드: --test-regs 옵션으로 레지스터 스크립트 / 파생 테이블 무효화 테스트
+    if (argc == 2 && strcmp(argv[1], "--test-regs") == 0) {
+        return test_register_tables();
+    }
+
+    // 테스트 모드: --test-compare 옵션으로 비교 커널 테스트
+    if (argc == 2 && strcmp(argv[1], "--test-compare") == 0) {
+        return test_compare();
+    }
+
+    // 테스트 모드: --test-hex 옵션으로 hex 벡터 덤프 테스트
+    if (argc == 2 && strcmp(argv[1], "--test-hex") == 0) {
+        return test_hex_dump();
+    }
+
+    // 테스트 모드: --test-server 옵션으로 서버 요청 처리 테스트
+    if (argc == 2 && strcmp(argv[1], "--test-server") == 0) {
+        return test_server();
+    }
+
+    // 테스트 모드: --test-lib 옵션으로 libctcmodel C API 테스트
+    if (argc == 2 && strcmp(argv[1], "--test-lib") == 0) {
+        return test_ctcmodel();
+    }
+
+    // 테스트 모드: --test-log 옵션으로 레벨 로그 테스트
+    if (argc == 2 && strcmp(argv[1], "--test-log") == 0) {
+        return test_log();
+    }
+
+    // 테스트 모드: --test-outq 옵션으로 비동기 출력 큐 테스트
+    if (argc == 2 && strcmp(argv[1], "--test-outq") == 0) {
+        return test_outq();
+    }
+
+    // 테스트 모드: --test-ctcz 옵션으로 .ctcz 코덱 테스트
+    if (argc == 2 && strcmp(argv[1], "--test-ctcz") == 0) {
+        return test_ctcz();
+    }
+
+    // 테스트 모드: --test-pattern 옵션으로 합성 패턴 테스트
+    if (argc == 2 && strcmp(argv[1], "--test-pattern") == 0) {
+        return test_pattern();
+    }
+
+    // 테스트 모드: --test-preview 옵션으로 RGBG 미리보기 테스트
+    if (argc == 2 && strcmp(argv[1], "--test-preview") == 0) {
+        return test_preview();
+    }
+
+    // 테스트 모드: --test-sweep 옵션으로 매니페스트 스윕 테스트
+    if (argc == 2 && strcmp(argv[1], "--test-sweep") == 0) {
+        return test_sweep();
+    }
+
+    // 테스트 모드: --test-tune 옵션으로 레지스터 튜닝 테스트
+    if (argc == 2 && strcmp(argv[1], "--test-tune") == 0) {
+        return test_tune();
+    }
+
+    // 테스트 모드: --test-perf 옵션으로 단계별 성능 카운터 테스트
+    if (argc == 2 && strcmp(argv[1], "--test-perf") == 0) {
+        return test_perf();
+    }
+
+    // 테스트 모드: --test-cache 옵션으로 단계 결과 캐시 테스트
+    if (argc == 2 && strcmp(argv[1], "--test-cache") == 0) {
+        return test_cache();
+    }
+
+    // 테스트 모드: --test-seq 옵션으로 시퀀스 처리(변경 행 건너뛰기) 테스트
+    if (argc == 2 && strcmp(argv[1], "--test-seq") == 0) {
+        return test_seq();
+    }
+
+    // 테스트 모드: --test-golden 옵션으로 골든 회귀 비교 테스트
+    if (argc == 2 && strcmp(argv[1], "--test-golden") == 0) {
+        return test_golden();
+    }
+
+    // --save-raw 옵션: BMP 파일을 RGBG 패킹 RAW로 저장 (기본 10bit)
+    if ((argc == 3 || argc == 4) && strcmp(argv[1], "--save-raw") == 0) {
+        return save_bmp_as_raw(argv[2], argc == 4 ? atoi(argv[3]) : 10) == 0 ? 0 : 1;
+    }
+
+    // --unctcz 옵션: .ctcz 파일을 원래 출력 형식으로 복원 (RGBG -> PPM, RGB -> 8bit BMP)
+    if ((argc == 4 || argc == 5) && strcmp(argv[1], "--unctcz") == 0) {
+        return convert_ctcz(argv[2], argv[3], argc == 5 ? atoi(argv[4]) : 10) == 0 ? 0 : 1;
+    }
+
+    // --render 옵션: 패킹 RAW / .ctcz(RGBG) 파일을 빠진 채널을 채운 미리보기 BMP로 변환
+    if ((argc == 4 || argc == 5) && strcmp(argv[1], "--render") == 0) {
+        return convert_to_preview(argv[2], argv[3], argc == 5 ? atoi(argv[4]) : 1) == 0 ? 0 : 1;
+    }
+
+    // --raw-to-ppm 옵션: 패킹 RAW 파일을 PPM으로 변환 (확인용)
+    if (argc == 4 && strcmp(argv[1], "--raw-to-ppm") == 0) {
+        return convert_raw_to_ppm(argv[2], argv[3]) == 0 ? 0 : 1;
+    }
+
+    // 테스트 모드: --print-config 옵션으로 config 값 출력
+    if (argc == 2 && strcmp(argv[1], "--print-config") == 0) {
+        print_config();
+        return 0;
+    }
+    
+    if (argc < 2) {
+        log_info("사용법: %s [옵션] [<BMP 파일 경로>]\n", argv[0]);
+        log_info("  인자 없음: test_img/1080x2392/256GRAY.bmp 테스트 실행\n");
+        log_info("  --test-ppm: PPM 저장 함수 테스트 실행\n");
+        log_info("  --verify-rgbg: RGBG 배열 구조 확인\n");
+        log_info("  --print-config: config 값 출력\n");
+        log_info("  --test-raw: RAW10/RAW12 패킹 테스트 실행\n");
+        log_info("  --test-depth: 10/12bit 내부 파이프라인 테스트 실행\n");
+        log_info("  --test-regs: 레지스터 스크립트 / 파생 테이블 무효화 테스트 실행\n");
+        log_info("  --test-roi: ROI / 타일 읽기 테스트 실행\n");
+        log_info("  --test-compare: 비교 커널 테스트 실행\n");
+        log_info("  --test-hex: hex 벡터 덤프 테스트 실행\n");
+        log_info("  --test-server: 서버 요청 처리 테스트 실행\n");
+        log_info("  --test-lib: libctcmodel C API 테스트 실행\n");
+        log_info("  --test-log: 레벨 로그 테스트 실행\n");
+        log_info("  --test-outq: 비동기 출력 큐 테스트 실행\n");
+        log_info("  --test-ctcz: .ctcz 코덱 테스트 실행\n");
+        log_info("  --test-pattern: 합성 패턴 테스트 실행\n");
+        log_info("  --test-preview: RGBG 미리보기 테스트 실행\n");
+        log_info("  --test-sweep: 매니페스트 스윕 테스트 실행\n");
+        log_info("  --test-tune: 레지스터 튜닝 테스트 실행\n");
+        log_info("  --test-perf: 단계별 성능 카운터 테스트 실행\n");
+        log_info("  --test-cache: 단계 결과 캐시 테스트 실행\n");
+        log_info("  --test-seq: 시퀀스 처리 테스트 실행\n");
+        log_info("  --test-golden: 골든 회귀 비교 테스트 실행\n");
+        log_info("  --log-level <quiet|info|debug|trace>: 출력 레벨 (모든 모드, 기본 info, 환경 변수 CTC_LOG_LEVEL)\n");
+        log_info("  --depth <8|10|12|16> <BMP>: 지정한 비트 깊이로 BMP 파일 처리\n");
+        log_info("  --roi x,y,w,h <BMP>: 지정한 영역만 읽어서 처리\n");
+        log_info("  --tile WxH <BMP>: 타일 단위로 읽어서 타일별로 저장\n");
+        log_info("  --stripe N <BMP>: N행 단위로 나누어 처리 (메모리 제한, 10/12bit PPM만 저장)\n");
+        log_info("  --cache [--cache-max-mb N] <BMP>: 단계 결과 캐시 사용 (test_out/cache, 기본 %dMB)\n",
+                 CACHE_DEFAULT_MAX_MB);
+        log_info("  --seq <입력> <출력> [옵션]: 프레임 시퀀스 처리 (옵션은 --seq만 입력하여 확인)\n");
+        log_info("  --golden <매니페스트> [--update] <BMP>...: 출력 해시를 매니페스트와 비교\n");
+        log_info("  --sweep <매니페스트> <출력 디렉토리> [--shard i/N | --merge]: 이미지 x 설정 점 스윕 (옵션은 --sweep만 입력하여 확인)\n");
+        log_info("  --tune <튜닝 파일> [옵션]: 기준 출력 대비 오차가 가장 작은 레지스터 값 탐색 (옵션은 --tune만 입력하여 확인)\n");
+        log_info("  --compare <A> <B> [옵션]: 두 출력 비교 (옵션은 --compare만 입력하여 확인)\n");
+        log_info("  --hex <BMP> [옵션]: 테스트벤치용 $readmemh 벡터 덤프 (옵션은 --hex만 입력하여 확인)\n");
+        log_info("  --serve [--socket [경로]] [--config 파일]: 상주 서버 (소켓 또는 stdin/stdout 요청 처리)\n");
+        log_info("  --save-raw <BMP> [10|12]: RGBG 패킹 RAW 파일로 저장\n");
+        log_info("  --raw-to-ppm <RAW> <PPM>: 패킹 RAW 파일을 PPM으로 변환\n");
+        log_info("  --ctcz <BMP>...: PPM/BMP 대신 RGBG / RGB 배열을 .ctcz 무손실 압축 파일로 저장\n");
+        log_info("  --unctcz <CTCZ> <출력> [10|12]: .ctcz를 PPM(RGBG) / 8bit BMP(RGB)로 복원\n");
+        log_info("  --render <RAW|CTCZ> <BMP> [N]: RGBG를 빠진 R/B를 채운 24bit BMP로 복원 (N: 1/N 축소, 기본 1)\n");
+        log_info("  --preview N <BMP>...: <이름>_preview.bmp (RGBG 복원 미리보기, 1/N 크기)도 저장\n");
+        log_info("  --pattern 이름,WxH[,키=값]...: BMP 대신 합성 패턴 처리 (여러 번 가능, 이름: gray ramp bars window\n");
+        log_info("             hlines vlines checker subpixel, 키: fg bg ch size x y)\n");
+        log_info("  --out-queue N <BMP>...: 출력 파일 비동기 쓰기 큐 깊이 (기본 %d, 0 = 동기 저장)\n",
+                 OUTQ_DEFAULT_DEPTH);
+        log_info("  --perf <BMP>...: 단계별(read rgbg pack bmp8) 하드웨어 성능 카운터를 프레임별 / 전체 출력\n");
+        log_info("  인자 있음: 지정한 BMP 파일 처리 (여러 개 가능)\n");
+        log_info("예시:\n");
+        log_info("  %s\n", argv[0]);
+        log_info("  %s --test-ppm\n", argv[0]);
+        log_info("  %s --verify-rgbg\n", argv[0]);
+        log_info("  %s --print-config\n", argv[0]);
+        log_info("  %s --save-raw test_img/1080x2392/CT_W.bmp 10\n", argv[0]);
+        log_info("  %s test_img/1080x2392/CT_W.bmp\n", argv[0]);
+        log_info("  %s --depth 12 test_img/1080x2392/CT_W.bmp\n", argv[0]);
+        log_info("  %s --roi 1000,2300,80,92 test_img/1080x2392/CT_W.bmp\n", argv[0]);
+        log_info("  %s --depth 10 --pattern window,1080x2392,size=25 --pattern hlines,1080x2392\n", argv[0]);
+        return 1;
+    }
+
+    // --depth 옵션: 내부 파이프라인 비트 깊이 선택 (로드 시 한 번 결정)
+    // --roi / --tile 옵션: 지정한 영역(타일)만 읽어서 처리
+    // BMP 파일을 여러 개 주면 차례로 처리 (출력 파일 쓰기는 출력 큐에서 다음 입력 처리와 겹쳐 실행)
+    const char **filenames = (const char **)malloc((size_t)argc * sizeof(const char *));
+    int file_count = 0;
+    const char **patterns = (const char **)malloc((size_t)argc * sizeof(const char *));
+    int pattern_count = 0;
+    const char *roi = NULL;
+    const char *tile = NULL;
+    int stripe_rows = 0;
+    int depth = 8;
+    int use_cache = 0;
+    int cache_max_mb = CACHE_DEFAULT_MAX_MB;
+    int queue_depth = OUTQ_DEFAULT_DEPTH;
+    int ctcz = 0;
+    int preview = 0;
+    int use_perf = 0;
+    if (!filenames || !patterns) {
+        log_error("인자 목록 메모리 할당 실패\n");
+        free(filenames);
+        free(patterns);
+        return 1;
+    }
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--depth") == 0 && i + 1 < argc) {
+            depth = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--roi") == 0 && i + 1 < argc) {
+            roi = argv[++i];
+        } else if (strcmp(argv[i], "--tile") == 0 && i + 1 < argc) {
+            tile = argv[++i];
+        } else if (strcmp(argv[i], "--stripe") == 0 && i + 1 < argc) {
+            stripe_rows = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--cache") == 0) {
+            use_cache = 1;
+        } else if (strcmp(argv[i], "--cache-max-mb") == 0 && i + 1 < argc) {
+            use_cache = 1;
+            cache_max_mb = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--out-queue") == 0 && i + 1 < argc) {
+            queue_depth = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--ctcz") == 0) {
+            ctcz = 1;
+        } else if (strcmp(argv[i], "--preview") == 0 && i + 1 < argc) {
+            preview = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--pattern") == 0 && i + 1 < argc) {
+            patterns[pattern_count++] = argv[++i];
+        } else if (strcmp(argv[i], "--perf") == 0) {
+            use_perf = 1;
+        } else if (strncmp(argv[i], "--", 2) == 0) {
+            log_error("알 수 없는 인자: %s\n", argv[i]);
+            free(filenames);
+            free(patterns);
+            return 1;
+        } else {
+            filenames[file_count++] = argv[i];
+        }
+    }
+    if (file_count == 0 && pattern_count == 0) {
+        log_error("BMP 파일 경로가 필요합니다\n");
+        free(filenames);
+        free(patterns);
+        return 1;
+    }
+    if (preview < 0 || preview > PREVIEW_MAX_SCALE) {
+        log_error("잘못된 --preview 배율: %d (1 ~ %d)\n", preview, PREVIEW_MAX_SCALE);
+        free(filenames);
+        free(patterns);
+        return 1;
+    }
+    if (pattern_count > 0 && (roi || tile || stripe_rows > 0)) {
+        log_error("--pattern은 --roi / --tile / --stripe와 같이 사용할 수 없습니다\n");
+        free(filenames);
+        free(patterns);
+        return 1;
+    }
+    if (preview > 0 && (roi || tile || stripe_rows > 0)) {
+        log_error("--preview는 --roi / --tile / --stripe와 같이 사용할 수 없습니다\n");
+        free(filenames);
+        free(patterns);
+        return 1;
+    }
+    if (ctcz && (roi || tile || stripe_rows > 0)) {
+        log_error("--ctcz는 --roi / --tile / --stripe와 같이 사용할 수 없습니다\n");
+        free(filenames);
+        free(patterns);
+        return 1;
+    }
+    if (use_cache && (roi || tile || stripe_rows > 0)) {
+        log_error("--cache는 --roi / --tile / --stripe와 같이 사용할 수 없습니다\n");
+        free(filenames);
+        free(patterns);
+        return 1;
+    }
+    if (use_cache && cache_open(CACHE_DEFAULT_DIR, (uint64_t)cache_max_mb << 20) != 0) {
+        free(filenames);
+        free(patterns);
+        return 1;
+    }
+    if (use_perf) {
+        perf_enable(PERF_COUNTERS);
+    }
+    OutQueue *outq = NULL;
+    if (!roi && !tile && stripe_rows <= 0 && !use_cache && queue_depth > 0) {
+        outq = outq_create(queue_depth, OUTQ_AUTO);
+    }
+
+    int failed = 0;
+    for (int p = 0; p < pattern_count; p++) {
+        failed |= process_pattern(patterns[p], depth, ctcz, preview, outq) != 0;
+    }
+    for (int f = 0; f < file_count; f++) {
+        const char *filename = filenames[f];
+        if (roi || tile) {
+            failed |= process_bmp_tiles(filename, depth, roi, tile) != 0;
+        } else if (stripe_rows > 0) {
+            // 스트라이프 처리: 10/12bit PPM만 저장 (8bit BMP 미리보기는 전체 프레임 처리에서만 생성)
+            char name_without_ext[256];
+            char out_10bit[512], out_12bit[512];
+            get_name_without_ext(filename, name_without_ext, sizeof(name_without_ext));
+            snprintf(out_10bit, sizeof(out_10bit), "test_out/img/%.200s_10bit.ppm", name_without_ext);
+            snprintf(out_12bit, sizeof(out_12bit), "test_out/img/%.200s_12bit.ppm", name_without_ext);
+            log_info("스트라이프 처리 (%d행 단위): %s\n", stripe_rows, filename);
+            failed |= process_bmp_stripes(filename, depth, stripe_rows, out_10bit, out_12bit) != 0;
+        } else {
+            failed |= process_bmp_file(filename, depth, ctcz, preview, outq) != 0;
+        }
+    }
+    free(filenames);
+    free(patterns);
+
+    // 남은 출력 쓰기 완료 대기
+    if (outq && outq_destroy(outq) != 0) {
+        failed = 1;
+    }
+    if (use_perf) {
+        log_info("\n");
+        perf_report();
+    }
+    if (failed) {
+        return 1;
+    }
+    if (!roi && !tile && stripe_rows <= 0) {
+        log_info("\n완료!\n");
+    }
     return 0;
 }
+#endif // CTC_NO_MAIN
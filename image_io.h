@@ -1,32 +1,102 @@
 #ifndef IMAGE_IO_H
 #define IMAGE_IO_H
 
+#include <stdio.h>
 #include <stdint.h>
+#include "sink.h"
 
 // RGB 배열 구조체
+// depth == 8: r, g, b (uint8_t) 사용
+// depth == 10/12/16: r16, g16, b16 (uint16_t) 사용
 typedef struct {
     uint8_t *r;
     uint8_t *g;
     uint8_t *b;
+    uint16_t *r16;
+    uint16_t *g16;
+    uint16_t *b16;
     int width;
     int height;
+    int depth;      // 비트 깊이 (8/10/12/16)
+    int x0;         // 원본 이미지에서 이 배열의 시작 위치 (ROI/타일, 전체 프레임은 0)
+    int y0;
 } RGBArray;
 
+// RGBG 서브픽셀 순서 (por_rgbg_order와 같은 의미)
+#define RGBG_ORDER_RGBG 0   // Even row = [R, G][G, B], Odd row = [B, G][R, G]
+#define RGBG_ORDER_BGRG 1   // Even row = [B, G][R, G], Odd row = [R, G][G, B]
+
 // RGBG 배열 구조체
+// 배열의 (x, y) 위치는 패널 기준 (x0 + x, y0 + y)이며,
+// 패널 행 (y0 + y + order)가 짝수이면 Even row, 패널 열 (x0 + x)가 짝수이면 [R, G]/[B, G] 쪽
 typedef struct {
-    uint8_t *data;
+    uint8_t *data;      // depth == 8
+    uint16_t *data16;   // depth == 10/12/16
     int width;
     int height;
+    int order;      // 서브픽셀 순서 (RGBG_ORDER_*)
+    int depth;      // 비트 깊이 (RGB 배열과 동일)
+    int x0;         // 패널 기준 시작 위치 (ROI/타일, 전체 프레임은 0)
+    int y0;
 } RGBGArray;
 
 // BMP 파일 읽기 함수
 // 반환값: 0 성공, -1 실패
 int read_bmp(const char *filename, RGBArray *rgb);
 
-// RGB 배열을 RGBG 배열로 변환
+// BMP 파일 크기만 읽기
+// 반환값: 0 성공, -1 실패
+int read_bmp_size(const char *filename, int *width, int *height);
+
+// BMP 파일에서 (x, y, w, h) 영역만 읽기 (필요한 행만 pread, bottom-up/top-down 모두 지원)
+// rgb->x0, rgb->y0에 영역 시작 위치가 저장되어 RGBG 변환 시 패널 기준 행/열 패턴이 유지됨
+// 반환값: 0 성공, -1 실패
+int read_bmp_roi(const char *filename, RGBArray *rgb, int x, int y, int w, int h);
+
+// 3바이트 인터리브 픽셀 n개를 바이트 순서대로 평면 3개로 분리 (SSSE3 pshufb, 미지원 CPU는 스칼라)
+// BMP 행: p0 = B, p1 = G, p2 = R / RGB24 스트림: p0 = R, p1 = G, p2 = B
+void deinterleave_rgb24_row(const uint8_t *src, uint8_t *p0, uint8_t *p1, uint8_t *p2, size_t n);
+
+// RGB 배열을 RGBG 배열로 변환 (서브픽셀 순서는 por_rgbg_order)
 // 반환값: 0 성공, -1 실패
 int rgb_to_rgbg(RGBArray *rgb, RGBGArray *rgbg);
 
+// RGBG 배열 할당 (변환은 하지 않음, free_rgbg로 해제)
+// 반환값: 0 성공, -1 실패
+int alloc_rgbg(RGBGArray *rgbg, int width, int height, int depth);
+
+// 할당된 RGBG 배열에 변환 (크기/비트 깊이가 RGB 배열과 같아야 함)
+// 반환값: 0 성공, -1 실패
+int rgb_to_rgbg_into(RGBArray *rgb, RGBGArray *rgbg);
+
+// 할당된 RGBG 배열의 [y_begin, y_end) 행만 변환 (변경된 행만 다시 변환할 때 사용)
+// 반환값: 0 성공, -1 실패
+int rgb_to_rgbg_rows(RGBArray *rgb, RGBGArray *rgbg, int y_begin, int y_end);
+
+// RGBG 배열의 모든 픽셀이 원본 RGB 배열을 서브픽셀 순서(rgbg->order, x0, y0)대로 배치한 값인지 검증 (SSE2 비교)
+// first_x, first_y: 첫 번째로 다른 픽셀 위치 (없으면 -1, NULL 가능)
+// 디버그 빌드(make DEBUG=1, CTC_DEBUG)에서는 rgb_to_rgbg_rows가 변환 후 자동으로 실행
+// 반환값: 다른 픽셀 수, -1 실패 (크기/비트 깊이 불일치)
+int64_t rgbg_verify(const RGBArray *rgb, const RGBGArray *rgbg, int *first_x, int *first_y);
+
+// RGBG 배열의 y행을 bits(8/10/12/16) 비트 샘플로 변환 (행당 width * 2)
+void rgbg_row_to_samples(const RGBGArray *rgbg, int y, uint16_t *dst, int bits);
+
+// RGB 배열의 y행을 [R, G, B] 순서의 bits 비트 샘플로 변환 (행당 width * 3)
+void rgb_row_to_samples(const RGBArray *rgb, int y, uint16_t *dst, int bits);
+
+// BMP 파일을 읽고 지정한 비트 깊이(8/10/12/16)로 변환
+// 반환값: 0 성공, -1 실패
+int read_bmp_depth(const char *filename, RGBArray *rgb, int depth);
+
+// RGB 배열을 지정한 비트 깊이로 변환한 복사본 생성
+// 반환값: 0 성공, -1 실패
+int rgb_convert_depth(const RGBArray *src, RGBArray *dst, int depth);
+
+// RGB 배열의 비트 깊이 변환 (기존 평면은 해제됨)
+// 반환값: 0 성공, -1 실패
+int rgb_set_depth(RGBArray *rgb, int depth);
+
 // RGB 배열 메모리 해제
 void free_rgb(RGBArray *rgb);
 
@@ -39,6 +109,10 @@ void print_rgb_info(RGBArray *rgb, const char *filename);
 // RGBG 배열 정보 출력
 void print_rgbg_info(RGBGArray *rgbg, const char *filename);
 
+// 출력 파일 경로의 상위 디렉토리 생성 (재귀적)
+// 반환값: 0 성공, -1 실패
+int make_parent_directory(const char *filename);
+
 // RGBG 배열을 10bit PPM 파일로 저장
 // 반환값: 0 성공, -1 실패
 int save_rgbg_to_ppm_10bit(RGBGArray *rgbg, const char *filename);
@@ -47,10 +121,45 @@ int save_rgbg_to_ppm_10bit(RGBGArray *rgbg, const char *filename);
 // 반환값: 0 성공, -1 실패
 int save_rgbg_to_ppm_12bit(RGBGArray *rgbg, const char *filename);
 
+// RGBG 배열을 10/12bit PPM 형식으로 출력 대상(파일/메모리/해시)에 쓰기
+// 반환값: 0 성공, -1 실패
+int write_rgbg_ppm(OutputSink *sink, RGBGArray *rgbg, int bits);
+
+// BMP 파일을 stripe_rows 행 단위로 나누어 10bit / 12bit PPM으로 변환 (out-of-core)
+// 입력/출력은 스트라이프 구간만 mmap으로 매핑하므로 메모리 사용량은 이미지 높이와 무관
+// 반환값: 0 성공, -1 실패
+int process_bmp_stripes(const char *filename, int depth, int stripe_rows,
+                        const char *ppm_10bit, const char *ppm_12bit);
+
+// RGBG 배열을 패킹 RAW 파일로 저장 (bits: 10 = RAW10, 12 = RAW12)
+// 헤더(16바이트) + 네이티브 서브픽셀을 MIPI RAW10/RAW12 방식으로 패킹
+// 반환값: 0 성공, -1 실패
+int save_rgbg_to_raw(RGBGArray *rgbg, const char *filename, int bits);
+
+// RGBG 배열 한 프레임을 출력 대상에 패킹 RAW(헤더 포함)로 쓰기
+// 반환값: 0 성공, -1 실패
+int write_rgbg_raw(OutputSink *sink, RGBGArray *rgbg, int bits);
+
+// 패킹 RAW 파일을 RGBG 배열로 읽기 (비트 깊이 = RAW 비트 수)
+// 반환값: 0 성공, -1 실패
+int read_raw(const char *filename, RGBGArray *rgbg);
+
+// 패킹 RAW 파일을 10/12bit PPM 파일로 변환 (확인용)
+// 반환값: 0 성공, -1 실패
+int convert_raw_to_ppm(const char *raw_filename, const char *ppm_filename);
+
 // RGB 배열을 8bit BMP 파일로 저장
 // 반환값: 0 성공, -1 실패
 int save_rgb_to_bmp_8bit(RGBArray *rgb, const char *filename);
 
+// RGB 배열을 8bit 팔레트 BMP 형식으로 출력 대상에 쓰기
+// 반환값: 0 성공, -1 실패
+int write_rgb_bmp_8bit(OutputSink *sink, RGBArray *rgb);
+
+// RGB 배열을 24bit BMP 형식으로 출력 대상에 쓰기 (10/12/16bit 배열은 8bit로 줄여서 저장)
+// 반환값: 0 성공, -1 실패
+int write_rgb_bmp24(OutputSink *sink, const RGBArray *rgb);
+
 // 256GRAY.bmp 파일을 이용한 RGB, RGBG 배열 변환 테스트 함수
 // 반환값: 0 성공, -1 실패
 int test_256gray_bmp(void);
@@ -59,6 +168,83 @@ int test_256gray_bmp(void);
 // 반환값: 0 성공, -1 실패
 int test_ppm_save_functions(void);
 
+// save_rgbg_to_raw, convert_raw_to_ppm 함수 테스트 (PPM 저장 결과와 비교)
+// 반환값: 0 성공, -1 실패
+int test_raw_pack_functions(void);
+
+// 10/12bit 내부 파이프라인 테스트 (8bit 경로 저장 결과와 비교)
+// 반환값: 0 성공, -1 실패
+int test_depth_pipeline(void);
+
+// 레지스터 스크립트 / 파생 테이블 무효화 테스트 (바뀐 레지스터를 읽는 테이블만 재계산되는지 확인)
+// 반환값: 0 성공, -1 실패
+int test_register_tables(void);
+
+// ROI / 타일 / 스트라이프 읽기 테스트 (부분 처리 결과가 전체 프레임 결과와 같은지 확인)
+// 반환값: 0 성공, -1 실패
+int test_roi_tiles(void);
+
+// --compare 비교 커널 테스트 (PPM/RAW 읽기 일치, 알려진 오차의 통계/비트맵 확인)
+// 반환값: 0 성공, -1 실패
+int test_compare(void);
+
+// --hex 벡터 덤프 테스트 (필드 비트 수 / 클럭당 픽셀 수 / beat 폭 / 순서 조합을 기준 포맷과 비교)
+// 반환값: 0 성공, -1 실패
+int test_hex_dump(void);
+
+// --serve 요청 처리 테스트 (레지스터 읽기/쓰기/요청별 덮어쓰기, 출력 해시 확인)
+// 반환값: 0 성공, -1 실패
+int test_server(void);
+
+// libctcmodel C API 테스트 (stride 버퍼 변환, 메모리 인코딩, 컨텍스트별 레지스터)
+// 반환값: 0 성공, -1 실패
+int test_ctcmodel(void);
+
+// 레벨 로그 테스트 (여러 스레드 기록 순서/누락, 긴 메시지, 레벨 필터)
+// 반환값: 0 성공, -1 실패
+int test_log(void);
+
+// 비동기 출력 큐 테스트 (io_uring / pwrite / 동기 쓰기 결과 비교, 구간 쓰기, 오류 보고)
+// 반환값: 0 성공, -1 실패
+int test_outq(void);
+
+// .ctcz 코덱 테스트 (깊이/위상별 왕복, 크기 상한, 손상 데이터 거부, 압축 비율/속도)
+// 반환값: 0 성공, -1 실패
+int test_ctcz(void);
+
+// 합성 패턴 테스트 (지정 해석, RGBG 직접 생성 = RGB 생성 후 변환, 패턴 값, 생성 속도)
+// 반환값: 0 성공, -1 실패
+int test_pattern(void);
+
+// RGBG 미리보기 테스트 (단색 복원, 기준 구현 일치, 스레드 수 무관, 속도)
+// 반환값: 0 성공, -1 실패
+int test_preview(void);
+
+// 매니페스트 스윕 테스트 (작업 분할, 중단 후 이어서 실행, 합치기 = 단일 실행 결과)
+// 반환값: 0 성공, -1 실패
+int test_sweep(void);
+
+// 레지스터 튜닝 테스트 (비트 수 범위, 병렬 좌표 하강 수렴, 작업 프로세스 수 무관, 기준 출력 비용)
+// 반환값: 0 성공, -1 실패
+int test_tune(void);
+
+// 단계별 성능 카운터 테스트 (꺼짐, 시간만, 하드웨어 카운터 또는 대체 동작, 스레드별 카운터)
+// 반환값: 0 성공, -1 실패
+int test_perf(void);
+
+// 시퀀스 처리 테스트 (변경 행 건너뛰기 출력 = 전체 변환 출력, 레지스터를 쓴 프레임은 재사용 안 함)
+// 반환값: 0 성공, -1 실패
+int test_seq(void);
+
+// 골든 회귀 비교 테스트 (기록, 일치, 해시 변경 시 종료 코드 1과 불일치 출력만 저장)
+// 반환값: 0 성공, -1 실패
+int test_golden(void);
+
+// 단계 결과 캐시 테스트 (miss 후 hit, 출력 동일, 레지스터 변경 시 miss, 저장 실패 보고)
+// 명령행 빌드 전용 (make lib에는 없음)
+// 반환값: 0 성공, -1 실패
+int test_cache(void);
+
 // RGBG 배열 구조 확인 함수 ([R, G], [B, G] 형태인지 검증)
 // 반환값: 0 성공, -1 실패
 int verify_rgbg_structure(void);
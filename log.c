@@ -0,0 +1,370 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include "log.h"
+
+// 스레드별 링 크기 (2의 거듭제곱), 이보다 절반 이상 큰 메시지는 바로 출력
+#define LOG_RING_SIZE (64 * 1024)
+#define LOG_RING_MASK (LOG_RING_SIZE - 1)
+#define LOG_MESSAGE_STACK 1024
+#define LOG_OUT_BUFFER (128 * 1024)
+#define LOG_IDLE_WAIT_NS 10000000L // writer 대기 주기 (10ms, 깨우기 신호를 놓쳐도 이 주기로 출력)
+
+int log_level = LOG_LEVEL_INFO;
+
+// 링 레코드 헤더 (뒤에 len 바이트 텍스트)
+typedef struct {
+    uint64_t seq;               // 전역 순번 (여러 링의 메시지를 기록 순서대로 합치기 위함)
+    uint32_t len;
+    uint32_t level;
+} LogRecord;
+
+// 단일 생산자(소유 스레드) / 단일 소비자(writer) 링
+typedef struct LogRing {
+    _Alignas(64) atomic_size_t head;    // 생산자 쓰기 위치 (누적)
+    _Alignas(64) atomic_size_t tail;    // 소비자 읽기 위치 (누적)
+    atomic_int closed;                  // 소유 스레드 종료 (비면 writer가 해제)
+    struct LogRing *next;
+    char data[LOG_RING_SIZE];
+} LogRing;
+
+static FILE *log_output = NULL;         // NULL이면 stdout
+static pthread_mutex_t output_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static LogRing *rings = NULL;           // 등록된 링 (스레드 첫 기록 시 추가, writer가 정리)
+static pthread_mutex_t registry_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t ring_key;
+static pthread_once_t ring_key_once = PTHREAD_ONCE_INIT;
+static __thread LogRing *thread_ring = NULL;
+
+static atomic_uint_fast64_t log_seq;
+static atomic_int log_running;
+static atomic_int writer_sleeping;
+static pthread_t writer_thread;
+static pthread_mutex_t state_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wake_cond = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t done_cond = PTHREAD_COND_INITIALIZER;
+static unsigned flush_requested = 0;
+static unsigned flush_done = 0;
+static int stopping = 0;
+
+static char *out_buffer = NULL;
+static size_t out_length = 0;
+
+static void ring_put(LogRing *ring, size_t pos, const void *src, size_t len) {
+    size_t offset = pos & LOG_RING_MASK;
+    size_t first = len < LOG_RING_SIZE - offset ? len : LOG_RING_SIZE - offset;
+    memcpy(ring->data + offset, src, first);
+    memcpy(ring->data, (const char *)src + first, len - first);
+}
+
+static void ring_get(const LogRing *ring, size_t pos, void *dst, size_t len) {
+    size_t offset = pos & LOG_RING_MASK;
+    size_t first = len < LOG_RING_SIZE - offset ? len : LOG_RING_SIZE - offset;
+    memcpy(dst, ring->data + offset, first);
+    memcpy((char *)dst + first, ring->data, len - first);
+}
+
+// 스레드 종료 시 링 반납 (남은 메시지는 writer가 출력한 뒤 해제)
+static void release_thread_ring(void *arg) {
+    LogRing *ring = (LogRing *)arg;
+    thread_ring = NULL;
+    atomic_store_explicit(&ring->closed, 1, memory_order_release);
+}
+
+static void create_ring_key(void) {
+    pthread_key_create(&ring_key, release_thread_ring);
+}
+
+static LogRing *get_thread_ring(void) {
+    if (thread_ring) {
+        return thread_ring;
+    }
+    LogRing *ring = (LogRing *)calloc(1, sizeof(LogRing));
+    if (!ring) {
+        return NULL;
+    }
+    pthread_once(&ring_key_once, create_ring_key);
+    pthread_setspecific(ring_key, ring);
+    pthread_mutex_lock(&registry_lock);
+    ring->next = rings;
+    rings = ring;
+    pthread_mutex_unlock(&registry_lock);
+    thread_ring = ring;
+    return ring;
+}
+
+static void write_output(const char *text, size_t len) {
+    pthread_mutex_lock(&output_lock);
+    FILE *out = log_output ? log_output : stdout;
+    fwrite(text, 1, len, out);
+    fflush(out);
+    pthread_mutex_unlock(&output_lock);
+}
+
+static void wake_writer(void) {
+    if (atomic_load_explicit(&writer_sleeping, memory_order_acquire)) {
+        pthread_mutex_lock(&state_lock);
+        pthread_cond_signal(&wake_cond);
+        pthread_mutex_unlock(&state_lock);
+    }
+}
+
+// 모든 링의 메시지를 순번 순서로 출력 (writer 스레드, 종료 후에는 log_shutdown)
+// 반환값: 출력한 메시지 수
+static size_t drain_rings(void) {
+    size_t count = 0;
+    pthread_mutex_lock(&registry_lock);
+    for (;;) {
+        LogRing *best = NULL;
+        LogRecord best_record;
+        size_t best_tail = 0;
+        for (LogRing *ring = rings; ring; ring = ring->next) {
+            size_t tail = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+            if (tail == atomic_load_explicit(&ring->head, memory_order_acquire)) {
+                continue;
+            }
+            LogRecord record;
+            ring_get(ring, tail, &record, sizeof(record));
+            if (!best || record.seq < best_record.seq) {
+                best = ring;
+                best_record = record;
+                best_tail = tail;
+            }
+        }
+        if (!best) {
+            break;
+        }
+        if (out_length + best_record.len > LOG_OUT_BUFFER) {
+            write_output(out_buffer, out_length);
+            out_length = 0;
+        }
+        ring_get(best, best_tail + sizeof(LogRecord), out_buffer + out_length, best_record.len);
+        out_length += best_record.len;
+        atomic_store_explicit(&best->tail, best_tail + sizeof(LogRecord) + best_record.len,
+                              memory_order_release);
+        count++;
+    }
+
+    // 종료된 스레드의 빈 링 해제
+    LogRing **link = &rings;
+    while (*link) {
+        LogRing *ring = *link;
+        if (atomic_load_explicit(&ring->closed, memory_order_acquire) &&
+            atomic_load_explicit(&ring->tail, memory_order_relaxed) ==
+            atomic_load_explicit(&ring->head, memory_order_acquire)) {
+            *link = ring->next;
+            free(ring);
+        } else {
+            link = &ring->next;
+        }
+    }
+    pthread_mutex_unlock(&registry_lock);
+
+    if (out_length > 0) {
+        write_output(out_buffer, out_length);
+        out_length = 0;
+    }
+    return count;
+}
+
+static void *writer_main(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&state_lock);
+    for (;;) {
+        // 요청 번호를 먼저 읽고 비울 때까지 출력 -> 요청 전에 기록된 메시지는 모두 출력됨
+        unsigned target = flush_requested;
+        int stop = stopping;
+        pthread_mutex_unlock(&state_lock);
+        size_t count = drain_rings();
+        pthread_mutex_lock(&state_lock);
+        if (count > 0) {
+            continue;
+        }
+        if (flush_done != target) {
+            flush_done = target;
+            pthread_cond_broadcast(&done_cond);
+        }
+        if (stop) {
+            break;
+        }
+        if (flush_requested != target || stopping) {
+            continue;
+        }
+        struct timespec deadline;
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_nsec += LOG_IDLE_WAIT_NS;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+        atomic_store_explicit(&writer_sleeping, 1, memory_order_release);
+        pthread_cond_timedwait(&wake_cond, &state_lock, &deadline);
+        atomic_store_explicit(&writer_sleeping, 0, memory_order_release);
+    }
+    pthread_mutex_unlock(&state_lock);
+    return NULL;
+}
+
+// 링에 기록 (공간이 없으면 writer가 비울 때까지 대기, 메시지는 버리지 않음)
+// 반환값: 0 성공, -1 링 사용 불가 (호출자가 바로 출력)
+static int ring_write(int level, const char *text, size_t len) {
+    size_t need = sizeof(LogRecord) + len;
+    if (need > LOG_RING_SIZE / 2) {
+        return -1;
+    }
+    LogRing *ring = get_thread_ring();
+    if (!ring) {
+        return -1;
+    }
+    size_t head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+    while (head + need - atomic_load_explicit(&ring->tail, memory_order_acquire) > LOG_RING_SIZE) {
+        if (!atomic_load_explicit(&log_running, memory_order_acquire)) {
+            return -1;
+        }
+        wake_writer();
+        sched_yield();
+    }
+    LogRecord record;
+    record.seq = atomic_fetch_add_explicit(&log_seq, 1, memory_order_relaxed);
+    record.len = (uint32_t)len;
+    record.level = (uint32_t)level;
+    ring_put(ring, head, &record, sizeof(record));
+    ring_put(ring, head + sizeof(record), text, len);
+    atomic_store_explicit(&ring->head, head + need, memory_order_release);
+
+    // 오류는 바로, 나머지는 링이 절반 이상 찼을 때만 깨움 (그 외에는 writer 대기 주기로 모아서 출력)
+    if (level == LOG_LEVEL_QUIET ||
+        head + need - atomic_load_explicit(&ring->tail, memory_order_relaxed) > LOG_RING_SIZE / 2) {
+        wake_writer();
+    }
+    return 0;
+}
+
+static void emit(int level, const char *text, size_t len) {
+    if (atomic_load_explicit(&log_running, memory_order_acquire) && ring_write(level, text, len) == 0) {
+        return;
+    }
+    // 바로 출력 (앞서 링에 넣은 메시지보다 먼저 나가지 않도록 비운 뒤)
+    log_flush();
+    write_output(text, len);
+}
+
+void log_write(int level, const char *format, ...) {
+    char stack[LOG_MESSAGE_STACK];
+    char *text = stack;
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(stack, sizeof(stack), format, args);
+    va_end(args);
+    if (n <= 0) {
+        return;
+    }
+    if ((size_t)n >= sizeof(stack)) {
+        text = (char *)malloc((size_t)n + 1);
+        if (!text) {
+            emit(level, stack, sizeof(stack) - 1);
+            return;
+        }
+        va_start(args, format);
+        vsnprintf(text, (size_t)n + 1, format, args);
+        va_end(args);
+    }
+    emit(level, text, (size_t)n);
+    if (text != stack) {
+        free(text);
+    }
+}
+
+int log_parse_level(const char *name) {
+    static const char *names[] = { "quiet", "info", "debug", "trace" };
+    for (int i = 0; i < 4; i++) {
+        if (strcmp(name, names[i]) == 0) {
+            return i;
+        }
+    }
+    if (name[0] >= '0' && name[0] <= '3' && name[1] == '\0') {
+        return name[0] - '0';
+    }
+    return -1;
+}
+
+int log_init(int level) {
+    static int registered = 0;
+    log_level = level;
+    if (atomic_load(&log_running)) {
+        return 0;
+    }
+    if (!out_buffer) {
+        out_buffer = (char *)malloc(LOG_OUT_BUFFER);
+        if (!out_buffer) {
+            return -1;
+        }
+    }
+    stopping = 0;
+    if (pthread_create(&writer_thread, NULL, writer_main, NULL) != 0) {
+        return -1;
+    }
+    atomic_store(&log_running, 1);
+    if (!registered) {
+        atexit(log_shutdown);
+        registered = 1;
+    }
+    return 0;
+}
+
+void log_flush(void) {
+    if (!atomic_load_explicit(&log_running, memory_order_acquire)) {
+        pthread_mutex_lock(&output_lock);
+        fflush(log_output ? log_output : stdout);
+        pthread_mutex_unlock(&output_lock);
+        return;
+    }
+    pthread_mutex_lock(&state_lock);
+    unsigned target = ++flush_requested;
+    pthread_cond_signal(&wake_cond);
+    while ((int)(flush_done - target) < 0 && !stopping) {
+        pthread_cond_wait(&done_cond, &state_lock);
+    }
+    pthread_mutex_unlock(&state_lock);
+}
+
+void log_set_output(FILE *out) {
+    log_flush();
+    pthread_mutex_lock(&output_lock);
+    log_output = out;
+    pthread_mutex_unlock(&output_lock);
+}
+
+void log_after_fork(void) {
+    atomic_store(&log_running, 0);
+    // fork 시점에 다른 스레드가 잡고 있던 lock은 자식에서 풀리지 않으므로 다시 초기화
+    pthread_mutex_init(&output_lock, NULL);
+    pthread_mutex_init(&registry_lock, NULL);
+    pthread_mutex_init(&state_lock, NULL);
+    pthread_cond_init(&wake_cond, NULL);
+    pthread_cond_init(&done_cond, NULL);
+    stopping = 1;
+    for (LogRing *ring = rings; ring; ring = ring->next) {
+        atomic_store(&ring->tail, atomic_load(&ring->head));
+    }
+}
+
+void log_shutdown(void) {
+    if (!atomic_exchange(&log_running, 0)) {
+        return;
+    }
+    pthread_mutex_lock(&state_lock);
+    stopping = 1;
+    pthread_cond_signal(&wake_cond);
+    pthread_cond_broadcast(&done_cond);
+    pthread_mutex_unlock(&state_lock);
+    pthread_join(writer_thread, NULL);
+    drain_rings();
+}
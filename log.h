@@ -0,0 +1,66 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <stdio.h>
+
+// 레벨 로그 (printf 대체)
+// 스레드마다 lock-free 링 버퍼에 메시지를 넣고 백그라운드 writer 스레드가 모아서 출력
+// 여러 스레드의 메시지는 기록 순서(전역 순번)대로 출력되며 같은 스레드의 메시지는 항상 순서 유지
+// log_init 전 / log_shutdown 후에는 호출한 스레드에서 바로 출력 (라이브러리 빌드 등)
+//
+//   log_error  : quiet에서도 출력 (오류, 테스트 실패)
+//   log_info   : 기본 출력 (진행 상황, 결과 요약)
+//   log_debug  : 호출별 상세 (config 항목, 파일 저장 완료, 테스트 픽셀 값)
+//   log_trace  : 행/타일 단위 상세 (LOG_MAX_LEVEL 3 빌드에서만)
+//
+// LOG_MAX_LEVEL보다 높은 레벨의 호출은 컴파일 시 제거됨 (make LOG_MAX_LEVEL=N, 기본 2)
+
+#define LOG_LEVEL_QUIET 0
+#define LOG_LEVEL_INFO  1
+#define LOG_LEVEL_DEBUG 2
+#define LOG_LEVEL_TRACE 3
+
+#ifndef LOG_MAX_LEVEL
+#define LOG_MAX_LEVEL LOG_LEVEL_DEBUG
+#endif
+
+// 현재 출력 레벨 (기본 LOG_LEVEL_INFO)
+extern int log_level;
+
+#define LOG_AT(level, ...) \
+    do { \
+        if ((level) <= LOG_MAX_LEVEL && (level) <= log_level) { \
+            log_write((level), __VA_ARGS__); \
+        } \
+    } while (0)
+
+#define log_error(...) log_write(LOG_LEVEL_QUIET, __VA_ARGS__)
+#define log_info(...)  LOG_AT(LOG_LEVEL_INFO, __VA_ARGS__)
+#define log_debug(...) LOG_AT(LOG_LEVEL_DEBUG, __VA_ARGS__)
+#define log_trace(...) LOG_AT(LOG_LEVEL_TRACE, __VA_ARGS__)
+
+// 메시지 기록 (레벨 확인은 매크로에서 하므로 직접 호출하지 않음)
+void log_write(int level, const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+// 레벨 이름 (quiet, info, debug, trace 또는 0~3) -> 레벨
+// 반환값: 레벨, 알 수 없는 이름이면 -1
+int log_parse_level(const char *name);
+
+// writer 스레드 시작 (종료 시 atexit에서 log_shutdown)
+// 반환값: 0 성공, -1 실패 (이후 메시지는 호출 스레드에서 바로 출력)
+int log_init(int level);
+
+// 지금까지 기록된 메시지를 모두 출력할 때까지 대기
+void log_flush(void);
+
+// 출력 대상 변경 (기본 stdout, 이전 메시지는 이전 대상으로 출력 후 변경)
+void log_set_output(FILE *out);
+
+// 남은 메시지 출력 후 writer 스레드 종료
+void log_shutdown(void);
+
+// fork한 자식 프로세스에서 호출: writer 스레드가 없으므로 이후 메시지는 바로 출력
+// (부모에서 링에 남아 있던 메시지는 부모가 출력하므로 버림, fork 전에 log_flush 권장)
+void log_after_fork(void);
+
+#endif // LOG_H
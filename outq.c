@@ -0,0 +1,538 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE     // fallocate
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <pthread.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/io_uring.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define OUTQ_HAVE_URING 1
+#endif
+#endif
+#include "outq.h"
+#include "log.h"
+
+#ifndef O_BINARY
+#define O_BINARY 0
+#endif
+
+#define OUTQ_MAX_WRITE (1u << 30)   // SQE / pwrite 한 번에 쓰는 최대 바이트 (나머지는 이어서 제출)
+
+// 쓰기 작업 하나 (파일 하나 또는 열린 파일의 한 구간)
+typedef struct OutJob {
+    struct OutJob *next;
+    int fd;
+    int owns_fd;            // 완료 후 fd 닫기 (outq_submit_file)
+    uint8_t *data;
+    size_t len;
+    size_t done;
+    uint64_t offset;
+    int error;              // errno (0 = 성공)
+    char path[512];         // 로그용 (outq_write_at은 빈 문자열)
+} OutJob;
+
+struct OutQueue {
+    OutQueueBackend backend;
+    int depth;
+    int inflight;           // 제출 후 완료되지 않은 작업 수
+    int failed;             // 이전 drain 이후 실패한 작업 수
+    int jobs;               // 통계: 제출한 작업 수
+    uint64_t bytes;         // 통계: 제출한 바이트 수
+    double wait_time;       // 통계: 큐가 가득 차서 제출이 기다린 시간 (초)
+
+    // OUTQ_PWRITE (inflight / failed도 lock으로 보호)
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    OutJob *head;
+    OutJob *tail;
+    int stop;
+
+#ifdef OUTQ_HAVE_URING
+    // OUTQ_URING (제출 스레드 전용)
+    int ring_fd;
+    void *sq_ring;
+    void *cq_ring;
+    size_t sq_ring_size;
+    size_t cq_ring_size;
+    struct io_uring_sqe *sqes;
+    size_t sqes_size;
+    unsigned *sq_tail;
+    unsigned *sq_mask;
+    unsigned *sq_array;
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned *cq_mask;
+    struct io_uring_cqe *cqes;
+    unsigned sq_pending;    // 링에 넣었지만 아직 커널에 제출하지 못한 SQE 수
+#endif
+};
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+const char *outq_backend_name(const OutQueue *q) {
+    switch (q->backend) {
+    case OUTQ_URING:  return "io_uring";
+    case OUTQ_PWRITE: return "pwrite";
+    default:          return "sync";
+    }
+}
+
+// 파일 구간 미리 할당 (지원하지 않는 파일 시스템에서는 그냥 진행)
+static void preallocate(int fd, uint64_t offset, size_t len) {
+#if defined(__linux__)
+    if (len > 0) {
+        (void)fallocate(fd, 0, (off_t)offset, (off_t)len);
+    }
+#else
+    (void)fd; (void)offset; (void)len;
+#endif
+}
+
+// 작업 마무리 (fd 닫기, 버퍼 해제, 실패 보고) - 실패하면 1
+static int finish_job(OutJob *job) {
+    if (job->owns_fd && close(job->fd) != 0 && job->error == 0) {
+        job->error = errno;
+    }
+    int failed = job->error != 0;
+    if (failed) {
+        if (job->path[0]) {
+            log_error("파일 쓰기 실패: %s (%s)\n", job->path, strerror(job->error));
+        } else {
+            log_error("출력 쓰기 실패: offset %llu, %zu bytes (%s)\n",
+                      (unsigned long long)job->offset, job->len, strerror(job->error));
+        }
+    } else if (job->path[0]) {
+        log_debug("비동기 저장 완료: %s (%zu bytes)\n", job->path, job->len);
+    }
+    free(job->data);
+    free(job);
+    return failed;
+}
+
+// 남은 구간을 모두 쓸 때까지 반복 (pwrite / sync 공용)
+static void write_job_blocking(OutJob *job) {
+    while (job->done < job->len && job->error == 0) {
+        size_t len = job->len - job->done;
+        if (len > OUTQ_MAX_WRITE) {
+            len = OUTQ_MAX_WRITE;
+        }
+#ifdef _WIN32
+        long long n = -1;
+        if (_lseeki64(job->fd, (long long)(job->offset + job->done), SEEK_SET) >= 0) {
+            n = _write(job->fd, job->data + job->done, (unsigned)len);
+        }
+#else
+        ssize_t n = pwrite(job->fd, job->data + job->done, len, (off_t)(job->offset + job->done));
+#endif
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            job->error = n < 0 ? errno : EIO;
+            break;
+        }
+        job->done += (size_t)n;
+    }
+}
+
+// ============================================================
+// pwrite 쓰기 스레드
+// ============================================================
+
+static void *writer_thread(void *arg) {
+    OutQueue *q = (OutQueue *)arg;
+    pthread_mutex_lock(&q->lock);
+    for (;;) {
+        while (!q->head && !q->stop) {
+            pthread_cond_wait(&q->cond, &q->lock);
+        }
+        OutJob *job = q->head;
+        if (!job) {
+            break;
+        }
+        q->head = job->next;
+        if (!q->head) {
+            q->tail = NULL;
+        }
+        pthread_mutex_unlock(&q->lock);
+
+        write_job_blocking(job);
+        int failed = finish_job(job);
+
+        pthread_mutex_lock(&q->lock);
+        q->inflight--;
+        q->failed += failed;
+        pthread_cond_broadcast(&q->cond);
+    }
+    pthread_mutex_unlock(&q->lock);
+    return NULL;
+}
+
+// ============================================================
+// io_uring (liburing 없이 링을 직접 매핑)
+// ============================================================
+#ifdef OUTQ_HAVE_URING
+
+static int uring_setup(OutQueue *q, unsigned entries) {
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    q->ring_fd = (int)syscall(__NR_io_uring_setup, entries, &params);
+    if (q->ring_fd < 0) {
+        log_debug("io_uring 사용 불가 (%s), pwrite 쓰기 스레드 사용\n", strerror(errno));
+        return -1;
+    }
+    // IORING_OP_WRITE는 5.6부터 (같은 버전에 추가된 RW_CUR_POS로 판단)
+    if (!(params.features & IORING_FEAT_RW_CUR_POS)) {
+        log_debug("io_uring 쓰기 미지원 커널, pwrite 쓰기 스레드 사용\n");
+        close(q->ring_fd);
+        return -1;
+    }
+
+    q->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    q->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    int single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single && q->cq_ring_size > q->sq_ring_size) {
+        q->sq_ring_size = q->cq_ring_size;
+    }
+    q->sq_ring = mmap(NULL, q->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                      q->ring_fd, IORING_OFF_SQ_RING);
+    q->cq_ring = single ? q->sq_ring
+                        : mmap(NULL, q->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                               q->ring_fd, IORING_OFF_CQ_RING);
+    q->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    q->sqes = (struct io_uring_sqe *)mmap(NULL, q->sqes_size, PROT_READ | PROT_WRITE,
+                                          MAP_SHARED | MAP_POPULATE, q->ring_fd, IORING_OFF_SQES);
+    if (q->sq_ring == MAP_FAILED || q->cq_ring == MAP_FAILED || q->sqes == MAP_FAILED) {
+        log_debug("io_uring 링 매핑 실패, pwrite 쓰기 스레드 사용\n");
+        if (q->sq_ring != MAP_FAILED) {
+            munmap(q->sq_ring, q->sq_ring_size);
+        }
+        if (!single && q->cq_ring != MAP_FAILED) {
+            munmap(q->cq_ring, q->cq_ring_size);
+        }
+        if (q->sqes != MAP_FAILED) {
+            munmap(q->sqes, q->sqes_size);
+        }
+        close(q->ring_fd);
+        return -1;
+    }
+
+    uint8_t *sq = (uint8_t *)q->sq_ring;
+    uint8_t *cq = (uint8_t *)q->cq_ring;
+    q->sq_tail = (unsigned *)(sq + params.sq_off.tail);
+    q->sq_mask = (unsigned *)(sq + params.sq_off.ring_mask);
+    q->sq_array = (unsigned *)(sq + params.sq_off.array);
+    q->cq_head = (unsigned *)(cq + params.cq_off.head);
+    q->cq_tail = (unsigned *)(cq + params.cq_off.tail);
+    q->cq_mask = (unsigned *)(cq + params.cq_off.ring_mask);
+    q->cqes = (struct io_uring_cqe *)(cq + params.cq_off.cqes);
+    return 0;
+}
+
+static void uring_teardown(OutQueue *q) {
+    munmap(q->sqes, q->sqes_size);
+    if (q->cq_ring != q->sq_ring) {
+        munmap(q->cq_ring, q->cq_ring_size);
+    }
+    munmap(q->sq_ring, q->sq_ring_size);
+    close(q->ring_fd);
+}
+
+// 링에 쌓인 SQE 제출, wait이면 완료 하나 이상 대기
+static int uring_enter(OutQueue *q, int wait) {
+    for (;;) {
+        int n = (int)syscall(__NR_io_uring_enter, q->ring_fd, q->sq_pending, wait ? 1 : 0,
+                             wait ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+        if (n >= 0) {
+            q->sq_pending -= (unsigned)n;
+            return 0;
+        }
+        if (errno != EINTR) {
+            log_error("io_uring 제출 실패 (%s)\n", strerror(errno));
+            return -1;
+        }
+    }
+}
+
+// 작업의 남은 구간을 SQE로 링에 추가 (작업 수 <= depth <= SQ 크기이므로 항상 자리가 있음)
+static void uring_push(OutQueue *q, OutJob *job) {
+    unsigned tail = *q->sq_tail;
+    unsigned index = tail & *q->sq_mask;
+    size_t len = job->len - job->done;
+    if (len > OUTQ_MAX_WRITE) {
+        len = OUTQ_MAX_WRITE;
+    }
+    struct io_uring_sqe *sqe = &q->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_WRITE;
+    sqe->fd = job->fd;
+    sqe->addr = (uint64_t)(uintptr_t)(job->data + job->done);
+    sqe->len = (unsigned)len;
+    sqe->off = job->offset + job->done;
+    sqe->user_data = (uint64_t)(uintptr_t)job;
+    q->sq_array[index] = index;
+    __atomic_store_n(q->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    q->sq_pending++;
+}
+
+// 완료된 쓰기 회수 (짧게 쓴 작업은 나머지를 다시 제출)
+static int uring_reap(OutQueue *q, int wait) {
+    if ((wait || q->sq_pending > 0) && uring_enter(q, wait) != 0) {
+        return -1;
+    }
+    int resubmit = 0;
+    unsigned head = *q->cq_head;
+    unsigned tail = __atomic_load_n(q->cq_tail, __ATOMIC_ACQUIRE);
+    while (head != tail) {
+        struct io_uring_cqe *cqe = &q->cqes[head & *q->cq_mask];
+        OutJob *job = (OutJob *)(uintptr_t)cqe->user_data;
+        int res = cqe->res;
+        head++;
+        __atomic_store_n(q->cq_head, head, __ATOMIC_RELEASE);
+
+        if (res == -EAGAIN || res == -EINTR) {
+            uring_push(q, job);
+            resubmit = 1;
+            continue;
+        }
+        if (res <= 0) {
+            job->error = res < 0 ? -res : EIO;
+        } else {
+            job->done += (size_t)res;
+            if (job->done < job->len) {
+                uring_push(q, job);
+                resubmit = 1;
+                continue;
+            }
+        }
+        q->failed += finish_job(job);
+        q->inflight--;
+    }
+    return resubmit ? uring_enter(q, 0) : 0;
+}
+
+#endif // OUTQ_HAVE_URING
+
+// ============================================================
+// 공용
+// ============================================================
+
+OutQueue *outq_create(int depth, OutQueueBackend backend) {
+    OutQueue *q = (OutQueue *)calloc(1, sizeof(OutQueue));
+    if (!q) {
+        log_error("출력 큐 메모리 할당 실패\n");
+        return NULL;
+    }
+    q->depth = depth > 0 ? depth : OUTQ_DEFAULT_DEPTH;
+
+    if (backend == OUTQ_AUTO) {
+        const char *env = getenv("CTC_OUTQ");
+        if (env && strcmp(env, "pwrite") == 0) {
+            backend = OUTQ_PWRITE;
+        } else if (env && strcmp(env, "sync") == 0) {
+            backend = OUTQ_SYNC;
+        }
+    }
+
+#ifdef OUTQ_HAVE_URING
+    if (backend == OUTQ_AUTO || backend == OUTQ_URING) {
+        unsigned entries = 1;
+        while (entries < (unsigned)q->depth) {
+            entries <<= 1;
+        }
+        if (uring_setup(q, entries) == 0) {
+            q->backend = OUTQ_URING;
+            return q;
+        }
+        backend = OUTQ_PWRITE;
+    }
+#endif
+#ifndef _WIN32
+    if (backend != OUTQ_SYNC) {
+        pthread_mutex_init(&q->lock, NULL);
+        pthread_cond_init(&q->cond, NULL);
+        if (pthread_create(&q->thread, NULL, writer_thread, q) == 0) {
+            q->backend = OUTQ_PWRITE;
+            return q;
+        }
+        log_debug("쓰기 스레드 생성 실패, 동기 쓰기 사용\n");
+        pthread_mutex_destroy(&q->lock);
+        pthread_cond_destroy(&q->cond);
+    }
+#endif
+    q->backend = OUTQ_SYNC;
+    return q;
+}
+
+// 작업 제출 (큐가 가득 차면 자리가 날 때까지 대기)
+static int enqueue_job(OutQueue *q, OutJob *job) {
+    q->jobs++;
+    q->bytes += job->len;
+    preallocate(job->fd, job->offset, job->len);
+
+    if (q->backend == OUTQ_SYNC || job->len == 0) {
+        write_job_blocking(job);
+        int failed = finish_job(job);
+        if (q->backend == OUTQ_PWRITE) {
+            pthread_mutex_lock(&q->lock);
+            q->failed += failed;
+            pthread_mutex_unlock(&q->lock);
+        } else {
+            q->failed += failed;
+        }
+        return 0;
+    }
+
+    double start = now_seconds();
+#ifdef OUTQ_HAVE_URING
+    if (q->backend == OUTQ_URING) {
+        // 링을 쓸 수 없으면 제출하지 못한 작업도 실패로 집계 (원인은 uring_enter가 출력)
+        if (uring_reap(q, 0) != 0) {
+            job->error = EIO;
+            q->failed += finish_job(job);
+            return -1;
+        }
+        while (q->inflight >= q->depth) {
+            if (uring_reap(q, 1) != 0) {
+                job->error = EIO;
+                q->failed += finish_job(job);
+                return -1;
+            }
+        }
+        q->wait_time += now_seconds() - start;
+        q->inflight++;
+        uring_push(q, job);
+        return uring_enter(q, 0);
+    }
+#endif
+    pthread_mutex_lock(&q->lock);
+    while (q->inflight >= q->depth) {
+        pthread_cond_wait(&q->cond, &q->lock);
+    }
+    q->wait_time += now_seconds() - start;
+    q->inflight++;
+    job->next = NULL;
+    if (q->tail) {
+        q->tail->next = job;
+    } else {
+        q->head = job;
+    }
+    q->tail = job;
+    pthread_cond_broadcast(&q->cond);
+    pthread_mutex_unlock(&q->lock);
+    return 0;
+}
+
+int outq_submit_file(OutQueue *q, const char *filename, OutputSink *sink) {
+    if (sink->kind != SINK_MEMORY || sink->error) {
+        log_error("출력 큐에는 메모리 sink만 제출할 수 있습니다: %s\n", filename);
+        return -1;
+    }
+    OutJob *job = (OutJob *)calloc(1, sizeof(OutJob));
+    if (!job) {
+        log_error("출력 작업 메모리 할당 실패\n");
+        return -1;
+    }
+    job->fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC | O_BINARY, 0644);
+    if (job->fd < 0) {
+        log_error("파일을 생성할 수 없습니다: %s\n", filename);
+        free(job);
+        return -1;
+    }
+    job->owns_fd = 1;
+    job->data = sink->data;
+    job->len = (size_t)sink->size;
+    snprintf(job->path, sizeof(job->path), "%s", filename);
+    sink->data = NULL;
+    sink->capacity = 0;
+    sink->size = 0;
+    return enqueue_job(q, job);
+}
+
+int outq_write_at(OutQueue *q, int fd, uint64_t offset, void *data, size_t len) {
+    OutJob *job = (OutJob *)calloc(1, sizeof(OutJob));
+    if (!job) {
+        log_error("출력 작업 메모리 할당 실패\n");
+        free(data);
+        return -1;
+    }
+    job->fd = fd;
+    job->data = (uint8_t *)data;
+    job->len = len;
+    job->offset = offset;
+    return enqueue_job(q, job);
+}
+
+int outq_drain(OutQueue *q) {
+    int failed;
+#ifdef OUTQ_HAVE_URING
+    if (q->backend == OUTQ_URING) {
+        while (q->inflight > 0) {
+            if (uring_reap(q, 1) != 0) {
+                // 링을 더 이상 쓸 수 없으면 남은 작업은 회수하지 못함 (버퍼는 누수)
+                q->failed += q->inflight;
+                q->inflight = 0;
+            }
+        }
+        failed = q->failed;
+        q->failed = 0;
+        return failed ? -1 : 0;
+    }
+#endif
+    if (q->backend == OUTQ_PWRITE) {
+        pthread_mutex_lock(&q->lock);
+        while (q->inflight > 0) {
+            pthread_cond_wait(&q->cond, &q->lock);
+        }
+        failed = q->failed;
+        q->failed = 0;
+        pthread_mutex_unlock(&q->lock);
+        return failed ? -1 : 0;
+    }
+    failed = q->failed;
+    q->failed = 0;
+    return failed ? -1 : 0;
+}
+
+int outq_destroy(OutQueue *q) {
+    if (!q) {
+        return 0;
+    }
+    int result = outq_drain(q);
+    log_debug("출력 큐 (%s, 깊이 %d): %d개, %.1f MB, 제출 대기 %.3f s\n", outq_backend_name(q),
+              q->depth, q->jobs, (double)q->bytes / (1024.0 * 1024.0), q->wait_time);
+#ifdef OUTQ_HAVE_URING
+    if (q->backend == OUTQ_URING) {
+        uring_teardown(q);
+    }
+#endif
+    if (q->backend == OUTQ_PWRITE) {
+        pthread_mutex_lock(&q->lock);
+        q->stop = 1;
+        pthread_cond_broadcast(&q->cond);
+        pthread_mutex_unlock(&q->lock);
+        pthread_join(q->thread, NULL);
+        pthread_mutex_destroy(&q->lock);
+        pthread_cond_destroy(&q->cond);
+    }
+    free(q);
+    return result;
+}
@@ -0,0 +1,52 @@
+#ifndef OUTQ_H
+#define OUTQ_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "sink.h"
+
+// 비동기 출력 큐 (배치 / 시퀀스 출력 파일 쓰기)
+// 인코딩이 끝난 메모리 버퍼를 넘기면 쓰기는 큐에서 처리하고 호출 스레드는 바로 다음 작업으로 진행
+// 제출 즉시 fallocate로 파일 크기를 미리 잡고, 완료되지 않은 버퍼 수가 depth에 도달하면
+// 가장 먼저 끝나는 쓰기를 기다림 (메모리 사용량 제한)
+//
+//   OUTQ_URING  : io_uring (liburing 없이 시스템 콜 직접 사용, 쓰기 완료는 제출 스레드에서 회수)
+//   OUTQ_PWRITE : 쓰기 스레드 + pwrite (io_uring을 쓸 수 없는 커널 / 컨테이너)
+//   OUTQ_SYNC   : 제출 시 바로 쓰기 (io_uring / pwrite가 없는 플랫폼)
+typedef enum {
+    OUTQ_AUTO = 0,      // io_uring -> pwrite 순으로 시도 (환경 변수 CTC_OUTQ=pwrite|sync로 지정 가능)
+    OUTQ_URING,
+    OUTQ_PWRITE,
+    OUTQ_SYNC
+} OutQueueBackend;
+
+#define OUTQ_DEFAULT_DEPTH 8
+
+typedef struct OutQueue OutQueue;
+
+// 출력 큐 생성 (depth: 동시에 쓰는 버퍼 최대 수)
+// 반환값: 큐, 실패 시 NULL
+OutQueue *outq_create(int depth, OutQueueBackend backend);
+
+// 실제 사용 중인 방식 이름 ("io_uring", "pwrite", "sync")
+const char *outq_backend_name(const OutQueue *q);
+
+// 메모리 sink 내용을 파일로 저장 (버퍼 소유권은 큐로 이동, sink는 비워짐)
+// 상위 디렉토리는 만들지 않음, 쓰기 오류는 outq_drain / outq_destroy에서 보고
+// 반환값: 0 제출 성공, -1 실패 (파일 생성 실패 등)
+int outq_submit_file(OutQueue *q, const char *filename, OutputSink *sink);
+
+// 열린 파일의 offset 위치에 data 쓰기 (malloc 버퍼, 소유권은 큐로 이동하여 완료 후 free)
+// fd는 outq_drain 전까지 닫지 않아야 함 (시퀀스 출력 등)
+// 반환값: 0 제출 성공, -1 실패
+int outq_write_at(OutQueue *q, int fd, uint64_t offset, void *data, size_t len);
+
+// 제출한 쓰기가 모두 끝날 때까지 대기
+// 반환값: 0 성공, -1 이전 drain 이후 실패한 쓰기가 있음
+int outq_drain(OutQueue *q);
+
+// 남은 쓰기를 마치고 큐 해제
+// 반환값: 0 성공, -1 실패한 쓰기가 있음
+int outq_destroy(OutQueue *q);
+
+#endif // OUTQ_H
@@ -0,0 +1,474 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "config.h"
+#include "pattern.h"
+#include "log.h"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+static const struct {
+    const char *name;
+    PatternKind kind;
+} pattern_names[] = {
+    { "gray",     PATTERN_GRAY },
+    { "ramp",     PATTERN_RAMP },
+    { "bars",     PATTERN_BARS },
+    { "256gray",  PATTERN_BARS },
+    { "window",   PATTERN_WINDOW },
+    { "hlines",   PATTERN_HLINES },
+    { "vlines",   PATTERN_VLINES },
+    { "checker",  PATTERN_CHECKER },
+    { "subpixel", PATTERN_SUBPIXEL },
+};
+
+#define PATTERN_NAME_COUNT ((int)(sizeof(pattern_names) / sizeof(pattern_names[0])))
+
+const char *pattern_name(PatternKind kind) {
+    for (int i = 0; i < PATTERN_NAME_COUNT; i++) {
+        if (pattern_names[i].kind == kind) {
+            return pattern_names[i].name;
+        }
+    }
+    return "unknown";
+}
+
+// 정수 값 해석 (문자열 전체가 숫자여야 함)
+static int parse_int(const char *text, int min, int max, int *value) {
+    char *end;
+    long v = strtol(text, &end, 10);
+    if (end == text || *end != '\0' || v < min || v > max) {
+        return -1;
+    }
+    *value = (int)v;
+    return 0;
+}
+
+static int parse_channels(const char *text, int *channels) {
+    int mask = 0;
+    for (const char *p = text; *p; p++) {
+        switch (tolower((unsigned char)*p)) {
+        case 'r': mask |= PATTERN_CH_R; break;
+        case 'g': mask |= PATTERN_CH_G; break;
+        case 'b': mask |= PATTERN_CH_B; break;
+        default: return -1;
+        }
+    }
+    if (mask == 0) {
+        return -1;
+    }
+    *channels = mask;
+    return 0;
+}
+
+int pattern_parse(const char *text, PatternSpec *spec) {
+    char buf[256];
+    if (!text || strlen(text) >= sizeof(buf)) {
+        log_error("패턴 지정이 너무 깁니다\n");
+        return -1;
+    }
+    strcpy(buf, text);
+
+    char *save = NULL;
+    char *token = strtok_r(buf, ",", &save);
+    int found = -1;
+    for (int i = 0; token && i < PATTERN_NAME_COUNT; i++) {
+        if (strcmp(token, pattern_names[i].name) == 0) {
+            found = i;
+        }
+    }
+    if (found < 0) {
+        log_error("알 수 없는 패턴: %s (gray, ramp, bars, window, hlines, vlines, checker, subpixel)\n",
+                  token ? token : "");
+        return -1;
+    }
+
+    memset(spec, 0, sizeof(*spec));
+    spec->kind = pattern_names[found].kind;
+    spec->fg = 255;
+    spec->bg = 0;
+    spec->channels = spec->kind == PATTERN_SUBPIXEL ? PATTERN_CH_G
+                                                    : PATTERN_CH_R | PATTERN_CH_G | PATTERN_CH_B;
+    spec->size = spec->kind == PATTERN_WINDOW ? 50 : 1;
+    spec->x = -1;
+    spec->y = -1;
+
+    while ((token = strtok_r(NULL, ",", &save)) != NULL) {
+        char *eq = strchr(token, '=');
+        int ok;
+        if (!eq) {
+            char tail;
+            ok = sscanf(token, "%dx%d%c", &spec->width, &spec->height, &tail) == 2 &&
+                 spec->width > 0 && spec->height > 0;
+        } else {
+            *eq = '\0';
+            const char *value = eq + 1;
+            if (strcmp(token, "fg") == 0) {
+                ok = parse_int(value, 0, 255, &spec->fg) == 0;
+            } else if (strcmp(token, "bg") == 0) {
+                ok = parse_int(value, 0, 255, &spec->bg) == 0;
+            } else if (strcmp(token, "ch") == 0) {
+                ok = parse_channels(value, &spec->channels) == 0;
+            } else if (strcmp(token, "size") == 0) {
+                ok = parse_int(value, 1, spec->kind == PATTERN_WINDOW ? 100 : 1 << 20, &spec->size) == 0;
+            } else if (strcmp(token, "x") == 0) {
+                ok = parse_int(value, 0, 1 << 20, &spec->x) == 0;
+            } else if (strcmp(token, "y") == 0) {
+                ok = parse_int(value, 0, 1 << 20, &spec->y) == 0;
+            } else {
+                ok = 0;
+            }
+            *eq = '=';
+        }
+        if (!ok) {
+            log_error("잘못된 패턴 인자: %s (WxH, fg=, bg=, ch=, size=, x=, y=)\n", token);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+// ============================================================
+// 행 생성
+// ============================================================
+
+// 배열 크기/깊이에 맞춰 계산한 생성 정보
+typedef struct {
+    const PatternSpec *spec;
+    int width;
+    int height;
+    int depth;
+    uint32_t max;
+    uint16_t fg[3];         // R, G, B 순서 (ch에 없는 채널은 0)
+    uint16_t bg[3];
+    int box_x0, box_x1;     // window 박스 [x0, x1) x [y0, y1)
+    int box_y0, box_y1;
+    int px, py;             // subpixel 위치
+} PatternPlan;
+
+static uint16_t scale_level(int level, uint32_t max) {
+    return (uint16_t)(((uint32_t)level * max) / 255u);
+}
+
+// x0, y0, order: 패널 기준 시작 위치 / 서브픽셀 순서 (subpixel 기본 위치 계산용)
+static int plan_pattern(const PatternSpec *spec, int width, int height, int depth,
+                        int x0, int y0, int order, PatternPlan *plan) {
+    if (width <= 0 || height <= 0) {
+        log_error("잘못된 패턴 크기: %d x %d\n", width, height);
+        return -1;
+    }
+    if (depth != 8 && depth != 10 && depth != 12 && depth != 16) {
+        log_error("지원하지 않는 비트 깊이: %d (8/10/12/16)\n", depth);
+        return -1;
+    }
+    if (spec->width && (spec->width != width || spec->height != height)) {
+        log_error("패턴 크기(%d x %d)와 배열 크기(%d x %d)가 다릅니다\n",
+                  spec->width, spec->height, width, height);
+        return -1;
+    }
+    memset(plan, 0, sizeof(*plan));
+    plan->spec = spec;
+    plan->width = width;
+    plan->height = height;
+    plan->depth = depth;
+    plan->max = (1u << depth) - 1;
+    for (int c = 0; c < 3; c++) {
+        plan->fg[c] = (spec->channels & (1 << c)) ? scale_level(spec->fg, plan->max) : 0;
+        plan->bg[c] = scale_level(spec->bg, plan->max);
+    }
+
+    if (spec->kind == PATTERN_WINDOW) {
+        int bw = (int)((int64_t)width * spec->size / 100);
+        int bh = (int)((int64_t)height * spec->size / 100);
+        plan->box_x0 = (width - bw) / 2;
+        plan->box_x1 = plan->box_x0 + bw;
+        plan->box_y0 = (height - bh) / 2;
+        plan->box_y1 = plan->box_y0 + bh;
+    } else if (spec->kind == PATTERN_SUBPIXEL) {
+        if (spec->x >= width || spec->y >= height) {
+            log_error("subpixel 위치 (%d, %d)가 배열(%d x %d) 밖입니다\n", spec->x, spec->y, width, height);
+            return -1;
+        }
+        plan->py = spec->y >= 0 ? spec->y : height / 2;
+        plan->px = spec->x >= 0 ? spec->x : width / 2;
+        // 기본 위치: R/B 하나만 지정하면 RGBG 변환 후에도 그 서브픽셀이 남는 열 선택
+        // (패널 행/열 짝홀이 같으면 [R, G], 다르면 [B, G] / [G, B] 픽셀)
+        if (spec->x < 0 && (spec->channels == PATTERN_CH_R || spec->channels == PATTERN_CH_B)) {
+            int row_parity = (y0 + plan->py + order) & 1;
+            int want_col = spec->channels == PATTERN_CH_R ? row_parity : !row_parity;
+            if (((x0 + plan->px) & 1) != want_col) {
+                plan->px += plan->px + 1 < width ? 1 : -1;
+            }
+            if (plan->px < 0) {
+                plan->px = 0;
+            }
+        }
+    }
+    return 0;
+}
+
+// 같은 값이면 같은 RGB 행 (한 번 만든 행을 복사하는 기준)
+static int row_key(const PatternPlan *plan, int y) {
+    const PatternSpec *spec = plan->spec;
+    switch (spec->kind) {
+    case PATTERN_BARS:
+        return (int)((int64_t)y * 256 / plan->height);
+    case PATTERN_WINDOW:
+        return y >= plan->box_y0 && y < plan->box_y1;
+    case PATTERN_HLINES:
+    case PATTERN_CHECKER:
+        return (y / spec->size) & 1;
+    case PATTERN_SUBPIXEL:
+        return y == plan->py;
+    default:
+        return 0;
+    }
+}
+
+// [begin, end) 구간을 value로 채우기
+static void fill_run(uint8_t *p8, uint16_t *p16, int begin, int end, uint16_t value) {
+    if (begin >= end) {
+        return;
+    }
+    if (p8) {
+        memset(p8 + begin, value, (size_t)(end - begin));
+        return;
+    }
+    uint16_t *p = p16 + begin;
+    size_t n = (size_t)(end - begin);
+    size_t i = 0;
+#if defined(__SSE2__)
+    const __m128i v = _mm_set1_epi16((short)value);
+    for (; i + 16 <= n; i += 16) {
+        _mm_storeu_si128((__m128i *)(p + i), v);
+        _mm_storeu_si128((__m128i *)(p + i + 8), v);
+    }
+#endif
+    for (; i < n; i++) {
+        p[i] = value;
+    }
+}
+
+static void fill_planes(uint8_t *p8[3], uint16_t *p16[3], int begin, int end, const uint16_t value[3]) {
+    for (int c = 0; c < 3; c++) {
+        fill_run(p8 ? p8[c] : NULL, p8 ? NULL : p16[c], begin, end, value[c]);
+    }
+}
+
+// 번갈아 나오는 size열 구간 (first_fg: 0번 구간이 fg)
+static void fill_alternating(const PatternPlan *plan, uint8_t *p8[3], uint16_t *p16[3], int first_fg) {
+    int size = plan->spec->size;
+    int fg = first_fg;
+    for (int x = 0; x < plan->width; x += size) {
+        int end = x + size < plan->width ? x + size : plan->width;
+        fill_planes(p8, p16, x, end, fg ? plan->fg : plan->bg);
+        fg = !fg;
+    }
+}
+
+// y행의 R, G, B 평면 생성 (8bit: p8, 그 외: p16)
+static void render_row(const PatternPlan *plan, int y, uint8_t *p8[3], uint16_t *p16[3]) {
+    const PatternSpec *spec = plan->spec;
+    int w = plan->width;
+    switch (spec->kind) {
+    case PATTERN_GRAY:
+        fill_planes(p8, p16, 0, w, plan->fg);
+        break;
+    case PATTERN_RAMP:
+        for (int c = 0; c < 3; c++) {
+            int on = (spec->channels & (1 << c)) != 0;
+            for (int x = 0; x < w; x++) {
+                uint32_t v = on && w > 1 ? (uint32_t)((uint64_t)x * plan->max / (uint32_t)(w - 1)) : 0;
+                if (p8) {
+                    p8[c][x] = (uint8_t)v;
+                } else {
+                    p16[c][x] = (uint16_t)v;
+                }
+            }
+        }
+        break;
+    case PATTERN_BARS: {
+        uint16_t level[3];
+        uint16_t v = scale_level(row_key(plan, y), plan->max);
+        for (int c = 0; c < 3; c++) {
+            level[c] = (spec->channels & (1 << c)) ? v : 0;
+        }
+        fill_planes(p8, p16, 0, w, level);
+        break;
+    }
+    case PATTERN_WINDOW:
+        fill_planes(p8, p16, 0, w, plan->bg);
+        if (row_key(plan, y)) {
+            fill_planes(p8, p16, plan->box_x0, plan->box_x1, plan->fg);
+        }
+        break;
+    case PATTERN_HLINES:
+        fill_planes(p8, p16, 0, w, row_key(plan, y) ? plan->bg : plan->fg);
+        break;
+    case PATTERN_VLINES:
+        fill_alternating(plan, p8, p16, 1);
+        break;
+    case PATTERN_CHECKER:
+        fill_alternating(plan, p8, p16, !row_key(plan, y));
+        break;
+    case PATTERN_SUBPIXEL:
+        fill_planes(p8, p16, 0, w, plan->bg);
+        if (y == plan->py) {
+            for (int c = 0; c < 3; c++) {
+                if (spec->channels & (1 << c)) {
+                    fill_run(p8 ? p8[c] : NULL, p8 ? NULL : p16[c], plan->px, plan->px + 1, plan->fg[c]);
+                }
+            }
+        }
+        break;
+    }
+}
+
+int pattern_fill_rgb(const PatternSpec *spec, RGBArray *rgb) {
+    PatternPlan plan;
+    if (plan_pattern(spec, rgb->width, rgb->height, rgb->depth, rgb->x0, rgb->y0,
+                     ip_ports.por_rgbg_order & 1, &plan) != 0) {
+        return -1;
+    }
+    size_t w = (size_t)rgb->width;
+    for (int y = 0; y < rgb->height; y++) {
+        size_t row = (size_t)y * w;
+        int key = row_key(&plan, y);
+        int src = y >= 1 && row_key(&plan, y - 1) == key ? y - 1
+                : y >= 2 && row_key(&plan, y - 2) == key ? y - 2 : -1;
+        if (rgb->depth == 8) {
+            uint8_t *p8[3] = { rgb->r + row, rgb->g + row, rgb->b + row };
+            if (src >= 0) {
+                for (int c = 0; c < 3; c++) {
+                    memcpy(p8[c], p8[c] - (size_t)(y - src) * w, w);
+                }
+            } else {
+                render_row(&plan, y, p8, NULL);
+            }
+        } else {
+            uint16_t *p16[3] = { rgb->r16 + row, rgb->g16 + row, rgb->b16 + row };
+            if (src >= 0) {
+                for (int c = 0; c < 3; c++) {
+                    memcpy(p16[c], p16[c] - (size_t)(y - src) * w, w * sizeof(uint16_t));
+                }
+            } else {
+                render_row(&plan, y, NULL, p16);
+            }
+        }
+    }
+    return 0;
+}
+
+int pattern_fill_rgbg(const PatternSpec *spec, RGBGArray *rgbg) {
+    PatternPlan plan;
+    if (plan_pattern(spec, rgbg->width, rgbg->height, rgbg->depth, rgbg->x0, rgbg->y0,
+                     rgbg->order, &plan) != 0) {
+        return -1;
+    }
+
+    // 행마다 RGB 한 행을 만들어 기존 행 변환 커널로 배치
+    // 서브픽셀 배치는 행 짝홀에 따라 다르므로 복사는 2행 위 (같은 짝홀)에서만
+    size_t bytes = rgbg->depth == 8 ? 1 : sizeof(uint16_t);
+    size_t w = (size_t)rgbg->width;
+    uint8_t *scratch = (uint8_t *)malloc(w * bytes * 3);
+    if (!scratch) {
+        log_error("패턴 행 버퍼 할당 실패\n");
+        return -1;
+    }
+    RGBArray row;
+    RGBGArray out;
+    memset(&row, 0, sizeof(row));
+    row.width = rgbg->width;
+    row.height = 1;
+    row.depth = rgbg->depth;
+    row.x0 = rgbg->x0;
+    out = *rgbg;
+    out.height = 1;
+    if (rgbg->depth == 8) {
+        row.r = scratch;
+        row.g = scratch + w;
+        row.b = scratch + w * 2;
+    } else {
+        row.r16 = (uint16_t *)scratch;
+        row.g16 = row.r16 + w;
+        row.b16 = row.r16 + w * 2;
+    }
+
+    size_t row_bytes = w * 2 * bytes;
+    uint8_t *base = rgbg->depth == 8 ? rgbg->data : (uint8_t *)rgbg->data16;
+    int result = 0;
+    for (int y = 0; y < rgbg->height && result == 0; y++) {
+        uint8_t *dst = base + (size_t)y * row_bytes;
+        if (y >= 2 && row_key(&plan, y - 2) == row_key(&plan, y)) {
+            memcpy(dst, dst - row_bytes * 2, row_bytes);
+            continue;
+        }
+        if (rgbg->depth == 8) {
+            uint8_t *p8[3] = { row.r, row.g, row.b };
+            render_row(&plan, y, p8, NULL);
+            out.data = dst;
+        } else {
+            uint16_t *p16[3] = { row.r16, row.g16, row.b16 };
+            render_row(&plan, y, NULL, p16);
+            out.data16 = (uint16_t *)dst;
+        }
+        row.y0 = out.y0 = rgbg->y0 + y;
+        result = rgb_to_rgbg_rows(&row, &out, 0, 1);
+    }
+    free(scratch);
+    return result;
+}
+
+int pattern_generate_rgb(const PatternSpec *spec, int depth, RGBArray *rgb) {
+    memset(rgb, 0, sizeof(*rgb));
+    if (spec->width <= 0 || spec->height <= 0) {
+        log_error("패턴 크기(WxH)가 필요합니다\n");
+        return -1;
+    }
+    if (depth != 8 && depth != 10 && depth != 12 && depth != 16) {
+        log_error("지원하지 않는 비트 깊이: %d (8/10/12/16)\n", depth);
+        return -1;
+    }
+    size_t pixels = (size_t)spec->width * spec->height;
+    rgb->width = spec->width;
+    rgb->height = spec->height;
+    rgb->depth = depth;
+    if (depth == 8) {
+        rgb->r = (uint8_t *)malloc(pixels);
+        rgb->g = (uint8_t *)malloc(pixels);
+        rgb->b = (uint8_t *)malloc(pixels);
+    } else {
+        rgb->r16 = (uint16_t *)malloc(pixels * sizeof(uint16_t));
+        rgb->g16 = (uint16_t *)malloc(pixels * sizeof(uint16_t));
+        rgb->b16 = (uint16_t *)malloc(pixels * sizeof(uint16_t));
+    }
+    if (depth == 8 ? (!rgb->r || !rgb->g || !rgb->b) : (!rgb->r16 || !rgb->g16 || !rgb->b16)) {
+        log_error("RGB 배열 메모리 할당 실패\n");
+        free_rgb(rgb);
+        return -1;
+    }
+    if (pattern_fill_rgb(spec, rgb) != 0) {
+        free_rgb(rgb);
+        return -1;
+    }
+    return 0;
+}
+
+int pattern_generate_rgbg(const PatternSpec *spec, int depth, RGBGArray *rgbg) {
+    if (spec->width <= 0 || spec->height <= 0) {
+        memset(rgbg, 0, sizeof(*rgbg));
+        log_error("패턴 크기(WxH)가 필요합니다\n");
+        return -1;
+    }
+    if (alloc_rgbg(rgbg, spec->width, spec->height, depth) != 0) {
+        free_rgbg(rgbg);
+        return -1;
+    }
+    if (pattern_fill_rgbg(spec, rgbg) != 0) {
+        free_rgbg(rgbg);
+        return -1;
+    }
+    return 0;
+}
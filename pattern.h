@@ -0,0 +1,75 @@
+#ifndef PATTERN_H
+#define PATTERN_H
+
+#include "image_io.h"
+
+// 합성 테스트 패턴 (BMP 파일 없이 RGB / RGBG 배열에 바로 생성)
+// 지정 형식: "이름[,WxH][,키=값]..."  (예: "bars,1080x2392", "window,1080x2392,size=25,bg=0")
+//
+//   gray     : 단색 (fg)
+//   ramp     : 가로 그라데이션 (0 ~ 최대값, 배열 비트 깊이 해상도)
+//   bars     : 256단계 가로 띠 (위에서 아래로 0 ~ 255, 256GRAY.bmp와 같은 용도, 별칭 256gray)
+//   window   : 가운데 박스(fg, 화면 크기의 size%) / 배경(bg)
+//   hlines   : 가로 줄무늬 (size행 fg / size행 bg 반복)
+//   vlines   : 세로 줄무늬 (size열 fg / size열 bg 반복)
+//   checker  : size x size 체커보드 (fg / bg)
+//   subpixel : (x, y) 픽셀의 ch 서브픽셀 하나만 fg, 나머지 bg
+//
+//   키: fg, bg (8bit 기준 레벨 0~255, 배열 깊이로 확장), ch (fg 채널, r/g/b 조합),
+//       size (줄/칸 크기, window는 %), x, y (subpixel 위치)
+//   fg 영역의 ch에 없는 채널은 0, bg 영역은 모든 채널이 bg
+//
+// 같은 내용의 행은 한 번만 만들고 복사하므로 생성 시간은 대부분 메모리 쓰기 시간
+
+typedef enum {
+    PATTERN_GRAY = 0,
+    PATTERN_RAMP,
+    PATTERN_BARS,
+    PATTERN_WINDOW,
+    PATTERN_HLINES,
+    PATTERN_VLINES,
+    PATTERN_CHECKER,
+    PATTERN_SUBPIXEL
+} PatternKind;
+
+#define PATTERN_CH_R 0x1
+#define PATTERN_CH_G 0x2
+#define PATTERN_CH_B 0x4
+
+typedef struct {
+    PatternKind kind;
+    int width;          // 0이면 지정하지 않음 (배열 크기 사용)
+    int height;
+    int fg;
+    int bg;
+    int channels;       // PATTERN_CH_* 조합
+    int size;
+    int x;              // subpixel 위치 (-1이면 가운데에서 ch를 가진 픽셀)
+    int y;
+} PatternSpec;
+
+// 패턴 지정 문자열 해석
+// 반환값: 0 성공, -1 실패 (알 수 없는 이름/키, 잘못된 값)
+int pattern_parse(const char *text, PatternSpec *spec);
+
+// 패턴 이름 (출력 파일명 등)
+const char *pattern_name(PatternKind kind);
+
+// 할당된 RGB 배열 전체에 패턴 생성 (크기/깊이는 배열 값 사용)
+// 반환값: 0 성공, -1 실패
+int pattern_fill_rgb(const PatternSpec *spec, RGBArray *rgb);
+
+// 할당된 RGBG 배열 전체에 패턴 생성 (서브픽셀 순서/시작 위치는 배열 값 사용)
+// 결과는 같은 패턴의 RGB 배열을 rgb_to_rgbg로 변환한 것과 같음
+// 반환값: 0 성공, -1 실패
+int pattern_fill_rgbg(const PatternSpec *spec, RGBGArray *rgbg);
+
+// spec 크기 / depth 비트 깊이로 RGB 배열을 할당하여 패턴 생성 (free_rgb로 해제)
+// 반환값: 0 성공, -1 실패
+int pattern_generate_rgb(const PatternSpec *spec, int depth, RGBArray *rgb);
+
+// spec 크기 / depth 비트 깊이로 RGBG 배열을 할당하여 패턴 생성 (서브픽셀 순서는 por_rgbg_order)
+// 반환값: 0 성공, -1 실패
+int pattern_generate_rgbg(const PatternSpec *spec, int depth, RGBGArray *rgbg);
+
+#endif // PATTERN_H
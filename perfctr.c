@@ -0,0 +1,452 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#if defined(__NR_perf_event_open)
+#define PERF_HAVE_EVENTS 1
+#endif
+#endif
+#include "perfctr.h"
+#include "log.h"
+
+// 1000 명령당 캐시 미스가 이 값 이상이면 메모리 위주 단계로 표시
+#define PERF_MEMORY_MPKI 5.0
+// 1000 명령당 분기 예측 실패가 이 값 이상이면 분기 위주 단계로 표시
+#define PERF_BRANCH_MPKI 5.0
+
+static const char *stage_names[PERF_STAGE_COUNT] = { "read", "rgbg", "pack", "bmp8" };
+static const char *event_names[PERF_EVENT_COUNT] = { "cycles", "instructions", "cache-misses", "branch-misses" };
+
+// 스레드별 카운터 fd (스레드가 끝나면 닫음)
+typedef struct {
+    int fd[PERF_EVENT_COUNT];
+} PerfThread;
+
+// 보고 전 프레임 기록
+typedef struct {
+    int frame;              // -1 = 비어 있음
+    PerfSample stage[PERF_STAGE_COUNT];
+} PerfFrame;
+
+static struct {
+    PerfMode mode;
+    unsigned available;
+    int next_frame;         // PERF_FRAME_CURRENT가 가리키는 프레임
+    int frames;             // 보고한 프레임 수
+    PerfSample total[PERF_STAGE_COUNT];
+    PerfFrame ring[PERF_FRAME_RING];
+} perf;
+
+static pthread_mutex_t perf_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t perf_key;
+static pthread_once_t perf_key_once = PTHREAD_ONCE_INIT;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// ============================================================
+// 카운터 열기 / 읽기
+// ============================================================
+
+#ifdef PERF_HAVE_EVENTS
+static const uint64_t event_configs[PERF_EVENT_COUNT] = {
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES,
+};
+
+// 호출 스레드의 사용자 공간 카운터 하나 열기
+// 반환값: fd, 실패 시 -1 (errno)
+static int open_event(int event) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = event_configs[event];
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    // 카운터 수가 PMU보다 많아 다중화되면 실행 시간 비율로 보정
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC);
+}
+
+static void close_event(int fd) {
+    close(fd);
+}
+
+// 반환값: 0 성공, -1 실패
+static int read_event(int fd, uint64_t *value, uint64_t *enabled, uint64_t *running) {
+    uint64_t buf[3];
+    if (read(fd, buf, sizeof(buf)) != (ssize_t)sizeof(buf)) {
+        return -1;
+    }
+    *value = buf[0];
+    *enabled = buf[1];
+    *running = buf[2];
+    return 0;
+}
+#else
+static int open_event(int event) {
+    (void)event;
+    errno = ENOSYS;
+    return -1;
+}
+
+static void close_event(int fd) {
+    (void)fd;
+}
+
+static int read_event(int fd, uint64_t *value, uint64_t *enabled, uint64_t *running) {
+    (void)fd;
+    *value = *enabled = *running = 0;
+    return -1;
+}
+#endif
+
+static void free_thread(void *arg) {
+    PerfThread *t = (PerfThread *)arg;
+    for (int e = 0; e < PERF_EVENT_COUNT; e++) {
+        if (t->fd[e] >= 0) {
+            close_event(t->fd[e]);
+        }
+    }
+    free(t);
+}
+
+static void create_key(void) {
+    pthread_key_create(&perf_key, free_thread);
+}
+
+// 호출 스레드의 카운터 (처음 호출 시 열기, 열지 못한 카운터는 fd -1)
+// err: 첫 번째 실패의 errno (NULL 가능)
+static PerfThread *thread_counters(int *err) {
+    pthread_once(&perf_key_once, create_key);
+    PerfThread *t = (PerfThread *)pthread_getspecific(perf_key);
+    if (t) {
+        return t;
+    }
+    t = (PerfThread *)malloc(sizeof(PerfThread));
+    if (!t) {
+        return NULL;
+    }
+    for (int e = 0; e < PERF_EVENT_COUNT; e++) {
+        t->fd[e] = open_event(e);
+        if (t->fd[e] < 0 && err && *err == 0) {
+            *err = errno;
+        }
+    }
+    pthread_setspecific(perf_key, t);
+    return t;
+}
+
+// ============================================================
+// 측정
+// ============================================================
+
+unsigned perf_enable(PerfMode mode) {
+    const char *env = getenv("CTC_PERF");
+    if (mode == PERF_COUNTERS && env && strcmp(env, "time") == 0) {
+        mode = PERF_TIME_ONLY;
+    }
+
+    pthread_mutex_lock(&perf_lock);
+    memset(perf.total, 0, sizeof(perf.total));
+    for (int i = 0; i < PERF_FRAME_RING; i++) {
+        memset(&perf.ring[i], 0, sizeof(perf.ring[i]));
+        perf.ring[i].frame = -1;
+    }
+    perf.next_frame = 0;
+    perf.frames = 0;
+    perf.available = 0;
+    pthread_mutex_unlock(&perf_lock);
+
+    unsigned available = 0;
+    if (mode == PERF_COUNTERS) {
+        int err = 0;
+        PerfThread *t = thread_counters(&err);
+        for (int e = 0; t && e < PERF_EVENT_COUNT; e++) {
+            if (t->fd[e] >= 0) {
+                available |= 1u << e;
+            }
+        }
+        if (available == 0) {
+            const char *reason = strerror(err ? err : ENOMEM);
+            if (err == EACCES || err == EPERM) {
+                reason = "권한 없음, /proc/sys/kernel/perf_event_paranoid 확인";
+            } else if (err == ENOENT || err == EOPNOTSUPP) {
+                reason = "PMU 없음, VM / 컨테이너";
+            }
+            log_info("하드웨어 성능 카운터 사용 불가 (%s), 시간만 측정\n", reason);
+            mode = PERF_TIME_ONLY;
+        } else if (available != (1u << PERF_EVENT_COUNT) - 1) {
+            for (int e = 0; e < PERF_EVENT_COUNT; e++) {
+                if (!(available & (1u << e))) {
+                    log_info("성능 카운터 %s 사용 불가\n", event_names[e]);
+                }
+            }
+        }
+    }
+
+    pthread_mutex_lock(&perf_lock);
+    perf.available = available;
+    perf.mode = mode;
+    pthread_mutex_unlock(&perf_lock);
+    return available;
+}
+
+int perf_enabled(void) {
+    return perf.mode != PERF_OFF;
+}
+
+unsigned perf_available(void) {
+    return perf.available;
+}
+
+const char *perf_stage_name(int stage) {
+    return (stage >= 0 && stage < PERF_STAGE_COUNT) ? stage_names[stage] : "?";
+}
+
+const char *perf_event_name(int event) {
+    return (event >= 0 && event < PERF_EVENT_COUNT) ? event_names[event] : "?";
+}
+
+// 호출 스레드의 카운터 값 읽기 (읽지 못한 카운터는 0)
+static void read_counters(PerfThread *t, uint64_t *value, uint64_t *enabled, uint64_t *running) {
+    for (int e = 0; e < PERF_EVENT_COUNT; e++) {
+        value[e] = enabled[e] = running[e] = 0;
+        if (t && t->fd[e] >= 0) {
+            read_event(t->fd[e], &value[e], &enabled[e], &running[e]);
+        }
+    }
+}
+
+void perf_begin(PerfScope *scope, PerfStage stage, int frame) {
+    scope->active = 0;
+    if (perf.mode == PERF_OFF) {
+        return;
+    }
+    scope->active = 1;
+    scope->stage = stage;
+    if (frame < 0) {
+        pthread_mutex_lock(&perf_lock);
+        frame = perf.next_frame;
+        pthread_mutex_unlock(&perf_lock);
+    }
+    scope->frame = frame;
+    PerfThread *t = perf.mode == PERF_COUNTERS ? thread_counters(NULL) : NULL;
+    read_counters(t, scope->value, scope->enabled, scope->running);
+    scope->start = now_seconds();
+}
+
+static void add_sample(PerfSample *dst, const PerfSample *src) {
+    for (int e = 0; e < PERF_EVENT_COUNT; e++) {
+        dst->count[e] += src->count[e];
+    }
+    dst->seconds += src->seconds;
+    dst->calls += src->calls;
+}
+
+void perf_end(PerfScope *scope) {
+    if (!scope->active) {
+        return;
+    }
+    scope->active = 0;
+    PerfSample delta;
+    memset(&delta, 0, sizeof(delta));
+    delta.seconds = now_seconds() - scope->start;
+    delta.calls = 1;
+
+    if (perf.mode == PERF_COUNTERS) {
+        uint64_t value[PERF_EVENT_COUNT], enabled[PERF_EVENT_COUNT], running[PERF_EVENT_COUNT];
+        read_counters(thread_counters(NULL), value, enabled, running);
+        for (int e = 0; e < PERF_EVENT_COUNT; e++) {
+            uint64_t d = value[e] - scope->value[e];
+            uint64_t en = enabled[e] - scope->enabled[e];
+            uint64_t run = running[e] - scope->running[e];
+            if (run == 0) {
+                d = 0;
+            } else if (run < en) {
+                d = (uint64_t)((double)d * (double)en / (double)run);
+            }
+            delta.count[e] = d;
+        }
+    }
+
+    pthread_mutex_lock(&perf_lock);
+    add_sample(&perf.total[scope->stage], &delta);
+    PerfFrame *f = &perf.ring[scope->frame % PERF_FRAME_RING];
+    if (f->frame != scope->frame) {
+        // 보고되지 않은 오래된 프레임 기록은 버림
+        memset(f, 0, sizeof(*f));
+        f->frame = scope->frame;
+    }
+    add_sample(&f->stage[scope->stage], &delta);
+    pthread_mutex_unlock(&perf_lock);
+}
+
+void perf_frame_sample(int frame, PerfStage stage, PerfSample *sample) {
+    memset(sample, 0, sizeof(*sample));
+    pthread_mutex_lock(&perf_lock);
+    if (frame < 0) {
+        frame = perf.next_frame;
+    }
+    const PerfFrame *f = &perf.ring[frame % PERF_FRAME_RING];
+    if (f->frame == frame) {
+        *sample = f->stage[stage];
+    }
+    pthread_mutex_unlock(&perf_lock);
+}
+
+void perf_total_sample(PerfStage stage, PerfSample *sample) {
+    pthread_mutex_lock(&perf_lock);
+    *sample = perf.total[stage];
+    pthread_mutex_unlock(&perf_lock);
+}
+
+// ============================================================
+// 보고
+// ============================================================
+
+// 1000 명령당 이벤트 수 (명령 수를 모르면 음수)
+static double per_kilo_instruction(const PerfSample *s, int event, unsigned available) {
+    if (!(available & (1u << event)) || !(available & (1u << PERF_INSTRUCTIONS)) ||
+        s->count[PERF_INSTRUCTIONS] == 0) {
+        return -1.0;
+    }
+    return 1000.0 * (double)s->count[event] / (double)s->count[PERF_INSTRUCTIONS];
+}
+
+static double instructions_per_cycle(const PerfSample *s, unsigned available) {
+    if (!(available & (1u << PERF_CYCLES)) || !(available & (1u << PERF_INSTRUCTIONS)) ||
+        s->count[PERF_CYCLES] == 0) {
+        return -1.0;
+    }
+    return (double)s->count[PERF_INSTRUCTIONS] / (double)s->count[PERF_CYCLES];
+}
+
+// 값 또는 "-" (측정하지 못함)
+static const char *format_ratio(char *buf, size_t size, double value) {
+    if (value < 0.0) {
+        snprintf(buf, size, "-");
+    } else {
+        snprintf(buf, size, "%.2f", value);
+    }
+    return buf;
+}
+
+static const char *format_count(char *buf, size_t size, const PerfSample *s, int event, unsigned available) {
+    if (available & (1u << event)) {
+        snprintf(buf, size, "%llu", (unsigned long long)s->count[event]);
+    } else {
+        snprintf(buf, size, "-");
+    }
+    return buf;
+}
+
+void perf_frame_report(int frame) {
+    if (perf.mode == PERF_OFF) {
+        return;
+    }
+    PerfFrame f;
+    pthread_mutex_lock(&perf_lock);
+    if (frame < 0) {
+        frame = perf.next_frame++;
+    }
+    PerfFrame *slot = &perf.ring[frame % PERF_FRAME_RING];
+    f = *slot;
+    if (slot->frame == frame) {
+        memset(slot, 0, sizeof(*slot));
+        slot->frame = -1;
+    }
+    perf.frames++;
+    unsigned available = perf.available;
+    pthread_mutex_unlock(&perf_lock);
+    if (f.frame != frame) {
+        return;
+    }
+
+    char line[1024];
+    int len = snprintf(line, sizeof(line), "  [perf] 프레임 %d:", frame);
+    for (int s = 0; s < PERF_STAGE_COUNT && len < (int)sizeof(line); s++) {
+        const PerfSample *st = &f.stage[s];
+        if (st->calls == 0) {
+            continue;
+        }
+        char ipc[16], cache[16], branch[16];
+        if (available) {
+            len += snprintf(line + len, sizeof(line) - (size_t)len,
+                            " %s %.2f ms IPC %s cache %s/ki branch %s/ki |", stage_names[s], st->seconds * 1e3,
+                            format_ratio(ipc, sizeof(ipc), instructions_per_cycle(st, available)),
+                            format_ratio(cache, sizeof(cache), per_kilo_instruction(st, PERF_CACHE_MISSES, available)),
+                            format_ratio(branch, sizeof(branch), per_kilo_instruction(st, PERF_BRANCH_MISSES, available)));
+        } else {
+            len += snprintf(line + len, sizeof(line) - (size_t)len, " %s %.2f ms |", stage_names[s], st->seconds * 1e3);
+        }
+    }
+    if (len > 0 && len < (int)sizeof(line) && line[len - 1] == '|') {
+        line[len - 2] = '\0';
+    }
+    log_info("%s\n", line);
+}
+
+void perf_report(void) {
+    if (perf.mode == PERF_OFF) {
+        return;
+    }
+    PerfSample total[PERF_STAGE_COUNT];
+    pthread_mutex_lock(&perf_lock);
+    memcpy(total, perf.total, sizeof(total));
+    unsigned available = perf.available;
+    int frames = perf.frames;
+    pthread_mutex_unlock(&perf_lock);
+
+    log_info("--- 단계별 성능 카운터 (프레임 %d개, %s) ---\n", frames,
+             available ? "사용자 공간 하드웨어 카운터" : "카운터 사용 불가, 시간만");
+    if (!available) {
+        log_info("  %-6s %6s %12s %12s\n", "단계", "호출", "시간(ms)", "ms/호출");
+    } else {
+        log_info("  %-6s %6s %12s %14s %14s %6s %10s %10s  %s\n", "단계", "호출", "시간(ms)",
+                 "cycles", "instructions", "IPC", "cache/ki", "branch/ki", "추정");
+    }
+    for (int s = 0; s < PERF_STAGE_COUNT; s++) {
+        const PerfSample *st = &total[s];
+        if (st->calls == 0) {
+            continue;
+        }
+        if (!available) {
+            log_info("  %-6s %6d %12.3f %12.3f\n", stage_names[s], st->calls, st->seconds * 1e3,
+                     st->seconds * 1e3 / st->calls);
+            continue;
+        }
+        char cycles[24], instructions[24], ipc[16], cache[16], branch[16];
+        format_count(cycles, sizeof(cycles), st, PERF_CYCLES, available);
+        format_count(instructions, sizeof(instructions), st, PERF_INSTRUCTIONS, available);
+        double cache_mpki = per_kilo_instruction(st, PERF_CACHE_MISSES, available);
+        double branch_mpki = per_kilo_instruction(st, PERF_BRANCH_MISSES, available);
+        const char *bound = "-";
+        if (cache_mpki >= PERF_MEMORY_MPKI) {
+            bound = "메모리";
+        } else if (branch_mpki >= PERF_BRANCH_MPKI) {
+            bound = "분기";
+        } else if (cache_mpki >= 0.0 && branch_mpki >= 0.0) {
+            bound = "연산";
+        }
+        log_info("  %-6s %6d %12.3f %14s %14s %6s %10s %10s  %s\n", stage_names[s], st->calls,
+                 st->seconds * 1e3, cycles, instructions,
+                 format_ratio(ipc, sizeof(ipc), instructions_per_cycle(st, available)),
+                 format_ratio(cache, sizeof(cache), cache_mpki),
+                 format_ratio(branch, sizeof(branch), branch_mpki), bound);
+    }
+}
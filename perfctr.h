@@ -0,0 +1,86 @@
+#ifndef PERFCTR_H
+#define PERFCTR_H
+
+#include <stdint.h>
+
+// 파이프라인 단계별 하드웨어 성능 카운터 (--perf)
+// 단계 구간마다 cycles / instructions / cache misses / branch misses를 읽어 프레임별, 전체 누적으로 보고
+// IPC와 1000 명령당 미스 수(MPKI)로 단계가 연산 위주인지 메모리 위주인지 구분
+//
+// 카운터는 perf_event_open (Linux)으로 스레드마다 처음 측정할 때 열고, 사용자 공간만 셈 (exclude_kernel)
+// 열 수 없으면 (perf_event_paranoid, 컨테이너 / VM, Linux 외 플랫폼) 시간만 측정
+// 환경 변수 CTC_PERF=time이면 카운터를 열지 않고 시간만 측정
+// 꺼져 있으면 perf_begin / perf_end는 바로 반환
+
+typedef enum {
+    PERF_STAGE_READ = 0,    // 입력 읽기 (BMP / 시퀀스 프레임)
+    PERF_STAGE_RGBG,        // RGB -> RGBG 변환
+    PERF_STAGE_PACK,        // PPM / 패킹 RAW 인코딩
+    PERF_STAGE_BMP8,        // 8bit BMP (팔레트 최근접 색 탐색)
+    PERF_STAGE_COUNT
+} PerfStage;
+
+typedef enum {
+    PERF_CYCLES = 0,
+    PERF_INSTRUCTIONS,
+    PERF_CACHE_MISSES,
+    PERF_BRANCH_MISSES,
+    PERF_EVENT_COUNT
+} PerfEvent;
+
+typedef enum {
+    PERF_OFF = 0,
+    PERF_COUNTERS,          // 하드웨어 카운터 + 시간 (열 수 없으면 시간만)
+    PERF_TIME_ONLY          // 시간만
+} PerfMode;
+
+#define PERF_FRAME_CURRENT -1   // 다음에 보고할 프레임 (단일 스레드 배치 처리)
+#define PERF_FRAME_RING 64      // 보고 전 프레임 기록 수 (시퀀스 읽기 단계가 앞서 갈 수 있는 프레임 수)
+
+typedef struct {
+    uint64_t count[PERF_EVENT_COUNT];   // 다중화된 카운터는 실행 시간 비율로 보정한 값
+    double seconds;
+    int calls;
+} PerfSample;
+
+// 단계 구간 하나 (perf_begin ~ perf_end, 같은 스레드에서 호출)
+typedef struct {
+    int active;
+    int stage;
+    int frame;
+    double start;
+    uint64_t value[PERF_EVENT_COUNT];
+    uint64_t enabled[PERF_EVENT_COUNT];
+    uint64_t running[PERF_EVENT_COUNT];
+} PerfScope;
+
+// 측정 켜기 / 끄기 (누적 값은 초기화)
+// PERF_COUNTERS이면 호출 스레드에서 카운터를 열어 보고 사용할 수 없는 이유를 한 번 출력
+// 반환값: 사용할 수 있는 카운터 비트 마스크 (1 << PerfEvent, 0이면 시간만)
+unsigned perf_enable(PerfMode mode);
+
+int perf_enabled(void);
+
+// 사용할 수 있는 카운터 비트 마스크
+unsigned perf_available(void);
+
+const char *perf_stage_name(int stage);
+const char *perf_event_name(int event);
+
+// 단계 구간 시작 / 끝 (frame: 프레임 번호 또는 PERF_FRAME_CURRENT)
+void perf_begin(PerfScope *scope, PerfStage stage, int frame);
+void perf_end(PerfScope *scope);
+
+// 프레임 하나의 단계 값 (보고 전, 없으면 0)
+void perf_frame_sample(int frame, PerfStage stage, PerfSample *sample);
+
+// 프레임 하나의 단계별 값을 한 줄로 출력하고 기록 비움 (PERF_FRAME_CURRENT이면 다음 프레임으로 진행)
+void perf_frame_report(int frame);
+
+// 전체 누적 값
+void perf_total_sample(PerfStage stage, PerfSample *sample);
+
+// 전체 누적 표 출력 (꺼져 있으면 출력 없음)
+void perf_report(void);
+
+#endif // PERFCTR_H
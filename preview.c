@@ -0,0 +1,478 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+#include "preview.h"
+#include "ctcz.h"
+#include "log.h"
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define PREVIEW_MAX_THREADS 64
+#define PREVIEW_MIN_BAND_ROWS 16    // 스레드 하나가 맡는 최소 행 수 (작은 이미지는 스레드 수 줄임)
+
+// (x0 + x, y0 + y) 패널 위치의 첫 샘플이 R인지 (아니면 B)
+// Even row [R, G][G, B], Odd row [B, G][R, G] -> 패널 행/열 짝홀이 같으면 R
+static inline int first_is_r(const RGBGArray *rgbg, int y) {
+    return ((rgbg->y0 + y + rgbg->order) & 1) == (rgbg->x0 & 1);
+}
+
+// ============================================================
+// 행 커널 (전체 해상도)
+// ============================================================
+// 행 버퍼는 앞뒤로 1샘플 여유를 두고 p[-1] = p[1], p[w] = p[w - 2]로 채움 (같은 색 이웃)
+
+#define AVG(a, b) (((unsigned)(a) + (unsigned)(b) + 1) >> 1)
+
+#define DEFINE_PREVIEW_SCALAR(SUFFIX, PIXEL_T)                                        \
+static void split_row_scalar_##SUFFIX(const PIXEL_T *src, PIXEL_T *p, PIXEL_T *g,    \
+                                      int start, int w) {                            \
+    for (int x = start; x < w; x++) {                                                \
+        p[x] = src[x * 2];                                                           \
+        if (g) g[x] = src[x * 2 + 1];                                                \
+    }                                                                                \
+}                                                                                    \
+static void fill_row_scalar_##SUFFIX(const PIXEL_T *cur, const PIXEL_T *up,          \
+                                     const PIXEL_T *down, PIXEL_T *r, PIXEL_T *b,    \
+                                     int start, int w, int r_phase) {                \
+    for (int x = start; x < w; x++) {                                                \
+        PIXEL_T q = (PIXEL_T)AVG(AVG(cur[x - 1], cur[x + 1]), AVG(up[x], down[x]));  \
+        int is_r = ((x + r_phase) & 1) == 0;                                         \
+        r[x] = is_r ? cur[x] : q;                                                    \
+        b[x] = is_r ? q : cur[x];                                                    \
+    }                                                                                \
+}
+
+DEFINE_PREVIEW_SCALAR(u8, uint8_t)
+DEFINE_PREVIEW_SCALAR(u16, uint16_t)
+
+// RGBG 행 -> R/B 샘플 행 p, G 행 g (g = NULL이면 생략)
+static void split_row_u8(const uint8_t *src, uint8_t *p, uint8_t *g, int w) {
+    int x = 0;
+#if defined(__SSE2__)
+    const __m128i lo = _mm_set1_epi16(0x00FF);
+    for (; x + 16 <= w; x += 16) {
+        __m128i v0 = _mm_loadu_si128((const __m128i *)(src + x * 2));
+        __m128i v1 = _mm_loadu_si128((const __m128i *)(src + x * 2 + 16));
+        _mm_storeu_si128((__m128i *)(p + x), _mm_packus_epi16(_mm_and_si128(v0, lo), _mm_and_si128(v1, lo)));
+        if (g) {
+            _mm_storeu_si128((__m128i *)(g + x), _mm_packus_epi16(_mm_srli_epi16(v0, 8), _mm_srli_epi16(v1, 8)));
+        }
+    }
+#endif
+    split_row_scalar_u8(src, p, g, x, w);
+}
+
+static void split_row_u16(const uint16_t *src, uint16_t *p, uint16_t *g, int w) {
+    int x = 0;
+#if defined(__SSE2__)
+    // 32bit 레인의 하위/상위 16bit를 부호 확장 후 packs (값이 그대로 유지됨)
+    for (; x + 8 <= w; x += 8) {
+        __m128i v0 = _mm_loadu_si128((const __m128i *)(src + x * 2));
+        __m128i v1 = _mm_loadu_si128((const __m128i *)(src + x * 2 + 8));
+        __m128i p0 = _mm_srai_epi32(_mm_slli_epi32(v0, 16), 16);
+        __m128i p1 = _mm_srai_epi32(_mm_slli_epi32(v1, 16), 16);
+        _mm_storeu_si128((__m128i *)(p + x), _mm_packs_epi32(p0, p1));
+        if (g) {
+            _mm_storeu_si128((__m128i *)(g + x), _mm_packs_epi32(_mm_srai_epi32(v0, 16), _mm_srai_epi32(v1, 16)));
+        }
+    }
+#endif
+    split_row_scalar_u16(src, p, g, x, w);
+}
+
+// 빠진 R/B 채우기: r_phase 0이면 짝수 번째 픽셀이 R
+static void fill_row_u8(const uint8_t *cur, const uint8_t *up, const uint8_t *down,
+                        uint8_t *r, uint8_t *b, int w, int r_phase) {
+    int x = 0;
+#if defined(__SSE2__)
+    const __m128i sel = r_phase ? _mm_set1_epi16((short)0xFF00) : _mm_set1_epi16(0x00FF);
+    for (; x + 16 <= w; x += 16) {
+        __m128i c = _mm_loadu_si128((const __m128i *)(cur + x));
+        __m128i h = _mm_avg_epu8(_mm_loadu_si128((const __m128i *)(cur + x - 1)),
+                                 _mm_loadu_si128((const __m128i *)(cur + x + 1)));
+        __m128i v = _mm_avg_epu8(_mm_loadu_si128((const __m128i *)(up + x)),
+                                 _mm_loadu_si128((const __m128i *)(down + x)));
+        __m128i q = _mm_avg_epu8(h, v);
+        _mm_storeu_si128((__m128i *)(r + x), _mm_or_si128(_mm_and_si128(sel, c), _mm_andnot_si128(sel, q)));
+        _mm_storeu_si128((__m128i *)(b + x), _mm_or_si128(_mm_and_si128(sel, q), _mm_andnot_si128(sel, c)));
+    }
+#endif
+    fill_row_scalar_u8(cur, up, down, r, b, x, w, r_phase);
+}
+
+static void fill_row_u16(const uint16_t *cur, const uint16_t *up, const uint16_t *down,
+                         uint16_t *r, uint16_t *b, int w, int r_phase) {
+    int x = 0;
+#if defined(__SSE2__)
+    const __m128i sel = r_phase ? _mm_set1_epi32((int)0xFFFF0000u) : _mm_set1_epi32(0x0000FFFF);
+    for (; x + 8 <= w; x += 8) {
+        __m128i c = _mm_loadu_si128((const __m128i *)(cur + x));
+        __m128i h = _mm_avg_epu16(_mm_loadu_si128((const __m128i *)(cur + x - 1)),
+                                  _mm_loadu_si128((const __m128i *)(cur + x + 1)));
+        __m128i v = _mm_avg_epu16(_mm_loadu_si128((const __m128i *)(up + x)),
+                                  _mm_loadu_si128((const __m128i *)(down + x)));
+        __m128i q = _mm_avg_epu16(h, v);
+        _mm_storeu_si128((__m128i *)(r + x), _mm_or_si128(_mm_and_si128(sel, c), _mm_andnot_si128(sel, q)));
+        _mm_storeu_si128((__m128i *)(b + x), _mm_or_si128(_mm_and_si128(sel, q), _mm_andnot_si128(sel, c)));
+    }
+#endif
+    fill_row_scalar_u16(cur, up, down, r, b, x, w, r_phase);
+}
+
+// ============================================================
+// 행 구간 처리
+// ============================================================
+
+typedef struct {
+    const RGBGArray *rgbg;
+    RGBArray *rgb;
+    int scale;
+    int y_begin;        // 출력 행 구간
+    int y_end;
+    int result;
+} PreviewWorker;
+
+// 전체 해상도: 필요한 원본 행(위/현재/아래)의 R/B 샘플만 버퍼 3개에 유지
+static void preview_band_full(PreviewWorker *wk) {
+    const RGBGArray *rgbg = wk->rgbg;
+    RGBArray *rgb = wk->rgb;
+    int w = rgbg->width;
+    int h = rgbg->height;
+    size_t bytes = rgbg->depth == 8 ? 1 : sizeof(uint16_t);
+    size_t stride = (size_t)w + 2;
+    uint8_t *mem = (uint8_t *)malloc(stride * bytes * 4);
+    if (!mem) {
+        log_error("미리보기 행 버퍼 할당 실패\n");
+        wk->result = -1;
+        return;
+    }
+    int tags[3] = { -1, -1, -1 };
+    for (int y = wk->y_begin; y < wk->y_end; y++) {
+        // 같은 색 위/아래 이웃 행 (가장자리는 반대쪽, 1행 이미지는 가로 평균 행)
+        int need[3] = { y > 0 ? y - 1 : (h > 1 ? 1 : -2), y, y + 1 < h ? y + 1 : (h > 1 ? h - 2 : -2) };
+        int slot[3];
+        for (int k = 0; k < 3; k++) {
+            slot[k] = -1;
+            if (need[k] == -2) {
+                continue;
+            }
+            for (int s = 0; s < 3; s++) {
+                if (tags[s] == need[k]) slot[k] = s;
+            }
+            if (slot[k] >= 0) {
+                continue;
+            }
+            for (int s = 0; s < 3 && slot[k] < 0; s++) {
+                if (tags[s] != need[0] && tags[s] != need[1] && tags[s] != need[2]) slot[k] = s;
+            }
+            int row = need[k];
+            int own = row >= wk->y_begin && row < wk->y_end;   // G는 이 구간 행만 기록
+            size_t offset = (size_t)row * w;
+            if (bytes == 1) {
+                uint8_t *p = mem + stride * slot[k] + 1;
+                split_row_u8(rgbg->data + offset * 2, p, own ? rgb->g + offset : NULL, w);
+                p[-1] = w > 1 ? p[1] : p[0];
+                p[w] = w > 1 ? p[w - 2] : p[0];
+            } else {
+                uint16_t *p = (uint16_t *)mem + stride * slot[k] + 1;
+                split_row_u16(rgbg->data16 + offset * 2, p, own ? rgb->g16 + offset : NULL, w);
+                p[-1] = w > 1 ? p[1] : p[0];
+                p[w] = w > 1 ? p[w - 2] : p[0];
+            }
+            tags[slot[k]] = row;
+        }
+
+        size_t offset = (size_t)y * w;
+        int r_phase = first_is_r(rgbg, y) ? 0 : 1;
+        if (bytes == 1) {
+            uint8_t *cur = mem + stride * slot[1] + 1;
+            uint8_t *hrow = mem + stride * 3 + 1;
+            if (h == 1) {
+                for (int x = 0; x < w; x++) hrow[x] = (uint8_t)AVG(cur[x - 1], cur[x + 1]);
+            }
+            uint8_t *up = slot[0] >= 0 ? mem + stride * slot[0] + 1 : hrow;
+            uint8_t *down = slot[2] >= 0 ? mem + stride * slot[2] + 1 : hrow;
+            fill_row_u8(cur, up, down, rgb->r + offset, rgb->b + offset, w, r_phase);
+        } else {
+            uint16_t *cur = (uint16_t *)mem + stride * slot[1] + 1;
+            uint16_t *hrow = (uint16_t *)mem + stride * 3 + 1;
+            if (h == 1) {
+                for (int x = 0; x < w; x++) hrow[x] = (uint16_t)AVG(cur[x - 1], cur[x + 1]);
+            }
+            uint16_t *up = slot[0] >= 0 ? (uint16_t *)mem + stride * slot[0] + 1 : hrow;
+            uint16_t *down = slot[2] >= 0 ? (uint16_t *)mem + stride * slot[2] + 1 : hrow;
+            fill_row_u16(cur, up, down, rgb->r16 + offset, rgb->b16 + offset, w, r_phase);
+        }
+    }
+    free(mem);
+}
+
+// 세로 누적: acc[x] += src[x] (u32 누적)
+static void accumulate_row_u8(uint32_t *acc, const uint8_t *src, int w) {
+    int x = 0;
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    for (; x + 16 <= w; x += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + x));
+        __m128i lo = _mm_unpacklo_epi8(v, zero);
+        __m128i hi = _mm_unpackhi_epi8(v, zero);
+        __m128i *a = (__m128i *)(acc + x);
+        _mm_storeu_si128(a, _mm_add_epi32(_mm_loadu_si128(a), _mm_unpacklo_epi16(lo, zero)));
+        _mm_storeu_si128(a + 1, _mm_add_epi32(_mm_loadu_si128(a + 1), _mm_unpackhi_epi16(lo, zero)));
+        _mm_storeu_si128(a + 2, _mm_add_epi32(_mm_loadu_si128(a + 2), _mm_unpacklo_epi16(hi, zero)));
+        _mm_storeu_si128(a + 3, _mm_add_epi32(_mm_loadu_si128(a + 3), _mm_unpackhi_epi16(hi, zero)));
+    }
+#endif
+    for (; x < w; x++) {
+        acc[x] += src[x];
+    }
+}
+
+static void accumulate_row_u16(uint32_t *acc, const uint16_t *src, int w) {
+    int x = 0;
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    for (; x + 8 <= w; x += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(src + x));
+        __m128i *a = (__m128i *)(acc + x);
+        _mm_storeu_si128(a, _mm_add_epi32(_mm_loadu_si128(a), _mm_unpacklo_epi16(v, zero)));
+        _mm_storeu_si128(a + 1, _mm_add_epi32(_mm_loadu_si128(a + 1), _mm_unpackhi_epi16(v, zero)));
+    }
+#endif
+    for (; x < w; x++) {
+        acc[x] += src[x];
+    }
+}
+
+// 면적 렌더링 (분리형): 블록 행의 원본 행을 R/B 샘플 / G로 나누어 열별로 세로 누적한 뒤 블록 단위로 가로 합산
+// R/B 샘플은 행 위상(r_phase)별로 따로 누적 -> 위상 0 행은 짝수 열이 R, 위상 1 행은 홀수 열이 R
+// 블록에 R(또는 B) 서브픽셀이 없으면 (1x1 블록) G 평균 사용
+static void preview_band_area(PreviewWorker *wk) {
+    const RGBGArray *rgbg = wk->rgbg;
+    RGBArray *rgb = wk->rgb;
+    int n = wk->scale;
+    int w = rgbg->width;
+    int ow = rgb->width;
+    size_t bytes = rgbg->depth == 8 ? 1 : sizeof(uint16_t);
+    uint32_t *acc = (uint32_t *)malloc((size_t)w * 3 * sizeof(uint32_t));
+    uint8_t *rows = (uint8_t *)malloc((size_t)w * 2 * bytes);
+    if (!acc || !rows) {
+        log_error("미리보기 누적 버퍼 할당 실패\n");
+        free(acc);
+        free(rows);
+        wk->result = -1;
+        return;
+    }
+    uint32_t *acc_p[2] = { acc, acc + w };      // 위상 0 / 1 행의 R/B 샘플
+    uint32_t *acc_g = acc + (size_t)w * 2;
+    for (int oy = wk->y_begin; oy < wk->y_end; oy++) {
+        memset(acc, 0, (size_t)w * 3 * sizeof(uint32_t));
+        int y_begin = oy * n;
+        int y_end = y_begin + n < rgbg->height ? y_begin + n : rgbg->height;
+        int phase_rows[2] = { 0, 0 };
+        for (int y = y_begin; y < y_end; y++) {
+            int r_phase = first_is_r(rgbg, y) ? 0 : 1;
+            size_t offset = (size_t)y * w * 2;
+            if (bytes == 1) {
+                split_row_u8(rgbg->data + offset, rows, rows + w, w);
+                accumulate_row_u8(acc_p[r_phase], rows, w);
+                accumulate_row_u8(acc_g, rows + w, w);
+            } else {
+                uint16_t *p = (uint16_t *)rows;
+                split_row_u16(rgbg->data16 + offset, p, p + w, w);
+                accumulate_row_u16(acc_p[r_phase], p, w);
+                accumulate_row_u16(acc_g, p + w, w);
+            }
+            phase_rows[r_phase]++;
+        }
+
+        size_t out = (size_t)oy * ow;
+        for (int ox = 0; ox < ow; ox++) {
+            int x_begin = ox * n;
+            int x_end = x_begin + n < w ? x_begin + n : w;
+            // 짝수/홀수 열 합 (위상 0 행: 짝수 = R, 위상 1 행: 홀수 = R)
+            uint32_t sum_r = 0, sum_b = 0, sum_g = 0;
+            for (int x = x_begin; x < x_end; x++) {
+                if (x & 1) {
+                    sum_b += acc_p[0][x];
+                    sum_r += acc_p[1][x];
+                } else {
+                    sum_r += acc_p[0][x];
+                    sum_b += acc_p[1][x];
+                }
+                sum_g += acc_g[x];
+            }
+            uint32_t even = (uint32_t)((x_end + 1) / 2 - (x_begin + 1) / 2);
+            uint32_t odd = (uint32_t)(x_end - x_begin) - even;
+            uint32_t cnt_r = phase_rows[0] * even + phase_rows[1] * odd;
+            uint32_t cnt_b = phase_rows[0] * odd + phase_rows[1] * even;
+            uint32_t cnt_g = cnt_r + cnt_b;
+            uint32_t v_g = (sum_g + cnt_g / 2) / cnt_g;
+            uint32_t v_r = cnt_r ? (sum_r + cnt_r / 2) / cnt_r : v_g;
+            uint32_t v_b = cnt_b ? (sum_b + cnt_b / 2) / cnt_b : v_g;
+            if (rgb->depth == 8) {
+                rgb->r[out + ox] = (uint8_t)v_r;
+                rgb->g[out + ox] = (uint8_t)v_g;
+                rgb->b[out + ox] = (uint8_t)v_b;
+            } else {
+                rgb->r16[out + ox] = (uint16_t)v_r;
+                rgb->g16[out + ox] = (uint16_t)v_g;
+                rgb->b16[out + ox] = (uint16_t)v_b;
+            }
+        }
+    }
+    free(acc);
+    free(rows);
+}
+
+static void *preview_worker(void *arg) {
+    PreviewWorker *wk = (PreviewWorker *)arg;
+    if (wk->scale == 1) {
+        preview_band_full(wk);
+    } else {
+        preview_band_area(wk);
+    }
+    return NULL;
+}
+
+int rgbg_to_rgb_preview(const RGBGArray *rgbg, RGBArray *rgb, int scale, int threads) {
+    memset(rgb, 0, sizeof(*rgb));
+    if (!rgbg || (rgbg->depth == 8 ? !rgbg->data : !rgbg->data16) || rgbg->width <= 0 || rgbg->height <= 0) {
+        log_error("유효하지 않은 RGBG 배열\n");
+        return -1;
+    }
+    if (scale < 1 || scale > PREVIEW_MAX_SCALE) {
+        log_error("잘못된 미리보기 배율: %d (1 ~ %d)\n", scale, PREVIEW_MAX_SCALE);
+        return -1;
+    }
+
+    int ow = (rgbg->width + scale - 1) / scale;
+    int oh = (rgbg->height + scale - 1) / scale;
+    size_t pixels = (size_t)ow * oh;
+    rgb->width = ow;
+    rgb->height = oh;
+    rgb->depth = rgbg->depth;
+    if (rgbg->depth == 8) {
+        rgb->r = (uint8_t *)malloc(pixels);
+        rgb->g = (uint8_t *)malloc(pixels);
+        rgb->b = (uint8_t *)malloc(pixels);
+    } else {
+        rgb->r16 = (uint16_t *)malloc(pixels * sizeof(uint16_t));
+        rgb->g16 = (uint16_t *)malloc(pixels * sizeof(uint16_t));
+        rgb->b16 = (uint16_t *)malloc(pixels * sizeof(uint16_t));
+    }
+    if (rgbg->depth == 8 ? (!rgb->r || !rgb->g || !rgb->b) : (!rgb->r16 || !rgb->g16 || !rgb->b16)) {
+        log_error("미리보기 RGB 배열 메모리 할당 실패\n");
+        free_rgb(rgb);
+        return -1;
+    }
+
+#ifdef _WIN32
+    if (threads <= 0) threads = 1;
+#else
+    if (threads <= 0) threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    if (threads > PREVIEW_MAX_THREADS) threads = PREVIEW_MAX_THREADS;
+    if (threads > oh / PREVIEW_MIN_BAND_ROWS) threads = oh / PREVIEW_MIN_BAND_ROWS;
+    if (threads < 1) threads = 1;
+
+    PreviewWorker workers[PREVIEW_MAX_THREADS];
+    pthread_t tids[PREVIEW_MAX_THREADS];
+    for (int t = 0; t < threads; t++) {
+        workers[t].rgbg = rgbg;
+        workers[t].rgb = rgb;
+        workers[t].scale = scale;
+        workers[t].y_begin = (int)((int64_t)oh * t / threads);
+        workers[t].y_end = (int)((int64_t)oh * (t + 1) / threads);
+        workers[t].result = 0;
+    }
+    int started = 1;
+    for (int t = 1; t < threads; t++, started++) {
+        if (pthread_create(&tids[t], NULL, preview_worker, &workers[t]) != 0) {
+            break;
+        }
+    }
+    // 스레드를 만들지 못한 구간은 호출 스레드에서 처리
+    for (int t = started; t < threads; t++) {
+        preview_worker(&workers[t]);
+    }
+    preview_worker(&workers[0]);
+    int result = workers[0].result;
+    for (int t = 1; t < threads; t++) {
+        if (t < started) {
+            pthread_join(tids[t], NULL);
+        }
+        if (workers[t].result != 0) {
+            result = -1;
+        }
+    }
+    if (result != 0) {
+        free_rgb(rgb);
+    }
+    return result;
+}
+
+int write_rgbg_preview(OutputSink *sink, const RGBGArray *rgbg, int scale) {
+    RGBArray rgb;
+    if (rgbg_to_rgb_preview(rgbg, &rgb, scale, 0) != 0) {
+        return -1;
+    }
+    int result = write_rgb_bmp24(sink, &rgb);
+    free_rgb(&rgb);
+    return result;
+}
+
+int save_rgbg_preview(const RGBGArray *rgbg, const char *filename, int scale) {
+    OutputSink sink;
+    if (make_parent_directory(filename) != 0 || sink_open_file(&sink, filename) != 0) {
+        return -1;
+    }
+    int result = write_rgbg_preview(&sink, rgbg, scale);
+    if (sink_close(&sink) != 0 || result != 0) {
+        return -1;
+    }
+    log_debug("미리보기 BMP 저장 완료: %s\n", filename);
+    return 0;
+}
+
+int convert_to_preview(const char *in_filename, const char *bmp_filename, int scale) {
+    RGBGArray rgbg;
+    RGBArray unused;
+    char magic[4] = { 0 };
+    FILE *file = fopen(in_filename, "rb");
+    if (!file) {
+        log_error("파일을 열 수 없습니다: %s\n", in_filename);
+        return -1;
+    }
+    size_t got = fread(magic, 1, sizeof(magic), file);
+    fclose(file);
+
+    int loaded;
+    if (got == 4 && memcmp(magic, "CTCZ", 4) == 0) {
+        loaded = read_ctcz(in_filename, &rgbg, &unused);
+        if (loaded == CTCZ_KIND_RGB) {
+            free_rgb(&unused);
+            log_error("RGB .ctcz는 미리보기 대상이 아닙니다 (RGBG .ctcz / 패킹 RAW만 가능): %s\n", in_filename);
+            return -1;
+        }
+        loaded = loaded == CTCZ_KIND_RGBG ? 0 : -1;
+    } else {
+        loaded = read_raw(in_filename, &rgbg);
+    }
+    if (loaded != 0) {
+        return -1;
+    }
+    int out_w = (rgbg.width + scale - 1) / scale;
+    int out_h = (rgbg.height + scale - 1) / scale;
+    int result = save_rgbg_preview(&rgbg, bmp_filename, scale);
+    free_rgbg(&rgbg);
+    if (result == 0) {
+        log_info("미리보기 변환 완료: %s -> %s (%dx%d, 배율 1/%d)\n", in_filename, bmp_filename, out_w, out_h, scale);
+    }
+    return result;
+}
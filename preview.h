@@ -0,0 +1,36 @@
+#ifndef PREVIEW_H
+#define PREVIEW_H
+
+#include "image_io.h"
+#include "sink.h"
+
+// RGBG 배열 -> 보기용 RGB 배열 복원 (미리보기)
+// PPM 출력은 픽셀마다 빠진 채널이 0이라 줄무늬로 보이므로, 빠진 R/B를 채워 실제 색으로 확인
+//
+//   scale 1 : 전체 해상도. G는 그대로, 빠진 R/B는 상하좌우 이웃(모두 그 색을 가진 픽셀)으로 채움
+//             값 = avg(avg(왼쪽, 오른쪽), avg(위, 아래)), avg(a, b) = (a + b + 1) >> 1
+//             가장자리는 반대쪽 이웃을 사용 (같은 색 위치 유지)
+//   scale N : N x N 블록마다 실제 서브픽셀만 채널별로 평균 (면적 렌더링, 크기 ceil(W/N) x ceil(H/N))
+//
+// 행 구간을 스레드로 나누어 처리하며 결과는 스레드 수와 무관
+
+#define PREVIEW_MAX_SCALE 64
+
+// 미리보기 RGB 배열 생성 (비트 깊이는 RGBG 배열과 같음, free_rgb로 해제)
+// threads: 스레드 수 (0이면 CPU 수)
+// 반환값: 0 성공, -1 실패
+int rgbg_to_rgb_preview(const RGBGArray *rgbg, RGBArray *rgb, int scale, int threads);
+
+// 미리보기를 24bit BMP로 출력 대상에 쓰기
+// 반환값: 0 성공, -1 실패
+int write_rgbg_preview(OutputSink *sink, const RGBGArray *rgbg, int scale);
+
+// 미리보기 24bit BMP 파일 저장 (상위 디렉토리 생성)
+// 반환값: 0 성공, -1 실패
+int save_rgbg_preview(const RGBGArray *rgbg, const char *filename, int scale);
+
+// 패킹 RAW / .ctcz(RGBG) 파일을 미리보기 BMP로 변환
+// 반환값: 0 성공, -1 실패
+int convert_to_preview(const char *in_filename, const char *bmp_filename, int scale);
+
+#endif // PREVIEW_H
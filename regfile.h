@@ -0,0 +1,231 @@
+// ==========================================
+// AUTO-GENERATED FILE by gen_registers.py
+// DO NOT EDIT THIS FILE DIRECTLY.
+// ==========================================
+#ifndef REGFILE_H
+#define REGFILE_H
+
+#include <stdint.h>
+
+// IP 내부 레지스터 파일 (registers_list.csv 순서, 필드 크기는 Width 열)
+// 이름 매크로(regmap.h)로 접근하며 page/addr 접근은 reg_read_by_addr / reg_value_at
+typedef struct {
+    uint8_t reg_ctc_lctc_en;                   // 0x05:0x01 8bit LCTC On/ Off ctrl
+    uint8_t reg_ctc_actc_en;                   // 0x05:0x02 8bit ACTC On/ Off ctrl
+    uint8_t reg_ctc_color_mode;                // 0x05:0x03 8bit
+    uint8_t reg_ctc_dbv_gain_en;               // 0x05:0x04 8bit
+    uint8_t reg_ctc_frq_gain_en;               // 0x05:0x05 8bit
+    uint8_t reg_ctc_lctc_off_mask0;            // 0x05:0x06 8bit
+    uint8_t reg_ctc_lctc_off_mask1;            // 0x05:0x07 8bit
+    uint8_t reg_ctc_th_gray;                   // 0x05:0x08 8bit
+    uint8_t reg_ctc_th_delta_line_avg;         // 0x05:0x09 8bit
+    uint8_t reg_ctc_th_sat;                    // 0x05:0x0A 8bit
+    uint8_t reg_ctc_lut_end_itp;               // 0x05:0x0B 8bit
+    uint8_t reg_ctc_delt_pxlv_mode;            // 0x05:0x0C 8bit
+    uint8_t reg_ctc_delt_linev_mode;           // 0x05:0x0D 8bit
+    uint8_t reg_ctc_lctc_interval_no;          // 0x05:0x0E 8bit
+    uint8_t reg_ctc_diff_gray;                 // 0x05:0x0F 8bit
+    uint8_t reg_ctc_pxl_vol_coefi_r;           // 0x05:0x10 8bit
+    uint8_t reg_ctc_pxl_vol_coefi_g;           // 0x05:0x11 8bit
+    uint8_t reg_ctc_pxl_vol_coefi_b;           // 0x05:0x12 8bit
+    uint8_t reg_ctc_line_vol_coefi_r;          // 0x05:0x13 8bit
+    uint8_t reg_ctc_line_vol_coefi_g0;         // 0x05:0x14 8bit
+    uint8_t reg_ctc_line_vol_coefi_b;          // 0x05:0x15 8bit
+    uint8_t reg_ctc_line_vol_coefi_g1;         // 0x05:0x16 8bit
+    uint8_t reg_ctc_gamma_gray_idx_x1;         // 0x05:0x17 8bit
+    uint8_t reg_ctc_gamma_gray_idx_x2;         // 0x05:0x18 8bit
+    uint8_t reg_ctc_gamma_gray_idx_x3;         // 0x05:0x19 8bit
+    uint8_t reg_ctc_gamma_gray_idx_x4;         // 0x05:0x1A 8bit
+    uint8_t reg_ctc_gamma_gray_idx_x5;         // 0x05:0x1B 8bit
+    uint8_t reg_ctc_gamma_gray_idx_x6;         // 0x05:0x1C 8bit
+    uint8_t reg_ctc_gamma_gray_idx_x7;         // 0x05:0x1D 8bit
+    uint8_t reg_ctc_nor_vol_r_y1;              // 0x05:0x1E 8bit
+    uint8_t reg_ctc_nor_vol_r_y2;              // 0x05:0x1F 8bit
+    uint8_t reg_ctc_nor_vol_r_y3;              // 0x05:0x20 8bit
+    uint8_t reg_ctc_nor_vol_r_y4;              // 0x05:0x21 8bit
+    uint8_t reg_ctc_nor_vol_r_y5;              // 0x05:0x22 8bit
+    uint8_t reg_ctc_nor_vol_r_y6;              // 0x05:0x23 8bit
+    uint8_t reg_ctc_nor_vol_r_y7;              // 0x05:0x24 8bit
+    uint8_t reg_ctc_nor_vol_r_y8;              // 0x05:0x25 8bit
+    uint8_t reg_ctc_nor_vol_g_y1;              // 0x05:0x26 8bit
+    uint8_t reg_ctc_nor_vol_g_y2;              // 0x05:0x27 8bit
+    uint8_t reg_ctc_nor_vol_g_y3;              // 0x05:0x28 8bit
+    uint8_t reg_ctc_nor_vol_g_y4;              // 0x05:0x29 8bit
+    uint8_t reg_ctc_nor_vol_g_y5;              // 0x05:0x2A 8bit
+    uint8_t reg_ctc_nor_vol_g_y6;              // 0x05:0x2B 8bit
+    uint8_t reg_ctc_nor_vol_g_y7;              // 0x05:0x2C 8bit
+    uint8_t reg_ctc_nor_vol_g_y8;              // 0x05:0x2D 8bit
+    uint8_t reg_ctc_nor_vol_b_y1;              // 0x05:0x2E 8bit
+    uint8_t reg_ctc_nor_vol_b_y2;              // 0x05:0x2F 8bit
+    uint8_t reg_ctc_nor_vol_b_y3;              // 0x05:0x30 8bit
+    uint8_t reg_ctc_nor_vol_b_y4;              // 0x05:0x31 8bit
+    uint8_t reg_ctc_nor_vol_b_y5;              // 0x05:0x32 8bit
+    uint8_t reg_ctc_nor_vol_b_y6;              // 0x05:0x33 8bit
+    uint8_t reg_ctc_nor_vol_b_y7;              // 0x05:0x34 8bit
+    uint8_t reg_ctc_nor_vol_b_y8;              // 0x05:0x35 8bit
+    uint8_t reg_ctc_pxl_gray_x0;               // 0x05:0x36 8bit
+    uint8_t reg_ctc_pxl_gray_x1;               // 0x05:0x37 8bit
+    uint8_t reg_ctc_pxl_gray_x2;               // 0x05:0x38 8bit
+    uint8_t reg_ctc_del_vol_idx_actb_y0;       // 0x05:0x39 8bit
+    uint8_t reg_ctc_del_vol_idx_actb_y1;       // 0x05:0x3A 8bit
+    uint8_t reg_ctc_del_vol_idx_actb_y2;       // 0x05:0x3B 8bit
+    uint8_t reg_ctc_del_vol_idx_actb_y3;       // 0x05:0x3C 8bit
+    uint8_t reg_ctc_del_vol_idx_actb_y4;       // 0x05:0x3D 8bit
+    uint8_t reg_ctc_del_vol_idx_actb_y5;       // 0x05:0x3E 8bit
+    uint8_t reg_ctc_del_vol_idx_lctb_y0;       // 0x05:0x3F 8bit
+    uint8_t reg_ctc_del_vol_idx_lctb_y1;       // 0x05:0x40 8bit
+    uint8_t reg_ctc_del_vol_idx_lctb_y2;       // 0x05:0x41 8bit
+    uint8_t reg_ctc_del_vol_idx_lctb_y3;       // 0x05:0x42 8bit
+    uint8_t reg_ctc_del_vol_idx_lctb_y4;       // 0x05:0x43 8bit
+    uint8_t reg_ctc_del_vol_idx_lctb_y5;       // 0x05:0x44 8bit
+    uint8_t reg_ctc_actc_lut_nega_00;          // 0x05:0x45 8bit
+    uint8_t reg_ctc_actc_lut_nega_01;          // 0x05:0x46 8bit
+    uint8_t reg_ctc_actc_lut_nega_02;          // 0x05:0x47 8bit
+    uint8_t reg_ctc_actc_lut_nega_03;          // 0x05:0x48 8bit
+    uint8_t reg_ctc_actc_lut_nega_10;          // 0x05:0x49 8bit
+    uint8_t reg_ctc_actc_lut_nega_11;          // 0x05:0x4A 8bit
+    uint8_t reg_ctc_actc_lut_nega_12;          // 0x05:0x4B 8bit
+    uint8_t reg_ctc_actc_lut_nega_13;          // 0x05:0x4C 8bit
+    uint8_t reg_ctc_actc_lut_nega_20;          // 0x05:0x4D 8bit
+    uint8_t reg_ctc_actc_lut_nega_21;          // 0x05:0x4E 8bit
+    uint8_t reg_ctc_actc_lut_nega_22;          // 0x05:0x4F 8bit
+    uint8_t reg_ctc_actc_lut_nega_23;          // 0x05:0x50 8bit
+    uint8_t reg_ctc_actc_lut_nega_30;          // 0x05:0x51 8bit
+    uint8_t reg_ctc_actc_lut_nega_31;          // 0x05:0x52 8bit
+    uint8_t reg_ctc_actc_lut_nega_32;          // 0x05:0x53 8bit
+    uint8_t reg_ctc_actc_lut_nega_33;          // 0x05:0x54 8bit
+    uint8_t reg_ctc_actc_lut_nega_40;          // 0x05:0x55 8bit
+    uint8_t reg_ctc_actc_lut_nega_41;          // 0x05:0x56 8bit
+    uint8_t reg_ctc_actc_lut_nega_42;          // 0x05:0x57 8bit
+    uint8_t reg_ctc_actc_lut_nega_43;          // 0x05:0x58 8bit
+    uint8_t reg_ctc_actc_lut_nega_50;          // 0x05:0x59 8bit
+    uint8_t reg_ctc_actc_lut_nega_51;          // 0x05:0x5A 8bit
+    uint8_t reg_ctc_actc_lut_nega_52;          // 0x05:0x5B 8bit
+    uint8_t reg_ctc_actc_lut_nega_53;          // 0x05:0x5C 8bit
+    uint8_t reg_ctc_actc_lut_posi_00;          // 0x05:0x5D 8bit
+    uint8_t reg_ctc_actc_lut_posi_01;          // 0x05:0x5E 8bit
+    uint8_t reg_ctc_actc_lut_posi_02;          // 0x05:0x5F 8bit
+    uint8_t reg_ctc_actc_lut_posi_03;          // 0x05:0x60 8bit
+    uint8_t reg_ctc_actc_lut_posi_10;          // 0x05:0x61 8bit
+    uint8_t reg_ctc_actc_lut_posi_11;          // 0x05:0x62 8bit
+    uint8_t reg_ctc_actc_lut_posi_12;          // 0x05:0x63 8bit
+    uint8_t reg_ctc_actc_lut_posi_13;          // 0x05:0x64 8bit
+    uint8_t reg_ctc_actc_lut_posi_20;          // 0x05:0x65 8bit
+    uint8_t reg_ctc_actc_lut_posi_21;          // 0x05:0x66 8bit
+    uint8_t reg_ctc_actc_lut_posi_22;          // 0x05:0x67 8bit
+    uint8_t reg_ctc_actc_lut_posi_23;          // 0x05:0x68 8bit
+    uint8_t reg_ctc_actc_lut_posi_30;          // 0x05:0x69 8bit
+    uint8_t reg_ctc_actc_lut_posi_31;          // 0x05:0x6A 8bit
+    uint8_t reg_ctc_actc_lut_posi_32;          // 0x05:0x6B 8bit
+    uint8_t reg_ctc_actc_lut_posi_33;          // 0x05:0x6C 8bit
+    uint8_t reg_ctc_actc_lut_posi_40;          // 0x05:0x6D 8bit
+    uint8_t reg_ctc_actc_lut_posi_41;          // 0x05:0x6E 8bit
+    uint8_t reg_ctc_actc_lut_posi_42;          // 0x05:0x6F 8bit
+    uint8_t reg_ctc_actc_lut_posi_43;          // 0x05:0x70 8bit
+    uint8_t reg_ctc_actc_lut_posi_50;          // 0x05:0x71 8bit
+    uint8_t reg_ctc_actc_lut_posi_51;          // 0x05:0x72 8bit
+    uint8_t reg_ctc_actc_lut_posi_52;          // 0x05:0x73 8bit
+    uint8_t reg_ctc_actc_lut_posi_53;          // 0x05:0x74 8bit
+    uint8_t reg_ctc_lctc_lut_nega_00;          // 0x05:0x75 8bit
+    uint8_t reg_ctc_lctc_lut_nega_01;          // 0x05:0x76 8bit
+    uint8_t reg_ctc_lctc_lut_nega_02;          // 0x05:0x77 8bit
+    uint8_t reg_ctc_lctc_lut_nega_03;          // 0x05:0x78 8bit
+    uint8_t reg_ctc_lctc_lut_nega_10;          // 0x05:0x79 8bit
+    uint8_t reg_ctc_lctc_lut_nega_11;          // 0x05:0x7A 8bit
+    uint8_t reg_ctc_lctc_lut_nega_12;          // 0x05:0x7B 8bit
+    uint8_t reg_ctc_lctc_lut_nega_13;          // 0x05:0x7C 8bit
+    uint8_t reg_ctc_lctc_lut_nega_20;          // 0x05:0x7D 8bit
+    uint8_t reg_ctc_lctc_lut_nega_21;          // 0x05:0x7E 8bit
+    uint8_t reg_ctc_lctc_lut_nega_22;          // 0x05:0x7F 8bit
+    uint8_t reg_ctc_lctc_lut_nega_23;          // 0x05:0x80 8bit
+    uint8_t reg_ctc_lctc_lut_nega_30;          // 0x05:0x81 8bit
+    uint8_t reg_ctc_lctc_lut_nega_31;          // 0x05:0x82 8bit
+    uint8_t reg_ctc_lctc_lut_nega_32;          // 0x05:0x83 8bit
+    uint8_t reg_ctc_lctc_lut_nega_33;          // 0x05:0x84 8bit
+    uint8_t reg_ctc_lctc_lut_nega_40;          // 0x05:0x85 8bit
+    uint8_t reg_ctc_lctc_lut_nega_41;          // 0x05:0x86 8bit
+    uint8_t reg_ctc_lctc_lut_nega_42;          // 0x05:0x87 8bit
+    uint8_t reg_ctc_lctc_lut_nega_43;          // 0x05:0x88 8bit
+    uint8_t reg_ctc_lctc_lut_nega_50;          // 0x05:0x89 8bit
+    uint8_t reg_ctc_lctc_lut_nega_51;          // 0x05:0x8A 8bit
+    uint8_t reg_ctc_lctc_lut_nega_52;          // 0x05:0x8B 8bit
+    uint8_t reg_ctc_lctc_lut_nega_53;          // 0x05:0x8C 8bit
+    uint8_t reg_ctc_lctc_lut_posi_00;          // 0x05:0x8D 8bit
+    uint8_t reg_ctc_lctc_lut_posi_01;          // 0x05:0x8E 8bit
+    uint8_t reg_ctc_lctc_lut_posi_02;          // 0x05:0x8F 8bit
+    uint8_t reg_ctc_lctc_lut_posi_03;          // 0x05:0x90 8bit
+    uint8_t reg_ctc_lctc_lut_posi_10;          // 0x05:0x91 8bit
+    uint8_t reg_ctc_lctc_lut_posi_11;          // 0x05:0x92 8bit
+    uint8_t reg_ctc_lctc_lut_posi_12;          // 0x05:0x93 8bit
+    uint8_t reg_ctc_lctc_lut_posi_13;          // 0x05:0x94 8bit
+    uint8_t reg_ctc_lctc_lut_posi_20;          // 0x05:0x95 8bit
+    uint8_t reg_ctc_lctc_lut_posi_21;          // 0x05:0x96 8bit
+    uint8_t reg_ctc_lctc_lut_posi_22;          // 0x05:0x97 8bit
+    uint8_t reg_ctc_lctc_lut_posi_23;          // 0x05:0x98 8bit
+    uint8_t reg_ctc_lctc_lut_posi_30;          // 0x05:0x99 8bit
+    uint8_t reg_ctc_lctc_lut_posi_31;          // 0x05:0x9A 8bit
+    uint8_t reg_ctc_lctc_lut_posi_32;          // 0x05:0x9B 8bit
+    uint8_t reg_ctc_lctc_lut_posi_33;          // 0x05:0x9C 8bit
+    uint8_t reg_ctc_lctc_lut_posi_40;          // 0x05:0x9D 8bit
+    uint8_t reg_ctc_lctc_lut_posi_41;          // 0x05:0x9E 8bit
+    uint8_t reg_ctc_lctc_lut_posi_42;          // 0x05:0x9F 8bit
+    uint8_t reg_ctc_lctc_lut_posi_43;          // 0x05:0xA0 8bit
+    uint8_t reg_ctc_lctc_lut_posi_50;          // 0x05:0xA1 8bit
+    uint8_t reg_ctc_lctc_lut_posi_51;          // 0x05:0xA2 8bit
+    uint8_t reg_ctc_lctc_lut_posi_52;          // 0x05:0xA3 8bit
+    uint8_t reg_ctc_lctc_lut_posi_53;          // 0x05:0xA4 8bit
+    uint8_t reg_ctc_line_r_nega_gain0;         // 0x05:0xA5 8bit
+    uint8_t reg_ctc_line_r_nega_gain1;         // 0x05:0xA6 8bit
+    uint8_t reg_ctc_line_r_nega_gain2;         // 0x05:0xA7 8bit
+    uint8_t reg_ctc_line_r_nega_gain3;         // 0x05:0xA8 8bit
+    uint8_t reg_ctc_line_r_nega_gain4;         // 0x05:0xA9 8bit
+    uint8_t reg_ctc_line_r_nega_gain5;         // 0x05:0xAA 8bit
+    uint8_t reg_ctc_line_g_nega_gain0;         // 0x05:0xAB 8bit
+    uint8_t reg_ctc_line_g_nega_gain1;         // 0x05:0xAC 8bit
+    uint8_t reg_ctc_line_g_nega_gain2;         // 0x05:0xAD 8bit
+    uint8_t reg_ctc_line_g_nega_gain3;         // 0x05:0xAE 8bit
+    uint8_t reg_ctc_line_g_nega_gain4;         // 0x05:0xAF 8bit
+    uint8_t reg_ctc_line_g_nega_gain5;         // 0x05:0xB0 8bit
+    uint8_t reg_ctc_line_b_nega_gain0;         // 0x05:0xB1 8bit
+    uint8_t reg_ctc_line_b_nega_gain1;         // 0x05:0xB2 8bit
+    uint8_t reg_ctc_line_b_nega_gain2;         // 0x05:0xB3 8bit
+    uint8_t reg_ctc_line_b_nega_gain3;         // 0x05:0xB4 8bit
+    uint8_t reg_ctc_line_b_nega_gain4;         // 0x05:0xB5 8bit
+    uint8_t reg_ctc_line_b_nega_gain5;         // 0x05:0xB6 8bit
+    uint8_t reg_ctc_line_r_posi_gain0;         // 0x05:0xB7 8bit
+    uint8_t reg_ctc_line_r_posi_gain1;         // 0x05:0xB8 8bit
+    uint8_t reg_ctc_line_r_posi_gain2;         // 0x05:0xB9 8bit
+    uint8_t reg_ctc_line_r_posi_gain3;         // 0x05:0xBA 8bit
+    uint8_t reg_ctc_line_r_posi_gain4;         // 0x05:0xBB 8bit
+    uint8_t reg_ctc_line_r_posi_gain5;         // 0x05:0xBC 8bit
+    uint8_t reg_ctc_line_g_posi_gain0;         // 0x05:0xBD 8bit
+    uint8_t reg_ctc_line_g_posi_gain1;         // 0x05:0xBE 8bit
+    uint8_t reg_ctc_line_g_posi_gain2;         // 0x05:0xBF 8bit
+    uint8_t reg_ctc_line_g_posi_gain3;         // 0x05:0xC0 8bit
+    uint8_t reg_ctc_line_g_posi_gain4;         // 0x05:0xC1 8bit
+    uint8_t reg_ctc_line_g_posi_gain5;         // 0x05:0xC2 8bit
+    uint8_t reg_ctc_line_b_posi_gain0;         // 0x05:0xC3 8bit
+    uint8_t reg_ctc_line_b_posi_gain1;         // 0x05:0xC4 8bit
+    uint8_t reg_ctc_line_b_posi_gain2;         // 0x05:0xC5 8bit
+    uint8_t reg_ctc_line_b_posi_gain3;         // 0x05:0xC6 8bit
+    uint8_t reg_ctc_line_b_posi_gain4;         // 0x05:0xC7 8bit
+    uint8_t reg_ctc_line_b_posi_gain5;         // 0x05:0xC8 8bit
+    uint8_t reg_ctc_dbv_node_x0;               // 0x05:0xC9 8bit
+    uint8_t reg_ctc_dbv_node_x1;               // 0x05:0xCA 8bit
+    uint8_t reg_ctc_dbv_node_x2;               // 0x05:0xCB 8bit
+    uint8_t reg_ctc_dbv_node_x3;               // 0x05:0xCC 8bit
+    uint8_t reg_ctc_dbv_gain_y0;               // 0x05:0xCD 8bit
+    uint8_t reg_ctc_dbv_gain_y1;               // 0x05:0xCE 8bit
+    uint8_t reg_ctc_dbv_gain_y2;               // 0x05:0xCF 8bit
+    uint8_t reg_ctc_dbv_gain_y3;               // 0x05:0xD0 8bit
+    uint8_t reg_ctc_dbv_gain_y4;               // 0x05:0xD1 8bit
+    uint8_t reg_ctc_freq_gain0;                // 0x05:0xD2 8bit
+    uint8_t reg_ctc_freq_gain1;                // 0x05:0xD3 8bit
+    uint8_t reg_ctc_freq_gain2;                // 0x05:0xD4 8bit
+    uint8_t reg_ctc_freq_gain3;                // 0x05:0xD5 8bit
+    uint8_t reg_ctc_freq_gain4;                // 0x05:0xD6 8bit
+} RegFile_t;
+
+extern RegFile_t regfile;
+
+#endif // REGFILE_H
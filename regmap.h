@@ -0,0 +1,225 @@
+// ==========================================
+// AUTO-GENERATED FILE by gen_registers.py
+// DO NOT EDIT THIS FILE DIRECTLY.
+// ==========================================
+#ifndef _REGMAP_H_
+#define _REGMAP_H_
+
+#include "config.h"
+
+#define reg_ctc_lctc_en                    regfile.reg_ctc_lctc_en  // LCTC On/ Off ctrl
+#define reg_ctc_actc_en                    regfile.reg_ctc_actc_en  // ACTC On/ Off ctrl
+#define reg_ctc_color_mode                 regfile.reg_ctc_color_mode
+#define reg_ctc_dbv_gain_en                regfile.reg_ctc_dbv_gain_en
+#define reg_ctc_frq_gain_en                regfile.reg_ctc_frq_gain_en
+#define reg_ctc_lctc_off_mask0             regfile.reg_ctc_lctc_off_mask0
+#define reg_ctc_lctc_off_mask1             regfile.reg_ctc_lctc_off_mask1
+#define reg_ctc_th_gray                    regfile.reg_ctc_th_gray
+#define reg_ctc_th_delta_line_avg          regfile.reg_ctc_th_delta_line_avg
+#define reg_ctc_th_sat                     regfile.reg_ctc_th_sat
+#define reg_ctc_lut_end_itp                regfile.reg_ctc_lut_end_itp
+#define reg_ctc_delt_pxlv_mode             regfile.reg_ctc_delt_pxlv_mode
+#define reg_ctc_delt_linev_mode            regfile.reg_ctc_delt_linev_mode
+#define reg_ctc_lctc_interval_no           regfile.reg_ctc_lctc_interval_no
+#define reg_ctc_diff_gray                  regfile.reg_ctc_diff_gray
+#define reg_ctc_pxl_vol_coefi_r            regfile.reg_ctc_pxl_vol_coefi_r
+#define reg_ctc_pxl_vol_coefi_g            regfile.reg_ctc_pxl_vol_coefi_g
+#define reg_ctc_pxl_vol_coefi_b            regfile.reg_ctc_pxl_vol_coefi_b
+#define reg_ctc_line_vol_coefi_r           regfile.reg_ctc_line_vol_coefi_r
+#define reg_ctc_line_vol_coefi_g0          regfile.reg_ctc_line_vol_coefi_g0
+#define reg_ctc_line_vol_coefi_b           regfile.reg_ctc_line_vol_coefi_b
+#define reg_ctc_line_vol_coefi_g1          regfile.reg_ctc_line_vol_coefi_g1
+#define reg_ctc_gamma_gray_idx_x1          regfile.reg_ctc_gamma_gray_idx_x1
+#define reg_ctc_gamma_gray_idx_x2          regfile.reg_ctc_gamma_gray_idx_x2
+#define reg_ctc_gamma_gray_idx_x3          regfile.reg_ctc_gamma_gray_idx_x3
+#define reg_ctc_gamma_gray_idx_x4          regfile.reg_ctc_gamma_gray_idx_x4
+#define reg_ctc_gamma_gray_idx_x5          regfile.reg_ctc_gamma_gray_idx_x5
+#define reg_ctc_gamma_gray_idx_x6          regfile.reg_ctc_gamma_gray_idx_x6
+#define reg_ctc_gamma_gray_idx_x7          regfile.reg_ctc_gamma_gray_idx_x7
+#define reg_ctc_nor_vol_r_y1               regfile.reg_ctc_nor_vol_r_y1
+#define reg_ctc_nor_vol_r_y2               regfile.reg_ctc_nor_vol_r_y2
+#define reg_ctc_nor_vol_r_y3               regfile.reg_ctc_nor_vol_r_y3
+#define reg_ctc_nor_vol_r_y4               regfile.reg_ctc_nor_vol_r_y4
+#define reg_ctc_nor_vol_r_y5               regfile.reg_ctc_nor_vol_r_y5
+#define reg_ctc_nor_vol_r_y6               regfile.reg_ctc_nor_vol_r_y6
+#define reg_ctc_nor_vol_r_y7               regfile.reg_ctc_nor_vol_r_y7
+#define reg_ctc_nor_vol_r_y8               regfile.reg_ctc_nor_vol_r_y8
+#define reg_ctc_nor_vol_g_y1               regfile.reg_ctc_nor_vol_g_y1
+#define reg_ctc_nor_vol_g_y2               regfile.reg_ctc_nor_vol_g_y2
+#define reg_ctc_nor_vol_g_y3               regfile.reg_ctc_nor_vol_g_y3
+#define reg_ctc_nor_vol_g_y4               regfile.reg_ctc_nor_vol_g_y4
+#define reg_ctc_nor_vol_g_y5               regfile.reg_ctc_nor_vol_g_y5
+#define reg_ctc_nor_vol_g_y6               regfile.reg_ctc_nor_vol_g_y6
+#define reg_ctc_nor_vol_g_y7               regfile.reg_ctc_nor_vol_g_y7
+#define reg_ctc_nor_vol_g_y8               regfile.reg_ctc_nor_vol_g_y8
+#define reg_ctc_nor_vol_b_y1               regfile.reg_ctc_nor_vol_b_y1
+#define reg_ctc_nor_vol_b_y2               regfile.reg_ctc_nor_vol_b_y2
+#define reg_ctc_nor_vol_b_y3               regfile.reg_ctc_nor_vol_b_y3
+#define reg_ctc_nor_vol_b_y4               regfile.reg_ctc_nor_vol_b_y4
+#define reg_ctc_nor_vol_b_y5               regfile.reg_ctc_nor_vol_b_y5
+#define reg_ctc_nor_vol_b_y6               regfile.reg_ctc_nor_vol_b_y6
+#define reg_ctc_nor_vol_b_y7               regfile.reg_ctc_nor_vol_b_y7
+#define reg_ctc_nor_vol_b_y8               regfile.reg_ctc_nor_vol_b_y8
+#define reg_ctc_pxl_gray_x0                regfile.reg_ctc_pxl_gray_x0
+#define reg_ctc_pxl_gray_x1                regfile.reg_ctc_pxl_gray_x1
+#define reg_ctc_pxl_gray_x2                regfile.reg_ctc_pxl_gray_x2
+#define reg_ctc_del_vol_idx_actb_y0        regfile.reg_ctc_del_vol_idx_actb_y0
+#define reg_ctc_del_vol_idx_actb_y1        regfile.reg_ctc_del_vol_idx_actb_y1
+#define reg_ctc_del_vol_idx_actb_y2        regfile.reg_ctc_del_vol_idx_actb_y2
+#define reg_ctc_del_vol_idx_actb_y3        regfile.reg_ctc_del_vol_idx_actb_y3
+#define reg_ctc_del_vol_idx_actb_y4        regfile.reg_ctc_del_vol_idx_actb_y4
+#define reg_ctc_del_vol_idx_actb_y5        regfile.reg_ctc_del_vol_idx_actb_y5
+#define reg_ctc_del_vol_idx_lctb_y0        regfile.reg_ctc_del_vol_idx_lctb_y0
+#define reg_ctc_del_vol_idx_lctb_y1        regfile.reg_ctc_del_vol_idx_lctb_y1
+#define reg_ctc_del_vol_idx_lctb_y2        regfile.reg_ctc_del_vol_idx_lctb_y2
+#define reg_ctc_del_vol_idx_lctb_y3        regfile.reg_ctc_del_vol_idx_lctb_y3
+#define reg_ctc_del_vol_idx_lctb_y4        regfile.reg_ctc_del_vol_idx_lctb_y4
+#define reg_ctc_del_vol_idx_lctb_y5        regfile.reg_ctc_del_vol_idx_lctb_y5
+#define reg_ctc_actc_lut_nega_00           regfile.reg_ctc_actc_lut_nega_00
+#define reg_ctc_actc_lut_nega_01           regfile.reg_ctc_actc_lut_nega_01
+#define reg_ctc_actc_lut_nega_02           regfile.reg_ctc_actc_lut_nega_02
+#define reg_ctc_actc_lut_nega_03           regfile.reg_ctc_actc_lut_nega_03
+#define reg_ctc_actc_lut_nega_10           regfile.reg_ctc_actc_lut_nega_10
+#define reg_ctc_actc_lut_nega_11           regfile.reg_ctc_actc_lut_nega_11
+#define reg_ctc_actc_lut_nega_12           regfile.reg_ctc_actc_lut_nega_12
+#define reg_ctc_actc_lut_nega_13           regfile.reg_ctc_actc_lut_nega_13
+#define reg_ctc_actc_lut_nega_20           regfile.reg_ctc_actc_lut_nega_20
+#define reg_ctc_actc_lut_nega_21           regfile.reg_ctc_actc_lut_nega_21
+#define reg_ctc_actc_lut_nega_22           regfile.reg_ctc_actc_lut_nega_22
+#define reg_ctc_actc_lut_nega_23           regfile.reg_ctc_actc_lut_nega_23
+#define reg_ctc_actc_lut_nega_30           regfile.reg_ctc_actc_lut_nega_30
+#define reg_ctc_actc_lut_nega_31           regfile.reg_ctc_actc_lut_nega_31
+#define reg_ctc_actc_lut_nega_32           regfile.reg_ctc_actc_lut_nega_32
+#define reg_ctc_actc_lut_nega_33           regfile.reg_ctc_actc_lut_nega_33
+#define reg_ctc_actc_lut_nega_40           regfile.reg_ctc_actc_lut_nega_40
+#define reg_ctc_actc_lut_nega_41           regfile.reg_ctc_actc_lut_nega_41
+#define reg_ctc_actc_lut_nega_42           regfile.reg_ctc_actc_lut_nega_42
+#define reg_ctc_actc_lut_nega_43           regfile.reg_ctc_actc_lut_nega_43
+#define reg_ctc_actc_lut_nega_50           regfile.reg_ctc_actc_lut_nega_50
+#define reg_ctc_actc_lut_nega_51           regfile.reg_ctc_actc_lut_nega_51
+#define reg_ctc_actc_lut_nega_52           regfile.reg_ctc_actc_lut_nega_52
+#define reg_ctc_actc_lut_nega_53           regfile.reg_ctc_actc_lut_nega_53
+#define reg_ctc_actc_lut_posi_00           regfile.reg_ctc_actc_lut_posi_00
+#define reg_ctc_actc_lut_posi_01           regfile.reg_ctc_actc_lut_posi_01
+#define reg_ctc_actc_lut_posi_02           regfile.reg_ctc_actc_lut_posi_02
+#define reg_ctc_actc_lut_posi_03           regfile.reg_ctc_actc_lut_posi_03
+#define reg_ctc_actc_lut_posi_10           regfile.reg_ctc_actc_lut_posi_10
+#define reg_ctc_actc_lut_posi_11           regfile.reg_ctc_actc_lut_posi_11
+#define reg_ctc_actc_lut_posi_12           regfile.reg_ctc_actc_lut_posi_12
+#define reg_ctc_actc_lut_posi_13           regfile.reg_ctc_actc_lut_posi_13
+#define reg_ctc_actc_lut_posi_20           regfile.reg_ctc_actc_lut_posi_20
+#define reg_ctc_actc_lut_posi_21           regfile.reg_ctc_actc_lut_posi_21
+#define reg_ctc_actc_lut_posi_22           regfile.reg_ctc_actc_lut_posi_22
+#define reg_ctc_actc_lut_posi_23           regfile.reg_ctc_actc_lut_posi_23
+#define reg_ctc_actc_lut_posi_30           regfile.reg_ctc_actc_lut_posi_30
+#define reg_ctc_actc_lut_posi_31           regfile.reg_ctc_actc_lut_posi_31
+#define reg_ctc_actc_lut_posi_32           regfile.reg_ctc_actc_lut_posi_32
+#define reg_ctc_actc_lut_posi_33           regfile.reg_ctc_actc_lut_posi_33
+#define reg_ctc_actc_lut_posi_40           regfile.reg_ctc_actc_lut_posi_40
+#define reg_ctc_actc_lut_posi_41           regfile.reg_ctc_actc_lut_posi_41
+#define reg_ctc_actc_lut_posi_42           regfile.reg_ctc_actc_lut_posi_42
+#define reg_ctc_actc_lut_posi_43           regfile.reg_ctc_actc_lut_posi_43
+#define reg_ctc_actc_lut_posi_50           regfile.reg_ctc_actc_lut_posi_50
+#define reg_ctc_actc_lut_posi_51           regfile.reg_ctc_actc_lut_posi_51
+#define reg_ctc_actc_lut_posi_52           regfile.reg_ctc_actc_lut_posi_52
+#define reg_ctc_actc_lut_posi_53           regfile.reg_ctc_actc_lut_posi_53
+#define reg_ctc_lctc_lut_nega_00           regfile.reg_ctc_lctc_lut_nega_00
+#define reg_ctc_lctc_lut_nega_01           regfile.reg_ctc_lctc_lut_nega_01
+#define reg_ctc_lctc_lut_nega_02           regfile.reg_ctc_lctc_lut_nega_02
+#define reg_ctc_lctc_lut_nega_03           regfile.reg_ctc_lctc_lut_nega_03
+#define reg_ctc_lctc_lut_nega_10           regfile.reg_ctc_lctc_lut_nega_10
+#define reg_ctc_lctc_lut_nega_11           regfile.reg_ctc_lctc_lut_nega_11
+#define reg_ctc_lctc_lut_nega_12           regfile.reg_ctc_lctc_lut_nega_12
+#define reg_ctc_lctc_lut_nega_13           regfile.reg_ctc_lctc_lut_nega_13
+#define reg_ctc_lctc_lut_nega_20           regfile.reg_ctc_lctc_lut_nega_20
+#define reg_ctc_lctc_lut_nega_21           regfile.reg_ctc_lctc_lut_nega_21
+#define reg_ctc_lctc_lut_nega_22           regfile.reg_ctc_lctc_lut_nega_22
+#define reg_ctc_lctc_lut_nega_23           regfile.reg_ctc_lctc_lut_nega_23
+#define reg_ctc_lctc_lut_nega_30           regfile.reg_ctc_lctc_lut_nega_30
+#define reg_ctc_lctc_lut_nega_31           regfile.reg_ctc_lctc_lut_nega_31
+#define reg_ctc_lctc_lut_nega_32           regfile.reg_ctc_lctc_lut_nega_32
+#define reg_ctc_lctc_lut_nega_33           regfile.reg_ctc_lctc_lut_nega_33
+#define reg_ctc_lctc_lut_nega_40           regfile.reg_ctc_lctc_lut_nega_40
+#define reg_ctc_lctc_lut_nega_41           regfile.reg_ctc_lctc_lut_nega_41
+#define reg_ctc_lctc_lut_nega_42           regfile.reg_ctc_lctc_lut_nega_42
+#define reg_ctc_lctc_lut_nega_43           regfile.reg_ctc_lctc_lut_nega_43
+#define reg_ctc_lctc_lut_nega_50           regfile.reg_ctc_lctc_lut_nega_50
+#define reg_ctc_lctc_lut_nega_51           regfile.reg_ctc_lctc_lut_nega_51
+#define reg_ctc_lctc_lut_nega_52           regfile.reg_ctc_lctc_lut_nega_52
+#define reg_ctc_lctc_lut_nega_53           regfile.reg_ctc_lctc_lut_nega_53
+#define reg_ctc_lctc_lut_posi_00           regfile.reg_ctc_lctc_lut_posi_00
+#define reg_ctc_lctc_lut_posi_01           regfile.reg_ctc_lctc_lut_posi_01
+#define reg_ctc_lctc_lut_posi_02           regfile.reg_ctc_lctc_lut_posi_02
+#define reg_ctc_lctc_lut_posi_03           regfile.reg_ctc_lctc_lut_posi_03
+#define reg_ctc_lctc_lut_posi_10           regfile.reg_ctc_lctc_lut_posi_10
+#define reg_ctc_lctc_lut_posi_11           regfile.reg_ctc_lctc_lut_posi_11
+#define reg_ctc_lctc_lut_posi_12           regfile.reg_ctc_lctc_lut_posi_12
+#define reg_ctc_lctc_lut_posi_13           regfile.reg_ctc_lctc_lut_posi_13
+#define reg_ctc_lctc_lut_posi_20           regfile.reg_ctc_lctc_lut_posi_20
+#define reg_ctc_lctc_lut_posi_21           regfile.reg_ctc_lctc_lut_posi_21
+#define reg_ctc_lctc_lut_posi_22           regfile.reg_ctc_lctc_lut_posi_22
+#define reg_ctc_lctc_lut_posi_23           regfile.reg_ctc_lctc_lut_posi_23
+#define reg_ctc_lctc_lut_posi_30           regfile.reg_ctc_lctc_lut_posi_30
+#define reg_ctc_lctc_lut_posi_31           regfile.reg_ctc_lctc_lut_posi_31
+#define reg_ctc_lctc_lut_posi_32           regfile.reg_ctc_lctc_lut_posi_32
+#define reg_ctc_lctc_lut_posi_33           regfile.reg_ctc_lctc_lut_posi_33
+#define reg_ctc_lctc_lut_posi_40           regfile.reg_ctc_lctc_lut_posi_40
+#define reg_ctc_lctc_lut_posi_41           regfile.reg_ctc_lctc_lut_posi_41
+#define reg_ctc_lctc_lut_posi_42           regfile.reg_ctc_lctc_lut_posi_42
+#define reg_ctc_lctc_lut_posi_43           regfile.reg_ctc_lctc_lut_posi_43
+#define reg_ctc_lctc_lut_posi_50           regfile.reg_ctc_lctc_lut_posi_50
+#define reg_ctc_lctc_lut_posi_51           regfile.reg_ctc_lctc_lut_posi_51
+#define reg_ctc_lctc_lut_posi_52           regfile.reg_ctc_lctc_lut_posi_52
+#define reg_ctc_lctc_lut_posi_53           regfile.reg_ctc_lctc_lut_posi_53
+#define reg_ctc_line_r_nega_gain0          regfile.reg_ctc_line_r_nega_gain0
+#define reg_ctc_line_r_nega_gain1          regfile.reg_ctc_line_r_nega_gain1
+#define reg_ctc_line_r_nega_gain2          regfile.reg_ctc_line_r_nega_gain2
+#define reg_ctc_line_r_nega_gain3          regfile.reg_ctc_line_r_nega_gain3
+#define reg_ctc_line_r_nega_gain4          regfile.reg_ctc_line_r_nega_gain4
+#define reg_ctc_line_r_nega_gain5          regfile.reg_ctc_line_r_nega_gain5
+#define reg_ctc_line_g_nega_gain0          regfile.reg_ctc_line_g_nega_gain0
+#define reg_ctc_line_g_nega_gain1          regfile.reg_ctc_line_g_nega_gain1
+#define reg_ctc_line_g_nega_gain2          regfile.reg_ctc_line_g_nega_gain2
+#define reg_ctc_line_g_nega_gain3          regfile.reg_ctc_line_g_nega_gain3
+#define reg_ctc_line_g_nega_gain4          regfile.reg_ctc_line_g_nega_gain4
+#define reg_ctc_line_g_nega_gain5          regfile.reg_ctc_line_g_nega_gain5
+#define reg_ctc_line_b_nega_gain0          regfile.reg_ctc_line_b_nega_gain0
+#define reg_ctc_line_b_nega_gain1          regfile.reg_ctc_line_b_nega_gain1
+#define reg_ctc_line_b_nega_gain2          regfile.reg_ctc_line_b_nega_gain2
+#define reg_ctc_line_b_nega_gain3          regfile.reg_ctc_line_b_nega_gain3
+#define reg_ctc_line_b_nega_gain4          regfile.reg_ctc_line_b_nega_gain4
+#define reg_ctc_line_b_nega_gain5          regfile.reg_ctc_line_b_nega_gain5
+#define reg_ctc_line_r_posi_gain0          regfile.reg_ctc_line_r_posi_gain0
+#define reg_ctc_line_r_posi_gain1          regfile.reg_ctc_line_r_posi_gain1
+#define reg_ctc_line_r_posi_gain2          regfile.reg_ctc_line_r_posi_gain2
+#define reg_ctc_line_r_posi_gain3          regfile.reg_ctc_line_r_posi_gain3
+#define reg_ctc_line_r_posi_gain4          regfile.reg_ctc_line_r_posi_gain4
+#define reg_ctc_line_r_posi_gain5          regfile.reg_ctc_line_r_posi_gain5
+#define reg_ctc_line_g_posi_gain0          regfile.reg_ctc_line_g_posi_gain0
+#define reg_ctc_line_g_posi_gain1          regfile.reg_ctc_line_g_posi_gain1
+#define reg_ctc_line_g_posi_gain2          regfile.reg_ctc_line_g_posi_gain2
+#define reg_ctc_line_g_posi_gain3          regfile.reg_ctc_line_g_posi_gain3
+#define reg_ctc_line_g_posi_gain4          regfile.reg_ctc_line_g_posi_gain4
+#define reg_ctc_line_g_posi_gain5          regfile.reg_ctc_line_g_posi_gain5
+#define reg_ctc_line_b_posi_gain0          regfile.reg_ctc_line_b_posi_gain0
+#define reg_ctc_line_b_posi_gain1          regfile.reg_ctc_line_b_posi_gain1
+#define reg_ctc_line_b_posi_gain2          regfile.reg_ctc_line_b_posi_gain2
+#define reg_ctc_line_b_posi_gain3          regfile.reg_ctc_line_b_posi_gain3
+#define reg_ctc_line_b_posi_gain4          regfile.reg_ctc_line_b_posi_gain4
+#define reg_ctc_line_b_posi_gain5          regfile.reg_ctc_line_b_posi_gain5
+#define reg_ctc_dbv_node_x0                regfile.reg_ctc_dbv_node_x0
+#define reg_ctc_dbv_node_x1                regfile.reg_ctc_dbv_node_x1
+#define reg_ctc_dbv_node_x2                regfile.reg_ctc_dbv_node_x2
+#define reg_ctc_dbv_node_x3                regfile.reg_ctc_dbv_node_x3
+#define reg_ctc_dbv_gain_y0                regfile.reg_ctc_dbv_gain_y0
+#define reg_ctc_dbv_gain_y1                regfile.reg_ctc_dbv_gain_y1
+#define reg_ctc_dbv_gain_y2                regfile.reg_ctc_dbv_gain_y2
+#define reg_ctc_dbv_gain_y3                regfile.reg_ctc_dbv_gain_y3
+#define reg_ctc_dbv_gain_y4                regfile.reg_ctc_dbv_gain_y4
+#define reg_ctc_freq_gain0                 regfile.reg_ctc_freq_gain0
+#define reg_ctc_freq_gain1                 regfile.reg_ctc_freq_gain1
+#define reg_ctc_freq_gain2                 regfile.reg_ctc_freq_gain2
+#define reg_ctc_freq_gain3                 regfile.reg_ctc_freq_gain3
+#define reg_ctc_freq_gain4                 regfile.reg_ctc_freq_gain4
+
+#endif // _REGMAP_H_
@@ -0,0 +1,161 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "config.h"
+#include "regscript.h"
+#include "log.h"
+
+// 앞뒤 공백 제거
+static char *trim(char *s) {
+    while (isspace((unsigned char)*s)) {
+        s++;
+    }
+    char *end = s + strlen(s);
+    while (end > s && isspace((unsigned char)end[-1])) {
+        *--end = '\0';
+    }
+    return s;
+}
+
+// "<프레임>[-<끝>] <이름> = <값>[..<값>]" 한 줄 파싱
+static int parse_line(char *line, RegScriptEntry *entry) {
+    char *eq = strchr(line, '=');
+    if (!eq) {
+        return -1;
+    }
+    *eq = '\0';
+    char *lhs = trim(line);
+    char *rhs = trim(eq + 1);
+
+    char *end;
+    entry->first_frame = (int)strtol(lhs, &end, 10);
+    if (end == lhs || entry->first_frame < 0) {
+        return -1;
+    }
+    entry->last_frame = entry->first_frame;
+    if (*end == '-') {
+        char *range_end = end + 1;
+        entry->last_frame = (int)strtol(range_end, &end, 10);
+        if (end == range_end || entry->last_frame < entry->first_frame) {
+            return -1;
+        }
+    }
+
+    char *name = trim(end);
+    if (*name == '\0' || strlen(name) >= sizeof(entry->name)) {
+        return -1;
+    }
+    strcpy(entry->name, name);
+
+    entry->value0 = (int)strtol(rhs, &end, 0);
+    if (end == rhs) {
+        return -1;
+    }
+    entry->value1 = entry->value0;
+    if (strncmp(end, "..", 2) == 0) {
+        char *value_end = end + 2;
+        entry->value1 = (int)strtol(value_end, &end, 0);
+        if (end == value_end) {
+            return -1;
+        }
+    }
+    return (*trim(end) == '\0') ? 0 : -1;
+}
+
+int regscript_load(RegScript *script, const char *filename) {
+    memset(script, 0, sizeof(*script));
+    FILE *fp = fopen(filename, "r");
+    if (!fp) {
+        log_error("Error: Cannot open register script '%s'.\n", filename);
+        return -1;
+    }
+
+    int capacity = 0;
+    char line[256];
+    int line_num = 0;
+    while (fgets(line, sizeof(line), fp)) {
+        line_num++;
+        char *comment = strchr(line, '#');
+        if (comment) {
+            *comment = '\0';
+        }
+        comment = strstr(line, "//");
+        if (comment) {
+            *comment = '\0';
+        }
+        char *text = trim(line);
+        if (*text == '\0') {
+            continue;
+        }
+
+        RegScriptEntry entry;
+        int current;
+        if (parse_line(text, &entry) != 0) {
+            log_error("Error: %s:%d 형식 오류 (예: '10 por_dbv = 0x200', '0-59 por_dbv = 0..0x3FFF')\n",
+                      filename, line_num);
+            goto fail;
+        }
+        if (reg_read_by_name(entry.name, &current) != 0) {
+            log_error("Error: %s:%d 알 수 없는 레지스터 '%s'\n", filename, line_num, entry.name);
+            goto fail;
+        }
+
+        if (script->count == capacity) {
+            capacity = capacity ? capacity * 2 : 16;
+            RegScriptEntry *grown = (RegScriptEntry *)realloc(script->entries,
+                                                              (size_t)capacity * sizeof(RegScriptEntry));
+            if (!grown) {
+                log_error("레지스터 스크립트 메모리 할당 실패\n");
+                goto fail;
+            }
+            script->entries = grown;
+        }
+        script->entries[script->count++] = entry;
+    }
+    fclose(fp);
+
+    // 시작 프레임 순 정렬 (같은 프레임의 쓰기는 파일 순서를 유지하도록 삽입 정렬)
+    for (int i = 1; i < script->count; i++) {
+        RegScriptEntry key = script->entries[i];
+        int j = i - 1;
+        while (j >= 0 && script->entries[j].first_frame > key.first_frame) {
+            script->entries[j + 1] = script->entries[j];
+            j--;
+        }
+        script->entries[j + 1] = key;
+    }
+    return 0;
+
+fail:
+    fclose(fp);
+    regscript_free(script);
+    return -1;
+}
+
+int regscript_apply(const RegScript *script, int frame) {
+    int applied = 0;
+    for (int i = 0; i < script->count; i++) {
+        const RegScriptEntry *e = &script->entries[i];
+        if (e->first_frame > frame) {
+            break; // 시작 프레임 순 정렬
+        }
+        if (frame > e->last_frame) {
+            continue;
+        }
+        int value = e->value0;
+        int span = e->last_frame - e->first_frame;
+        if (span > 0) {
+            value = e->value0 + (int)((long long)(e->value1 - e->value0) * (frame - e->first_frame) / span);
+        }
+        reg_write_by_name(e->name, value);
+        applied++;
+    }
+    return applied;
+}
+
+void regscript_free(RegScript *script) {
+    free(script->entries);
+    script->entries = NULL;
+    script->count = 0;
+}
@@ -0,0 +1,33 @@
+#ifndef REGSCRIPT_H
+#define REGSCRIPT_H
+
+// 프레임별 레지스터 쓰기 스크립트
+// 한 줄에 하나의 쓰기 (# 또는 // 이후는 주석):
+//   <프레임> <이름> = <값>              해당 프레임에서 한 번 쓰기
+//   <시작>-<끝> <이름> = <값0>..<값1>   구간 동안 프레임마다 선형 램프
+// 이름은 config.txt와 동일 (PORT/REG 이름, por_dbv는 14bit 통합 값)
+
+typedef struct {
+    int first_frame;
+    int last_frame;
+    char name[64];
+    int value0;
+    int value1;
+} RegScriptEntry;
+
+typedef struct {
+    RegScriptEntry *entries;    // 시작 프레임 순으로 정렬
+    int count;
+} RegScript;
+
+// 스크립트 파일 읽기 (알 수 없는 이름은 오류)
+// 반환값: 0 성공, -1 실패
+int regscript_load(RegScript *script, const char *filename);
+
+// frame에 해당하는 쓰기를 레지스터에 적용 (값이 바뀐 레지스터만 테이블 무효화)
+// 반환값: 적용한 쓰기 수
+int regscript_apply(const RegScript *script, int frame);
+
+void regscript_free(RegScript *script);
+
+#endif // REGSCRIPT_H
@@ -0,0 +1,800 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+#include <fcntl.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include "config.h"
+#include "sequence.h"
+#include "ctc_tables.h"
+#include "regscript.h"
+#include "hash.h"
+#include "log.h"
+#include "outq.h"
+#include "perfctr.h"
+
+#ifndef O_BINARY
+#define O_BINARY 0
+#endif
+
+// ============================================================
+// 프레임 입력 스트림
+// ============================================================
+
+static int has_suffix(const char *str, const char *suffix) {
+    size_t len = strlen(str);
+    size_t suffix_len = strlen(suffix);
+    return len >= suffix_len && strcmp(str + len - suffix_len, suffix) == 0;
+}
+
+// 8bit RGB 평면이 준비되어 있지 않으면 할당
+static int ensure_rgb_planes(RGBArray *rgb, int width, int height) {
+    if (rgb->r && rgb->depth == 8 && rgb->width == width && rgb->height == height) {
+        return 0;
+    }
+    free_rgb(rgb);
+    memset(rgb, 0, sizeof(*rgb));
+    size_t pixels = (size_t)width * height;
+    rgb->r = (uint8_t *)malloc(pixels);
+    rgb->g = (uint8_t *)malloc(pixels);
+    rgb->b = (uint8_t *)malloc(pixels);
+    if (!rgb->r || !rgb->g || !rgb->b) {
+        log_error("프레임 메모리 할당 실패\n");
+        free_rgb(rgb);
+        return -1;
+    }
+    rgb->width = width;
+    rgb->height = height;
+    rgb->depth = 8;
+    return 0;
+}
+
+// Y4M 스트림 헤더 파싱 ("YUV4MPEG2 W1080 H2392 F60:1 Ip A1:1 C420jpeg")
+static int parse_y4m_header(FrameSource *src) {
+    char line[256];
+    if (!fgets(line, sizeof(line), src->file) || strncmp(line, "YUV4MPEG2 ", 10) != 0) {
+        log_error("Y4M 헤더가 아닙니다\n");
+        return -1;
+    }
+
+    // 기본 크로마 형식은 420jpeg
+    src->chroma_w_shift = 1;
+    src->chroma_h_shift = 1;
+    src->mono = 0;
+
+    char *token = strtok(line + 10, " \n");
+    while (token) {
+        if (token[0] == 'W') {
+            src->width = atoi(token + 1);
+        } else if (token[0] == 'H') {
+            src->height = atoi(token + 1);
+        } else if (token[0] == 'C') {
+            if (strcmp(token, "C444") == 0) {
+                src->chroma_w_shift = 0;
+                src->chroma_h_shift = 0;
+            } else if (strcmp(token, "C422") == 0) {
+                src->chroma_w_shift = 1;
+                src->chroma_h_shift = 0;
+            } else if (strcmp(token, "C420") == 0 || strcmp(token, "C420jpeg") == 0 ||
+                       strcmp(token, "C420paldv") == 0 || strcmp(token, "C420mpeg2") == 0) {
+                src->chroma_w_shift = 1;
+                src->chroma_h_shift = 1;
+            } else if (strcmp(token, "Cmono") == 0) {
+                src->mono = 1;
+            } else {
+                log_error("지원하지 않는 Y4M 크로마 형식: %s (8bit 444/422/420/mono만 지원)\n", token);
+                return -1;
+            }
+        }
+        token = strtok(NULL, " \n");
+    }
+
+    if (src->width <= 0 || src->height <= 0) {
+        log_error("Y4M 헤더에 크기 정보가 없습니다\n");
+        return -1;
+    }
+
+    size_t luma = (size_t)src->width * src->height;
+    size_t chroma_w = ((size_t)src->width + (1u << src->chroma_w_shift) - 1) >> src->chroma_w_shift;
+    size_t chroma_h = ((size_t)src->height + (1u << src->chroma_h_shift) - 1) >> src->chroma_h_shift;
+    src->frame_bytes = luma + (src->mono ? 0 : chroma_w * chroma_h * 2);
+    return 0;
+}
+
+// 0~255 범위로 제한
+static inline uint8_t clamp_u8(int v) {
+    return (uint8_t)(v < 0 ? 0 : (v > 255 ? 255 : v));
+}
+
+// Y4M 프레임(YCbCr BT.601 제한 범위)을 RGB 평면으로 변환
+static void y4m_frame_to_rgb(const FrameSource *src, RGBArray *rgb) {
+    int width = src->width;
+    int height = src->height;
+    size_t chroma_w = ((size_t)width + (1u << src->chroma_w_shift) - 1) >> src->chroma_w_shift;
+    size_t chroma_h = ((size_t)height + (1u << src->chroma_h_shift) - 1) >> src->chroma_h_shift;
+    const uint8_t *y_plane = src->buffer;
+    const uint8_t *cb_plane = y_plane + (size_t)width * height;
+    const uint8_t *cr_plane = cb_plane + chroma_w * chroma_h;
+
+    for (int y = 0; y < height; y++) {
+        const uint8_t *y_row = y_plane + (size_t)y * width;
+        const uint8_t *cb_row = cb_plane + (size_t)(y >> src->chroma_h_shift) * chroma_w;
+        const uint8_t *cr_row = cr_plane + (size_t)(y >> src->chroma_h_shift) * chroma_w;
+        size_t rowOffset = (size_t)y * width;
+        for (int x = 0; x < width; x++) {
+            // 고정소수점 (x256) BT.601 계수
+            int c = 298 * ((int)y_row[x] - 16);
+            int d = src->mono ? 0 : (int)cb_row[x >> src->chroma_w_shift] - 128;
+            int e = src->mono ? 0 : (int)cr_row[x >> src->chroma_w_shift] - 128;
+            rgb->r[rowOffset + x] = clamp_u8((c + 409 * e + 128) >> 8);
+            rgb->g[rowOffset + x] = clamp_u8((c - 100 * d - 208 * e + 128) >> 8);
+            rgb->b[rowOffset + x] = clamp_u8((c + 516 * d + 128) >> 8);
+        }
+    }
+}
+
+// 입력 스트림 열기
+int frame_source_open(FrameSource *src, const char *path, int width, int height) {
+    memset(src, 0, sizeof(*src));
+
+    // 파일명에 '%'가 있으면 번호가 붙은 BMP 시퀀스
+    if (strchr(path, '%')) {
+        src->type = FRAME_SRC_BMP_SEQ;
+        strncpy(src->pattern, path, sizeof(src->pattern) - 1);
+
+        // 시작 번호: 0번 파일이 없으면 1번부터
+        char first[600];
+        snprintf(first, sizeof(first), src->pattern, 0);
+        FILE *probe = fopen(first, "rb");
+        if (probe) {
+            fclose(probe);
+            src->index = 0;
+        } else {
+            src->index = 1;
+        }
+        return 0;
+    }
+
+    src->file = fopen(path, "rb");
+    if (!src->file) {
+        log_error("입력 스트림을 열 수 없습니다: %s\n", path);
+        return -1;
+    }
+
+    if (has_suffix(path, ".y4m")) {
+        src->type = FRAME_SRC_Y4M;
+        if (parse_y4m_header(src) != 0) {
+            frame_source_close(src);
+            return -1;
+        }
+    } else {
+        src->type = FRAME_SRC_RAW_RGB;
+        if (width <= 0 || height <= 0) {
+            log_error("RAW RGB 입력은 --size WxH 지정이 필요합니다\n");
+            frame_source_close(src);
+            return -1;
+        }
+        src->width = width;
+        src->height = height;
+        src->frame_bytes = (size_t)width * height * 3;
+    }
+
+    src->buffer = (uint8_t *)malloc(src->frame_bytes);
+    if (!src->buffer) {
+        log_error("프레임 읽기 버퍼 할당 실패\n");
+        frame_source_close(src);
+        return -1;
+    }
+    return 0;
+}
+
+// 다음 프레임 읽기
+int frame_source_read(FrameSource *src, RGBArray *rgb) {
+    if (src->type == FRAME_SRC_BMP_SEQ) {
+        char path[600];
+        snprintf(path, sizeof(path), src->pattern, src->index);
+        FILE *probe = fopen(path, "rb");
+        if (!probe) {
+            return 1; // 다음 번호 파일이 없으면 시퀀스 끝
+        }
+        fclose(probe);
+
+        free_rgb(rgb);
+        if (read_bmp(path, rgb) != 0) {
+            return -1;
+        }
+        if (src->width == 0) {
+            src->width = rgb->width;
+            src->height = rgb->height;
+        } else if (rgb->width != src->width || rgb->height != src->height) {
+            log_error("프레임 크기가 다릅니다: %s (%d x %d, 예상 %d x %d)\n",
+                      path, rgb->width, rgb->height, src->width, src->height);
+            return -1;
+        }
+        src->index++;
+        return 0;
+    }
+
+    if (src->type == FRAME_SRC_Y4M) {
+        char frame_header[256];
+        if (!fgets(frame_header, sizeof(frame_header), src->file)) {
+            return 1;
+        }
+        if (strncmp(frame_header, "FRAME", 5) != 0) {
+            log_error("Y4M FRAME 헤더 오류 (프레임 %d)\n", src->index);
+            return -1;
+        }
+    }
+
+    size_t bytesRead = fread(src->buffer, 1, src->frame_bytes, src->file);
+    if (bytesRead == 0 && src->type == FRAME_SRC_RAW_RGB) {
+        return 1;
+    }
+    if (bytesRead != src->frame_bytes) {
+        log_error("프레임 데이터가 잘렸습니다 (프레임 %d)\n", src->index);
+        return -1;
+    }
+
+    if (ensure_rgb_planes(rgb, src->width, src->height) != 0) {
+        return -1;
+    }
+
+    if (src->type == FRAME_SRC_Y4M) {
+        y4m_frame_to_rgb(src, rgb);
+    } else {
+        // RGB24 인터리브 -> 평면
+        deinterleave_rgb24_row(src->buffer, rgb->r, rgb->g, rgb->b, (size_t)src->width * src->height);
+    }
+    src->index++;
+    return 0;
+}
+
+// 입력 스트림 닫기
+void frame_source_close(FrameSource *src) {
+    if (src->file) {
+        fclose(src->file);
+        src->file = NULL;
+    }
+    free(src->buffer);
+    src->buffer = NULL;
+}
+
+// ============================================================
+// 읽기 / 변환 / 쓰기 파이프라인
+// ============================================================
+// 슬롯 상태: EMPTY -> (읽기 스레드) -> LOADED -> (변환 스레드) -> DONE -> (쓰기) -> EMPTY
+// 프레임 i는 슬롯 i % slot_count를 사용하므로 단계 간 순서가 유지됨
+// 슬롯이 2~3개이면 세 단계가 서로 다른 프레임을 동시에 처리하여
+// 처리량이 단계 시간의 합이 아닌 가장 느린 단계 시간으로 결정됨
+
+enum {
+    SLOT_EMPTY = 0,
+    SLOT_LOADED,
+    SLOT_DONE
+};
+
+typedef struct {
+    RGBArray rgb;
+    RGBGArray rgbg;
+    int frame_index;
+    int state;
+    int end;                // 스트림 끝을 알리는 슬롯
+} FrameSlot;
+
+typedef struct {
+    FrameSlot *slots;
+    int slot_count;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    FrameSource src;
+    int out_fd;
+    uint64_t out_offset;    // 다음 프레임 쓰기 위치
+    OutQueue *outq;         // 프레임 쓰기 큐 (쓰기 단계는 인코딩 후 제출만 함)
+    int out_raw;
+    const SequenceOptions *opt;
+    RegScript script;
+    int error;
+    SequenceStats stats;
+
+    // 변경 행 감지 (변환 스레드 전용)
+    uint64_t *row_hash;     // 이전 프레임 입력 행 해시
+    uint64_t *next_hash;    // 현재 프레임 입력 행 해시
+    uint8_t *row_changed;   // 현재 프레임에서 바뀐 입력 행
+    int hash_capacity;
+    int hash_rows;          // row_hash의 유효 행 수 (0 = 이전 프레임 없음)
+    int hash_width;
+    unsigned hash_generation; // 이전 프레임 변환 시 레지스터 세대
+} SequencePipeline;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// 프레임 index의 슬롯이 state가 될 때까지 대기 (오류 시 NULL)
+static FrameSlot *wait_slot(SequencePipeline *p, int index, int state) {
+    FrameSlot *slot = &p->slots[index % p->slot_count];
+    pthread_mutex_lock(&p->lock);
+    while (slot->state != state && !p->error) {
+        pthread_cond_wait(&p->cond, &p->lock);
+    }
+    int error = p->error;
+    pthread_mutex_unlock(&p->lock);
+    return error ? NULL : slot;
+}
+
+static void set_slot_state(SequencePipeline *p, FrameSlot *slot, int state) {
+    pthread_mutex_lock(&p->lock);
+    slot->state = state;
+    pthread_cond_broadcast(&p->cond);
+    pthread_mutex_unlock(&p->lock);
+}
+
+static void fail_pipeline(SequencePipeline *p) {
+    pthread_mutex_lock(&p->lock);
+    p->error = 1;
+    pthread_cond_broadcast(&p->cond);
+    pthread_mutex_unlock(&p->lock);
+}
+
+// 읽기 스레드
+static void *reader_thread(void *arg) {
+    SequencePipeline *p = (SequencePipeline *)arg;
+    for (int i = 0; ; i++) {
+        FrameSlot *slot = wait_slot(p, i, SLOT_EMPTY);
+        if (!slot) {
+            break;
+        }
+
+        double start = now_seconds();
+        int result = 1;
+        if (p->opt->max_frames <= 0 || i < p->opt->max_frames) {
+            PerfScope scope;
+            perf_begin(&scope, PERF_STAGE_READ, i);
+            result = frame_source_read(&p->src, &slot->rgb);
+            perf_end(&scope);
+        }
+        p->stats.read_time += now_seconds() - start;
+
+        if (result < 0) {
+            fail_pipeline(p);
+            break;
+        }
+        slot->frame_index = i;
+        slot->end = (result == 1);
+        set_slot_state(p, slot, SLOT_LOADED);
+        if (slot->end) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+// ============================================================
+// 변경 행 건너뛰기
+// ============================================================
+// 입력 행마다 해시를 계산하여 이전 프레임과 비교하고, 레지스터가 그대로이면
+// 바뀌지 않은 행은 변환하지 않고 이전 프레임 슬롯의 출력 행을 복사함
+// 이전 프레임 슬롯의 RGBG 버퍼는 변환 스레드만 쓰므로 현재 프레임 변환 중에 바뀌지 않음
+
+// 출력 행 y가 읽는 입력 행 반경 (y - SEQ_ROW_CONTEXT ~ y + SEQ_ROW_CONTEXT)
+// 현재 RGBG 변환은 자기 행만 읽으므로 0, 주변 라인을 참조하는 단계가 추가되면 그 창 반경으로 설정
+#define SEQ_ROW_CONTEXT 0
+
+// 입력 행 해시를 계산하고 바뀐 행 표시
+// 반환값: 출력을 재사용할 수 있는 이전 프레임 슬롯 (없으면 NULL)
+static const FrameSlot *hash_input_rows(SequencePipeline *p, int index, const RGBArray *rgb) {
+    int width = rgb->width;
+    int height = rgb->height;
+    if (height > p->hash_capacity) {
+        free(p->row_hash);
+        free(p->next_hash);
+        free(p->row_changed);
+        p->row_hash = (uint64_t *)malloc((size_t)height * sizeof(uint64_t));
+        p->next_hash = (uint64_t *)malloc((size_t)height * sizeof(uint64_t));
+        p->row_changed = (uint8_t *)malloc((size_t)height);
+        p->hash_rows = 0;
+        p->hash_capacity = (p->row_hash && p->next_hash && p->row_changed) ? height : 0;
+        if (!p->hash_capacity) {
+            return NULL; // 메모리 부족 시 전체 변환
+        }
+    }
+
+    for (int y = 0; y < height; y++) {
+        size_t offset = (size_t)y * width;
+        uint64_t h = hash64(rgb->r + offset, (size_t)width, 0);
+        h = hash64(rgb->g + offset, (size_t)width, h);
+        p->next_hash[y] = hash64(rgb->b + offset, (size_t)width, h);
+    }
+
+    unsigned generation = config_generation();
+    int reusable = index > 0 && p->hash_rows == height && p->hash_width == width &&
+                   p->hash_generation == generation;
+    for (int y = 0; y < height; y++) {
+        p->row_changed[y] = !reusable || p->next_hash[y] != p->row_hash[y];
+    }
+
+    uint64_t *tmp = p->row_hash;
+    p->row_hash = p->next_hash;
+    p->next_hash = tmp;
+    p->hash_rows = height;
+    p->hash_width = width;
+    p->hash_generation = generation;
+    return reusable ? &p->slots[(index - 1) % p->slot_count] : NULL;
+}
+
+// 출력 행 y가 읽는 입력 행 중 바뀐 행이 있는지 확인
+static int row_needs_update(const SequencePipeline *p, int y, int height) {
+    int lo = y - SEQ_ROW_CONTEXT < 0 ? 0 : y - SEQ_ROW_CONTEXT;
+    int hi = y + SEQ_ROW_CONTEXT >= height ? height - 1 : y + SEQ_ROW_CONTEXT;
+    for (int k = lo; k <= hi; k++) {
+        if (p->row_changed[k]) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// 바뀐 행 구간만 변환하고 나머지는 이전 프레임 출력에서 복사
+static int convert_changed_rows(SequencePipeline *p, FrameSlot *slot, const FrameSlot *prev) {
+    RGBGArray *rgbg = &slot->rgbg;
+    const RGBGArray *prev_rgbg = &prev->rgbg;
+    if (prev_rgbg->width != rgbg->width || prev_rgbg->height != rgbg->height ||
+        prev_rgbg->depth != rgbg->depth) {
+        p->stats.rows_converted += rgbg->height;
+        return rgb_to_rgbg_into(&slot->rgb, rgbg);
+    }
+
+    // 슬롯 버퍼의 패턴 정보는 이전 프레임과 같게 맞춤 (레지스터가 그대로인 경우에만 호출됨)
+    rgbg->order = prev_rgbg->order;
+    rgbg->x0 = prev_rgbg->x0;
+    rgbg->y0 = prev_rgbg->y0;
+
+    size_t row_bytes = (size_t)rgbg->width * 2 * (rgbg->depth == 8 ? 1 : sizeof(uint16_t));
+    uint8_t *dst = (rgbg->depth == 8) ? rgbg->data : (uint8_t *)rgbg->data16;
+    const uint8_t *src = (rgbg->depth == 8) ? prev_rgbg->data : (const uint8_t *)prev_rgbg->data16;
+
+    int height = rgbg->height;
+    int y = 0;
+    while (y < height) {
+        // 변환 여부가 같은 연속 행 구간 [y, end)
+        int dirty = row_needs_update(p, y, height);
+        int end = y + 1;
+        while (end < height && row_needs_update(p, end, height) == dirty) {
+            end++;
+        }
+        if (dirty) {
+            if (rgb_to_rgbg_rows(&slot->rgb, rgbg, y, end) != 0) {
+                return -1;
+            }
+            p->stats.rows_converted += end - y;
+        } else {
+            memcpy(dst + (size_t)y * row_bytes, src + (size_t)y * row_bytes, (size_t)(end - y) * row_bytes);
+            p->stats.rows_skipped += end - y;
+        }
+        y = end;
+    }
+    return 0;
+}
+
+// 변환 스레드
+static void *compute_thread(void *arg) {
+    SequencePipeline *p = (SequencePipeline *)arg;
+    for (int i = 0; ; i++) {
+        FrameSlot *slot = wait_slot(p, i, SLOT_LOADED);
+        if (!slot) {
+            break;
+        }
+        if (slot->end) {
+            set_slot_state(p, slot, SLOT_DONE);
+            break;
+        }
+
+        double start = now_seconds();
+        // 프레임 순서대로 레지스터 쓰기 적용 후 영향받은 파생 테이블만 재계산
+        p->stats.reg_writes += regscript_apply(&p->script, i);
+        p->stats.table_rebuilds += ctc_tables_refresh();
+
+        // 행 해시는 8bit 입력 기준 (비트 깊이 변환 전)
+        const FrameSlot *prev = p->opt->skip_rows ? hash_input_rows(p, i, &slot->rgb) : NULL;
+
+        PerfScope scope;
+        perf_begin(&scope, PERF_STAGE_RGBG, i);
+        int result = 0;
+        if (p->opt->depth != 8) {
+            result = rgb_set_depth(&slot->rgb, p->opt->depth);
+        }
+        if (result == 0) {
+            // 슬롯의 RGBG 버퍼는 첫 프레임에서 할당하고 이후 재사용
+            if (slot->rgbg.width != slot->rgb.width || slot->rgbg.height != slot->rgb.height ||
+                slot->rgbg.depth != slot->rgb.depth) {
+                free_rgbg(&slot->rgbg);
+                result = alloc_rgbg(&slot->rgbg, slot->rgb.width, slot->rgb.height, slot->rgb.depth);
+            }
+        }
+        if (result == 0) {
+            if (prev) {
+                result = convert_changed_rows(p, slot, prev);
+            } else {
+                result = rgb_to_rgbg_into(&slot->rgb, &slot->rgbg);
+                p->stats.rows_converted += slot->rgb.height;
+            }
+        }
+        perf_end(&scope);
+        p->stats.compute_time += now_seconds() - start;
+
+        if (result != 0) {
+            fail_pipeline(p);
+            break;
+        }
+        set_slot_state(p, slot, SLOT_DONE);
+    }
+    return NULL;
+}
+
+// 쓰기 단계 (호출한 스레드에서 실행)
+static void run_writer(SequencePipeline *p) {
+    for (int i = 0; ; i++) {
+        FrameSlot *slot = wait_slot(p, i, SLOT_DONE);
+        if (!slot || slot->end) {
+            break;
+        }
+
+        double start = now_seconds();
+        PerfScope scope;
+        perf_begin(&scope, PERF_STAGE_PACK, i);
+        int result = 0;
+        uint8_t *data = NULL;
+        size_t len = 0;
+        if (p->out_raw) {
+            OutputSink sink;
+            sink_init_memory(&sink);
+            result = write_rgbg_raw(&sink, &slot->rgbg, p->opt->out_bits);
+            data = sink.data;
+            len = (size_t)sink.size;
+        } else {
+            // 네이티브 RGBG 샘플 (8bit: 1바이트, 10/12/16bit: uint16_t 호스트 엔디안)
+            // 슬롯은 바로 다음 프레임에 재사용하므로 쓰기 큐에는 복사본을 넘김
+            size_t samples = (size_t)slot->rgbg.width * slot->rgbg.height * 2;
+            len = (slot->rgbg.depth == 8) ? samples : samples * sizeof(uint16_t);
+            data = (uint8_t *)malloc(len);
+            if (data) {
+                memcpy(data, slot->rgbg.depth == 8 ? (void *)slot->rgbg.data : (void *)slot->rgbg.data16, len);
+            } else {
+                result = -1;
+            }
+        }
+        perf_end(&scope);
+        if (result == 0) {
+            result = outq_write_at(p->outq, p->out_fd, p->out_offset, data, len);
+            p->out_offset += len;
+        } else {
+            free(data);
+        }
+        p->stats.write_time += now_seconds() - start;
+
+        if (result != 0) {
+            log_error("프레임 %d 쓰기 실패\n", slot->frame_index);
+            fail_pipeline(p);
+            break;
+        }
+        p->stats.frames++;
+        set_slot_state(p, slot, SLOT_EMPTY);
+        perf_frame_report(i);
+    }
+}
+
+void sequence_default_options(SequenceOptions *opt) {
+    memset(opt, 0, sizeof(*opt));
+    opt->slots = 3;
+    opt->depth = 8;
+    opt->out_bits = 10;
+    opt->skip_rows = 1;
+    opt->out_queue = OUTQ_DEFAULT_DEPTH;
+}
+
+// 시퀀스 처리
+int run_sequence(const char *input, const char *output,
+                 const SequenceOptions *opt, SequenceStats *stats) {
+    SequencePipeline p;
+    memset(&p, 0, sizeof(p));
+    p.opt = opt;
+    p.slot_count = opt->slots < 2 ? 2 : opt->slots;
+
+    if (opt->reg_script && regscript_load(&p.script, opt->reg_script) != 0) {
+        return -1;
+    }
+    ctc_tables_init();
+
+    if (frame_source_open(&p.src, input, opt->width, opt->height) != 0) {
+        regscript_free(&p.script);
+        return -1;
+    }
+
+    p.out_raw = has_suffix(output, ".raw");
+    p.out_fd = open(output, O_WRONLY | O_CREAT | O_TRUNC | O_BINARY, 0644);
+    if (p.out_fd < 0) {
+        log_error("출력 스트림을 생성할 수 없습니다: %s\n", output);
+        frame_source_close(&p.src);
+        regscript_free(&p.script);
+        return -1;
+    }
+    p.outq = opt->out_queue > 0 ? outq_create(opt->out_queue, OUTQ_AUTO) : outq_create(1, OUTQ_SYNC);
+    if (!p.outq) {
+        close(p.out_fd);
+        frame_source_close(&p.src);
+        regscript_free(&p.script);
+        return -1;
+    }
+
+    p.slots = (FrameSlot *)calloc((size_t)p.slot_count, sizeof(FrameSlot));
+    if (!p.slots) {
+        log_error("프레임 슬롯 할당 실패\n");
+        outq_destroy(p.outq);
+        close(p.out_fd);
+        frame_source_close(&p.src);
+        regscript_free(&p.script);
+        return -1;
+    }
+    pthread_mutex_init(&p.lock, NULL);
+    pthread_cond_init(&p.cond, NULL);
+
+    double start = now_seconds();
+    pthread_t reader, compute;
+    int reader_started = pthread_create(&reader, NULL, reader_thread, &p) == 0;
+    int compute_started = reader_started && pthread_create(&compute, NULL, compute_thread, &p) == 0;
+    if (compute_started) {
+        run_writer(&p);
+    } else {
+        // 시작한 스레드는 오류 상태로 깨워서 종료
+        log_error("시퀀스 처리 스레드 생성 실패\n");
+        fail_pipeline(&p);
+    }
+    if (reader_started) {
+        pthread_join(reader, NULL);
+    }
+    if (compute_started) {
+        pthread_join(compute, NULL);
+    }
+    // 큐에 남은 프레임 쓰기 완료 대기 (쓰기 오류도 여기서 확인)
+    if (outq_destroy(p.outq) != 0) {
+        p.error = 1;
+    }
+    p.stats.wall_time = now_seconds() - start;
+
+    for (int i = 0; i < p.slot_count; i++) {
+        free_rgb(&p.slots[i].rgb);
+        free_rgbg(&p.slots[i].rgbg);
+    }
+    free(p.slots);
+    free(p.row_hash);
+    free(p.next_hash);
+    free(p.row_changed);
+    pthread_mutex_destroy(&p.lock);
+    pthread_cond_destroy(&p.cond);
+    if (close(p.out_fd) != 0) {
+        p.error = 1;
+    }
+    frame_source_close(&p.src);
+    regscript_free(&p.script);
+
+    if (stats) {
+        *stats = p.stats;
+    }
+    return p.error ? -1 : 0;
+}
+
+// 처리 결과 출력
+static void print_sequence_stats(const SequenceStats *stats, int slots) {
+    double slowest = stats->read_time;
+    const char *slowest_name = "읽기";
+    if (stats->compute_time > slowest) {
+        slowest = stats->compute_time;
+        slowest_name = "변환";
+    }
+    if (stats->write_time > slowest) {
+        slowest = stats->write_time;
+        slowest_name = "쓰기";
+    }
+
+    log_info("--- 시퀀스 처리 결과 (슬롯 %d개) ---\n", slots);
+    log_info("  프레임 수     : %d\n", stats->frames);
+    log_info("  전체 시간     : %.3f s", stats->wall_time);
+    if (stats->wall_time > 0.0) {
+        log_info(" (%.2f fps)", stats->frames / stats->wall_time);
+    }
+    log_info("\n");
+    log_info("  읽기 누적     : %.3f s\n", stats->read_time);
+    log_info("  변환 누적     : %.3f s\n", stats->compute_time);
+    log_info("  쓰기 누적     : %.3f s\n", stats->write_time);
+    log_info("  단계 합계     : %.3f s (가장 느린 단계: %s %.3f s)\n",
+             stats->read_time + stats->compute_time + stats->write_time,
+             slowest_name, slowest);
+    long long rows = stats->rows_converted + stats->rows_skipped;
+    if (rows > 0) {
+        log_info("  행 재사용     : %lld / %lld (%.1f%%)\n", stats->rows_skipped, rows,
+                 100.0 * (double)stats->rows_skipped / (double)rows);
+    }
+    if (stats->reg_writes > 0) {
+        log_info("  레지스터 쓰기 : %d\n", stats->reg_writes);
+        log_info("  테이블 재계산 : %d (전체 재계산 시 %d)\n", stats->table_rebuilds,
+                 stats->frames * CTC_TABLE_COUNT);
+        for (int id = 0; id < CTC_TABLE_COUNT; id++) {
+            log_info("    %-14s: %u\n", ctc_table_name(id), ctc_table_rebuild_count(id));
+        }
+    }
+}
+
+// --seq <입력> <출력> [--size WxH] [--slots N] [--frames N] [--bits 10|12] [--depth D] [--regs FILE] [--no-skip]
+//       [--out-queue N] [--perf]
+int sequence_main(int argc, char *argv[]) {
+    if (argc < 4) {
+        log_info("사용법: %s --seq <입력> <출력> [옵션]\n", argv[0]);
+        log_info("  입력: RAW RGB 스트림(.rgb, --size 필요), Y4M(.y4m), BMP 시퀀스(예: f_%%04d.bmp)\n");
+        log_info("  출력: .raw = 프레임별 패킹 RAW, 그 외 = 네이티브 RGBG 샘플 스트림\n");
+        log_info("  --size WxH    RAW RGB 입력 크기\n");
+        log_info("  --slots N     프레임 슬롯 수 (2 = 더블 버퍼, 3 = 트리플 버퍼, 기본 3)\n");
+        log_info("  --frames N    처리할 최대 프레임 수\n");
+        log_info("  --bits 10|12  출력 RAW 비트 수 (기본 10)\n");
+        log_info("  --depth D     내부 비트 깊이 (8/10/12/16, 기본 8)\n");
+        log_info("  --regs FILE   프레임별 레지스터 쓰기 스크립트 (예: '0-59 por_dbv = 0..0x3FFF')\n");
+        log_info("  --no-skip     이전 프레임과 같은 행도 모두 다시 변환\n");
+        log_info("  --out-queue N 프레임 비동기 쓰기 큐 깊이 (기본 %d, 0 = 동기 쓰기)\n", OUTQ_DEFAULT_DEPTH);
+        log_info("  --perf        단계별(read rgbg pack) 하드웨어 성능 카운터를 프레임별 / 전체 출력\n");
+        return 1;
+    }
+
+    const char *input = argv[2];
+    const char *output = argv[3];
+    SequenceOptions opt;
+    sequence_default_options(&opt);
+    int use_perf = 0;
+
+    for (int i = 4; i < argc; i++) {
+        if (strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+            if (sscanf(argv[++i], "%dx%d", &opt.width, &opt.height) != 2) {
+                log_error("잘못된 크기: %s (예: 1080x2392)\n", argv[i]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--slots") == 0 && i + 1 < argc) {
+            opt.slots = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            opt.max_frames = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--bits") == 0 && i + 1 < argc) {
+            opt.out_bits = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--depth") == 0 && i + 1 < argc) {
+            opt.depth = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--regs") == 0 && i + 1 < argc) {
+            opt.reg_script = argv[++i];
+        } else if (strcmp(argv[i], "--no-skip") == 0) {
+            opt.skip_rows = 0;
+        } else if (strcmp(argv[i], "--out-queue") == 0 && i + 1 < argc) {
+            opt.out_queue = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--perf") == 0) {
+            use_perf = 1;
+        } else {
+            log_error("알 수 없는 옵션: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    if (use_perf) {
+        perf_enable(PERF_COUNTERS);
+    }
+    log_info("시퀀스 처리: %s -> %s\n", input, output);
+    SequenceStats stats;
+    if (run_sequence(input, output, &opt, &stats) != 0) {
+        log_error("오류: 시퀀스 처리 실패\n");
+        return 1;
+    }
+    print_sequence_stats(&stats, opt.slots < 2 ? 2 : opt.slots);
+    perf_report();
+    return 0;
+}
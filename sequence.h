@@ -0,0 +1,80 @@
+#ifndef SEQUENCE_H
+#define SEQUENCE_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "image_io.h"
+
+// 프레임 입력 형식
+typedef enum {
+    FRAME_SRC_RAW_RGB = 0,  // RGB24 인터리브 프레임이 연속된 스트림 (크기 지정 필요)
+    FRAME_SRC_Y4M,          // YUV4MPEG2 (C444/C422/C420*/Cmono)
+    FRAME_SRC_BMP_SEQ       // 번호가 붙은 BMP 파일 (예: frames/f_%04d.bmp)
+} FrameSourceType;
+
+// 프레임 입력 스트림
+typedef struct {
+    FrameSourceType type;
+    FILE *file;
+    char pattern[512];      // BMP 시퀀스 파일명 패턴
+    int width;
+    int height;
+    int index;              // 다음에 읽을 프레임 번호
+    int chroma_w_shift;     // Y4M 크로마 가로 서브샘플링 (0: 444, 1: 422/420)
+    int chroma_h_shift;     // Y4M 크로마 세로 서브샘플링 (0: 444/422, 1: 420)
+    int mono;               // Y4M 흑백 (Cmono)
+    uint8_t *buffer;        // 프레임 읽기 버퍼
+    size_t frame_bytes;     // 프레임당 바이트 수 (RAW RGB / Y4M)
+} FrameSource;
+
+// 시퀀스 처리 옵션
+typedef struct {
+    int width;              // RAW RGB 입력 크기 (Y4M/BMP는 파일에서 읽음)
+    int height;
+    int slots;              // 프레임 슬롯 수 (2 = 더블 버퍼, 3 = 트리플 버퍼)
+    int depth;              // 내부 파이프라인 비트 깊이 (8/10/12/16)
+    int max_frames;         // 처리할 최대 프레임 수 (0 = 끝까지)
+    int out_bits;           // 출력 RAW 비트 수 (10/12)
+    const char *reg_script; // 프레임별 레지스터 쓰기 스크립트 (NULL = 없음)
+    int skip_rows;          // 이전 프레임과 같은 행은 변환하지 않고 복사 (기본 1)
+    int out_queue;          // 프레임 비동기 쓰기 큐 깊이 (기본 OUTQ_DEFAULT_DEPTH, 0 = 동기 쓰기)
+} SequenceOptions;
+
+// 시퀀스 처리 결과 통계
+typedef struct {
+    int frames;             // 처리한 프레임 수
+    double wall_time;       // 전체 경과 시간 (초)
+    double read_time;       // 읽기 단계 누적 시간 (초)
+    double compute_time;    // 변환 단계 누적 시간 (초)
+    double write_time;      // 쓰기 단계 누적 시간 (초, 인코딩 + 쓰기 큐 제출)
+    int reg_writes;         // 레지스터 스크립트 쓰기 수
+    int table_rebuilds;     // 파생 테이블 재계산 수 (첫 계산 포함)
+    long long rows_converted; // 변환한 행 수
+    long long rows_skipped;   // 이전 프레임 출력을 재사용한 행 수
+} SequenceStats;
+
+// 입력 스트림 열기 (확장자/패턴으로 형식 판별)
+// 반환값: 0 성공, -1 실패
+int frame_source_open(FrameSource *src, const char *path, int width, int height);
+
+// 다음 프레임을 8bit RGB 배열로 읽기 (배열이 비어 있으면 할당)
+// 반환값: 0 성공, 1 스트림 끝, -1 실패
+int frame_source_read(FrameSource *src, RGBArray *rgb);
+
+// 입력 스트림 닫기
+void frame_source_close(FrameSource *src);
+
+// 시퀀스 처리 옵션 기본값 설정
+void sequence_default_options(SequenceOptions *opt);
+
+// 읽기/변환/쓰기를 별도 스레드에서 프레임 슬롯으로 겹쳐 실행
+// output 확장자가 .raw이면 프레임별 패킹 RAW, 그 외에는 네이티브 RGBG 샘플 스트림
+// 반환값: 0 성공, -1 실패
+int run_sequence(const char *input, const char *output,
+                 const SequenceOptions *opt, SequenceStats *stats);
+
+// --seq 명령행 처리
+// 반환값: 0 성공, 1 실패
+int sequence_main(int argc, char *argv[]);
+
+#endif // SEQUENCE_H
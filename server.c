@@ -0,0 +1,601 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#ifndef _WIN32
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#endif
+#include "config.h"
+#include "ctc_tables.h"
+#include "image_io.h"
+#include "sink.h"
+#include "hexdump.h"
+#include "server.h"
+#include "log.h"
+
+#define SERVER_MAX_TOKENS 128
+#define SERVER_MAX_CLIENTS 32
+#define SERVER_MAX_LINE (64 * 1024)
+
+typedef enum {
+    SERVER_OUT_PPM = 0,
+    SERVER_OUT_RAW,
+    SERVER_OUT_BMP8,
+    SERVER_OUT_HEX
+} ServerOutputKind;
+
+typedef struct {
+    const char *name;
+    ServerOutputKind kind;
+    int bits;
+} ServerOutput;
+
+static const ServerOutput server_outputs[] = {
+    { "ppm10", SERVER_OUT_PPM,  10 },
+    { "ppm12", SERVER_OUT_PPM,  12 },
+    { "raw10", SERVER_OUT_RAW,  10 },
+    { "raw12", SERVER_OUT_RAW,  12 },
+    { "bmp8",  SERVER_OUT_BMP8, 8 },
+    { "hex",   SERVER_OUT_HEX,  0 },
+};
+#define SERVER_OUTPUT_COUNT ((int)(sizeof(server_outputs) / sizeof(server_outputs[0])))
+
+// 요청 사이에 유지되는 상태
+typedef struct {
+    char config_file[256];
+    // 마지막 입력 (같은 파일/깊이/수정 시각이면 다시 읽지 않음)
+    RGBArray input;
+    int has_input;
+    char input_path[512];
+    int input_depth;
+    long long input_mtime;
+    long long input_size;
+    // 통계
+    unsigned jobs;
+    unsigned errors;
+    unsigned input_hits;
+    unsigned table_rebuilds;
+    double busy_ms;
+} ServerState;
+
+static ServerState server = { "config.txt", { 0 }, 0, "", 0, 0, 0, 0, 0, 0, 0, 0.0 };
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1000.0 + (double)ts.tv_nsec * 1e-6;
+}
+
+// 응답 문자열 뒤에 덧붙이기 (넘치면 잘림)
+static void append(char *response, size_t size, const char *format, ...) {
+    size_t len = strlen(response);
+    if (len + 1 >= size) {
+        return;
+    }
+    va_list args;
+    va_start(args, format);
+    vsnprintf(response + len, size - len, format, args);
+    va_end(args);
+}
+
+static const ServerOutput *find_output(const char *name, size_t len) {
+    for (int i = 0; i < SERVER_OUTPUT_COUNT; i++) {
+        if (strlen(server_outputs[i].name) == len && strncmp(server_outputs[i].name, name, len) == 0) {
+            return &server_outputs[i];
+        }
+    }
+    return NULL;
+}
+
+static int emit_output(const ServerOutput *out, RGBArray *rgb, RGBGArray *rgbg, OutputSink *sink) {
+    switch (out->kind) {
+    case SERVER_OUT_PPM:
+        return write_rgbg_ppm(sink, rgbg, out->bits);
+    case SERVER_OUT_RAW:
+        return write_rgbg_raw(sink, rgbg, out->bits);
+    case SERVER_OUT_BMP8:
+        return write_rgb_bmp_8bit(sink, rgb);
+    case SERVER_OUT_HEX:
+        break;
+    }
+    return -1;
+}
+
+// 입력 읽기 (마지막 입력과 같으면 메모리의 배열 사용)
+static int load_input(const char *path, int depth) {
+    long long mtime = -1, size = -1;
+#ifndef _WIN32
+    struct stat st;
+    if (stat(path, &st) == 0) {
+        mtime = (long long)st.st_mtime * 1000000000LL + st.st_mtim.tv_nsec;
+        size = (long long)st.st_size;
+    }
+#endif
+    if (server.has_input && mtime >= 0 && strcmp(server.input_path, path) == 0 &&
+        server.input_depth == depth && server.input_mtime == mtime && server.input_size == size) {
+        server.input_hits++;
+        return 0;
+    }
+    if (server.has_input) {
+        free_rgb(&server.input);
+        server.has_input = 0;
+    }
+    if (read_bmp_depth(path, &server.input, depth) != 0) {
+        return -1;
+    }
+    server.has_input = 1;
+    snprintf(server.input_path, sizeof(server.input_path), "%s", path);
+    server.input_depth = depth;
+    server.input_mtime = mtime;
+    server.input_size = size;
+    return 0;
+}
+
+// 요청별 레지스터 덮어쓰기 (처리 후 복원)
+typedef struct {
+    char name[64];
+    int old_value;
+} RegOverride;
+
+static void restore_overrides(const RegOverride *saved, int count) {
+    for (int i = count - 1; i >= 0; i--) {
+        reg_write_by_name(saved[i].name, saved[i].old_value);
+    }
+}
+
+static int handle_process(char **tokens, int count, char *response, size_t size) {
+    const char *input = NULL;
+    int depth = 8;
+    const char *paths[SERVER_OUTPUT_COUNT] = { 0 };
+    int hashed[SERVER_OUTPUT_COUNT] = { 0 };
+    RegOverride saved[SERVER_MAX_TOKENS];
+    int saved_count = 0;
+
+    for (int i = 2; i < count; i++) {
+        char *eq = strchr(tokens[i], '=');
+        if (!eq) {
+            append(response, size, "error 잘못된 인자: %s", tokens[i]);
+            restore_overrides(saved, saved_count);
+            return -1;
+        }
+        *eq = '\0';
+        const char *key = tokens[i];
+        const char *value = eq + 1;
+        const ServerOutput *out = find_output(key, strlen(key));
+        if (strcmp(key, "in") == 0) {
+            input = value;
+        } else if (strcmp(key, "depth") == 0) {
+            depth = atoi(value);
+        } else if (strncmp(key, "reg.", 4) == 0) {
+            RegOverride *r = &saved[saved_count];
+            snprintf(r->name, sizeof(r->name), "%s", key + 4);
+            if (reg_read_by_name(r->name, &r->old_value) != 0) {
+                append(response, size, "error 알 수 없는 레지스터: %s", r->name);
+                restore_overrides(saved, saved_count);
+                return -1;
+            }
+            saved_count++;
+            reg_write_by_name(r->name, (int)strtol(value, NULL, 0));
+        } else if (strcmp(key, "hash") == 0) {
+            for (const char *p = value; *p;) {
+                size_t len = strcspn(p, ",");
+                const ServerOutput *h = find_output(p, len);
+                if (!h || h->kind == SERVER_OUT_HEX) {
+                    append(response, size, "error 해시할 수 없는 출력: %.*s", (int)len, p);
+                    restore_overrides(saved, saved_count);
+                    return -1;
+                }
+                hashed[h - server_outputs] = 1;
+                p += len + (p[len] == ',');
+            }
+        } else if (out) {
+            paths[out - server_outputs] = value;
+        } else {
+            append(response, size, "error 알 수 없는 키: %s", key);
+            restore_overrides(saved, saved_count);
+            return -1;
+        }
+    }
+    if (!input) {
+        append(response, size, "error in=<BMP>가 필요합니다");
+        restore_overrides(saved, saved_count);
+        return -1;
+    }
+
+    int result = 0;
+    server.table_rebuilds += (unsigned)ctc_tables_refresh();
+    RGBGArray rgbg;
+    if (load_input(input, depth) != 0) {
+        append(response, size, "error 입력을 읽을 수 없습니다: %s", input);
+        result = -1;
+    } else if (rgb_to_rgbg(&server.input, &rgbg) != 0) {
+        append(response, size, "error RGBG 변환 실패");
+        result = -1;
+    } else {
+        append(response, size, "ok size=%dx%d", rgbg.width, rgbg.height);
+        for (int i = 0; i < SERVER_OUTPUT_COUNT && result == 0; i++) {
+            const ServerOutput *out = &server_outputs[i];
+            if (paths[i] && out->kind == SERVER_OUT_HEX) {
+                HexDumpOptions opt;
+                hexdump_default_options(&opt);
+                result = hexdump_rgbg(paths[i], &rgbg, &opt);
+            } else if (paths[i]) {
+                OutputSink sink;
+                if (make_parent_directory(paths[i]) != 0 || sink_open_file(&sink, paths[i]) != 0) {
+                    result = -1;
+                } else {
+                    result = emit_output(out, &server.input, &rgbg, &sink);
+                    result |= sink_close(&sink);
+                }
+            }
+            if (result == 0 && hashed[i]) {
+                OutputSink sink;
+                if (sink_init_hash(&sink) != 0) {
+                    result = -1;
+                    break;
+                }
+                result = emit_output(out, &server.input, &rgbg, &sink);
+                result |= sink_close(&sink);
+                append(response, size, " %s=%016llx/%llu", out->name,
+                       (unsigned long long)sink_hash(&sink), (unsigned long long)sink.size);
+                sink_free(&sink);
+            }
+            if (result != 0) {
+                response[0] = '\0';
+                append(response, size, "error 출력 실패: %s", out->name);
+            }
+        }
+        free_rgbg(&rgbg);
+    }
+    restore_overrides(saved, saved_count);
+    return result;
+}
+
+int server_handle_line(const char *line, char *response, size_t response_size) {
+    char buffer[SERVER_MAX_LINE];
+    char *tokens[SERVER_MAX_TOKENS];
+    int count = 0;
+    snprintf(buffer, sizeof(buffer), "%s", line);
+    char *save = NULL;
+    for (char *t = strtok_r(buffer, " \t\r\n", &save); t && count < SERVER_MAX_TOKENS;
+         t = strtok_r(NULL, " \t\r\n", &save)) {
+        tokens[count++] = t;
+    }
+    response[0] = '\0';
+    if (count == 0) {
+        return 0;
+    }
+    append(response, response_size, "%s ", tokens[0]);
+    if (count < 2) {
+        append(response, response_size, "error 명령이 없습니다");
+        server.errors++;
+        return 0;
+    }
+
+    // 응답 본문 (id 뒤에 붙음)
+    char body[4096] = "";
+    const char *command = tokens[1];
+    double start = now_ms();
+    int status = 0;
+    int result = 0;
+    if (strcmp(command, "process") == 0) {
+        result = handle_process(tokens, count, body, sizeof(body));
+        server.jobs++;
+        double elapsed = now_ms() - start;
+        server.busy_ms += elapsed;
+        if (result == 0) {
+            append(body, sizeof(body), " ms=%.2f", elapsed);
+        }
+    } else if (strcmp(command, "set") == 0) {
+        for (int i = 2; i < count && result == 0; i++) {
+            char *eq = strchr(tokens[i], '=');
+            if (eq) {
+                *eq = '\0';
+            }
+            if (!eq || reg_write_by_name(tokens[i], (int)strtol(eq + 1, NULL, 0)) != 0) {
+                append(body, sizeof(body), "error 알 수 없는 레지스터/형식: %s", tokens[i]);
+                result = -1;
+            }
+        }
+        if (result == 0) {
+            append(body, sizeof(body), "ok");
+        }
+    } else if (strcmp(command, "get") == 0) {
+        char values[4000] = "";
+        for (int i = 2; i < count && result == 0; i++) {
+            int value;
+            if (reg_read_by_name(tokens[i], &value) != 0) {
+                append(body, sizeof(body), "error 알 수 없는 레지스터: %s", tokens[i]);
+                result = -1;
+            } else {
+                append(values, sizeof(values), " %s=%d", tokens[i], value);
+            }
+        }
+        if (result == 0) {
+            append(body, sizeof(body), "ok%s", values);
+        }
+    } else if (strcmp(command, "reload") == 0) {
+        if (count > 2) {
+            snprintf(server.config_file, sizeof(server.config_file), "%s", tokens[2]);
+        }
+        config_load_defaults(); // set으로 바꾼 값이 남지 않도록 기본값에서 다시 로드
+        result = load_config(server.config_file);
+        ctc_tables_invalidate_all();
+        if (result == 0) {
+            append(body, sizeof(body), "ok config=%s", server.config_file);
+        } else {
+            append(body, sizeof(body), "error config를 읽을 수 없습니다: %s", server.config_file);
+        }
+    } else if (strcmp(command, "stats") == 0) {
+        append(body, sizeof(body), "ok jobs=%u errors=%u input_hits=%u table_rebuilds=%u busy_ms=%.1f",
+               server.jobs, server.errors, server.input_hits, server.table_rebuilds, server.busy_ms);
+    } else if (strcmp(command, "ping") == 0) {
+        append(body, sizeof(body), "ok");
+    } else if (strcmp(command, "quit") == 0) {
+        append(body, sizeof(body), "ok");
+        status = 1;
+    } else if (strcmp(command, "shutdown") == 0) {
+        append(body, sizeof(body), "ok");
+        status = 2;
+    } else {
+        append(body, sizeof(body), "error 알 수 없는 명령: %s", command);
+        result = -1;
+    }
+    append(response, response_size, "%s", body);
+    if (result != 0) {
+        server.errors++;
+    }
+    return status;
+}
+
+// ============================================================
+// 연결 처리
+// ============================================================
+
+#ifndef _WIN32
+typedef struct {
+    int in_fd;
+    int out_fd;
+    char *buffer;
+    size_t length;
+    size_t capacity;
+} ServerClient;
+
+static int write_all(int fd, const char *data, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, data, len);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return -1;
+        }
+        data += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+// 받은 데이터 중 완성된 줄을 모두 처리 (eof이면 마지막 줄도 처리)
+// 반환값: 0 계속, 1 연결 종료, 2 서버 종료
+static int drain_client(ServerClient *client, int eof) {
+    char response[4096];
+    size_t start = 0;
+    int status = 0;
+    while (status == 0 && start < client->length) {
+        char *nl = (char *)memchr(client->buffer + start, '\n', client->length - start);
+        if (!nl && !eof) {
+            break;
+        }
+        size_t end = nl ? (size_t)(nl - client->buffer) : client->length;
+        client->buffer[end] = '\0';
+        status = server_handle_line(client->buffer + start, response, sizeof(response) - 1);
+        if (response[0]) {
+            size_t len = strlen(response);
+            response[len++] = '\n';
+            if (write_all(client->out_fd, response, len) != 0) {
+                status = 1;
+            }
+        }
+        start = nl ? end + 1 : client->length;
+    }
+    memmove(client->buffer, client->buffer + start, client->length - start);
+    client->length -= start;
+    return status;
+}
+
+// 읽을 수 있는 데이터를 버퍼에 추가
+// 반환값: 0 계속, 1 연결 종료, 2 서버 종료
+static int read_client(ServerClient *client) {
+    if (client->capacity - client->length < 4096) {
+        size_t capacity = client->capacity ? client->capacity * 2 : 16384;
+        if (capacity > SERVER_MAX_LINE * 2) {
+            log_error("요청 줄이 너무 깁니다\n");
+            return 1;
+        }
+        char *grown = (char *)realloc(client->buffer, capacity);
+        if (!grown) {
+            return 1;
+        }
+        client->buffer = grown;
+        client->capacity = capacity;
+    }
+    ssize_t n = read(client->in_fd, client->buffer + client->length, client->capacity - client->length - 1);
+    if (n < 0 && errno == EINTR) {
+        return 0;
+    }
+    if (n <= 0) {
+        int status = drain_client(client, 1);
+        return status == 2 ? 2 : 1;
+    }
+    client->length += (size_t)n;
+    return drain_client(client, 0);
+}
+
+static void close_client(ServerClient *client) {
+    if (client->in_fd > 2) {
+        close(client->in_fd);
+    }
+    free(client->buffer);
+    memset(client, 0, sizeof(*client));
+}
+
+// stdin/stdout 파이프 모드 (요청 응답 외 출력은 stderr)
+static int serve_pipe(int out_fd) {
+    ServerClient client = { 0, out_fd, NULL, 0, 0 };
+    int status = 0;
+    while (status == 0) {
+        status = read_client(&client);
+    }
+    close_client(&client);
+    return 0;
+}
+
+static int serve_socket(const char *path) {
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        log_error("소켓 경로가 너무 깁니다: %s\n", path);
+        return 1;
+    }
+    snprintf(addr.sun_path, sizeof(addr.sun_path), "%s", path);
+    if (make_parent_directory(path) != 0) {
+        return 1;
+    }
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(path);
+    if (listen_fd < 0 || bind(listen_fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+        listen(listen_fd, SERVER_MAX_CLIENTS) != 0) {
+        log_error("소켓을 열 수 없습니다: %s\n", path);
+        if (listen_fd >= 0) {
+            close(listen_fd);
+        }
+        return 1;
+    }
+    log_info("서버 대기: %s\n", path);
+    log_flush();
+
+    // 요청은 연결 순서와 관계없이 한 번에 하나씩 처리 (레지스터가 전역 상태이므로)
+    ServerClient clients[SERVER_MAX_CLIENTS];
+    memset(clients, 0, sizeof(clients));
+    int running = 1;
+    while (running) {
+        struct pollfd fds[SERVER_MAX_CLIENTS + 1];
+        int slots[SERVER_MAX_CLIENTS + 1];
+        int nfds = 0;
+        fds[nfds].fd = listen_fd;
+        fds[nfds].events = POLLIN;
+        slots[nfds++] = -1;
+        for (int i = 0; i < SERVER_MAX_CLIENTS; i++) {
+            if (clients[i].buffer || clients[i].in_fd > 0) {
+                fds[nfds].fd = clients[i].in_fd;
+                fds[nfds].events = POLLIN;
+                slots[nfds++] = i;
+            }
+        }
+        if (poll(fds, (nfds_t)nfds, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        for (int k = 0; k < nfds && running; k++) {
+            if (!(fds[k].revents & (POLLIN | POLLHUP | POLLERR))) {
+                continue;
+            }
+            if (slots[k] < 0) {
+                int fd = accept(listen_fd, NULL, NULL);
+                int slot = -1;
+                for (int i = 0; i < SERVER_MAX_CLIENTS && fd >= 0 && slot < 0; i++) {
+                    if (clients[i].in_fd == 0 && !clients[i].buffer) {
+                        slot = i;
+                    }
+                }
+                if (slot < 0) {
+                    if (fd >= 0) {
+                        close(fd);
+                    }
+                    continue;
+                }
+                clients[slot].in_fd = fd;
+                clients[slot].out_fd = fd;
+                continue;
+            }
+            int status = read_client(&clients[slots[k]]);
+            if (status != 0) {
+                close_client(&clients[slots[k]]);
+            }
+            if (status == 2) {
+                running = 0;
+            }
+        }
+    }
+    for (int i = 0; i < SERVER_MAX_CLIENTS; i++) {
+        if (clients[i].in_fd > 0) {
+            close_client(&clients[i]);
+        }
+    }
+    close(listen_fd);
+    unlink(path);
+    log_info("서버 종료 (요청 %u, 오류 %u)\n", server.jobs, server.errors);
+    return 0;
+}
+#endif
+
+int server_main(int argc, char *argv[]) {
+#ifdef _WIN32
+    (void)argc; (void)argv;
+    log_error("서버 모드는 이 플랫폼에서 지원하지 않습니다\n");
+    return 1;
+#else
+    const char *socket_path = NULL;
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "--socket") == 0) {
+            socket_path = (i + 1 < argc && argv[i + 1][0] != '-') ? argv[++i] : SERVER_DEFAULT_SOCKET;
+        } else if (strcmp(argv[i], "--config") == 0 && i + 1 < argc) {
+            snprintf(server.config_file, sizeof(server.config_file), "%s", argv[++i]);
+        } else {
+            log_info("사용법: %s --serve [--socket [경로]] [--config 파일]\n", argv[0]);
+            log_info("  --socket   Unix 도메인 소켓에서 대기 (기본 %s), 없으면 stdin/stdout 파이프\n",
+                     SERVER_DEFAULT_SOCKET);
+            log_info("  요청 형식은 server.h 참고, 클라이언트: ctc_client\n");
+            return 1;
+        }
+    }
+    signal(SIGPIPE, SIG_IGN);
+
+    // 파이프 모드: 응답은 원래 stdout으로, 나머지 출력은 모두 stderr로
+    int out_fd = -1;
+    if (!socket_path) {
+        log_flush();
+        out_fd = dup(STDOUT_FILENO);
+        if (out_fd < 0 || dup2(STDERR_FILENO, STDOUT_FILENO) < 0) {
+            fprintf(stderr, "stdout 전환 실패\n");
+            return 1;
+        }
+    }
+    if (load_config(server.config_file) != 0) {
+        log_error("경고: %s 파일을 읽을 수 없습니다. 기본값을 사용합니다.\n", server.config_file);
+    }
+    ctc_tables_init();
+    server.table_rebuilds += (unsigned)ctc_tables_refresh();
+
+    int result = socket_path ? serve_socket(socket_path) : serve_pipe(out_fd);
+    if (out_fd >= 0) {
+        close(out_fd);
+    }
+    if (server.has_input) {
+        free_rgb(&server.input);
+        server.has_input = 0;
+    }
+    return result;
+#endif
+}
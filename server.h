@@ -0,0 +1,30 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <stddef.h>
+
+// 상주 처리 서버 (--serve)
+// config/파생 테이블/마지막 입력을 메모리에 유지하고 한 줄 요청마다 한 줄 응답
+// 연결당 요청은 순서대로 처리되며 응답을 기다리지 않고 여러 요청을 보낼 수 있음 (파이프라인)
+//
+// 요청: <id> <명령> [인자...]   (토큰은 공백으로 구분, 경로에 공백 불가)
+//   <id> process in=<BMP> [depth=D] [reg.<이름>=<값>]... [<출력>=<경로>]... [hash=<출력>,...]
+//        출력: ppm10, ppm12, raw10, raw12, bmp8, hex (hex는 파일만)
+//        reg.*는 이 요청에만 적용하고 처리 후 원래 값으로 복원
+//   <id> set <이름>=<값>...   레지스터 쓰기 (이후 요청에 계속 적용)
+//   <id> get <이름>...
+//   <id> reload [config 파일]   registers_list.csv 기본값에서 config 다시 적용
+//   <id> stats | ping | quit (연결 종료) | shutdown (서버 종료)
+// 응답: <id> ok [키=값...] 또는 <id> error <메시지>
+
+#define SERVER_DEFAULT_SOCKET "test_out/ctc_server.sock"
+
+// 요청 한 줄 처리 (응답은 줄바꿈 없이 response에 기록)
+// 반환값: 0 계속, 1 연결 종료(quit), 2 서버 종료(shutdown)
+int server_handle_line(const char *line, char *response, size_t response_size);
+
+// --serve 명령행 처리 (config 로드 전에 호출, stdin/stdout 모드는 stdout 출력을 stderr로 돌림)
+// 반환값: 0 성공, 1 실패
+int server_main(int argc, char *argv[]);
+
+#endif // SERVER_H
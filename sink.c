@@ -0,0 +1,135 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include "sink.h"
+#include "log.h"
+
+static void sink_reset(OutputSink *sink, SinkKind kind) {
+    memset(sink, 0, sizeof(*sink));
+    sink->kind = kind;
+}
+
+int sink_open_file(OutputSink *sink, const char *filename) {
+    sink_reset(sink, SINK_FILE);
+    sink->file = fopen(filename, "wb");
+    if (!sink->file) {
+        log_error("파일을 생성할 수 없습니다: %s\n", filename);
+        return -1;
+    }
+    sink->owns_file = 1;
+    return 0;
+}
+
+void sink_from_stream(OutputSink *sink, FILE *file) {
+    sink_reset(sink, SINK_FILE);
+    sink->file = file;
+}
+
+void sink_init_memory(OutputSink *sink) {
+    sink_reset(sink, SINK_MEMORY);
+}
+
+int sink_init_hash(OutputSink *sink) {
+    sink_reset(sink, SINK_HASH);
+    sink->hash = (Hash64Stream *)malloc(sizeof(Hash64Stream));
+    if (!sink->hash) {
+        log_error("해시 상태 메모리 할당 실패\n");
+        return -1;
+    }
+    hash64_stream_init(sink->hash, 0);
+    return 0;
+}
+
+// 메모리 버퍼 확장 (2배씩)
+static int reserve_memory(OutputSink *sink, size_t need) {
+    if (need <= sink->capacity) {
+        return 0;
+    }
+    size_t capacity = sink->capacity ? sink->capacity : 4096;
+    while (capacity < need) {
+        capacity *= 2;
+    }
+    uint8_t *grown = (uint8_t *)realloc(sink->data, capacity);
+    if (!grown) {
+        log_error("출력 버퍼 메모리 할당 실패 (%zu bytes)\n", capacity);
+        return -1;
+    }
+    sink->data = grown;
+    sink->capacity = capacity;
+    return 0;
+}
+
+int sink_write(OutputSink *sink, const void *data, size_t len) {
+    if (sink->error) {
+        return -1;
+    }
+    switch (sink->kind) {
+    case SINK_FILE:
+        if (fwrite(data, 1, len, sink->file) != len) {
+            sink->error = 1;
+            return -1;
+        }
+        break;
+    case SINK_MEMORY:
+        if (reserve_memory(sink, (size_t)sink->size + len) != 0) {
+            sink->error = 1;
+            return -1;
+        }
+        memcpy(sink->data + sink->size, data, len);
+        break;
+    case SINK_HASH:
+        hash64_stream_update(sink->hash, data, len);
+        break;
+    }
+    sink->size += len;
+    return 0;
+}
+
+int sink_printf(OutputSink *sink, const char *format, ...) {
+    char text[256];
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    if (n < 0 || (size_t)n >= sizeof(text)) {
+        sink->error = 1;
+        return -1;
+    }
+    return sink_write(sink, text, (size_t)n);
+}
+
+uint64_t sink_hash(const OutputSink *sink) {
+    if (sink->kind == SINK_HASH) {
+        return hash64_stream_final(sink->hash);
+    }
+    if (sink->kind == SINK_MEMORY) {
+        Hash64Stream *s = (Hash64Stream *)malloc(sizeof(Hash64Stream));
+        if (!s) {
+            return 0;
+        }
+        hash64_stream_init(s, 0);
+        hash64_stream_update(s, sink->data, (size_t)sink->size);
+        uint64_t h = hash64_stream_final(s);
+        free(s);
+        return h;
+    }
+    return 0;
+}
+
+int sink_close(OutputSink *sink) {
+    if (sink->kind == SINK_FILE && sink->file) {
+        if (sink->owns_file && fclose(sink->file) != 0) {
+            sink->error = 1;
+        }
+        sink->file = NULL;
+    }
+    return sink->error ? -1 : 0;
+}
+
+void sink_free(OutputSink *sink) {
+    free(sink->data);
+    free(sink->hash);
+    sink->data = NULL;
+    sink->hash = NULL;
+    sink->capacity = 0;
+}
@@ -0,0 +1,59 @@
+#ifndef SINK_H
+#define SINK_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "hash.h"
+
+// 출력 대상 (save_* 함수 공용)
+// 같은 쓰기 코드로 파일, 메모리 버퍼, 스트리밍 해시 중 하나에 출력
+typedef enum {
+    SINK_FILE = 0,      // 파일 (sink_open_file로 연 파일은 sink_close에서 닫음)
+    SINK_MEMORY,        // 메모리 버퍼 (data/size, sink_free로 해제)
+    SINK_HASH           // 내용은 저장하지 않고 해시/크기만 계산 (골든 비교용)
+} SinkKind;
+
+typedef struct {
+    SinkKind kind;
+    FILE *file;
+    int owns_file;
+    uint8_t *data;      // SINK_MEMORY
+    size_t capacity;
+    uint64_t size;      // 누적 바이트 수 (모든 종류)
+    Hash64Stream *hash; // SINK_HASH
+    int error;          // 쓰기 실패 발생 여부
+} OutputSink;
+
+// 파일 출력 (상위 디렉토리는 만들지 않음)
+// 반환값: 0 성공, -1 실패
+int sink_open_file(OutputSink *sink, const char *filename);
+
+// 이미 열린 파일에 출력 (sink_close에서 닫지 않음, 시퀀스 출력 등)
+void sink_from_stream(OutputSink *sink, FILE *file);
+
+// 메모리 버퍼 출력
+void sink_init_memory(OutputSink *sink);
+
+// 스트리밍 해시 출력
+// 반환값: 0 성공, -1 실패
+int sink_init_hash(OutputSink *sink);
+
+// 반환값: 0 성공, -1 실패
+int sink_write(OutputSink *sink, const void *data, size_t len);
+
+// printf 형식 쓰기 (헤더 등 짧은 문자열용)
+// 반환값: 0 성공, -1 실패
+int sink_printf(OutputSink *sink, const char *format, ...);
+
+// SINK_HASH / SINK_MEMORY 내용 해시 (파일 해시 비교와 같은 값)
+uint64_t sink_hash(const OutputSink *sink);
+
+// 출력 마무리 (소유한 파일 닫기), 메모리 버퍼는 sink_free 전까지 유지
+// 반환값: 0 성공, -1 쓰기 중 오류 발생
+int sink_close(OutputSink *sink);
+
+// 메모리 버퍼 / 해시 상태 해제
+void sink_free(OutputSink *sink);
+
+#endif // SINK_H
@@ -0,0 +1,657 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <dirent.h>
+#include "config.h"
+#include "image_io.h"
+#include "pattern.h"
+#include "sink.h"
+#include "hash.h"
+#include "sweep.h"
+#include "log.h"
+
+#define SWEEP_LINE_MAX 4096
+#define SWEEP_MAX_AXIS_VALUES (1 << 20)
+#define SWEEP_PATTERN_PREFIX "pattern:"
+#define SWEEP_COLUMNS "# job\timage\tsettings\tstatus\tppm10_hash\tppm10_size\tbmp8_hash\tms\n"
+// 결과 열 구성이 바뀌면 올림 (지문에 포함되어 이전 형식 결과 파일에는 이어 쓰지 않음)
+#define SWEEP_FORMAT_VERSION 2
+
+// ============================================================
+// 매니페스트
+// ============================================================
+
+static char *trim(char *s) {
+    while (*s == ' ' || *s == '\t') s++;
+    char *end = s + strlen(s);
+    while (end > s && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\n' || end[-1] == '\r')) {
+        *--end = '\0';
+    }
+    return s;
+}
+
+// 값 목록 해석: "N", "시작..끝", "시작..끝:간격"을 쉼표로 연결
+static int parse_axis_values(char *text, SweepAxis *axis) {
+    int capacity = 0;
+    for (char *token = strtok(text, ","); token; token = strtok(NULL, ",")) {
+        token = trim(token);
+        int first, last, step = 1;
+        char tail;
+        if (sscanf(token, "%d..%d:%d%c", &first, &last, &step, &tail) == 3 ||
+            sscanf(token, "%d..%d%c", &first, &last, &tail) == 2) {
+            if (step <= 0 || last < first) {
+                return -1;
+            }
+        } else if (sscanf(token, "%d%c", &first, &tail) == 1) {
+            last = first;
+        } else {
+            return -1;
+        }
+        for (int64_t v = first; v <= last; v += step) {
+            if (axis->count == SWEEP_MAX_AXIS_VALUES) {
+                return -1;
+            }
+            if (axis->count == capacity) {
+                capacity = capacity ? capacity * 2 : 16;
+                int *grown = (int *)realloc(axis->values, (size_t)capacity * sizeof(int));
+                if (!grown) {
+                    return -1;
+                }
+                axis->values = grown;
+            }
+            axis->values[axis->count++] = (int)v;
+        }
+    }
+    return axis->count > 0 ? 0 : -1;
+}
+
+// 작업 목록을 결정하는 내용만 해시 (주석, 공백, 줄 순서 중 축 외의 차이는 무시)
+static uint64_t manifest_fingerprint(const SweepManifest *m) {
+    uint64_t h = hash64(&m->depth, sizeof(m->depth), SWEEP_FORMAT_VERSION);
+    for (int i = 0; i < m->image_count; i++) {
+        h = hash64(m->images[i], strlen(m->images[i]) + 1, h);
+    }
+    for (int a = 0; a < m->axis_count; a++) {
+        h = hash64(m->axes[a].name, strlen(m->axes[a].name) + 1, h);
+        h = hash64(m->axes[a].values, (size_t)m->axes[a].count * sizeof(int), h);
+    }
+    return h;
+}
+
+int sweep_load(const char *path, SweepManifest *m) {
+    memset(m, 0, sizeof(*m));
+    m->depth = 8;
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        log_error("스윕 매니페스트를 열 수 없습니다: %s\n", path);
+        return -1;
+    }
+
+    char line[SWEEP_LINE_MAX];
+    int line_no = 0;
+    int image_capacity = 0;
+    int result = 0;
+    while (result == 0 && fgets(line, sizeof(line), file)) {
+        line_no++;
+        char *comment = strchr(line, '#');
+        if (comment) *comment = '\0';
+        char *s = trim(line);
+        if (*s == '\0') {
+            continue;
+        }
+        if (strncmp(s, "image", 5) == 0 && (s[5] == ' ' || s[5] == '\t')) {
+            char *name = trim(s + 5);
+            if (*name == '\0' || strchr(name, '\t')) {
+                result = -1;
+                break;
+            }
+            if (m->image_count == image_capacity) {
+                image_capacity = image_capacity ? image_capacity * 2 : 16;
+                char **grown = (char **)realloc(m->images, (size_t)image_capacity * sizeof(char *));
+                if (!grown) {
+                    result = -1;
+                    break;
+                }
+                m->images = grown;
+            }
+            m->images[m->image_count] = strdup(name);
+            if (!m->images[m->image_count++]) {
+                result = -1;
+            }
+        } else if (strncmp(s, "axis", 4) == 0 && (s[4] == ' ' || s[4] == '\t')) {
+            char *eq = strchr(s, '=');
+            int value;
+            if (!eq || m->axis_count == SWEEP_MAX_AXES) {
+                result = -1;
+                break;
+            }
+            *eq = '\0';
+            SweepAxis *axis = &m->axes[m->axis_count++];
+            snprintf(axis->name, sizeof(axis->name), "%s", trim(s + 4));
+            if (reg_read_by_name(axis->name, &value) != 0) {
+                log_error("알 수 없는 레지스터 이름: %s (%s:%d)\n", axis->name, path, line_no);
+                result = -1;
+                break;
+            }
+            result = parse_axis_values(eq + 1, axis);
+        } else if (strncmp(s, "depth", 5) == 0 && (s[5] == ' ' || s[5] == '\t')) {
+            m->depth = atoi(s + 5);
+            if (m->depth != 8 && m->depth != 10 && m->depth != 12 && m->depth != 16) {
+                result = -1;
+            }
+        } else {
+            result = -1;
+        }
+    }
+    fclose(file);
+
+    if (result == 0 && m->image_count == 0) {
+        log_error("스윕 매니페스트에 image 항목이 없습니다: %s\n", path);
+        sweep_free(m);
+        return -1;
+    }
+    if (result != 0) {
+        log_error("스윕 매니페스트 형식 오류: %s:%d\n", path, line_no);
+        sweep_free(m);
+        return -1;
+    }
+    m->points = 1;
+    for (int a = 0; a < m->axis_count; a++) {
+        m->points *= m->axes[a].count;
+    }
+    m->jobs = m->points * m->image_count;
+    m->fingerprint = manifest_fingerprint(m);
+    return 0;
+}
+
+void sweep_free(SweepManifest *m) {
+    for (int i = 0; i < m->image_count; i++) {
+        free(m->images[i]);
+    }
+    free(m->images);
+    for (int a = 0; a < m->axis_count; a++) {
+        free(m->axes[a].values);
+    }
+    memset(m, 0, sizeof(*m));
+}
+
+void sweep_job_point(const SweepManifest *m, int64_t job, int *image, int *values) {
+    *image = (int)(job / m->points);
+    int64_t point = job % m->points;
+    for (int a = m->axis_count - 1; a >= 0; a--) {
+        values[a] = m->axes[a].values[point % m->axes[a].count];
+        point /= m->axes[a].count;
+    }
+}
+
+// ============================================================
+// 결과 파일
+// ============================================================
+
+// 결과 줄의 상태 열이 ok인지
+static int row_ok(const char *row) {
+    const char *p = row;
+    for (int tabs = 0; p && tabs < 3; tabs++) {
+        p = strchr(p, '\t');
+        p = p ? p + 1 : NULL;
+    }
+    return p && strncmp(p, "ok\t", 3) == 0;
+}
+
+// 결과 파일 읽기: rows[작업 번호]에 마지막 줄 저장 (기존 값은 해제)
+// 줄바꿈으로 끝나지 않는 마지막 줄 (쓰는 중 중단)은 버림
+// 반환값: 0 성공, 1 파일 없음, -1 실패 (지문 / 샤드 불일치, 형식 오류)
+static int read_results(const char *path, const SweepManifest *m, int *shard, int *shards, char **rows) {
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        return 1;
+    }
+    char line[SWEEP_LINE_MAX];
+    unsigned long long fingerprint;
+    long long jobs;
+    int file_shard, file_shards;
+    if (!fgets(line, sizeof(line), file) ||
+        sscanf(line, "# sweep %llx shard %d/%d jobs %lld", &fingerprint, &file_shard, &file_shards, &jobs) != 4) {
+        log_error("스윕 결과 파일 형식 오류: %s\n", path);
+        fclose(file);
+        return -1;
+    }
+    if (fingerprint != m->fingerprint || jobs != m->jobs) {
+        log_error("스윕 결과 파일이 다른 매니페스트에서 만들어졌습니다: %s (지문 %016llx, 현재 %016llx)\n",
+                  path, fingerprint, (unsigned long long)m->fingerprint);
+        fclose(file);
+        return -1;
+    }
+    if ((*shards > 0 && (file_shard != *shard || file_shards != *shards)) ||
+        file_shards <= 0 || file_shard < 0 || file_shard >= file_shards) {
+        log_error("스윕 결과 파일의 샤드가 다릅니다: %s (%d/%d)\n", path, file_shard, file_shards);
+        fclose(file);
+        return -1;
+    }
+    *shard = file_shard;
+    *shards = file_shards;
+
+    int result = 0;
+    while (fgets(line, sizeof(line), file)) {
+        size_t len = strlen(line);
+        if (len == 0 || line[len - 1] != '\n') {
+            if (!feof(file)) {
+                log_error("스윕 결과 줄이 너무 깁니다: %s\n", path);
+                result = -1;
+            }
+            break;
+        }
+        if (line[0] == '#') {
+            continue;
+        }
+        char *end;
+        long long job = strtoll(line, &end, 10);
+        if (end == line || *end != '\t' || job < 0 || job >= m->jobs || job % file_shards != file_shard) {
+            log_error("스윕 결과 줄 무시 (작업 번호 오류): %s\n", path);
+            continue;
+        }
+        char *copy = strdup(line);
+        if (!copy) {
+            result = -1;
+            break;
+        }
+        free(rows[job]);
+        rows[job] = copy;
+    }
+    fclose(file);
+    return result;
+}
+
+static void free_rows(char **rows, int64_t count) {
+    if (!rows) {
+        return;
+    }
+    for (int64_t j = 0; j < count; j++) {
+        free(rows[j]);
+    }
+    free(rows);
+}
+
+// 결과 파일 헤더와 남은 줄을 임시 파일에 쓰고 교체 (중단된 줄 / 중복 줄 정리)
+// 반환값: 이어서 쓸 파일 (실패 시 NULL)
+static FILE *rewrite_results(const char *path, const SweepManifest *m, int shard, int shards, char **rows) {
+    char temp[640];
+    snprintf(temp, sizeof(temp), "%.600s.tmp", path);
+    FILE *file = fopen(temp, "w");
+    if (!file) {
+        log_error("스윕 결과 파일을 만들 수 없습니다: %s\n", temp);
+        return NULL;
+    }
+    fprintf(file, "# sweep %016llx shard %d/%d jobs %lld\n", (unsigned long long)m->fingerprint,
+            shard, shards, (long long)m->jobs);
+    fputs(SWEEP_COLUMNS, file);
+    for (int64_t j = shard; j < m->jobs; j += shards) {
+        if (rows[j]) {
+            fputs(rows[j], file);
+        }
+    }
+    if (fclose(file) != 0 || rename(temp, path) != 0) {
+        log_error("스윕 결과 파일 쓰기 실패: %s\n", path);
+        return NULL;
+    }
+    file = fopen(path, "a");
+    if (!file) {
+        log_error("스윕 결과 파일을 열 수 없습니다: %s\n", path);
+    }
+    return file;
+}
+
+// ============================================================
+// 작업 실행
+// ============================================================
+
+// 연속된 작업은 같은 이미지를 쓰는 경우가 많으므로 마지막 입력을 유지
+typedef struct {
+    int image;
+    RGBArray rgb;
+} SweepInput;
+
+static int load_input(const SweepManifest *m, int image, SweepInput *input) {
+    if (input->image == image) {
+        return 0;
+    }
+    if (input->image >= 0) {
+        free_rgb(&input->rgb);
+        input->image = -1;
+    }
+    const char *name = m->images[image];
+    int result;
+    if (strncmp(name, SWEEP_PATTERN_PREFIX, strlen(SWEEP_PATTERN_PREFIX)) == 0) {
+        PatternSpec spec;
+        result = pattern_parse(name + strlen(SWEEP_PATTERN_PREFIX), &spec);
+        if (result == 0 && spec.width <= 0) {
+            log_error("패턴 입력에는 크기가 필요합니다: %s\n", name);
+            result = -1;
+        }
+        result = result == 0 ? pattern_generate_rgb(&spec, m->depth, &input->rgb) : -1;
+    } else {
+        result = read_bmp_depth(name, &input->rgb, m->depth);
+    }
+    if (result == 0) {
+        input->image = image;
+    }
+    return result;
+}
+
+static int hash_output(int (*emit)(OutputSink *, void *, int), void *arg, int bits,
+                       uint64_t *hash, uint64_t *size) {
+    OutputSink sink;
+    if (sink_init_hash(&sink) != 0) {
+        return -1;
+    }
+    int result = emit(&sink, arg, bits) == 0 && sink_close(&sink) == 0 ? 0 : -1;
+    *hash = sink_hash(&sink);
+    *size = sink.size;
+    sink_free(&sink);
+    return result;
+}
+
+static int emit_ppm(OutputSink *sink, void *arg, int bits) {
+    return write_rgbg_ppm(sink, (RGBGArray *)arg, bits);
+}
+
+static int emit_bmp8(OutputSink *sink, void *arg, int bits) {
+    (void)bits;
+    return write_rgb_bmp_8bit(sink, (RGBArray *)arg);
+}
+
+// 작업 하나 실행 후 결과 줄 작성
+// 반환값: 0 성공, -1 실패 (row에는 fail 줄)
+static int run_job(const SweepManifest *m, int64_t job, SweepInput *input, char *row, size_t row_size) {
+    int image;
+    int values[SWEEP_MAX_AXES];
+    char settings[SWEEP_LINE_MAX / 2];
+    size_t len = 0;
+    struct timespec t0, t1;
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    sweep_job_point(m, job, &image, values);
+    settings[0] = '\0';
+    for (int a = 0; a < m->axis_count; a++) {
+        reg_write_by_name(m->axes[a].name, values[a]);
+        len += (size_t)snprintf(settings + len, sizeof(settings) - len, "%s%s=%d",
+                                a ? " " : "", m->axes[a].name, values[a]);
+        if (len >= sizeof(settings)) {
+            len = sizeof(settings) - 1;
+        }
+    }
+    if (m->axis_count == 0) {
+        snprintf(settings, sizeof(settings), "-");
+    }
+    RGBGArray rgbg;
+    uint64_t ppm_hash = 0, ppm_size = 0, bmp_hash = 0, bmp_size = 0;
+    int result = load_input(m, image, input);
+    if (result == 0 && rgb_to_rgbg(&input->rgb, &rgbg) == 0) {
+        result = hash_output(emit_ppm, &rgbg, 10, &ppm_hash, &ppm_size) |
+                 hash_output(emit_bmp8, &input->rgb, 8, &bmp_hash, &bmp_size);
+        free_rgbg(&rgbg);
+    } else {
+        result = -1;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double ms = (double)(t1.tv_sec - t0.tv_sec) * 1e3 + (double)(t1.tv_nsec - t0.tv_nsec) * 1e-6;
+
+    if (result != 0) {
+        snprintf(row, row_size, "%lld\t%s\t%s\tfail\t-\t-\t-\t%.2f\n",
+                 (long long)job, m->images[image], settings, ms);
+        return -1;
+    }
+    snprintf(row, row_size, "%lld\t%s\t%s\tok\t%016llx\t%llu\t%016llx\t%.2f\n",
+             (long long)job, m->images[image], settings,
+             (unsigned long long)ppm_hash, (unsigned long long)ppm_size, (unsigned long long)bmp_hash, ms);
+    return 0;
+}
+
+int sweep_run(const SweepManifest *m, const char *out_dir, int shard, int shards,
+              int max_jobs, SweepStats *stats) {
+    memset(stats, 0, sizeof(*stats));
+    stats->jobs = m->jobs;
+    if (shards <= 0 || shard < 0 || shard >= shards) {
+        log_error("잘못된 샤드: %d/%d\n", shard, shards);
+        return -1;
+    }
+    stats->shard_jobs = m->jobs > shard ? (m->jobs - shard + shards - 1) / shards : 0;
+
+    char path[600];
+    snprintf(path, sizeof(path), "%s/shard_%dof%d.tsv", out_dir, shard, shards);
+    char **rows = (char **)calloc((size_t)m->jobs, sizeof(char *));
+    if (!rows || make_parent_directory(path) != 0) {
+        log_error("스윕 준비 실패: %s\n", path);
+        free(rows);
+        return -1;
+    }
+    int file_shard = shard, file_shards = shards;
+    FILE *file = NULL;
+    if (read_results(path, m, &file_shard, &file_shards, rows) >= 0) {
+        file = rewrite_results(path, m, shard, shards, rows);
+    }
+    if (!file) {
+        free_rows(rows, m->jobs);
+        return -1;
+    }
+
+    // 축 레지스터는 끝난 뒤 원래 값으로 되돌림
+    int baseline[SWEEP_MAX_AXES];
+    for (int a = 0; a < m->axis_count; a++) {
+        reg_read_by_name(m->axes[a].name, &baseline[a]);
+    }
+    SweepInput input;
+    memset(&input, 0, sizeof(input));
+    input.image = -1;
+    char row[SWEEP_LINE_MAX];
+    int result = 0;
+    for (int64_t j = shard; j < m->jobs; j += shards) {
+        if (rows[j] && row_ok(rows[j])) {
+            stats->skipped++;
+            continue;
+        }
+        if (max_jobs > 0 && stats->run == max_jobs) {
+            break;
+        }
+        if (run_job(m, j, &input, row, sizeof(row)) != 0) {
+            log_error("  작업 %lld 실패: %s\n", (long long)j, m->images[j / m->points]);
+            stats->failed++;
+        }
+        stats->run++;
+        if (fputs(row, file) == EOF || fflush(file) != 0) {
+            log_error("스윕 결과 쓰기 실패: %s\n", path);
+            result = -1;
+            break;
+        }
+        log_debug("  %s", row);
+    }
+    if (input.image >= 0) {
+        free_rgb(&input.rgb);
+    }
+    for (int a = 0; a < m->axis_count; a++) {
+        reg_write_by_name(m->axes[a].name, baseline[a]);
+    }
+    if (fclose(file) != 0) {
+        result = -1;
+    }
+    free_rows(rows, m->jobs);
+    return result == 0 && stats->failed == 0 ? 0 : -1;
+}
+
+// ============================================================
+// 합치기
+// ============================================================
+
+// 결과 비교용 길이 (마지막 열 ms 제외)
+static size_t row_result_length(const char *row) {
+    const char *last = strrchr(row, '\t');
+    return last ? (size_t)(last - row) : strlen(row);
+}
+
+int sweep_merge(const SweepManifest *m, const char *out_dir, const char *report, SweepStats *stats) {
+    memset(stats, 0, sizeof(*stats));
+    stats->jobs = m->jobs;
+    DIR *dir = opendir(out_dir);
+    if (!dir) {
+        log_error("스윕 결과 디렉토리를 열 수 없습니다: %s\n", out_dir);
+        return -1;
+    }
+    char **merged = (char **)calloc((size_t)m->jobs, sizeof(char *));
+    char **rows = (char **)calloc((size_t)m->jobs, sizeof(char *));
+    if (!merged || !rows) {
+        log_error("스윕 합치기 메모리 할당 실패\n");
+        closedir(dir);
+        free(merged);
+        free(rows);
+        return -1;
+    }
+
+    int files = 0;
+    struct dirent *ent;
+    while ((ent = readdir(dir)) != NULL) {
+        int shard, shards, used = 0;
+        if (sscanf(ent->d_name, "shard_%dof%d.tsv%n", &shard, &shards, &used) != 2 ||
+            ent->d_name[used] != '\0') {
+            continue;
+        }
+        char path[600];
+        snprintf(path, sizeof(path), "%s/%s", out_dir, ent->d_name);
+        int file_shard = 0, file_shards = 0;
+        if (read_results(path, m, &file_shard, &file_shards, rows) != 0) {
+            log_error("  건너뜀: %s\n", path);
+            continue;
+        }
+        files++;
+        int64_t done = 0;
+        for (int64_t j = file_shard; j < m->jobs; j += file_shards) {
+            char *row = rows[j];
+            rows[j] = NULL;
+            if (!row || !row_ok(row)) {
+                free(row);
+                continue;
+            }
+            done++;
+            if (!merged[j]) {
+                merged[j] = row;
+                continue;
+            }
+            // 샤드 수를 바꾸어 다시 실행한 경우 같은 작업이 여러 파일에 있을 수 있음
+            size_t len = row_result_length(row);
+            if (len != row_result_length(merged[j]) || memcmp(row, merged[j], len) != 0) {
+                log_error("  작업 %lld 결과가 샤드마다 다릅니다\n", (long long)j);
+                stats->conflicts++;
+            }
+            free(row);
+        }
+        log_info("  %s: 완료 %lld개\n", ent->d_name, (long long)done);
+    }
+    closedir(dir);
+    free(rows);
+
+    FILE *file = NULL;
+    if (make_parent_directory(report) == 0) {
+        file = fopen(report, "w");
+    }
+    if (!file) {
+        log_error("스윕 보고서를 저장할 수 없습니다: %s\n", report);
+        free_rows(merged, m->jobs);
+        return -1;
+    }
+    for (int64_t j = 0; j < m->jobs; j++) {
+        stats->merged += merged[j] != NULL;
+    }
+    fprintf(file, "# sweep %016llx merged %lld/%lld\n", (unsigned long long)m->fingerprint,
+            (long long)stats->merged, (long long)m->jobs);
+    fputs(SWEEP_COLUMNS, file);
+    for (int64_t j = 0; j < m->jobs; j++) {
+        if (merged[j]) {
+            fputs(merged[j], file);
+        } else {
+            if (stats->missing < 10) {
+                log_info("  빠진 작업: %lld (%s)\n", (long long)j, m->images[j / m->points]);
+            }
+            stats->missing++;
+        }
+    }
+    int result = fclose(file) == 0 ? 0 : -1;
+    free_rows(merged, m->jobs);
+    if (result != 0) {
+        log_error("스윕 보고서 쓰기 실패: %s\n", report);
+        return -1;
+    }
+    if (files == 0) {
+        log_error("스윕 결과 파일이 없습니다: %s/shard_*of*.tsv\n", out_dir);
+    }
+    return stats->missing > 0 || stats->conflicts > 0 ? 1 : 0;
+}
+
+// ============================================================
+// 명령행
+// ============================================================
+
+int sweep_main(int argc, char *argv[]) {
+    if (argc < 4) {
+        log_info("사용법: %s --sweep <매니페스트> <출력 디렉토리> [--shard i/N] [--max-jobs K]\n", argv[0]);
+        log_info("       %s --sweep <매니페스트> <출력 디렉토리> --merge [보고서]\n", argv[0]);
+        log_info("  매니페스트: image <BMP | pattern:지정>, axis <레지스터> = <값 | 시작..끝[:간격]>,..., depth D\n");
+        log_info("  --shard i/N   번호 %% N == i인 작업만 처리 (기본 0/1), 결과: <출력 디렉토리>/shard_<i>of<N>.tsv\n");
+        log_info("                다시 실행하면 끝난 작업은 건너뜀 (중단된 샤드 이어서 실행)\n");
+        log_info("  --max-jobs K  K개 처리 후 중단\n");
+        log_info("  --merge       샤드 결과를 작업 순서로 합침 (기본 <출력 디렉토리>/report.tsv)\n");
+        return 1;
+    }
+
+    const char *out_dir = argv[3];
+    const char *report = NULL;
+    int merge = 0;
+    int shard = 0, shards = 1;
+    int max_jobs = 0;
+    for (int i = 4; i < argc; i++) {
+        if (strcmp(argv[i], "--shard") == 0 && i + 1 < argc) {
+            if (sscanf(argv[++i], "%d/%d", &shard, &shards) != 2) {
+                log_error("잘못된 샤드 지정: %s (예: 2/8)\n", argv[i]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--max-jobs") == 0 && i + 1 < argc) {
+            max_jobs = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--merge") == 0) {
+            merge = 1;
+            if (i + 1 < argc && strncmp(argv[i + 1], "--", 2) != 0) {
+                report = argv[++i];
+            }
+        } else {
+            log_error("알 수 없는 인자: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    SweepManifest m;
+    if (sweep_load(argv[2], &m) != 0) {
+        return 1;
+    }
+    SweepStats stats;
+    int result;
+    if (merge) {
+        char report_path[600];
+        snprintf(report_path, sizeof(report_path), "%s/report.tsv", out_dir);
+        if (!report) {
+            report = report_path;
+        }
+        result = sweep_merge(&m, out_dir, report, &stats);
+        if (result >= 0) {
+            log_info("스윕 합치기: 작업 %lld개 중 %lld개 완료, 빠짐 %lld, 불일치 %lld -> %s\n",
+                     (long long)stats.jobs, (long long)stats.merged, (long long)stats.missing,
+                     (long long)stats.conflicts, report);
+        }
+    } else {
+        log_info("스윕 샤드 %d/%d: 전체 작업 %lld개 (이미지 %d x 설정 점 %lld)\n", shard, shards,
+                 (long long)m.jobs, m.image_count, (long long)m.points);
+        result = sweep_run(&m, out_dir, shard, shards, max_jobs, &stats);
+        log_info("스윕 샤드 %d/%d: 샤드 작업 %lld개, 처리 %lld, 건너뜀 %lld, 실패 %lld, 남음 %lld\n",
+                 shard, shards, (long long)stats.shard_jobs, (long long)stats.run, (long long)stats.skipped,
+                 (long long)stats.failed, (long long)(stats.shard_jobs - stats.skipped - stats.run + stats.failed));
+    }
+    sweep_free(&m);
+    return result == 0 ? 0 : 1;
+}
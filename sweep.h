@@ -0,0 +1,72 @@
+#ifndef SWEEP_H
+#define SWEEP_H
+
+#include <stdint.h>
+
+// 매니페스트 기반 스윕 (입력 이미지 x 레지스터 설정 점)
+// 여러 호스트가 같은 출력 디렉토리(공유 파일시스템)를 쓰고 --shard i/N으로 작업을 나누어 실행
+//
+// 매니페스트 (한 줄에 하나, # 이후는 주석):
+//   image <BMP 경로>                    입력 이미지 (pattern:<지정>이면 합성 패턴, 예: pattern:bars,1080x2392)
+//   axis <이름> = <값>[,<값>]...        설정 축 (이름은 config.txt와 동일, 값은 N 또는 시작..끝[:간격])
+//   depth <8|10|12|16>                  내부 비트 깊이 (기본 8)
+//
+// 작업 = 이미지 x 모든 축 값 조합, 번호는 이미지가 가장 바깥, 마지막 축이 가장 안쪽
+// 샤드 i/N은 번호 % N == i인 작업을 처리 (매니페스트가 같으면 어느 호스트에서도 같은 분할)
+// 결과: <출력 디렉토리>/shard_<i>of<N>.tsv (작업마다 한 줄 추가 후 flush)
+// 다시 실행하면 결과 파일에서 끝난 작업(ok)을 건너뛰고, 잘린 마지막 줄과 실패한 작업만 다시 처리
+// 결과 파일 첫 줄의 매니페스트 지문이 다르면 이어서 실행하지 않음
+
+#define SWEEP_MAX_AXES 16
+
+typedef struct {
+    char name[64];
+    int *values;
+    int count;
+} SweepAxis;
+
+typedef struct {
+    char **images;
+    int image_count;
+    SweepAxis axes[SWEEP_MAX_AXES];
+    int axis_count;
+    int depth;
+    int64_t points;         // 이미지 하나당 설정 점 수 (축 값 개수의 곱)
+    int64_t jobs;           // 전체 작업 수
+    uint64_t fingerprint;   // 작업 목록 지문 (이미지, 축, 깊이)
+} SweepManifest;
+
+typedef struct {
+    int64_t jobs;           // 전체 작업 수
+    int64_t shard_jobs;     // 이 샤드의 작업 수
+    int64_t skipped;        // 이미 끝나 건너뛴 작업 수
+    int64_t run;            // 이번에 처리한 작업 수
+    int64_t failed;         // 실패한 작업 수
+    int64_t merged;         // 합친 작업 수 (merge)
+    int64_t missing;        // 결과가 없는 작업 수 (merge)
+    int64_t conflicts;      // 샤드마다 결과가 다른 작업 수 (merge)
+} SweepStats;
+
+// 매니페스트 읽기 (알 수 없는 레지스터 이름, 빈 값 목록은 오류)
+// 반환값: 0 성공, -1 실패
+int sweep_load(const char *path, SweepManifest *manifest);
+
+void sweep_free(SweepManifest *manifest);
+
+// 작업 번호 -> 이미지 번호와 축별 값
+void sweep_job_point(const SweepManifest *manifest, int64_t job, int *image, int *values);
+
+// 샤드 i/N 실행 (max_jobs > 0이면 그 수만큼 처리하고 중단)
+// 반환값: 0 성공 (실패한 작업이 없음), -1 실패
+int sweep_run(const SweepManifest *manifest, const char *out_dir, int shard, int shards,
+              int max_jobs, SweepStats *stats);
+
+// 출력 디렉토리의 샤드 결과를 작업 번호 순으로 합쳐 report에 저장
+// 반환값: 0 모든 작업 완료, 1 빠진 작업 있음, -1 실패
+int sweep_merge(const SweepManifest *manifest, const char *out_dir, const char *report, SweepStats *stats);
+
+// --sweep 명령행 처리
+// 반환값: 0 성공, 1 실패 / 빠진 작업 있음
+int sweep_main(int argc, char *argv[]);
+
+#endif // SWEEP_H
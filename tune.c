@@ -0,0 +1,636 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <fnmatch.h>
+#ifndef _WIN32
+#include <signal.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
+#include "config.h"
+#include "ctc_tables.h"
+#include "pattern.h"
+#include "tune.h"
+#include "log.h"
+
+#define TUNE_LINE_MAX 1024
+#define TUNE_PATTERN_PREFIX "pattern:"
+
+// ============================================================
+// 튜닝 파일
+// ============================================================
+
+static char *trim(char *s) {
+    while (*s == ' ' || *s == '\t') s++;
+    char *end = s + strlen(s);
+    while (end > s && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\n' || end[-1] == '\r')) {
+        *--end = '\0';
+    }
+    return s;
+}
+
+static int add_one_param(TuneProblem *problem, const char *name, int min, int max) {
+    for (int i = 0; i < problem->param_count; i++) {
+        if (strcmp(problem->params[i].name, name) == 0) {
+            return 0;
+        }
+    }
+    int width = reg_width_by_name(name);
+    if (width <= 0 || problem->param_count == TUNE_MAX_PARAMS) {
+        return -1;
+    }
+    int limit = width >= 31 ? 0x7FFFFFFF : (1 << width) - 1;
+    TuneParam *param = &problem->params[problem->param_count];
+    snprintf(param->name, sizeof(param->name), "%s", name);
+    param->min = max < min ? 0 : (min < 0 ? 0 : min);
+    param->max = max < min ? limit : (max > limit ? limit : max);
+    if (param->min > param->max) {
+        log_error("파라미터 범위가 비트 수(%d)를 벗어납니다: %s = %d..%d\n", width, name, min, max);
+        return -1;
+    }
+    problem->param_count++;
+    return 1;
+}
+
+int tune_add_param(TuneProblem *problem, const char *pattern, int min, int max) {
+    if (!strpbrk(pattern, "*?[")) {
+        int added = add_one_param(problem, pattern, min, max);
+        if (added < 0) {
+            log_error("튜닝 파라미터를 추가할 수 없습니다: %s\n", pattern);
+        }
+        return added;
+    }
+    int added = 0;
+    const char *name;
+    for (int i = 0; (name = reg_name_at(i)) != NULL; i++) {
+        if (fnmatch(pattern, name, 0) != 0) {
+            continue;
+        }
+        int one = add_one_param(problem, name, min, max);
+        if (one < 0) {
+            log_error("튜닝 파라미터를 추가할 수 없습니다: %s (최대 %d개)\n", name, TUNE_MAX_PARAMS);
+            return -1;
+        }
+        added += one;
+    }
+    if (added == 0) {
+        log_error("패턴과 일치하는 레지스터가 없습니다: %s\n", pattern);
+        return -1;
+    }
+    return added;
+}
+
+// 입력을 기준 출력 비트 수로 읽기 (모델 출력과 기준 출력을 같은 비트 수로 비교)
+static int load_target(TuneTarget *target, const char *input, const char *reference) {
+    memset(target, 0, sizeof(*target));
+    if (compare_load(reference, NULL, &target->reference) != 0) {
+        return -1;
+    }
+    int bits = target->reference.bits;
+    int result;
+    if (strncmp(input, TUNE_PATTERN_PREFIX, strlen(TUNE_PATTERN_PREFIX)) == 0) {
+        PatternSpec spec;
+        result = pattern_parse(input + strlen(TUNE_PATTERN_PREFIX), &spec);
+        if (result == 0 && spec.width <= 0) {
+            spec.width = target->reference.width;
+            spec.height = target->reference.height;
+        }
+        result = result == 0 ? pattern_generate_rgb(&spec, bits, &target->rgb) : -1;
+    } else {
+        result = read_bmp_depth(input, &target->rgb, bits);
+    }
+    if (result == 0 && (target->rgb.width != target->reference.width ||
+                        target->rgb.height != target->reference.height)) {
+        log_error("입력과 기준 출력 크기가 다릅니다: %s (%dx%d), %s (%dx%d)\n", input,
+                  target->rgb.width, target->rgb.height, reference,
+                  target->reference.width, target->reference.height);
+        free_rgb(&target->rgb);
+        result = -1;
+    }
+    if (result != 0) {
+        compare_free(&target->reference);
+        return -1;
+    }
+    target->input = strdup(input);
+    return 0;
+}
+
+int tune_load(const char *path, TuneProblem *problem) {
+    memset(problem, 0, sizeof(*problem));
+    problem->max_evals = TUNE_DEFAULT_MAX_EVALS;
+    FILE *file = fopen(path, "r");
+    if (!file) {
+        log_error("튜닝 파일을 열 수 없습니다: %s\n", path);
+        return -1;
+    }
+
+    char line[TUNE_LINE_MAX];
+    int line_no = 0;
+    int result = 0;
+    while (result == 0 && fgets(line, sizeof(line), file)) {
+        line_no++;
+        char *comment = strchr(line, '#');
+        if (comment) *comment = '\0';
+        char *s = trim(line);
+        char input[512], reference[512], tail;
+        if (*s == '\0') {
+            continue;
+        }
+        if (sscanf(s, "target %511s %511s %c", input, reference, &tail) == 2) {
+            TuneTarget *grown = (TuneTarget *)realloc(problem->targets,
+                                                      (size_t)(problem->target_count + 1) * sizeof(TuneTarget));
+            if (!grown) {
+                result = -1;
+                break;
+            }
+            problem->targets = grown;
+            result = load_target(&problem->targets[problem->target_count], input, reference);
+            if (result == 0) {
+                problem->target_count++;
+            }
+        } else if (strncmp(s, "param", 5) == 0 && (s[5] == ' ' || s[5] == '\t')) {
+            int min = 0, max = -1;
+            char *eq = strchr(s, '=');
+            if (eq) {
+                *eq = '\0';
+                if (sscanf(eq + 1, " %d..%d %c", &min, &max, &tail) != 2 || max < min) {
+                    result = -1;
+                    break;
+                }
+            }
+            result = tune_add_param(problem, trim(s + 5), min, max) > 0 ? 0 : -1;
+        } else if (sscanf(s, "max-evals %d %c", &problem->max_evals, &tail) == 1 && problem->max_evals > 0) {
+            continue;
+        } else {
+            result = -1;
+        }
+    }
+    fclose(file);
+    if (result == 0 && (problem->target_count == 0 || problem->param_count == 0)) {
+        log_error("튜닝 파일에 target / param 항목이 필요합니다: %s\n", path);
+        result = -1;
+    } else if (result != 0) {
+        log_error("튜닝 파일 처리 실패: %s:%d\n", path, line_no);
+    }
+    if (result != 0) {
+        tune_free(problem);
+    }
+    return result;
+}
+
+void tune_free(TuneProblem *problem) {
+    for (int i = 0; i < problem->target_count; i++) {
+        free(problem->targets[i].input);
+        free_rgb(&problem->targets[i].rgb);
+        compare_free(&problem->targets[i].reference);
+    }
+    free(problem->targets);
+    memset(problem, 0, sizeof(*problem));
+}
+
+double tune_output_cost(void *arg) {
+    TuneProblem *problem = (TuneProblem *)arg;
+    uint64_t sse = 0, samples = 0;
+    for (int i = 0; i < problem->target_count; i++) {
+        TuneTarget *target = &problem->targets[i];
+        RGBGArray rgbg;
+        CompareImage image;
+        CompareResult r;
+        if (rgb_to_rgbg(&target->rgb, &rgbg) != 0) {
+            return -1.0;
+        }
+        int ok = compare_from_rgbg_array(&rgbg, &image) == 0;
+        free_rgbg(&rgbg);
+        if (!ok) {
+            return -1.0;
+        }
+        ok = compare_images(&image, &target->reference, NULL, &r) == 0;
+        compare_free(&image);
+        if (!ok) {
+            return -1.0;
+        }
+        sse += r.channel_sse[0] + r.channel_sse[1] + r.channel_sse[2];
+        samples += r.samples;
+    }
+    return samples ? (double)sse / (double)samples : 0.0;
+}
+
+// ============================================================
+// 후보 평가 (작업 프로세스)
+// ============================================================
+
+typedef struct {
+    const TuneProblem *problem;
+    TuneCostFn cost;
+    void *arg;
+    int count;                  // 작업 프로세스 수 (0이면 현재 프로세스에서 평가)
+#ifndef _WIN32
+    pid_t pids[TUNE_MAX_WORKERS];
+    int to_fd[TUNE_MAX_WORKERS];
+    int from_fd[TUNE_MAX_WORKERS];
+    void (*saved_sigpipe)(int);
+#endif
+} TunePool;
+
+static double evaluate_here(const TunePool *pool, const int *values) {
+    for (int i = 0; i < pool->problem->param_count; i++) {
+        reg_write_by_name(pool->problem->params[i].name, values[i]);
+    }
+    ctc_tables_refresh();
+    double cost = pool->cost(pool->arg);
+    return cost < 0 ? -1.0 : cost;
+}
+
+#ifndef _WIN32
+static int read_full(int fd, void *data, size_t len) {
+    uint8_t *p = (uint8_t *)data;
+    while (len > 0) {
+        ssize_t n = read(fd, p, len);
+        if (n <= 0) {
+            return -1;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+static int write_full(int fd, const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t *)data;
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n <= 0) {
+            return -1;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+// 작업 프로세스: 후보 값을 받아 비용을 돌려줌 (입력이 닫히면 종료)
+static void worker_loop(const TunePool *pool, int in_fd, int out_fd) {
+    int values[TUNE_MAX_PARAMS];
+    size_t bytes = (size_t)pool->problem->param_count * sizeof(int);
+    while (read_full(in_fd, values, bytes) == 0) {
+        double cost = evaluate_here(pool, values);
+        if (write_full(out_fd, &cost, sizeof(cost)) != 0) {
+            break;
+        }
+    }
+    _exit(0);
+}
+#endif
+
+static void pool_stop(TunePool *pool) {
+#ifndef _WIN32
+    for (int k = 0; k < pool->count; k++) {
+        close(pool->to_fd[k]);
+    }
+    for (int k = 0; k < pool->count; k++) {
+        waitpid(pool->pids[k], NULL, 0);
+        close(pool->from_fd[k]);
+    }
+    if (pool->count > 0) {
+        signal(SIGPIPE, pool->saved_sigpipe);
+    }
+#endif
+    pool->count = 0;
+}
+
+// 작업 프로세스 시작 (fork 실패 시 만든 수만큼 사용, 하나도 없으면 현재 프로세스에서 평가)
+static void pool_start(TunePool *pool, int workers) {
+    pool->count = 0;
+#ifndef _WIN32
+    if (workers <= 1) {
+        return;
+    }
+    ctc_tables_refresh();
+    log_flush();
+    fflush(stdout);
+    fflush(stderr);
+    pool->saved_sigpipe = signal(SIGPIPE, SIG_IGN);
+    for (int k = 0; k < workers; k++) {
+        int to[2], from[2];
+        if (pipe(to) != 0) {
+            break;
+        }
+        if (pipe(from) != 0) {
+            close(to[0]);
+            close(to[1]);
+            break;
+        }
+        pid_t pid = fork();
+        if (pid < 0) {
+            close(to[0]);
+            close(to[1]);
+            close(from[0]);
+            close(from[1]);
+            break;
+        }
+        if (pid == 0) {
+            // 자식에는 로그 writer 스레드가 없으므로 바로 출력으로 전환
+            log_after_fork();
+            // 앞서 만든 작업 프로세스의 파이프는 닫아야 부모가 닫을 때 EOF가 전달됨
+            for (int j = 0; j < pool->count; j++) {
+                close(pool->to_fd[j]);
+                close(pool->from_fd[j]);
+            }
+            close(to[1]);
+            close(from[0]);
+            worker_loop(pool, to[0], from[1]);
+        }
+        close(to[0]);
+        close(from[1]);
+        pool->pids[pool->count] = pid;
+        pool->to_fd[pool->count] = to[1];
+        pool->from_fd[pool->count] = from[0];
+        pool->count++;
+    }
+    if (pool->count == 0) {
+        signal(SIGPIPE, pool->saved_sigpipe);
+    }
+#else
+    (void)workers;
+#endif
+}
+
+// 후보 n개 평가 (candidates: n x param_count)
+// 반환값: 0 성공, -1 작업 프로세스 통신 실패
+static int pool_evaluate(TunePool *pool, const int *candidates, int n, double *costs) {
+    int params = pool->problem->param_count;
+    if (pool->count == 0) {
+        for (int i = 0; i < n; i++) {
+            costs[i] = evaluate_here(pool, candidates + (size_t)i * params);
+        }
+        return 0;
+    }
+#ifndef _WIN32
+    size_t bytes = (size_t)params * sizeof(int);
+    for (int base = 0; base < n; base += pool->count) {
+        int wave = n - base < pool->count ? n - base : pool->count;
+        for (int k = 0; k < wave; k++) {
+            if (write_full(pool->to_fd[k], candidates + (size_t)(base + k) * params, bytes) != 0) {
+                log_error("튜닝 작업 프로세스에 후보를 보낼 수 없습니다\n");
+                return -1;
+            }
+        }
+        for (int k = 0; k < wave; k++) {
+            if (read_full(pool->from_fd[k], &costs[base + k], sizeof(double)) != 0) {
+                log_error("튜닝 작업 프로세스가 응답하지 않습니다\n");
+                return -1;
+            }
+        }
+    }
+#endif
+    return 0;
+}
+
+// ============================================================
+// 병렬 좌표 하강
+// ============================================================
+
+static double effective_cost(double cost) {
+    return cost < 0 ? HUGE_VAL : cost;
+}
+
+int tune_run(const TuneProblem *problem, TuneCostFn cost_fn, void *arg, int workers, TuneResult *result) {
+    int params = problem->param_count;
+    memset(result, 0, sizeof(*result));
+    if (params <= 0 || params > TUNE_MAX_PARAMS) {
+        log_error("튜닝 파라미터가 없습니다\n");
+        return -1;
+    }
+#ifdef _WIN32
+    workers = 1;
+#else
+    if (workers <= 0) workers = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    if (workers > TUNE_MAX_WORKERS) workers = TUNE_MAX_WORKERS;
+    // 한 단계 후보 수 (파라미터마다 ±, 합친 후보 1개)보다 많은 작업 프로세스는 쓰이지 않음
+    if (workers > params * 2) workers = params * 2;
+
+    int start[TUNE_MAX_PARAMS];
+    int step[TUNE_MAX_PARAMS];
+    int *x = result->values;
+    for (int i = 0; i < params; i++) {
+        reg_read_by_name(problem->params[i].name, &start[i]);
+        const TuneParam *p = &problem->params[i];
+        x[i] = start[i] < p->min ? p->min : (start[i] > p->max ? p->max : start[i]);
+        step[i] = (p->max - p->min + 1) / 4;
+        if (step[i] < 1 && p->max > p->min) step[i] = 1;
+    }
+
+    int *candidates = (int *)malloc((size_t)(params * 2 + 1) * params * sizeof(int));
+    double *costs = (double *)malloc((size_t)(params * 2 + 1) * sizeof(double));
+    if (!candidates || !costs) {
+        log_error("튜닝 후보 메모리 할당 실패\n");
+        free(candidates);
+        free(costs);
+        return -1;
+    }
+
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    TunePool pool;
+    memset(&pool, 0, sizeof(pool));
+    pool.problem = problem;
+    pool.cost = cost_fn;
+    pool.arg = arg;
+    pool_start(&pool, workers);
+    result->workers = pool.count > 0 ? pool.count : 1;
+
+    int status = 0;
+    double best = 0;
+    memcpy(candidates, x, (size_t)params * sizeof(int));
+    if (pool_evaluate(&pool, candidates, 1, costs) != 0 || costs[0] < 0) {
+        log_error("시작 값 비용을 계산할 수 없습니다\n");
+        status = -1;
+    } else {
+        best = costs[0];
+        result->start_cost = best;
+        result->evals = 1;
+    }
+
+    while (status == 0 && result->evals < problem->max_evals) {
+        // 파라미터마다 ±간격 후보 (범위 안으로 자름, 같은 값은 제외)
+        int n = 0;
+        int owner[TUNE_MAX_PARAMS * 2];
+        for (int i = 0; i < params; i++) {
+            for (int dir = -1; dir <= 1 && step[i] > 0; dir += 2) {
+                const TuneParam *p = &problem->params[i];
+                int v = x[i] + dir * step[i];
+                v = v < p->min ? p->min : (v > p->max ? p->max : v);
+                if (v == x[i] || n + result->evals >= problem->max_evals) {
+                    continue;
+                }
+                int *c = candidates + (size_t)n * params;
+                memcpy(c, x, (size_t)params * sizeof(int));
+                c[i] = v;
+                owner[n++] = i;
+            }
+        }
+        if (n == 0) {
+            break;
+        }
+        if (pool_evaluate(&pool, candidates, n, costs) != 0) {
+            status = -1;
+            break;
+        }
+        result->evals += n;
+        result->rounds++;
+
+        // 가장 좋은 후보와 파라미터별로 좋아진 방향
+        int best_index = -1;
+        double round_best = best;
+        int better[TUNE_MAX_PARAMS];
+        double better_cost[TUNE_MAX_PARAMS];
+        for (int i = 0; i < params; i++) {
+            better[i] = -1;
+        }
+        for (int k = 0; k < n; k++) {
+            double c = effective_cost(costs[k]);
+            int i = owner[k];
+            if (c < best && (better[i] < 0 || c < better_cost[i])) {
+                better[i] = k;
+                better_cost[i] = c;
+            }
+            if (c < round_best) {
+                round_best = c;
+                best_index = k;
+            }
+        }
+        int improved_params = 0;
+        for (int i = 0; i < params; i++) {
+            improved_params += better[i] >= 0;
+        }
+        // 좋아진 방향이 둘 이상이면 모두 합친 후보도 평가
+        if (improved_params >= 2 && result->evals < problem->max_evals) {
+            int *c = candidates + (size_t)n * params;
+            memcpy(c, x, (size_t)params * sizeof(int));
+            for (int i = 0; i < params; i++) {
+                if (better[i] >= 0) {
+                    c[i] = candidates[(size_t)better[i] * params + i];
+                }
+            }
+            if (pool_evaluate(&pool, c, 1, &costs[n]) != 0) {
+                status = -1;
+                break;
+            }
+            result->evals++;
+            if (effective_cost(costs[n]) < round_best) {
+                round_best = costs[n];
+                best_index = n;
+            }
+        }
+
+        if (best_index >= 0) {
+            memcpy(x, candidates + (size_t)best_index * params, (size_t)params * sizeof(int));
+            best = round_best;
+            result->moves++;
+            log_debug("  단계 %d: 비용 %.6f (평가 %d)\n", result->rounds, best, result->evals);
+        }
+        // 좋아지지 않은 파라미터는 간격 절반
+        for (int i = 0; i < params; i++) {
+            if (better[i] < 0) {
+                step[i] /= 2;
+            }
+        }
+    }
+    pool_stop(&pool);
+
+    // 레지스터는 시작 값으로 되돌림 (작업 프로세스가 없으면 현재 프로세스에서 후보를 썼음)
+    for (int i = 0; i < params; i++) {
+        reg_write_by_name(problem->params[i].name, start[i]);
+    }
+    ctc_tables_refresh();
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    result->cost = best;
+    result->seconds = (double)(t1.tv_sec - t0.tv_sec) + (double)(t1.tv_nsec - t0.tv_nsec) * 1e-9;
+    free(candidates);
+    free(costs);
+    return status;
+}
+
+int tune_save_config(const TuneProblem *problem, const TuneResult *result, const char *filename) {
+    FILE *file = NULL;
+    if (make_parent_directory(filename) == 0) {
+        file = fopen(filename, "w");
+    }
+    if (!file) {
+        log_error("튜닝 결과를 저장할 수 없습니다: %s\n", filename);
+        return -1;
+    }
+    fprintf(file, "# 튜닝 결과: 비용 %.6f -> %.6f (평가 %d회)\n", result->start_cost, result->cost, result->evals);
+    for (int i = 0; i < problem->param_count; i++) {
+        fprintf(file, "%-30s = %d\n", problem->params[i].name, result->values[i]);
+    }
+    if (fclose(file) != 0) {
+        log_error("튜닝 결과 쓰기 실패: %s\n", filename);
+        return -1;
+    }
+    return 0;
+}
+
+// ============================================================
+// 명령행
+// ============================================================
+
+int tune_main(int argc, char *argv[]) {
+    if (argc < 3) {
+        log_info("사용법: %s --tune <튜닝 파일> [--workers N] [--max-evals N] [--out 파일]\n", argv[0]);
+        log_info("  튜닝 파일: target <BMP | pattern:지정> <기준 출력>, param <이름 | 패턴>[ = 최소..최대], max-evals N\n");
+        log_info("  --workers N   후보 평가 프로세스 수 (기본 CPU 수)\n");
+        log_info("  --out 파일    최적 값 config 형식 저장 (기본 test_out/tune/best_config.txt)\n");
+        log_info("  현재 config 값에서 시작, 범위 기본값은 registers_list.csv 비트 수\n");
+        return 1;
+    }
+    int workers = 0;
+    int max_evals = 0;
+    const char *out = "test_out/tune/best_config.txt";
+    for (int i = 3; i < argc; i++) {
+        if (strcmp(argv[i], "--workers") == 0 && i + 1 < argc) {
+            workers = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--max-evals") == 0 && i + 1 < argc) {
+            max_evals = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            out = argv[++i];
+        } else {
+            log_error("알 수 없는 인자: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    TuneProblem problem;
+    if (tune_load(argv[2], &problem) != 0) {
+        return 1;
+    }
+    if (max_evals > 0) {
+        problem.max_evals = max_evals;
+    }
+    log_info("튜닝: target %d개, 파라미터 %d개, 평가 상한 %d\n",
+             problem.target_count, problem.param_count, problem.max_evals);
+    ctc_tables_init();
+
+    TuneResult result;
+    int status = tune_run(&problem, tune_output_cost, &problem, workers, &result);
+    if (status == 0) {
+        log_info("MSE %.6f -> %.6f (평가 %d회, 단계 %d, 프로세스 %d개, %.2f초)\n", result.start_cost, result.cost,
+                 result.evals, result.rounds, result.workers, result.seconds);
+        for (int i = 0; i < problem.param_count; i++) {
+            int start;
+            reg_read_by_name(problem.params[i].name, &start);
+            if (start != result.values[i]) {
+                log_info("  %-30s %d -> %d\n", problem.params[i].name, start, result.values[i]);
+            }
+        }
+        status = tune_save_config(&problem, &result, out);
+        if (status == 0) {
+            log_info("최적 값 저장: %s\n", out);
+        }
+    }
+    tune_free(&problem);
+    return status == 0 ? 0 : 1;
+}
@@ -0,0 +1,87 @@
+#ifndef TUNE_H
+#define TUNE_H
+
+#include "image_io.h"
+#include "compare.h"
+
+// 레지스터 자동 튜닝 (병렬 좌표 하강)
+// 매 단계 모든 파라미터를 ±간격으로 움직인 후보를 동시에 평가하여 가장 좋은 후보로 이동
+// (좋아진 방향이 여러 개이면 합친 후보도 평가), 좋아지지 않은 파라미터는 간격을 절반으로 줄임
+// 모든 간격이 0이 되면 (정수 격자 국소 최소) 또는 평가 횟수 상한에서 종료
+//
+// 후보는 작업 프로세스(fork)에서 평가: 레지스터 / 파생 테이블이 전역 상태이므로 프로세스마다 독립 복사본 사용
+// 평가 결과는 작업 프로세스 수와 무관 (같은 후보 목록을 같은 순서로 비교)
+//
+// 튜닝 파일 (한 줄에 하나, # 이후는 주석):
+//   target <BMP | pattern:지정> <기준 출력>   입력과 기준 출력 (PPM / 패킹 RAW / RGBG .ctcz, 모델은 기준 비트 수로 실행)
+//   param <이름 | 패턴>[ = 최소..최대]         튜닝할 레지스터 (패턴은 * ? 사용, 예: reg_ctc_line_r_*_gain*)
+//                                              범위 기본값은 registers_list.csv 비트 수 (0 ~ 2^Width - 1)
+//   max-evals N                               평가 횟수 상한 (기본 TUNE_DEFAULT_MAX_EVALS)
+// 비용: 모든 target의 기준 출력 대비 샘플 평균 제곱 오차 (MSE)
+
+#define TUNE_MAX_PARAMS 256
+#define TUNE_MAX_WORKERS 64
+#define TUNE_DEFAULT_MAX_EVALS 2000
+
+typedef struct {
+    char name[64];
+    int min;
+    int max;
+} TuneParam;
+
+typedef struct {
+    char *input;
+    RGBArray rgb;               // 입력 (기준 비트 수)
+    CompareImage reference;
+} TuneTarget;
+
+typedef struct {
+    TuneTarget *targets;
+    int target_count;
+    TuneParam params[TUNE_MAX_PARAMS];
+    int param_count;
+    int max_evals;
+} TuneProblem;
+
+// 후보 비용 (후보 값을 레지스터에 쓰고 파생 테이블을 갱신한 상태에서 작업 프로세스 안에서 호출)
+// 반환값: 비용 (작을수록 좋음), 음수는 평가 실패
+typedef double (*TuneCostFn)(void *arg);
+
+typedef struct {
+    int values[TUNE_MAX_PARAMS];    // 최적 값
+    double cost;                    // 최적 비용
+    double start_cost;              // 시작 값(현재 레지스터) 비용
+    int evals;                      // 평가 횟수
+    int rounds;                     // 단계 수
+    int moves;                      // 이동한 단계 수
+    int workers;                    // 사용한 작업 프로세스 수 (1이면 현재 프로세스에서 평가)
+    double seconds;
+} TuneResult;
+
+// 튜닝 파일 읽기 (입력 / 기준 출력도 읽음)
+// 반환값: 0 성공, -1 실패
+int tune_load(const char *path, TuneProblem *problem);
+
+void tune_free(TuneProblem *problem);
+
+// 파라미터 추가 (패턴이면 일치하는 모든 레지스터, max < min이면 비트 수 전체 범위)
+// 반환값: 추가한 파라미터 수, -1 실패 (일치하는 이름 없음, 개수 초과)
+int tune_add_param(TuneProblem *problem, const char *pattern, int min, int max);
+
+// 기준 출력 대비 MSE 비용 (arg: TuneProblem)
+double tune_output_cost(void *arg);
+
+// 현재 레지스터 값에서 시작하여 튜닝 (레지스터는 끝난 뒤 시작 값으로 되돌림)
+// workers: 작업 프로세스 수 (0이면 CPU 수)
+// 반환값: 0 성공, -1 실패
+int tune_run(const TuneProblem *problem, TuneCostFn cost, void *arg, int workers, TuneResult *result);
+
+// 최적 값을 config.txt 형식으로 저장
+// 반환값: 0 성공, -1 실패
+int tune_save_config(const TuneProblem *problem, const TuneResult *result, const char *filename);
+
+// --tune 명령행 처리
+// 반환값: 0 성공, 1 실패
+int tune_main(int argc, char *argv[]);
+
+#endif // TUNE_H